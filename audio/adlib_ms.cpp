@@ -1367,17 +1367,8 @@ uint8 MidiDriver_ADLIB_Multisource::calculateVolume(uint8 channel, uint8 source,
 	uint8 unscaledVolume = calculateUnscaledVolume(channel, source, velocity, instrumentDef, operatorNum);
 
 	uint8 invertedVolume = 0x3F - unscaledVolume;
-	// Scale by source volume.
-	invertedVolume = (invertedVolume * _sources[source].volume) / _sources[source].neutralVolume;
-	if (_userVolumeScaling) {
-		if (_userMute) {
-			invertedVolume = 0;
-		} else {
-			// Scale by user volume.
-			uint16 userVolume = (_sources[source].type == SOURCE_TYPE_SFX ? _userSfxVolume : _userMusicVolume); // Treat SOURCE_TYPE_UNDEFINED as music
-			invertedVolume = (invertedVolume * userVolume) >> 8;
-		}
-	}
+	// Scale by source volume and user volume using the precomputed table.
+	invertedVolume = getEffectiveVolume(source, invertedVolume);
 	// Source volume scaling might clip volume, so reduce to maximum.
 	invertedVolume = MIN((uint8)0x3F, invertedVolume);
 	uint8 scaledVolume = 0x3F - invertedVolume;
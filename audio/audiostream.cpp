@@ -23,7 +23,9 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/mutex.h"
+#include "common/system.h"
 #include "common/textconsole.h"
+#include "common/timer.h"
 #include "common/queue.h"
 #include "common/util.h"
 
@@ -282,6 +284,23 @@ void QueuingAudioStream::queueBuffer(byte *data, uint32 size, DisposeAfterUse::F
 }
 
 
+/**
+ * Issues a full memory barrier, so ring entries written before advancing a
+ * queue index are visible to the other thread once it observes the index.
+ */
+static inline void queueMemoryBarrier() {
+#if defined(__GNUC__) || defined(__clang__)
+	__sync_synchronize();
+#elif defined(_MSC_VER)
+	_ReadWriteBarrier();
+	MemoryBarrier();
+#else
+	// No known barrier primitive; x86-ish TSO targets still work because
+	// the indices are volatile, which at least prevents reordering by the
+	// compiler.
+#endif
+}
+
 class QueuingAudioStreamImpl : public QueuingAudioStream {
 private:
 	/**
@@ -289,16 +308,19 @@ private:
 	 * In addition, we need to remember for each stream whether
 	 * to dispose it after all data has been read from it.
 	 * Hence, we don't store pointers to stream objects directly,
-	 * but rather StreamHolder structs.
+	 * but rather StreamEntry structs.
 	 */
-	struct StreamHolder {
+	struct StreamEntry {
 		AudioStream *_stream;
 		DisposeAfterUse::Flag _disposeAfterUse;
-		StreamHolder(AudioStream *stream, DisposeAfterUse::Flag disposeAfterUse)
-		    : _stream(stream),
-		      _disposeAfterUse(disposeAfterUse) {}
 	};
 
+	/**
+	 * Upper bound on the number of queued streams. Popped slots are reused,
+	 * so this only needs to cover streams alive at the same time.
+	 */
+	enum { kQueueCapacity = 256 };
+
 	/**
 	 * The sampling rate of this audio stream.
 	 */
@@ -312,22 +334,22 @@ private:
 	/**
 	 * This flag is set by the finish() method only. See there for more details.
 	 */
-	bool _finished;
-
-	/**
-	 * A mutex to avoid access problems (causing e.g. corruption of
-	 * the linked list) in thread aware environments.
-	 */
-	Common::Mutex _mutex;
+	volatile bool _finished;
 
 	/**
-	 * The queue of audio streams.
+	 * The queue of audio streams, kept in a lock-free single-producer/
+	 * single-consumer ring: only the producer (the thread queueing
+	 * streams) advances _tail and only the consumer (the mixer thread
+	 * calling readBuffer()) advances _head, so neither side ever blocks
+	 * on the other. Entries are published with a memory barrier before
+	 * the index advance that makes them visible.
 	 */
-	Common::Queue<StreamHolder> _queue;
+	StreamEntry _ring[kQueueCapacity];
+	volatile uint32 _head, _tail;
 
 public:
 	QueuingAudioStreamImpl(int rate, bool stereo)
-	    : _rate(rate), _stereo(stereo), _finished(false) {}
+	    : _rate(rate), _stereo(stereo), _finished(false), _head(0), _tail(0) {}
 	~QueuingAudioStreamImpl();
 
 	// Implement the AudioStream API
@@ -335,6 +357,125 @@ public:
 	bool isStereo() const override { return _stereo; }
 	int getRate() const override { return _rate; }
 
+	bool endOfData() const override {
+		// Consumer side: only the consumer pops entries, so the front
+		// entry cannot go away under us here.
+		const uint32 head = _head;
+		if (head == _tail)
+			return true;
+		queueMemoryBarrier();
+		return _ring[head % kQueueCapacity]._stream->endOfData();
+	}
+
+	bool endOfStream() const override {
+		return _finished && _head == _tail;
+	}
+
+	// Implement the QueuingAudioStream API
+	void queueAudioStream(AudioStream *stream, DisposeAfterUse::Flag disposeAfterUse) override;
+
+	void finish() override {
+		_finished = true;
+	}
+
+	uint32 numQueuedStreams() const override {
+		return _tail - _head;
+	}
+};
+
+QueuingAudioStreamImpl::~QueuingAudioStreamImpl() {
+	while (_head != _tail) {
+		StreamEntry &entry = _ring[_head % kQueueCapacity];
+		if (entry._disposeAfterUse == DisposeAfterUse::YES)
+			delete entry._stream;
+		_head = _head + 1;
+	}
+}
+
+void QueuingAudioStreamImpl::queueAudioStream(AudioStream *stream, DisposeAfterUse::Flag disposeAfterUse) {
+	assert(!_finished);
+	if ((stream->getRate() != getRate()) || (stream->isStereo() != isStereo()))
+		error("QueuingAudioStreamImpl::queueAudioStream: stream has mismatched parameters");
+
+	// The ring holds more streams than well-behaved users keep in flight.
+	// If it ever fills up regardless, drop the new stream rather than
+	// overwrite live entries or abort: a skipped chunk of audio is the
+	// most graceful failure mode we have here.
+	if (_tail - _head >= kQueueCapacity) {
+		warning("QueuingAudioStreamImpl::queueAudioStream: queue overflow, more than %d streams in flight; dropping stream", kQueueCapacity);
+		if (disposeAfterUse == DisposeAfterUse::YES)
+			delete stream;
+		return;
+	}
+
+	StreamEntry &entry = _ring[_tail % kQueueCapacity];
+	entry._stream = stream;
+	entry._disposeAfterUse = disposeAfterUse;
+
+	// Publish the entry before making it visible to the consumer.
+	queueMemoryBarrier();
+	_tail = _tail + 1;
+}
+
+int QueuingAudioStreamImpl::readBuffer(int16 *buffer, const int numSamples) {
+	int samplesDecoded = 0;
+
+	while (samplesDecoded < numSamples && _head != _tail) {
+		// Make sure we see the entry contents published with _tail.
+		queueMemoryBarrier();
+		StreamEntry &entry = _ring[_head % kQueueCapacity];
+		AudioStream *stream = entry._stream;
+		samplesDecoded += stream->readBuffer(buffer + samplesDecoded, numSamples - samplesDecoded);
+
+		// Done with the stream completely
+		if (stream->endOfStream()) {
+			if (entry._disposeAfterUse == DisposeAfterUse::YES)
+				delete stream;
+			// Release the slot only after we are done with it.
+			queueMemoryBarrier();
+			_head = _head + 1;
+			continue;
+		}
+
+		// Done with data but not the stream, bail out
+		if (stream->endOfData())
+			break;
+	}
+
+	return samplesDecoded;
+}
+
+/**
+ * A QueuingAudioStream variant that guards its queue with a mutex, for
+ * users where several threads act as producers. Unlike the lock-free
+ * implementation above, the queue is unbounded, so it can never drop
+ * streams on overflow; the price is that the mixer thread takes the
+ * mutex on every readBuffer() call.
+ */
+class MutexQueuingAudioStreamImpl : public QueuingAudioStream {
+private:
+	struct StreamEntry {
+		AudioStream *_stream;
+		DisposeAfterUse::Flag _disposeAfterUse;
+	};
+
+	const int _rate;
+	const int _stereo;
+	bool _finished;
+
+	mutable Common::Mutex _mutex;
+	Common::Queue<StreamEntry> _queue;
+
+public:
+	MutexQueuingAudioStreamImpl(int rate, bool stereo)
+	    : _rate(rate), _stereo(stereo), _finished(false) {}
+	~MutexQueuingAudioStreamImpl();
+
+	// Implement the AudioStream API
+	int readBuffer(int16 *buffer, const int numSamples) override;
+	bool isStereo() const override { return _stereo; }
+	int getRate() const override { return _rate; }
+
 	bool endOfData() const override {
 		Common::StackLock lock(_mutex);
 		return _queue.empty() || _queue.front()._stream->endOfData();
@@ -359,24 +500,27 @@ public:
 	}
 };
 
-QueuingAudioStreamImpl::~QueuingAudioStreamImpl() {
+MutexQueuingAudioStreamImpl::~MutexQueuingAudioStreamImpl() {
 	while (!_queue.empty()) {
-		StreamHolder tmp = _queue.pop();
-		if (tmp._disposeAfterUse == DisposeAfterUse::YES)
-			delete tmp._stream;
+		StreamEntry entry = _queue.pop();
+		if (entry._disposeAfterUse == DisposeAfterUse::YES)
+			delete entry._stream;
 	}
 }
 
-void QueuingAudioStreamImpl::queueAudioStream(AudioStream *stream, DisposeAfterUse::Flag disposeAfterUse) {
+void MutexQueuingAudioStreamImpl::queueAudioStream(AudioStream *stream, DisposeAfterUse::Flag disposeAfterUse) {
 	assert(!_finished);
 	if ((stream->getRate() != getRate()) || (stream->isStereo() != isStereo()))
-		error("QueuingAudioStreamImpl::queueAudioStream: stream has mismatched parameters");
+		error("MutexQueuingAudioStreamImpl::queueAudioStream: stream has mismatched parameters");
 
 	Common::StackLock lock(_mutex);
-	_queue.push(StreamHolder(stream, disposeAfterUse));
+	StreamEntry entry;
+	entry._stream = stream;
+	entry._disposeAfterUse = disposeAfterUse;
+	_queue.push(entry);
 }
 
-int QueuingAudioStreamImpl::readBuffer(int16 *buffer, const int numSamples) {
+int MutexQueuingAudioStreamImpl::readBuffer(int16 *buffer, const int numSamples) {
 	Common::StackLock lock(_mutex);
 	int samplesDecoded = 0;
 
@@ -386,8 +530,8 @@ int QueuingAudioStreamImpl::readBuffer(int16 *buffer, const int numSamples) {
 
 		// Done with the stream completely
 		if (stream->endOfStream()) {
-			StreamHolder tmp = _queue.pop();
-			if (tmp._disposeAfterUse == DisposeAfterUse::YES)
+			StreamEntry entry = _queue.pop();
+			if (entry._disposeAfterUse == DisposeAfterUse::YES)
 				delete stream;
 			continue;
 		}
@@ -400,7 +544,9 @@ int QueuingAudioStreamImpl::readBuffer(int16 *buffer, const int numSamples) {
 	return samplesDecoded;
 }
 
-QueuingAudioStream *makeQueuingAudioStream(int rate, bool stereo) {
+QueuingAudioStream *makeQueuingAudioStream(int rate, bool stereo, bool sharedProducers) {
+	if (sharedProducers)
+		return new MutexQueuingAudioStreamImpl(rate, stereo);
 	return new QueuingAudioStreamImpl(rate, stereo);
 }
 
@@ -468,6 +614,121 @@ AudioStream *makeLimitingAudioStream(AudioStream *parentStream, const Timestamp
 	return new LimitingAudioStream(parentStream, length, disposeAfterUse);
 }
 
+/**
+ * An AudioStream wrapper that uses a timer proc to keep a window of PCM
+ * decoded ahead of the mixer, so the parent stream's decoder normally
+ * never runs on the audio thread.
+ */
+class PreBufferingAudioStream : public AudioStream {
+public:
+	PreBufferingAudioStream(AudioStream *parentStream, uint32 bufferMs, DisposeAfterUse::Flag disposeAfterUse) :
+			_parentStream(parentStream), _disposeAfterUse(disposeAfterUse),
+			_readPos(0), _writePos(0), _parentDone(false) {
+		// Round the requested window up to a power of two of samples.
+		const uint32 samples = (getRate() * bufferMs / 1000) * getChannels();
+		_ringSize = 1;
+		while (_ringSize < samples)
+			_ringSize <<= 1;
+		_ringBuffer = new int16[_ringSize];
+
+		g_system->getTimerManager()->installTimerProc(&fillTimerProc, 5 * 1000, this, "PreBufferingAudioStream");
+	}
+
+	~PreBufferingAudioStream() {
+		g_system->getTimerManager()->removeTimerProc(&fillTimerProc);
+
+		delete[] _ringBuffer;
+		if (_disposeAfterUse == DisposeAfterUse::YES)
+			delete _parentStream;
+	}
+
+	int readBuffer(int16 *buffer, const int numSamples) override {
+		Common::StackLock lock(_mutex);
+
+		// Drain the pre-decoded window...
+		uint32 samples = MIN<uint32>(numSamples, _writePos - _readPos);
+		int16 *dst = buffer;
+		while (samples > 0) {
+			const uint32 readIdx = _readPos & (_ringSize - 1);
+			const uint32 run = MIN<uint32>(samples, _ringSize - readIdx);
+			memcpy(dst, _ringBuffer + readIdx, run * sizeof(int16));
+			dst += run;
+			_readPos += run;
+			samples -= run;
+		}
+
+		// ...and decode any shortfall in the caller's context.
+		int remaining = numSamples - (dst - buffer);
+		if (remaining > 0 && !_parentDone) {
+			const int got = _parentStream->readBuffer(dst, remaining);
+			if (got > 0)
+				dst += got;
+			if (_parentStream->endOfData())
+				_parentDone = true;
+		}
+
+		return dst - buffer;
+	}
+
+	bool endOfData() const override {
+		Common::StackLock lock(_mutex);
+		return _readPos == _writePos && _parentStream->endOfData();
+	}
+
+	bool endOfStream() const override {
+		Common::StackLock lock(_mutex);
+		return _readPos == _writePos && _parentStream->endOfStream();
+	}
+
+	bool isStereo() const override { return _parentStream->isStereo(); }
+	int getRate() const override { return _parentStream->getRate(); }
+
+private:
+	enum {
+		// Samples decoded per mutex acquisition in the timer proc, so the
+		// mixer never waits for more than one small decode burst.
+		kFillChunkSamples = 512
+	};
+
+	static void fillTimerProc(void *refCon) {
+		((PreBufferingAudioStream *)refCon)->fill();
+	}
+
+	void fill() {
+		Common::StackLock lock(_mutex);
+
+		while (!_parentDone && _ringSize - (_writePos - _readPos) >= kFillChunkSamples) {
+			const uint32 writeIdx = _writePos & (_ringSize - 1);
+			// Decode at most up to the physical end of the buffer.
+			const uint32 samples = MIN<uint32>(kFillChunkSamples, _ringSize - writeIdx);
+			const int got = _parentStream->readBuffer(_ringBuffer + writeIdx, samples);
+			if (got > 0)
+				_writePos += got;
+			if (_parentStream->endOfData()) {
+				_parentDone = true;
+				break;
+			}
+			if (got <= 0)
+				break;
+		}
+	}
+
+	int getChannels() const { return isStereo() ? 2 : 1; }
+
+	AudioStream *_parentStream;
+	DisposeAfterUse::Flag _disposeAfterUse;
+
+	mutable Common::Mutex _mutex;
+	int16 *_ringBuffer;
+	uint32 _ringSize;
+	uint32 _readPos, _writePos;
+	bool _parentDone;
+};
+
+AudioStream *makePreBufferingAudioStream(AudioStream *parentStream, uint32 bufferMs, DisposeAfterUse::Flag disposeAfterUse) {
+	return new PreBufferingAudioStream(parentStream, bufferMs, disposeAfterUse);
+}
+
 /**
  * An AudioStream that plays nothing and immediately returns that
  * the endOfStream() has been reached
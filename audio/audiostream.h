@@ -333,6 +333,15 @@ private:
 
 /**
  * A QueuingAudioStream class that allows for queuing multiple audio streams for playback.
+ *
+ * The default implementation is lock-free for the common
+ * single-producer/single-consumer case: one thread queueing streams (the
+ * producer side: queueAudioStream(), queueBuffer(), finish()) while the
+ * mixer drains them (the consumer side: readBuffer(), endOfData()).
+ * Neither side ever blocks on the other, so a game thread queueing chunks
+ * cannot stall the audio callback. If several threads act as producers,
+ * pass sharedProducers = true to makeQueuingAudioStream() to get a
+ * mutex-guarded implementation instead.
  */
 
 class QueuingAudioStream : public Audio::AudioStream {
@@ -381,8 +390,13 @@ public:
 
 /**
  * Factory function for a QueuingAudioStream.
+ *
+ * @param sharedProducers  Set to true if several threads queue streams
+ *                         concurrently; this selects a mutex-guarded,
+ *                         unbounded implementation over the default
+ *                         lock-free single-producer one.
  */
-QueuingAudioStream *makeQueuingAudioStream(int rate, bool stereo);
+QueuingAudioStream *makeQueuingAudioStream(int rate, bool stereo, bool sharedProducers = false);
 
 /**
  * Convert a point in time to a precise sample offset
@@ -404,6 +418,22 @@ Timestamp convertTimeToStreamPos(const Timestamp &where, int rate, bool isStereo
  */
 AudioStream *makeLimitingAudioStream(AudioStream *parentStream, const Timestamp &length, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
 
+/**
+ * Factory function for an AudioStream wrapper that keeps a window of PCM
+ * decoded ahead of the mixer.
+ *
+ * A timer proc (which backends run outside the audio thread) pulls samples
+ * from the parent stream into a ring buffer in small chunks, and readBuffer()
+ * calls from the mixer drain that buffer. This keeps expensive decoders
+ * (Vorbis, MP3, FLAC, ...) off the real-time audio thread; on underrun the
+ * wrapper transparently falls back to decoding in the caller's context.
+ *
+ * @param parentStream     The stream to decode ahead.
+ * @param bufferMs         How many milliseconds of PCM to keep pre-decoded.
+ * @param disposeAfterUse  Whether the parent stream object should be destroyed on destruction of the returned stream.
+ */
+AudioStream *makePreBufferingAudioStream(AudioStream *parentStream, uint32 bufferMs = 100, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
+
 /**
  * An AudioStream designed to work in terms of packets.
  *
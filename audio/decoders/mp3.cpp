@@ -24,6 +24,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/mutex.h"
 #include "common/ptr.h"
@@ -108,6 +109,21 @@ protected:
 	Timestamp _length;
 
 private:
+	/**
+	 * One entry of the seek index: the file offset of a frame together
+	 * with the playback time at its start. Recorded while the constructor
+	 * scans the file for its length anyway, so the index is built for free.
+	 */
+	struct SeekIndexEntry {
+		mad_timer_t time;
+		uint32 offset;
+	};
+
+	/** Frame offsets roughly every kIndexIntervalMs of playback time. */
+	Common::Array<SeekIndexEntry> _seekIndex;
+
+	enum { kIndexIntervalMs = 1000 };
+
 	static Common::SeekableReadStream *skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose);
 };
 
@@ -337,9 +353,27 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_channels = MAD_NCHANNELS(&_frame.header);
 	_rate = _frame.header.samplerate;
 
-	// Calculate the length of the stream
-	while (_state != MP3_STATE_EOS)
+	// Calculate the length of the stream, recording a seek index entry
+	// roughly every second of playback time as we pass the frame headers.
+	mad_timer_t nextIndexTime = mad_timer_zero;
+	while (_state != MP3_STATE_EOS) {
+		// The time and file offset at the start of the upcoming frame. The
+		// offset is where MAD will resync next, i.e. the end of the buffer
+		// data it has already consumed.
+		if (mad_timer_compare(_curTime, nextIndexTime) >= 0 && _stream.next_frame) {
+			SeekIndexEntry entry;
+			entry.time = _curTime;
+			entry.offset = _inStream->pos() - (_stream.bufend - _stream.next_frame);
+			_seekIndex.push_back(entry);
+
+			nextIndexTime = _curTime;
+			mad_timer_t interval;
+			mad_timer_set(&interval, kIndexIntervalMs / 1000, kIndexIntervalMs % 1000, 1000);
+			mad_timer_add(&nextIndexTime, interval);
+		}
+
 		readHeader(*_inStream);
+	}
 
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
@@ -377,9 +411,31 @@ bool MP3Stream::seek(const Timestamp &where) {
 	mad_timer_t destination;
 	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0) {
-		_inStream->seek(0);
-		initStream(*_inStream);
+	// Binary search the seek index for the last frame at or before the
+	// destination, so only the residual interval has to be scanned.
+	int best = -1;
+	int lo = 0, hi = (int)_seekIndex.size() - 1;
+	while (lo <= hi) {
+		const int mid = (lo + hi) / 2;
+		if (mad_timer_compare(_seekIndex[mid].time, destination) <= 0) {
+			best = mid;
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0 ||
+			(best >= 0 && mad_timer_compare(_curTime, _seekIndex[best].time) < 0)) {
+		if (best >= 0) {
+			// Resume decoding at the indexed frame boundary.
+			_inStream->seek(_seekIndex[best].offset);
+			initStream(*_inStream);
+			_curTime = _seekIndex[best].time;
+		} else {
+			_inStream->seek(0);
+			initStream(*_inStream);
+		}
 	}
 
 	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
@@ -50,6 +50,7 @@ MidiDriver_Multisource::MidiDriver_Multisource() :
 		// Default source type: 0 = music, 1+ = SFX
 		_sources[i].type = (i == 0 ? SOURCE_TYPE_MUSIC : SOURCE_TYPE_SFX);
 	}
+	recomputeEffectiveVolume(0xFF);
 }
 
 void MidiDriver_Multisource::send(uint32 b) {
@@ -62,6 +63,7 @@ uint32 MidiDriver_Multisource::property(int prop, uint32 param) {
 		if (param == 0xFFFF)
 			return _userVolumeScaling ? 1 : 0;
 		_userVolumeScaling = param > 0;
+		recomputeEffectiveVolume(0xFF);
 		break;
 	default:
 		return MidiDriver::property(prop, param);
@@ -206,6 +208,7 @@ void MidiDriver_Multisource::setSourceType(uint8 source, SourceType type) {
 	// A changed source type can mean a different user volume level should be
 	// used for this source. Calling applySourceVolume will apply the user
 	// volume.
+	recomputeEffectiveVolume(source);
 	applySourceVolume(source);
 }
 
@@ -221,6 +224,7 @@ void MidiDriver_Multisource::setSourceVolume(uint8 source, uint16 volume) {
 	_sources[source].volume = volume;
 
 	// Set the volume for active notes and/or MIDI channels for this source.
+	recomputeEffectiveVolume(source);
 	applySourceVolume(source);
 }
 
@@ -246,6 +250,7 @@ void MidiDriver_Multisource::setSourceNeutralVolume(uint8 source, uint16 volume)
 	assert(source < MAXIMUM_SOURCES);
 
 	_sources[source].neutralVolume = volume;
+	recomputeEffectiveVolume(source);
 }
 
 void MidiDriver_Multisource::syncSoundSettings() {
@@ -255,9 +260,39 @@ void MidiDriver_Multisource::syncSoundSettings() {
 	_userMute = ConfMan.getBool("mute");
 
 	// Calling applySourceVolume will apply the user volume.
+	recomputeEffectiveVolume(0xFF);
 	applySourceVolume(0xFF);
 }
 
+void MidiDriver_Multisource::recomputeEffectiveVolume(uint8 source) {
+	if (source == 0xFF) {
+		for (int i = 0; i < MAXIMUM_SOURCES; ++i) {
+			recomputeEffectiveVolume(i);
+		}
+		return;
+	}
+
+	assert(source < MAXIMUM_SOURCES);
+
+	// Determine the user volume level which applies to this source.
+	// Treat SOURCE_TYPE_UNDEFINED as music.
+	uint16 userVolume = (_sources[source].type == SOURCE_TYPE_SFX ? _userSfxVolume : _userMusicVolume);
+
+	for (int volume = 0; volume < 0x80; ++volume) {
+		// Scale by source volume.
+		uint8 scaledVolume = (volume * _sources[source].volume) / _sources[source].neutralVolume;
+		if (_userVolumeScaling) {
+			if (_userMute) {
+				scaledVolume = 0;
+			} else {
+				// Scale by user volume.
+				scaledVolume = (scaledVolume * userVolume) >> 8;
+			}
+		}
+		_effectiveVolume[source][volume] = scaledVolume;
+	}
+}
+
 void MidiDriver_Multisource::onTimer() {
 	updateFading();
 
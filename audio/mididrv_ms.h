@@ -335,6 +335,36 @@ protected:
 	 * or all sources if 0xFF is specified.
 	 */
 	virtual void applySourceVolume(uint8 source) = 0;
+	/**
+	 * Recalculates the precomputed effective volume table for the specified
+	 * source, or for all sources if 0xFF is specified. The table combines the
+	 * source volume, neutral volume and user volume settings, so subclasses
+	 * can scale a MIDI volume value with a single lookup
+	 * (@see getEffectiveVolume) instead of recalculating the scaling factors
+	 * on every MIDI event. This function is called whenever one of the inputs
+	 * of the table changes; subclasses only need to call it if they change
+	 * these values directly.
+	 *
+	 * @param source The source for which the table should be recalculated, or
+	 * all sources if 0xFF is specified.
+	 */
+	void recomputeEffectiveVolume(uint8 source);
+	/**
+	 * Scales a MIDI volume value by the source volume and (if user volume
+	 * scaling is enabled) the user volume settings of the specified source,
+	 * using the precomputed effective volume table. Note that the result is
+	 * not clipped; the caller must reduce it to the maximum value of its
+	 * volume scale if necessary.
+	 *
+	 * @param source The source to whose volume settings the value should be
+	 * scaled.
+	 * @param volume The MIDI volume value (0 - 0x7F) which should be scaled.
+	 * @return The scaled volume value.
+	 */
+	uint8 getEffectiveVolume(uint8 source, uint8 volume) {
+		assert(source < MAXIMUM_SOURCES);
+		return _effectiveVolume[source][volume & 0x7F];
+	}
 	/**
 	 * Processes active fades and sets new volume values if necessary.
 	 */
@@ -348,6 +378,11 @@ protected:
 	// MIDI source data
 	MidiSource _sources[MAXIMUM_SOURCES];
 
+	// Precomputed effective volume table for each source. Maps a MIDI volume
+	// value (0 - 0x7F) to the value scaled by the source volume and the user
+	// volume settings. Updated by recomputeEffectiveVolume.
+	uint8 _effectiveVolume[MAXIMUM_SOURCES][0x80];
+
 	// True if the driver should scale MIDI channel volume to the user
 	// specified volume settings.
 	bool _userVolumeScaling;
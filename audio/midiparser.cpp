@@ -124,6 +124,9 @@ void MidiParser::activeNote(byte channel, byte note, bool active) {
 		_activeNotes[note] &= ~(1 << channel);
 
 	// See if there are hanging notes that we can cancel
+	if (!_hangingNotesCount)
+		return;
+
 	NoteTimer *ptr = _hangingNotes;
 	int i;
 	for (i = ARRAYSIZE(_hangingNotes); i; --i, ++ptr) {
@@ -226,9 +229,10 @@ void MidiParser::onTimer() {
 			return;
 		}
 
-		if (info.command() == 0x8) {
+		const byte command = info.command();
+		if (command == 0x8) {
 			activeNote(info.channel(), info.basic.param1, false);
-		} else if (info.command() == 0x9) {
+		} else if (command == 0x9) {
 			if (info.length > 0)
 				hangingNote(info.channel(), info.basic.param1, info.length * _psecPerTick - (endTime - eventTime));
 			else
@@ -815,17 +815,8 @@ void MidiDriver_Miles_AdLib::updatePhysicalFmVoice(byte virtualFmVoice, bool key
 		if (compositeVolume)
 			compositeVolume++; // round up in case result wasn't 0
 
-		// Scale by source volume.
-		compositeVolume = compositeVolume * _sources[0].volume / _sources[0].neutralVolume;
-		if (_userVolumeScaling) {
-			if (_userMute) {
-				compositeVolume = 0;
-			} else {
-				// Scale by user volume.
-				uint16 userVolume = (_sources[0].type == SOURCE_TYPE_SFX ? _userSfxVolume : _userMusicVolume); // Treat SOURCE_TYPE_UNDEFINED as music
-				compositeVolume = (compositeVolume * userVolume) >> 8;
-			}
-		}
+		// Scale by source volume and user volume using the precomputed table.
+		compositeVolume = getEffectiveVolume(0, compositeVolume);
 		// Source volume scaling might clip volume, so reduce to maximum.
 		compositeVolume = MIN(compositeVolume, (uint16)0x7F);
 
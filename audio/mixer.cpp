@@ -22,6 +22,7 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
@@ -177,8 +178,8 @@ private:
 #pragma mark --- Mixer ---
 #pragma mark -
 
-MixerImpl::MixerImpl(uint sampleRate)
-	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+MixerImpl::MixerImpl(uint sampleRate, uint outputBufSize)
+	: _mutex(), _sampleRate(sampleRate), _outputBufSize(outputBufSize), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
 
 	assert(sampleRate > 0);
 
@@ -201,6 +202,16 @@ uint MixerImpl::getOutputRate() const {
 	return _sampleRate;
 }
 
+uint MixerImpl::getOutputBufSize() const {
+	return _outputBufSize;
+}
+
+void MixerImpl::setOutputBufSize(uint outputBufSize) {
+	Common::StackLock lock(_mutex);
+
+	_outputBufSize = outputBufSize;
+}
+
 void MixerImpl::insertChannel(SoundHandle *handle, Channel *chan) {
 	int index = -1;
 	for (int i = 0; i != NUM_CHANNELS; i++) {
@@ -274,6 +285,8 @@ void MixerImpl::playStream(
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
+	PROFILER_SCOPE("mixer.mixCallback");
+
 	Common::StackLock lock(_mutex);
 
 	int16 *buf = (int16 *)samples;
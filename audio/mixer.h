@@ -305,6 +305,17 @@ public:
 	 * @return The output sample rate in Hz.
 	 */
 	virtual uint getOutputRate() const = 0;
+
+	/**
+	 * Return the output buffer size of the system.
+	 *
+	 * Together with getOutputRate(), this allows engines to estimate the
+	 * worst-case output latency (bufSize * 1000 / rate milliseconds), e.g.
+	 * for lip-sync compensation.
+	 *
+	 * @return The output buffer size in sample pairs, or 0 if unknown.
+	 */
+	virtual uint getOutputBufSize() const = 0;
 };
 
 /** @} */
@@ -65,6 +65,7 @@ private:
 	Common::Mutex _mutex;
 
 	const uint _sampleRate;
+	uint _outputBufSize;
 	bool _mixerReady;
 	uint32 _handleSeed;
 
@@ -81,7 +82,7 @@ private:
 
 public:
 
-	MixerImpl(uint sampleRate);
+	MixerImpl(uint sampleRate, uint outputBufSize = 0);
 	~MixerImpl();
 
 	virtual bool isReady() const { Common::StackLock lock(_mutex); return _mixerReady; }
@@ -129,6 +130,7 @@ public:
 	virtual int getVolumeForSoundType(SoundType type) const;
 
 	virtual uint getOutputRate() const;
+	virtual uint getOutputBufSize() const;
 
 protected:
 	void insertChannel(SoundHandle *handle, Channel *chan);
@@ -151,6 +153,13 @@ public:
 	 * their audio system has been completed.
 	 */
 	void setReady(bool ready);
+
+	/**
+	 * Update the output buffer size reported by getOutputBufSize().
+	 * Backends which renegotiate their output buffer at runtime should
+	 * call this whenever the buffer size changes.
+	 */
+	void setOutputBufSize(uint outputBufSize);
 };
 
 /** @} */
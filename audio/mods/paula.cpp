@@ -39,6 +39,13 @@
 #include "audio/mods/paula.h"
 #include "audio/null.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace Audio {
 
 Paula::Paula(bool stereo, int rate, uint interruptFreq, FilterMode filterMode, int periodScaleDivisor) :
@@ -156,9 +163,100 @@ inline int32 filter(int32 input, Paula::FilterState &state, int voice) {
 	return CLIP<int32>(state.ledFilter ? ledOutput : normalOutput, -32768, 32767);
 }
 
+/**
+ * Accumulates a block of pre-scaled (sample * volume) channel samples into
+ * the output buffer, applying panning for stereo output. Used by the
+ * unfiltered fast path in mixBuffer(), where the per-sample math is a pure
+ * multiply-shift-add and thus vectorizes; results are bit-identical to the
+ * scalar loop.
+ */
+template<bool stereo>
+inline void accumulateBlock(int16 *&buf, const int16 *src, int samples, byte panning) {
+	int i = 0;
+
+	if (stereo) {
+		const int volL = 255 - panning;
+		const int volR = panning;
+
+#if defined(__SSE2__)
+		const __m128i vl = _mm_set1_epi16(volL);
+		const __m128i vr = _mm_set1_epi16(volR);
+		for (; i + 8 <= samples; i += 8) {
+			const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+			// (s * vol) >> 7 kept in 16 bits: combine the partial products.
+			const __m128i prodL = _mm_or_si128(_mm_srli_epi16(_mm_mullo_epi16(s, vl), 7), _mm_slli_epi16(_mm_mulhi_epi16(s, vl), 9));
+			const __m128i prodR = _mm_or_si128(_mm_srli_epi16(_mm_mullo_epi16(s, vr), 7), _mm_slli_epi16(_mm_mulhi_epi16(s, vr), 9));
+			int16 *dst = buf + 2 * i;
+			_mm_storeu_si128((__m128i *)dst, _mm_add_epi16(_mm_loadu_si128((const __m128i *)dst), _mm_unpacklo_epi16(prodL, prodR)));
+			_mm_storeu_si128((__m128i *)(dst + 8), _mm_add_epi16(_mm_loadu_si128((const __m128i *)(dst + 8)), _mm_unpackhi_epi16(prodL, prodR)));
+		}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		const int16x4_t vl = vdup_n_s16(volL);
+		const int16x4_t vr = vdup_n_s16(volR);
+		for (; i + 8 <= samples; i += 8) {
+			const int16x8_t s = vld1q_s16(src + i);
+			int16x8x2_t out = vld2q_s16(buf + 2 * i);
+			const int16x8_t prodL = vcombine_s16(vmovn_s32(vshrq_n_s32(vmull_s16(vget_low_s16(s), vl), 7)),
+			                                     vmovn_s32(vshrq_n_s32(vmull_s16(vget_high_s16(s), vl), 7)));
+			const int16x8_t prodR = vcombine_s16(vmovn_s32(vshrq_n_s32(vmull_s16(vget_low_s16(s), vr), 7)),
+			                                     vmovn_s32(vshrq_n_s32(vmull_s16(vget_high_s16(s), vr), 7)));
+			out.val[0] = vaddq_s16(out.val[0], prodL);
+			out.val[1] = vaddq_s16(out.val[1], prodR);
+			vst2q_s16(buf + 2 * i, out);
+		}
+#endif
+
+		for (; i < samples; ++i) {
+			const int32 tmp = src[i];
+			buf[2 * i]     += (tmp * volL) >> 7;
+			buf[2 * i + 1] += (tmp * volR) >> 7;
+		}
+		buf += 2 * samples;
+	} else {
+#if defined(__SSE2__)
+		for (; i + 8 <= samples; i += 8)
+			_mm_storeu_si128((__m128i *)(buf + i), _mm_add_epi16(_mm_loadu_si128((const __m128i *)(buf + i)), _mm_loadu_si128((const __m128i *)(src + i))));
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		for (; i + 8 <= samples; i += 8)
+			vst1q_s16(buf + i, vaddq_s16(vld1q_s16(buf + i), vld1q_s16(src + i)));
+#endif
+		for (; i < samples; ++i)
+			buf[i] += src[i];
+		buf += samples;
+	}
+}
+
 template<bool stereo>
 inline int mixBuffer(int16 *&buf, const int8 *data, Paula::Offset &offset, frac_t rate, int neededSamples, uint bufSize, byte volume, byte panning, Paula::FilterState &filterState, int voice) {
 	int samples;
+
+	if (filterState.mode == Paula::kFilterModeNone) {
+		// Unfiltered fast path: gather the fractionally stepped source
+		// samples into short pre-scaled runs, then accumulate each run
+		// with the vectorized block kernel. The gather itself stays
+		// scalar, but it is only a table lookup and one multiply.
+		int16 block[128];
+
+		samples = 0;
+		while (samples < neededSamples && offset.int_off < bufSize) {
+			int count = 0;
+			while (count < ARRAYSIZE(block) && samples + count < neededSamples && offset.int_off < bufSize) {
+				block[count++] = ((int32)data[offset.int_off]) * volume;
+
+				// Step to next source sample
+				offset.rem_off += rate;
+				if (offset.rem_off >= (frac_t)FRAC_ONE) {
+					offset.int_off += fracToInt(offset.rem_off);
+					offset.rem_off &= FRAC_LO_MASK;
+				}
+			}
+			accumulateBlock<stereo>(buf, block, count, panning);
+			samples += count;
+		}
+
+		return samples;
+	}
+
 	for (samples = 0; samples < neededSamples && offset.int_off < bufSize; ++samples) {
 		const int32 tmp = filter(((int32) data[offset.int_off]) * volume, filterState, voice);
 		if (stereo) {
@@ -486,16 +486,16 @@ void MidiDriver_MT32GM::controlChange(byte outputChannel, byte controllerNumber,
 		controlData.volume = controllerValue;
 		controlData.sourceVolumeApplied = true;
 		if (source >= 0) {
-			// Scale to source volume
-			controllerValue = (controllerValue * _sources[source].volume) / _sources[source].neutralVolume;
-		}
-		if (_userVolumeScaling) {
+			// Scale to source volume and user volume using the precomputed
+			// table.
+			controllerValue = getEffectiveVolume(source, controllerValue);
+		} else if (_userVolumeScaling) {
 			if (_userMute) {
 				controllerValue = 0;
 			} else {
-				// Scale to user volume
-				uint16 userVolume = _sources[source].type == SOURCE_TYPE_SFX ? _userSfxVolume : _userMusicVolume; // Treat SOURCE_TYPE_UNDEFINED as music
-				controllerValue = (controllerValue * userVolume) >> 8;
+				// Scale to user volume. There is no source, so treat the data
+				// as music.
+				controllerValue = (controllerValue * _userMusicVolume) >> 8;
 			}
 		}
 		if (_scaleGSPercussionVolumeToMT32 && outputChannel == MIDI_RHYTHM_CHANNEL) {
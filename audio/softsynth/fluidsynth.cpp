@@ -38,6 +38,8 @@
 #include "common/scummsys.h"
 #include "common/config-manager.h"
 #include "common/error.h"
+#include "common/fs.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -212,6 +214,48 @@ static long SoundFontMemLoader_tell(void *handle) {
 #endif
 	return ((Common::SeekableReadStream *) handle)->pos();
 }
+
+// Process-lifetime cache of the configured SoundFont file. Reading a large
+// SF2 from disk - worse, from a network share - dominates open() time, and
+// the driver is torn down and recreated on every engine restart and every
+// return to the launcher. We keep the raw file image around and feed it to
+// FluidSynth through the memory loader above, so only the first open()
+// touches the filesystem.
+
+static byte *s_soundFontCacheData = nullptr;
+static uint32 s_soundFontCacheSize = 0;
+static Common::String *s_soundFontCachePath = nullptr;
+
+static Common::SeekableReadStream *getCachedSoundFont(const Common::String &path) {
+	if (!s_soundFontCachePath || *s_soundFontCachePath != path) {
+		free(s_soundFontCacheData);
+		s_soundFontCacheData = nullptr;
+		s_soundFontCacheSize = 0;
+		delete s_soundFontCachePath;
+		s_soundFontCachePath = nullptr;
+
+		Common::SeekableReadStream *file = Common::FSNode(path).createReadStream();
+		if (!file)
+			return nullptr;
+
+		uint32 size = file->size();
+		byte *data = (byte *)malloc(size);
+		if (!data || file->read(data, size) != size) {
+			free(data);
+			delete file;
+			return nullptr;
+		}
+		delete file;
+
+		s_soundFontCacheData = data;
+		s_soundFontCacheSize = size;
+		s_soundFontCachePath = new Common::String(path);
+	}
+
+	// The memory loader's close callback deletes the stream it was handed,
+	// so wrap the cached image in a fresh non-disposing stream every time.
+	return new Common::MemoryReadStream(s_soundFontCacheData, s_soundFontCacheSize, DisposeAfterUse::NO);
+}
 #endif
 
 int MidiDriver_FluidSynth::open() {
@@ -332,11 +376,28 @@ int MidiDriver_FluidSynth::open() {
 
 	fluid_synth_set_interp_method(_synth, -1, interpMethod);
 
-	const char *soundfont = !isUsingInMemorySoundFontData ?
-			ConfMan.get("soundfont").c_str() : Common::String::format("&%p", (void *)_engineSoundFontData).c_str();
+	Common::String soundFontPath;
+	if (!isUsingInMemorySoundFontData) {
+		soundFontPath = ConfMan.get("soundfont");
+#if defined(IPHONE_IOS7) && defined(IPHONE_SANDBOXED)
+		// HACK: Due to the sandbox on non-jailbroken iOS devices, we need to deal
+		// with the chroot filesystem. All the path selected by the user are
+		// relative to the Document directory. So, we need to adjust the path to
+		// reflect that.
+		soundFontPath = iOS7_getDocumentsDir() + soundFontPath;
+#endif
+	}
 
+	Common::SeekableReadStream *memorySoundFont = nullptr;
 #if FS_API_VERSION >= 0x0200
-	if (isUsingInMemorySoundFontData) {
+	// Either the engine handed us SoundFont data directly, or we route the
+	// configured file through the process-lifetime cache. Both go in via
+	// the memory loader. If the cache cannot read the file we fall back to
+	// letting FluidSynth load the path itself.
+	memorySoundFont = isUsingInMemorySoundFontData ?
+			_engineSoundFontData : getCachedSoundFont(soundFontPath);
+
+	if (memorySoundFont) {
 		fluid_sfloader_t *soundFontMemoryLoader = new_fluid_defsfloader(_settings);
 		fluid_sfloader_set_callbacks(soundFontMemoryLoader,
 									 SoundFontMemLoader_open,
@@ -348,24 +409,16 @@ int MidiDriver_FluidSynth::open() {
 	}
 #endif
 
-#if defined(IPHONE_IOS7) && defined(IPHONE_SANDBOXED)
-	if (!isUsingInMemorySoundFontData) {
-		// HACK: Due to the sandbox on non-jailbroken iOS devices, we need to deal
-		// with the chroot filesystem. All the path selected by the user are
-		// relative to the Document directory. So, we need to adjust the path to
-		// reflect that.
-		Common::String soundfont_fullpath = iOS7_getDocumentsDir();
-		soundfont_fullpath += soundfont;
-		_soundFont = fluid_synth_sfload(_synth, soundfont_fullpath.c_str(), 1);
+	if (memorySoundFont) {
+		Common::String handle = Common::String::format("&%p", (void *)memorySoundFont);
+		_soundFont = fluid_synth_sfload(_synth, handle.c_str(), 1);
 	} else {
-		_soundFont = fluid_synth_sfload(_synth, soundfont, 1);
+		_soundFont = fluid_synth_sfload(_synth, soundFontPath.c_str(), 1);
 	}
-#else
-	_soundFont = fluid_synth_sfload(_synth, soundfont, 1);
-#endif
 
 	if (_soundFont == -1) {
-		GUI::MessageDialog dialog(Common::U32String::format(_("FluidSynth: Failed loading custom SoundFont '%s'. Music is off."), soundfont));
+		GUI::MessageDialog dialog(Common::U32String::format(_("FluidSynth: Failed loading custom SoundFont '%s'. Music is off."),
+				isUsingInMemorySoundFontData ? "<engine data>" : soundFontPath.c_str()));
 		dialog.runModal();
 		return MERR_DEVICE_NOT_AVAILABLE;
 	}
@@ -35,6 +35,7 @@
 #include "common/events.h"
 #include "common/file.h"
 #include "common/system.h"
+#include "common/timer.h"
 #include "common/util.h"
 #include "common/archive.h"
 #include "common/textconsole.h"
@@ -120,6 +121,25 @@ private:
 
 	int _outputRate;
 
+	// Render-ahead mode: a timer proc (which the backend runs outside the
+	// audio thread) keeps a ring buffer of rendered samples filled, and the
+	// mixer callback is reduced to draining it. This keeps an expensive
+	// MUNT scene from overrunning the audio callback at the price of a few
+	// dozen milliseconds of extra output latency.
+	bool _renderAhead;
+	int16 *_ringBuffer;
+	uint32 _ringSize;		// in samples, power of two
+	uint32 _ringReadPos, _ringWritePos;
+
+	enum {
+		// Frames rendered per mutex acquisition in the timer proc, so the
+		// mixer callback never waits for more than one small chunk.
+		kRenderChunkFrames = 256
+	};
+
+	static void renderAheadTimerProc(void *refCon);
+	void renderAhead();
+
 protected:
 	void generateSamples(int16 *buf, int len) override;
 
@@ -157,6 +177,10 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderAhead = false;
+	_ringBuffer = nullptr;
+	_ringSize = 0;
+	_ringReadPos = _ringWritePos = 0;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -216,6 +240,20 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	// Optional render-ahead mode, mainly of interest on hardware where a
+	// busy MT-32 scene makes the mixer callback overrun.
+	_renderAhead = ConfMan.hasKey("mt32_render_ahead") && ConfMan.getBool("mt32_render_ahead");
+	if (_renderAhead) {
+		// Roughly 100ms of stereo samples, rounded up to a power of two.
+		uint32 frames = 1;
+		while (frames < (uint32)_outputRate / 10)
+			frames <<= 1;
+		_ringSize = frames * 2;
+		_ringBuffer = new int16[_ringSize];
+		_ringReadPos = _ringWritePos = 0;
+		g_system->getTimerManager()->installTimerProc(&renderAheadTimerProc, 10 * 1000, this, "MT32RenderAhead");
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -264,6 +302,9 @@ void MidiDriver_MT32::close() {
 		return;
 	_isOpen = false;
 
+	// Detach the render-ahead handler
+	if (_renderAhead)
+		g_system->getTimerManager()->removeTimerProc(&renderAheadTimerProc);
 	// Detach the player callback handler
 	setTimerCallback(nullptr, nullptr);
 	// Detach the mixer callback handler
@@ -276,10 +317,59 @@ void MidiDriver_MT32::close() {
 	_controlData = nullptr;
 	delete[] _pcmData;
 	_pcmData = nullptr;
+	delete[] _ringBuffer;
+	_ringBuffer = nullptr;
+	_renderAhead = false;
+}
+
+void MidiDriver_MT32::renderAheadTimerProc(void *refCon) {
+	((MidiDriver_MT32 *)refCon)->renderAhead();
+}
+
+void MidiDriver_MT32::renderAhead() {
+	// Top the ring buffer up one chunk per mutex acquisition; holding the
+	// mutex across a full refill would stall the mixer callback just like
+	// rendering there. Releasing it between chunks lets the callback drain
+	// the ring while a long top-up (e.g. the initial fill) is in progress.
+	for (;;) {
+		Common::StackLock lock(_mutex);
+
+		if (!_isOpen)
+			return;
+
+		if (_ringSize - (_ringWritePos - _ringReadPos) < 2 * kRenderChunkFrames)
+			return;
+
+		const uint32 writeIdx = _ringWritePos & (_ringSize - 1);
+		// Render at most up to the physical end of the buffer.
+		const uint32 samples = MIN<uint32>(2 * kRenderChunkFrames, _ringSize - writeIdx);
+		_service.renderBit16s(_ringBuffer + writeIdx, samples / 2);
+		_ringWritePos += samples;
+	}
 }
 
 void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	Common::StackLock lock(_mutex);
+
+	if (_renderAhead) {
+		// Drain what the render-ahead timer has produced...
+		uint32 samples = MIN<uint32>(2 * (uint32)len, _ringWritePos - _ringReadPos);
+		int16 *dst = data;
+		while (samples > 0) {
+			const uint32 readIdx = _ringReadPos & (_ringSize - 1);
+			const uint32 run = MIN<uint32>(samples, _ringSize - readIdx);
+			memcpy(dst, _ringBuffer + readIdx, run * sizeof(int16));
+			dst += run;
+			_ringReadPos += run;
+			samples -= run;
+		}
+		// ...and render any shortfall directly, as before.
+		len -= (dst - data) / 2;
+		if (len > 0)
+			_service.renderBit16s(dst, len);
+		return;
+	}
+
 	_service.renderBit16s(data, len);
 }
 
@@ -40,6 +40,13 @@
 #include <math.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace OPL {
 namespace DOSBox {
 
@@ -321,6 +328,34 @@ void OPL::dualWrite(uint8 index, uint8 reg, uint8 val) {
 	_emulator->WriteReg(fullReg, val);
 }
 
+// Narrows a block of 32 bit samples from the emulator core to the 16 bit
+// output format, saturating instead of wrapping on the rare overdriven
+// sample. The core itself already synthesizes per channel in whole blocks,
+// so this conversion is the only remaining per-sample loop on this path.
+static void convertBlock(int16 *dst, const int32 *src, uint samples) {
+#if defined(__SSE2__)
+	while (samples >= 8) {
+		const __m128i lo = _mm_loadu_si128((const __m128i *)src);
+		const __m128i hi = _mm_loadu_si128((const __m128i *)(src + 4));
+		_mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(lo, hi));
+		dst += 8;
+		src += 8;
+		samples -= 8;
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	while (samples >= 8) {
+		const int16x4_t lo = vqmovn_s32(vld1q_s32(src));
+		const int16x4_t hi = vqmovn_s32(vld1q_s32(src + 4));
+		vst1q_s16(dst, vcombine_s16(lo, hi));
+		dst += 8;
+		src += 8;
+		samples -= 8;
+	}
+#endif
+	while (samples--)
+		*dst++ = (int16)CLIP<int32>(*src++, -32768, 32767);
+}
+
 void OPL::generateSamples(int16 *buffer, int length) {
 	// For stereo OPL cards, we divide the sample count by 2,
 	// to match stereo AudioStream behavior.
@@ -336,8 +371,7 @@ void OPL::generateSamples(int16 *buffer, int length) {
 
 			_emulator->GenerateBlock3(readSamples, tempBuffer);
 
-			for (uint i = 0; i < (readSamples << 1); ++i)
-				buffer[i] = tempBuffer[i];
+			convertBlock(buffer, tempBuffer, readSamples << 1);
 
 			buffer += (readSamples << 1);
 			length -= readSamples;
@@ -348,8 +382,7 @@ void OPL::generateSamples(int16 *buffer, int length) {
 
 			_emulator->GenerateBlock2(readSamples, tempBuffer);
 
-			for (uint i = 0; i < readSamples; ++i)
-				buffer[i] = tempBuffer[i];
+			convertBlock(buffer, tempBuffer, readSamples);
 
 			buffer += readSamples;
 			length -= readSamples;
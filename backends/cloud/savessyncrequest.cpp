@@ -44,6 +44,10 @@ SavesSyncRequest::~SavesSyncRequest() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i)
+		_downloadingFiles[i].request->finish();
+	for (uint32 i = 0; i < _uploadingFiles.size(); ++i)
+		_uploadingFiles[i].request->finish();
 	delete _boolCallback;
 }
 
@@ -52,8 +56,12 @@ void SavesSyncRequest::start() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
-	_currentDownloadingFile = StorageFile();
-	_currentUploadingFile = "";
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i)
+		_downloadingFiles[i].request->finish();
+	for (uint32 i = 0; i < _uploadingFiles.size(); ++i)
+		_uploadingFiles[i].request->finish();
+	_downloadingFiles.clear();
+	_uploadingFiles.clear();
 	_filesToDownload.clear();
 	_filesToUpload.clear();
 	_localFilesTimestamps.clear();
@@ -268,45 +276,59 @@ void SavesSyncRequest::directoryCreatedErrorCallback(Networking::ErrorResponse e
 }
 
 void SavesSyncRequest::downloadNextFile() {
-	if (_filesToDownload.empty()) {
-		_currentDownloadingFile = StorageFile("", 0, 0, false); //so getFilesToDownload() would return an empty array
+	//fill up the download slots, so several files are transferred at once
+	while (!_filesToDownload.empty() && _downloadingFiles.size() < kMaxConcurrentTransfers) {
+		StorageFile file = _filesToDownload.back();
+		_filesToDownload.pop_back();
+
+		sendCommand(GUI::kSavesSyncProgressCmd, (int)(getDownloadingProgress() * 100));
+
+		debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", file.name().c_str(), (int)(getProgress() * 100));
+		Request *request = _storage->downloadById(
+			file.id(),
+			DefaultSaveFileManager::concatWithSavesPath(file.name()),
+			new Common::Callback<SavesSyncRequest, Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback),
+			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
+		);
+		if (!request) {
+			finishError(Networking::ErrorResponse(this, "SavesSyncRequest::downloadNextFile: Storage couldn't create Request to download a file"));
+			return;
+		}
+		_downloadingFiles.push_back(ActiveDownload(request, file));
+	}
+
+	if (_filesToDownload.empty() && _downloadingFiles.empty()) {
 		sendCommand(GUI::kSavesSyncEndedCmd, 0);
 		uploadNextFile();
-		return;
 	}
-
-	_currentDownloadingFile = _filesToDownload.back();
-	_filesToDownload.pop_back();
-
-	sendCommand(GUI::kSavesSyncProgressCmd, (int)(getDownloadingProgress() * 100));
-
-	debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", _currentDownloadingFile.name().c_str(), (int)(getProgress() * 100));
-	_workingRequest = _storage->downloadById(
-		_currentDownloadingFile.id(),
-		DefaultSaveFileManager::concatWithSavesPath(_currentDownloadingFile.name()),
-		new Common::Callback<SavesSyncRequest, Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback),
-		new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
-	);
-	if (!_workingRequest)
-		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::downloadNextFile: Storage couldn't create Request to download a file"));
 }
 
 void SavesSyncRequest::fileDownloadedCallback(Storage::BoolResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//find the transfer slot this response belongs to
+	StorageFile file;
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i) {
+		if (_downloadingFiles[i].request == response.request) {
+			file = _downloadingFiles[i].file;
+			_downloadingFiles.remove_at(i);
+			break;
+		}
+	}
+
 	//stop syncing if download failed
 	if (!response.value) {
 		//delete the incomplete file
-		g_system->getSavefileManager()->removeSavefile(_currentDownloadingFile.name());
+		if (file.name() != "")
+			g_system->getSavefileManager()->removeSavefile(file.name());
 		finishError(Networking::ErrorResponse(this, false, true, "SavesSyncRequest::fileDownloadedCallback: failed to download a file", -1));
 		return;
 	}
 
 	//update local timestamp for downloaded file
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentDownloadingFile.name()] = _currentDownloadingFile.timestamp();
+	_localFilesTimestamps[file.name()] = file.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
 
 	//continue downloading files
@@ -314,61 +336,97 @@ void SavesSyncRequest::fileDownloadedCallback(Storage::BoolResponse response) {
 }
 
 void SavesSyncRequest::fileDownloadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//drop the erroring transfer slot and delete its incomplete file;
+	//finishError() takes care of the other slots
+	Common::String name;
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i) {
+		if (_downloadingFiles[i].request == error.request) {
+			name = _downloadingFiles[i].file.name();
+			_downloadingFiles.remove_at(i);
+			break;
+		}
+	}
+	if (name != "")
+		g_system->getSavefileManager()->removeSavefile(name);
+
 	//stop syncing if download failed
 	finishError(error);
 }
 
 void SavesSyncRequest::uploadNextFile() {
-	if (_filesToUpload.empty()) {
-		finishSync(true);
-		return;
+	//fill up the upload slots, so several files are transferred at once
+	while (!_filesToUpload.empty() && _uploadingFiles.size() < kMaxConcurrentTransfers) {
+		Common::String name = _filesToUpload.back();
+		_filesToUpload.pop_back();
+
+		debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", name.c_str(), (int)(getProgress() * 100));
+		Request *request;
+		if (_storage->uploadStreamSupported()) {
+			request = _storage->upload(
+				_storage->savesDirectoryPath() + name,
+				g_system->getSavefileManager()->openRawFile(name),
+				new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
+				new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+			);
+		} else {
+			request = _storage->upload(
+				_storage->savesDirectoryPath() + name,
+				DefaultSaveFileManager::concatWithSavesPath(name),
+				new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
+				new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+			);
+		}
+		if (!request) {
+			finishError(Networking::ErrorResponse(this, "SavesSyncRequest::uploadNextFile: Storage couldn't create Request to upload a file"));
+			return;
+		}
+		_uploadingFiles.push_back(ActiveUpload(request, name));
 	}
 
-	_currentUploadingFile = _filesToUpload.back();
-	_filesToUpload.pop_back();
-
-	debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", _currentUploadingFile.c_str(), (int)(getProgress() * 100));
-	if (_storage->uploadStreamSupported()) {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			g_system->getSavefileManager()->openRawFile(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
-	} else {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			DefaultSaveFileManager::concatWithSavesPath(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
-	}
-	if (!_workingRequest) finishError(Networking::ErrorResponse(this, "SavesSyncRequest::uploadNextFile: Storage couldn't create Request to upload a file"));
+	if (_filesToUpload.empty() && _uploadingFiles.empty())
+		finishSync(true);
 }
 
 void SavesSyncRequest::fileUploadedCallback(Storage::UploadResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//find the transfer slot this response belongs to
+	Common::String name;
+	for (uint32 i = 0; i < _uploadingFiles.size(); ++i) {
+		if (_uploadingFiles[i].request == response.request) {
+			name = _uploadingFiles[i].name;
+			_uploadingFiles.remove_at(i);
+			break;
+		}
+	}
+
 	//update local timestamp for the uploaded file
-	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentUploadingFile] = response.value.timestamp();
-	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	if (name != "") {
+		_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
+		_localFilesTimestamps[name] = response.value.timestamp();
+		DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	}
 
 	//continue uploading files
 	uploadNextFile();
 }
 
 void SavesSyncRequest::fileUploadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//drop the erroring transfer slot; finishError() takes care of the others
+	for (uint32 i = 0; i < _uploadingFiles.size(); ++i) {
+		if (_uploadingFiles[i].request == error.request) {
+			_uploadingFiles.remove_at(i);
+			break;
+		}
+	}
+
 	//stop syncing if upload failed
 	finishError(error);
 }
@@ -384,11 +442,12 @@ double SavesSyncRequest::getDownloadingProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	if (_totalFilesToHandle == _filesToUpload.size())
+	uint32 filesLeftToUpload = _filesToUpload.size() + _uploadingFiles.size();
+	if (_totalFilesToHandle == filesLeftToUpload)
 		return 1; //nothing to download => download complete
 
-	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 totalFilesToDownload = _totalFilesToHandle - filesLeftToUpload;
+	uint32 filesLeftToDownload = _filesToDownload.size() + _downloadingFiles.size();
 	return (double)(totalFilesToDownload - filesLeftToDownload) / (double)(totalFilesToDownload);
 }
 
@@ -399,35 +458,45 @@ double SavesSyncRequest::getProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	return (double)(_totalFilesToHandle - _filesToDownload.size() - _filesToUpload.size()) / (double)(_totalFilesToHandle);
+	uint32 filesLeft = _filesToDownload.size() + _downloadingFiles.size() + _filesToUpload.size() + _uploadingFiles.size();
+	return (double)(_totalFilesToHandle - filesLeft) / (double)(_totalFilesToHandle);
 }
 
 Common::Array<Common::String> SavesSyncRequest::getFilesToDownload() {
 	Common::Array<Common::String> result;
 	for (uint32 i = 0; i < _filesToDownload.size(); ++i)
 		result.push_back(_filesToDownload[i].name());
-	if (_currentDownloadingFile.name() != "")
-		result.push_back(_currentDownloadingFile.name());
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i)
+		result.push_back(_downloadingFiles[i].file.name());
 	return result;
 }
 
 void SavesSyncRequest::finishError(Networking::ErrorResponse error) {
 	debug(9, "SavesSync::finishError");
-	//if we were downloading a file - remember the name
-	//and make the Request close() it, so we can delete it
-	Common::String name = _currentDownloadingFile.name();
+	//remember the names of the files being downloaded and make their
+	//Requests close() them, so we can delete the incomplete files
+	Common::Array<Common::String> incompleteFiles;
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i)
+		incompleteFiles.push_back(_downloadingFiles[i].file.name());
+
+	_ignoreCallback = true;
 	if (_workingRequest) {
-		_ignoreCallback = true;
 		_workingRequest->finish();
 		_workingRequest = nullptr;
-		_ignoreCallback = false;
 	}
+	for (uint32 i = 0; i < _downloadingFiles.size(); ++i)
+		_downloadingFiles[i].request->finish();
+	for (uint32 i = 0; i < _uploadingFiles.size(); ++i)
+		_uploadingFiles[i].request->finish();
+	_ignoreCallback = false;
+
 	//unlock all the files by making getFilesToDownload() return empty array
-	_currentDownloadingFile = StorageFile();
+	_downloadingFiles.clear();
+	_uploadingFiles.clear();
 	_filesToDownload.clear();
-	//delete the incomplete file
-	if (name != "")
-		g_system->getSavefileManager()->removeSavefile(name);
+	//delete the incomplete files
+	for (uint32 i = 0; i < incompleteFiles.size(); ++i)
+		g_system->getSavefileManager()->removeSavefile(incompleteFiles[i]);
 	Request::finishError(error);
 }
 
@@ -32,13 +32,36 @@
 namespace Cloud {
 
 class SavesSyncRequest: public Networking::Request, public GUI::CommandSender {
+	/** An in-flight file transfer, so the callbacks can tell which file a response belongs to. */
+	struct ActiveDownload {
+		Networking::Request *request;
+		StorageFile file;
+
+		ActiveDownload() : request(nullptr) {}
+		ActiveDownload(Networking::Request *rq, const StorageFile &f) : request(rq), file(f) {}
+	};
+
+	struct ActiveUpload {
+		Networking::Request *request;
+		Common::String name;
+
+		ActiveUpload() : request(nullptr) {}
+		ActiveUpload(Networking::Request *rq, const Common::String &n) : request(rq), name(n) {}
+	};
+
+	/**
+	 * Number of transfer Requests driven through the ConnectionManager at
+	 * once. Kept modest so storage providers do not rate-limit the sync.
+	 */
+	static const uint32 kMaxConcurrentTransfers = 4;
+
 	Storage *_storage;
 	Storage::BoolCallback _boolCallback;
 	Common::HashMap<Common::String, uint32> _localFilesTimestamps;
 	Common::Array<StorageFile> _filesToDownload;
 	Common::Array<Common::String> _filesToUpload;
-	StorageFile _currentDownloadingFile;
-	Common::String _currentUploadingFile;
+	Common::Array<ActiveDownload> _downloadingFiles;
+	Common::Array<ActiveUpload> _uploadingFiles;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	uint32 _totalFilesToHandle;
@@ -93,6 +93,32 @@ bool DefaultEventManager::pollEvent(Common::Event &event) {
 	}
 
 	event = _eventQueue.pop();
+	return processEvent(event);
+}
+
+uint DefaultEventManager::pollEvents(Common::Array<Common::Event> &events) {
+	// A single dispatch drains the backend queue and runs the keymapper
+	// over the whole batch, so high-rate input does not pay the dispatch
+	// setup cost once per event.
+	_dispatcher.dispatch();
+
+	if (g_engine)
+		// Handle autosaves if enabled
+		g_engine->handleAutoSave();
+
+	uint count = 0;
+	while (!_eventQueue.empty()) {
+		Common::Event event = _eventQueue.pop();
+		if (processEvent(event)) {
+			events.push_back(event);
+			++count;
+		}
+	}
+
+	return count;
+}
+
+bool DefaultEventManager::processEvent(Common::Event &event) {
 	bool forwardEvent = true;
 
 	// If the backend has the kFeatureNoQuit or the "Return to Launcher at Exit" option is enabled,
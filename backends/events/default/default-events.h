@@ -59,12 +59,21 @@ class DefaultEventManager : public Common::EventManager, Common::EventObserver {
 	bool _shouldReturnToLauncher;
 	bool _confirmExitDialogActive;
 
+	/**
+	 * Apply the manager-level processing (input state tracking, quit
+	 * confirmation, main menu, ...) to one dequeued event.
+	 *
+	 * @retval true If the event should be forwarded to the client.
+	 */
+	bool processEvent(Common::Event &event);
+
 public:
 	DefaultEventManager(Common::EventSource *boss);
 	~DefaultEventManager();
 
 	void init() override;
 	bool pollEvent(Common::Event &event) override;
+	uint pollEvents(Common::Array<Common::Event> &events) override;
 	void pushEvent(const Common::Event &event) override;
 	void purgeMouseEvents() override;
 	void purgeKeyboardEvents() override;
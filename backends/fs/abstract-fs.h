@@ -119,6 +119,17 @@ public:
 	 */
 	virtual bool getChildren(AbstractFSList &list, ListMode mode, bool hidden) const = 0;
 
+	/**
+	 * Returns the time of the last modification of the object referred by
+	 * this path, in seconds since the epoch, or 0 when the backend cannot
+	 * provide it.
+	 *
+	 * FSNode uses this to decide whether a cached directory listing is
+	 * still valid, so backends returning 0 simply opt out of the listing
+	 * cache.
+	 */
+	virtual uint32 lastModified() const { return 0; }
+
 	/**
 	 * Returns a human readable path string.
 	 *
@@ -183,6 +194,17 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStream() = 0;
 
+	/**
+	 * Creates a SeekableReadStream instance backed by a read-only memory
+	 * mapping of the file referred by this node. Reads from the stream
+	 * then are plain memory accesses without any syscall or copy.
+	 * Backends without memory mapping support return 0; callers fall
+	 * back to createReadStream().
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::SeekableReadStream *createMappedReadStream() { return nullptr; }
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
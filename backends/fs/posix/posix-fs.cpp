@@ -35,6 +35,7 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/posix/posix-iostream.h"
 #include "common/algorithm.h"
+#include "common/memstream.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -49,6 +50,9 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
+#ifdef POSIX
+#include <sys/mman.h>
+#endif
 
 #ifdef __OS2__
 #define INCL_DOS
@@ -85,6 +89,15 @@ void POSIXFilesystemNode::setFlags() {
 	_isDirectory = _isValid ? S_ISDIR(st.st_mode) : false;
 }
 
+uint32 POSIXFilesystemNode::lastModified() const {
+	struct stat st;
+
+	if (stat(_path.c_str(), &st) != 0)
+		return 0;
+
+	return (uint32)st.st_mtime;
+}
+
 POSIXFilesystemNode::POSIXFilesystemNode(const Common::String &p) {
 	assert(p.size() > 0);
 
@@ -297,6 +310,56 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return PosixIoStream::makeFromPath(getPath(), false);
 }
 
+#ifdef POSIX
+namespace {
+
+/**
+ * A read stream over a memory mapped file; unmaps on destruction.
+ */
+class POSIXMappedFileStream : public Common::MemoryReadStream {
+public:
+	POSIXMappedFileStream(void *map, uint32 size) :
+		Common::MemoryReadStream((const byte *)map, size), _map(map), _mapSize(size) {}
+
+	~POSIXMappedFileStream() {
+		munmap(_map, _mapSize);
+	}
+
+private:
+	void *_map;
+	uint32 _mapSize;
+};
+
+} // End of anonymous namespace
+#endif
+
+Common::SeekableReadStream *POSIXFilesystemNode::createMappedReadStream() {
+#ifdef POSIX
+	int fd = open(_path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return nullptr;
+
+	struct stat st;
+	if (fstat(fd, &st) == -1 || st.st_size <= 0 || (uint64)st.st_size > 0xFFFFFFFFu) {
+		// Empty and oversized files go through the regular stream path
+		close(fd);
+		return nullptr;
+	}
+
+	void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping stays valid without the descriptor
+	close(fd);
+
+	if (map == MAP_FAILED)
+		return nullptr;
+
+	return new POSIXMappedFileStream(map, st.st_size);
+#else
+	return nullptr;
+#endif
+}
+
 Common::SeekableWriteStream *POSIXFilesystemNode::createWriteStream() {
 	return PosixIoStream::makeFromPath(getPath(), true);
 }
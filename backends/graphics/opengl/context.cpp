@@ -43,6 +43,7 @@ void Context::reset() {
 	framebufferObjectSupported = false;
 	packedPixelsSupported = false;
 	textureEdgeClampSupported = false;
+	unpackRowLengthSupported = false;
 
 #define GL_FUNC_DEF(ret, name, param) name = nullptr;
 #include "backends/graphics/opengl/opengl-func.h"
@@ -162,6 +163,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 			g_context.packedPixelsSupported = true;
 		} else if (token == "GL_SGIS_texture_edge_clamp") {
 			g_context.textureEdgeClampSupported = true;
+		} else if (token == "GL_EXT_unpack_subimage") {
+			g_context.unpackRowLengthSupported = true;
 		}
 	}
 
@@ -187,6 +190,13 @@ void OpenGLGraphicsManager::initializeGLContext() {
 		g_context.textureEdgeClampSupported = true;
 	}
 
+	// Desktop GL has had GL_UNPACK_ROW_LENGTH from the beginning; GLES
+	// gained it in version 3.0 (or through GL_EXT_unpack_subimage, handled
+	// above).
+	if (g_context.type == kContextGL || g_context.isGLVersionOrHigher(3, 0)) {
+		g_context.unpackRowLengthSupported = true;
+	}
+
 	// Log context type.
 	switch (g_context.type) {
 	case kContextGL:
@@ -213,6 +223,7 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	debug(5, "OpenGL: FBO support: %d", g_context.framebufferObjectSupported);
 	debug(5, "OpenGL: Packed pixels support: %d", g_context.packedPixelsSupported);
 	debug(5, "OpenGL: Texture edge clamping support: %d", g_context.textureEdgeClampSupported);
+	debug(5, "OpenGL: Unpack row length support: %d", g_context.unpackRowLengthSupported);
 }
 
 } // End of namespace OpenGL
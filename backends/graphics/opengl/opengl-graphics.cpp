@@ -61,7 +61,7 @@ namespace OpenGL {
 
 OpenGLGraphicsManager::OpenGLGraphicsManager()
 	: _currentState(), _oldState(), _transactionMode(kTransactionNone), _screenChangeID(1 << (sizeof(int) * 8 - 2)),
-	  _pipeline(nullptr), _stretchMode(STRETCH_FIT),
+	  _pipeline(nullptr), _sharpScalePipeline(nullptr), _stretchMode(STRETCH_FIT),
 	  _defaultFormat(), _defaultFormatAlpha(),
 	  _gameScreen(nullptr), _overlay(nullptr),
 	  _cursor(nullptr),
@@ -506,7 +506,12 @@ void OpenGLGraphicsManager::updateScreen() {
 	if (_cursorVisible && _cursor) {
 		_cursor->updateGLTexture();
 	}
-	_overlay->updateGLTexture();
+	if (_overlayVisible) {
+		// The overlay is only composited while it is visible; its dirty area
+		// keeps accumulating while it is hidden and is uploaded in one go by
+		// the forced redraw after showOverlay.
+		_overlay->updateGLTexture();
+	}
 
 	// Clear the screen buffer.
 	GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
@@ -522,6 +527,26 @@ void OpenGLGraphicsManager::updateScreen() {
 	_backBuffer.enableBlend(Framebuffer::kBlendModeDisabled);
 
 	// First step: Draw the (virtual) game screen.
+#if !USE_FORCED_GLES
+	if (_sharpScalePipeline && _currentState.filtering) {
+		// With filtering enabled the game screen is scaled by the
+		// sharp-bilinear shader instead of plain bilinear sampling:
+		// nearest neighbor to the closest integer factor, bilinear for
+		// the rest, so pixel art stays crisp at arbitrary window sizes
+		// and scaling remains entirely on the GPU.
+		const GLTexture &gameTexture = _gameScreen->getGLTexture();
+		Shader *sharpShader = ShaderMan.query(ShaderManager::kSharpBilinear);
+		sharpShader->setUniform("texSize", new ShaderUniformVec2(gameTexture.getWidth(), gameTexture.getHeight()));
+
+		const GLfloat prescaleX = MAX<GLfloat>((GLfloat)(_gameDrawRect.width() / gameTexture.getLogicalWidth()), 1.0f);
+		const GLfloat prescaleY = MAX<GLfloat>((GLfloat)(_gameDrawRect.height() / gameTexture.getLogicalHeight()), 1.0f);
+		sharpShader->setUniform("prescale", new ShaderUniformVec2(prescaleX, prescaleY));
+
+		Pipeline *oldPipeline = g_context.setPipeline(_sharpScalePipeline);
+		g_context.getActivePipeline()->drawTexture(gameTexture, _gameDrawRect.left, _gameDrawRect.top, _gameDrawRect.width(), _gameDrawRect.height());
+		g_context.setPipeline(oldPipeline);
+	} else
+#endif
 	g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top, _gameDrawRect.width(), _gameDrawRect.height());
 
 	// Second step: Draw the overlay if visible.
@@ -995,11 +1020,14 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	// Initialize pipeline.
 	delete _pipeline;
 	_pipeline = nullptr;
+	delete _sharpScalePipeline;
+	_sharpScalePipeline = nullptr;
 
 #if !USE_FORCED_GLES
 	if (g_context.shadersSupported) {
 		ShaderMan.notifyCreate();
 		_pipeline = new ShaderPipeline(ShaderMan.query(ShaderManager::kDefault));
+		_sharpScalePipeline = new ShaderPipeline(ShaderMan.query(ShaderManager::kSharpBilinear));
 	}
 #endif
 
@@ -1024,6 +1052,11 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	_backBuffer.setClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
 	g_context.getActivePipeline()->setFramebuffer(&_backBuffer);
+	if (_sharpScalePipeline) {
+		// The scaling pipeline renders into the same back buffer, so a
+		// mid-frame pipeline switch restores viewport and projection.
+		_sharpScalePipeline->setFramebuffer(&_backBuffer);
+	}
 
 	// We use a "pack" alignment (when reading from textures) to 4 here,
 	// since the only place where we really use it is the BMP screenshot
@@ -1097,6 +1130,8 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 	g_context.setPipeline(nullptr);
 	delete _pipeline;
 	_pipeline = nullptr;
+	delete _sharpScalePipeline;
+	_sharpScalePipeline = nullptr;
 
 	// Rest our context description since the context is gone soon.
 	g_context.reset();
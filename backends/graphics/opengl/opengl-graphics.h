@@ -293,6 +293,13 @@ private:
 	 */
 	Pipeline *_pipeline;
 
+	/**
+	 * Pipeline drawing the game screen with the sharp-bilinear scaling
+	 * shader when filtering is enabled. Only available with shader
+	 * support.
+	 */
+	Pipeline *_sharpScalePipeline;
+
 protected:
 	/**
 	 * Query the address of an OpenGL function by name.
@@ -78,6 +78,30 @@ const char *const g_lookUpFragmentShader =
 	"}\n";
 
 
+// Scale to the nearest integer factor with nearest neighbor filtering
+// and from there to the target size bilinearly. This keeps pixel art
+// crisp at arbitrary scale factors without the shimmering of pure
+// nearest neighbor scaling. The shader relies on the texture sampler
+// being set to linear filtering.
+const char *const g_sharpBilinearFragmentShader =
+	"varying vec2 texCoord;\n"
+	"varying vec4 blendColor;\n"
+	"\n"
+	"uniform sampler2D shaderTexture;\n"
+	"uniform vec2 texSize;\n"
+	"uniform vec2 prescale;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec2 texel = texCoord * texSize;\n"
+	"\tvec2 texelFloored = floor(texel);\n"
+	"\tvec2 s = fract(texel);\n"
+	"\tvec2 regionRange = 0.5 - 0.5 / prescale;\n"
+	"\tvec2 centerDist = s - 0.5;\n"
+	"\tvec2 f = (centerDist - clamp(centerDist, -regionRange, regionRange)) * prescale + 0.5;\n"
+	"\n"
+	"\tgl_FragColor = blendColor * texture2D(shaderTexture, (texelFloored + f) / texSize);\n"
+	"}\n";
+
 // Taken from: https://en.wikibooks.org/wiki/OpenGL_Programming/Modern_OpenGL_Tutorial_03#OpenGL_ES_2_portability
 const char *const g_precisionDefines =
 	"#ifdef GL_ES\n"
@@ -104,6 +128,10 @@ void ShaderUniformFloat::set(GLint location) const {
 	GL_CALL(glUniform1f(location, _value));
 }
 
+void ShaderUniformVec2::set(GLint location) const {
+	GL_CALL(glUniform2f(location, _x, _y));
+}
+
 void ShaderUniformMatrix44::set(GLint location) const {
 	GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, _matrix));
 }
@@ -312,6 +340,11 @@ void ShaderManager::notifyCreate() {
 		_builtIn[kDefault] = new Shader(g_defaultVertexShader, g_defaultFragmentShader);
 		_builtIn[kCLUT8LookUp] = new Shader(g_defaultVertexShader, g_lookUpFragmentShader);
 		_builtIn[kCLUT8LookUp]->setUniform1I("palette", 1);
+		_builtIn[kSharpBilinear] = new Shader(g_defaultVertexShader, g_sharpBilinearFragmentShader);
+		// Neutral values; the graphics manager supplies the real ones
+		// before each draw.
+		_builtIn[kSharpBilinear]->setUniform("texSize", new ShaderUniformVec2(1.0f, 1.0f));
+		_builtIn[kSharpBilinear]->setUniform("prescale", new ShaderUniformVec2(1.0f, 1.0f));
 
 		for (uint i = 0; i < kMaxUsages; ++i) {
 			_builtIn[i]->setUniform1I("shaderTexture", 0);
@@ -74,6 +74,20 @@ private:
 	const GLfloat _value;
 };
 
+/**
+ * Two component vector value for a shader uniform.
+ */
+class ShaderUniformVec2 : public ShaderUniformValue {
+public:
+	ShaderUniformVec2(GLfloat x, GLfloat y) : _x(x), _y(y) {}
+
+	void set(GLint location) const override;
+
+private:
+	const GLfloat _x;
+	const GLfloat _y;
+};
+
 /**
  * 4x4 Matrix value for a shader uniform.
  */
@@ -249,6 +263,9 @@ public:
 		/** CLUT8 look up shader. */
 		kCLUT8LookUp,
 
+		/** Sharp-bilinear scaling shader. */
+		kSharpBilinear,
+
 		/** Number of built-in shaders. Should not be used for query. */
 		kMaxUsages
 	};
@@ -1438,7 +1438,13 @@ void SurfaceSdlGraphicsManager::copyRectToScreen(const void *buf, int pitch, int
 	assert(h > 0 && y + h <= _videoMode.screenHeight);
 	assert(w > 0 && x + w <= _videoMode.screenWidth);
 
-	addDirtyRect(x, y, w, h);
+	// While the overlay is visible, the displayed image is composed from the
+	// overlay surface, so game screen changes are invisible until the overlay
+	// is hidden again. Don't add them to the dirty rect list (which is in
+	// overlay coordinates at this point); hideOverlay forces a full redraw,
+	// which repaints any game screen areas changed in the meantime.
+	if (!_overlayVisible)
+		addDirtyRect(x, y, w, h);
 
 	// Try to lock the screen surface
 	if (SDL_LockSurface(_screen) == -1)
@@ -1489,8 +1495,10 @@ void SurfaceSdlGraphicsManager::unlockScreen() {
 	// Unlock the screen surface
 	SDL_UnlockSurface(_screen);
 
-	// Trigger a full screen update
-	_forceRedraw = true;
+	// Trigger a full screen update, unless the overlay hides the game screen
+	// anyway; in that case hideOverlay will force a redraw later.
+	if (!_overlayVisible)
+		_forceRedraw = true;
 
 	// Finally unlock the graphics mutex
 	_graphicsMutex.unlock();
@@ -2577,6 +2585,10 @@ void SurfaceSdlGraphicsManager::recreateScreenTexture() {
 		SDL_DestroyTexture(oldTexture);
 	else
 		_screenTexture = oldTexture;
+
+	// The content of a freshly created texture is undefined, so the next
+	// update must upload the whole screen, not just the dirty rects.
+	_forceRedraw = true;
 }
 
 SDL_Surface *SurfaceSdlGraphicsManager::SDL_SetVideoMode(int width, int height, int bpp, Uint32 flags) {
@@ -2636,12 +2648,34 @@ SDL_Surface *SurfaceSdlGraphicsManager::SDL_SetVideoMode(int width, int height,
 		deinitializeRenderer();
 		return nullptr;
 	} else {
+		// Both the texture and the surface start out with undefined
+		// respectively blank content, so the first update has to cover
+		// the whole screen rather than just the dirty rects.
+		_forceRedraw = true;
 		return screen;
 	}
 }
 
 void SurfaceSdlGraphicsManager::SDL_UpdateRects(SDL_Surface *screen, int numrects, SDL_Rect *rects) {
-	SDL_UpdateTexture(_screenTexture, nullptr, screen->pixels, screen->pitch);
+	// Only upload the dirty parts of the surface to the texture. With
+	// mostly static screens this is a fraction of the fixed cost of a
+	// full-screen SDL_UpdateTexture per frame, which hurts at high
+	// output resolutions.
+	SDL_Rect bounds;
+	bounds.x = 0;
+	bounds.y = 0;
+	bounds.w = screen->w;
+	bounds.h = screen->h;
+
+	const int bytesPerPixel = screen->format->BytesPerPixel;
+	for (int i = 0; i < numrects; ++i) {
+		SDL_Rect clipped;
+		if (!SDL_IntersectRect(&rects[i], &bounds, &clipped))
+			continue;
+
+		const byte *src = (const byte *)screen->pixels + clipped.y * screen->pitch + clipped.x * bytesPerPixel;
+		SDL_UpdateTexture(_screenTexture, &clipped, src, screen->pitch);
+	}
 
 	SDL_Rect viewport;
 	viewport.x = _activeArea.drawRect.left;
@@ -33,6 +33,8 @@
 
 namespace Common {
 
+uint32 Keymap::s_mappingsGeneration = 0;
+
 Keymap::Keymap(KeymapType type, const String &id, const U32String &description) :
 		_type(type),
 		_id(id),
@@ -58,6 +60,9 @@ Keymap::Keymap(KeymapType type, const String &id, const String &description) :
 Keymap::~Keymap() {
 	for (ActionArray::iterator it = _actions.begin(); it != _actions.end(); ++it)
 		delete *it;
+
+	// Compiled lookup tables may hold pointers to our actions
+	s_mappingsGeneration++;
 }
 
 void Keymap::addAction(Action *action) {
@@ -74,6 +79,7 @@ void Keymap::registerMapping(Action *action, const HardwareInput &hwInput) {
 	ActionArray::const_iterator found = find(actionArray.begin(), actionArray.end(), action);
 	if (found == actionArray.end()) {
 		actionArray.push_back(action);
+		s_mappingsGeneration++;
 	}
 }
 
@@ -90,6 +96,8 @@ void Keymap::unregisterMapping(Action *action) {
 			_hwActionMap.erase(itInput);
 		}
 	}
+
+	s_mappingsGeneration++;
 }
 
 void Keymap::resetMapping(Action *action) {
@@ -135,17 +143,79 @@ const Action *Keymap::findAction(const char *id) const {
 	return nullptr;
 }
 
-Keymap::KeymapMatch Keymap::getMappedActions(const Event &event, ActionArray &actions) const {
+uint Keymap::eventToHardwareInputKeys(const Event &event, HardwareInput (&keys)[2]) {
 	switch (event.type) {
 	case EVENT_KEYDOWN:
-	case EVENT_KEYUP: {
-		KeyState normalizedKeystate = KeyboardHardwareInputSet::normalizeKeyState(event.kbd);
-		HardwareInput hardwareInput = HardwareInput::createKeyboard("", normalizedKeystate, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		if (!actions.empty()) {
-			return kKeymapMatchExact;
+	case EVENT_KEYUP:
+		keys[0] = HardwareInput::createKeyboard("", KeyboardHardwareInputSet::normalizeKeyState(event.kbd), U32String());
+		return 1;
+	case EVENT_LBUTTONDOWN:
+	case EVENT_LBUTTONUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_BUTTON_LEFT, U32String());
+		return 1;
+	case EVENT_RBUTTONDOWN:
+	case EVENT_RBUTTONUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_BUTTON_RIGHT, U32String());
+		return 1;
+	case EVENT_MBUTTONDOWN:
+	case EVENT_MBUTTONUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_BUTTON_MIDDLE, U32String());
+		return 1;
+	case EVENT_WHEELUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_WHEEL_UP, U32String());
+		return 1;
+	case EVENT_WHEELDOWN:
+		keys[0] = HardwareInput::createMouse("", MOUSE_WHEEL_DOWN, U32String());
+		return 1;
+	case EVENT_X1BUTTONDOWN:
+	case EVENT_X1BUTTONUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_BUTTON_X1, U32String());
+		return 1;
+	case EVENT_X2BUTTONDOWN:
+	case EVENT_X2BUTTONUP:
+		keys[0] = HardwareInput::createMouse("", MOUSE_BUTTON_X2, U32String());
+		return 1;
+	case EVENT_JOYBUTTON_DOWN:
+	case EVENT_JOYBUTTON_UP:
+		keys[0] = HardwareInput::createJoystickButton("", event.joystick.button, U32String());
+		return 1;
+	case EVENT_JOYAXIS_MOTION:
+		if (event.joystick.position != 0) {
+			bool positiveHalf = event.joystick.position >= 0;
+			keys[0] = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, positiveHalf, U32String());
+			return 1;
+		} else {
+			// Axis position zero is part of both half axes, and triggers actions bound to both
+			keys[0] = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, true, U32String());
+			keys[1] = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, false, U32String());
+			return 2;
 		}
+	case EVENT_CUSTOM_BACKEND_HARDWARE:
+		keys[0] = HardwareInput::createCustom("", event.customType, U32String());
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+void Keymap::addMappingsTo(HardwareActionMap &target) const {
+	for (HardwareActionMap::const_iterator itInput = _hwActionMap.begin(); itInput != _hwActionMap.end(); ++itInput) {
+		target.getOrCreateVal(itInput->_key).push_back(itInput->_value);
+	}
+}
+
+Keymap::KeymapMatch Keymap::getMappedActions(const Event &event, ActionArray &actions) const {
+	HardwareInput keys[2];
+	uint keyCount = eventToHardwareInputKeys(event, keys);
+	for (uint i = 0; i < keyCount; i++) {
+		actions.push_back(_hwActionMap.getValOrDefault(keys[i]));
+	}
+	if (!actions.empty()) {
+		return kKeymapMatchExact;
+	}
 
+	if (event.type == EVENT_KEYDOWN || event.type == EVENT_KEYUP) {
+		KeyState normalizedKeystate = KeyboardHardwareInputSet::normalizeKeyState(event.kbd);
 		if (normalizedKeystate.flags & KBD_NON_STICKY) {
 			// If no matching actions and non-sticky keyboard modifiers are down,
 			// check again for matches without the exact keyboard modifiers
@@ -161,82 +231,13 @@ Keymap::KeymapMatch Keymap::getMappedActions(const Event &event, ActionArray &ac
 
 			// Lastly check again for matches no non-sticky keyboard modifiers
 			normalizedKeystate.flags &= ~KBD_NON_STICKY;
-			hardwareInput = HardwareInput::createKeyboard("", normalizedKeystate, U32String());
+			HardwareInput hardwareInput = HardwareInput::createKeyboard("", normalizedKeystate, U32String());
 			actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
 			return actions.empty() ? kKeymapMatchNone : kKeymapMatchPartial;
 		}
-		break;
-	}
-	case EVENT_LBUTTONDOWN:
-	case EVENT_LBUTTONUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_BUTTON_LEFT, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_RBUTTONDOWN:
-	case EVENT_RBUTTONUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_BUTTON_RIGHT, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_MBUTTONDOWN:
-	case EVENT_MBUTTONUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_BUTTON_MIDDLE, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case Common::EVENT_WHEELUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_WHEEL_UP, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case Common::EVENT_WHEELDOWN: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_WHEEL_DOWN, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_X1BUTTONDOWN:
-	case EVENT_X1BUTTONUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_BUTTON_X1, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_X2BUTTONDOWN:
-	case EVENT_X2BUTTONUP: {
-		HardwareInput hardwareInput = HardwareInput::createMouse("", MOUSE_BUTTON_X2, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_JOYBUTTON_DOWN:
-	case EVENT_JOYBUTTON_UP: {
-		HardwareInput hardwareInput = HardwareInput::createJoystickButton("", event.joystick.button, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	case EVENT_JOYAXIS_MOTION: {
-		if (event.joystick.position != 0) {
-			bool positiveHalf = event.joystick.position >= 0;
-			HardwareInput hardwareInput = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, positiveHalf, U32String());
-			actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		} else {
-			// Axis position zero is part of both half axes, and triggers actions bound to both
-			HardwareInput hardwareInputPos = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, true, U32String());
-			HardwareInput hardwareInputNeg = HardwareInput::createJoystickHalfAxis("", event.joystick.axis, false, U32String());
-			actions.push_back(_hwActionMap.getValOrDefault(hardwareInputPos));
-			actions.push_back(_hwActionMap.getValOrDefault(hardwareInputNeg));
-		}
-		break;
-	}
-	case EVENT_CUSTOM_BACKEND_HARDWARE: {
-		HardwareInput hardwareInput = HardwareInput::createCustom("", event.customType, U32String());
-		actions.push_back(_hwActionMap.getValOrDefault(hardwareInput));
-		break;
-	}
-	default:
-		break;
 	}
 
-	return actions.empty() ? kKeymapMatchNone : kKeymapMatchExact;
+	return kKeymapMatchNone;
 }
 
 void Keymap::setConfigDomain(ConfigManager::Domain *configDomain) {
@@ -287,6 +288,7 @@ void Keymap::loadMappings() {
 	String prefix = KEYMAP_KEY_PREFIX + _id + "_";
 
 	_hwActionMap.clear();
+	s_mappingsGeneration++;
 	for (ActionArray::const_iterator it = _actions.begin(); it != _actions.end(); ++it) {
 		Action *action = *it;
 		String confKey = prefix + action->id;
@@ -79,6 +79,7 @@ public:
 	};
 
 	typedef Array<Action *> ActionArray;
+	typedef HashMap<HardwareInput, ActionArray, HardwareInput_Hash, HardwareInput_EqualTo> HardwareActionMap;
 
 	Keymap(KeymapType type, const String &id, const U32String &description);
 	Keymap(KeymapType type, const String &id, const String &description);
@@ -121,6 +122,30 @@ public:
 	 */
 	KeymapMatch getMappedActions(const Event &event, ActionArray &actions) const;
 
+	/**
+	 * Convert an incoming event to the hardware input keys used by the
+	 * mapping tables.
+	 *
+	 * Axis position zero is part of both half axes, so an event can
+	 * convert to up to two keys.
+	 *
+	 * @return the number of keys written to the array
+	 */
+	static uint eventToHardwareInputKeys(const Event &event, HardwareInput (&keys)[2]);
+
+	/**
+	 * Append this keymap's input-to-action table to an aggregated map,
+	 * merging the action lists of inputs already present in the target.
+	 */
+	void addMappingsTo(HardwareActionMap &target) const;
+
+	/**
+	 * Generation counter bumped whenever any keymap's mappings or enabled
+	 * state change. Lets the Keymapper detect that its compiled lookup
+	 * tables are stale without coupling every mutation point to it.
+	 */
+	static uint32 getMappingsGeneration() { return s_mappingsGeneration; }
+
 	/**
 	 * Adds a new Action to this Map
 	 *
@@ -163,7 +188,10 @@ public:
 	 * Defines if the keymap is considered when mapping events
 	 */
 	bool isEnabled() const { return _enabled; }
-	void setEnabled(bool enabled) { _enabled = enabled; }
+	void setEnabled(bool enabled) {
+		_enabled = enabled;
+		s_mappingsGeneration++;
+	}
 
 	/** Helper to return an array with a single keymap element */
 	static Array<Keymap *> arrayOf(Keymap *keymap) {
@@ -177,7 +205,7 @@ private:
 	void registerMappings(Action *action, const StringArray &hwInputIds);
 	bool areMappingsIdentical(const Array<HardwareInput> &inputs, const StringArray &mapping);
 
-	typedef HashMap<HardwareInput, ActionArray, HardwareInput_Hash, HardwareInput_EqualTo> HardwareActionMap;
+	static uint32 s_mappingsGeneration;
 
 	KeymapType _type;
 	String _id;
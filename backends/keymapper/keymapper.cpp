@@ -40,7 +40,10 @@ Keymapper::Keymapper(EventManager *eventMan) :
 		_backendDefaultBindings(nullptr),
 		_delayedEventSource(new DelayedEventSource()),
 		_enabled(true),
-		_enabledKeymapType(Keymap::kKeymapTypeGame) {
+		_enabledKeymapType(Keymap::kKeymapTypeGame),
+		_compiledMapsValid(false),
+		_compiledMapsGeneration(0),
+		_compiledMapsType(Keymap::kKeymapTypeGame) {
 	_eventMan->getEventDispatcher()->registerSource(_delayedEventSource, true);
 	resetInputState();
 }
@@ -60,6 +63,8 @@ void Keymapper::clear() {
 
 	delete _hardwareInputs;
 	_hardwareInputs = nullptr;
+
+	_compiledMapsValid = false;
 }
 
 void Keymapper::registerHardwareInputSet(HardwareInputSet *inputs, KeymapperDefaultBindings *backendDefaultBindings) {
@@ -96,6 +101,7 @@ void Keymapper::addGlobalKeymap(Keymap *keymap) {
 	ConfigManager::Domain *keymapperDomain = ConfMan.getDomain(ConfigManager::kKeymapperDomain);
 	initKeymap(keymap, keymapperDomain);
 	_keymaps.push_back(keymap);
+	_compiledMapsValid = false;
 }
 
 void Keymapper::addGameKeymap(Keymap *keymap) {
@@ -109,6 +115,7 @@ void Keymapper::addGameKeymap(Keymap *keymap) {
 
 	initKeymap(keymap, gameDomain);
 	_keymaps.push_back(keymap);
+	_compiledMapsValid = false;
 }
 
 void Keymapper::initKeymap(Keymap *keymap, ConfigManager::Domain *domain) {
@@ -138,6 +145,8 @@ void Keymapper::cleanupGameKeymaps() {
 			it++;
 		}
 	}
+
+	_compiledMapsValid = false;
 }
 
 Keymap *Keymapper::getKeymap(const String &id) const {
@@ -170,6 +179,8 @@ List<Event> Keymapper::mapEvent(const Event &ev) {
 
 	hardcodedEventMapping(ev);
 
+	ensureCompiledMaps();
+
 	Keymap::ActionArray actions;
 	Keymap::KeymapMatch match = getMappedActions(ev, actions, _enabledKeymapType);
 	if (match != Keymap::kKeymapMatchExact) {
@@ -222,25 +233,72 @@ List<Event> Keymapper::mapEvent(const Event &ev) {
 	return mappedEvents;
 }
 
-Keymap::KeymapMatch Keymapper::getMappedActions(const Event &event, Keymap::ActionArray &actions, Keymap::KeymapType keymapType) const {
-	Keymap::KeymapMatch match = Keymap::kKeymapMatchNone;
+void Keymapper::ensureCompiledMaps() {
+	if (_compiledMapsValid
+	        && _compiledMapsGeneration == Keymap::getMappingsGeneration()
+	        && _compiledMapsType == _enabledKeymapType) {
+		return;
+	}
+
+	_compiledEnabledMap.clear();
+	_compiledGlobalMap.clear();
 
 	for (uint i = 0; i < _keymaps.size(); i++) {
-		if (!_keymaps[i]->isEnabled() || _keymaps[i]->getType() != keymapType) {
+		Keymap *keymap = _keymaps[i];
+		if (!keymap->isEnabled()) {
 			continue;
 		}
 
-		Keymap::ActionArray array;
-		Keymap::KeymapMatch match2 = _keymaps[i]->getMappedActions(event, array);
-		if (match2 == match) {
-			actions.push_back(array);
-		} else if (match2 > match) {
-			match = match2;
-			actions.clear();
-			actions.push_back(array);
+		if (keymap->getType() == Keymap::kKeymapTypeGlobal) {
+			keymap->addMappingsTo(_compiledGlobalMap);
+		} else if (keymap->getType() == _enabledKeymapType) {
+			keymap->addMappingsTo(_compiledEnabledMap);
+		}
+	}
+
+	_compiledMapsValid = true;
+	_compiledMapsGeneration = Keymap::getMappingsGeneration();
+	_compiledMapsType = _enabledKeymapType;
+}
+
+Keymap::KeymapMatch Keymapper::getMappedActions(const Event &event, Keymap::ActionArray &actions, Keymap::KeymapType keymapType) const {
+	const Keymap::HardwareActionMap &compiled =
+	        (keymapType == Keymap::kKeymapTypeGlobal) ? _compiledGlobalMap : _compiledEnabledMap;
+
+	HardwareInput keys[2];
+	uint keyCount = Keymap::eventToHardwareInputKeys(event, keys);
+	for (uint i = 0; i < keyCount; i++) {
+		actions.push_back(compiled.getValOrDefault(keys[i]));
+	}
+	if (!actions.empty()) {
+		return Keymap::kKeymapMatchExact;
+	}
+
+	// Keyboard events with non-sticky modifiers held can still partially
+	// match mappings with relaxed modifiers. That requires scanning the
+	// individual keymaps, but it is only reached on an exact-match miss.
+	if (event.type == EVENT_KEYDOWN || event.type == EVENT_KEYUP) {
+		Keymap::KeymapMatch match = Keymap::kKeymapMatchNone;
+
+		for (uint i = 0; i < _keymaps.size(); i++) {
+			if (!_keymaps[i]->isEnabled() || _keymaps[i]->getType() != keymapType) {
+				continue;
+			}
+
+			Keymap::ActionArray array;
+			Keymap::KeymapMatch match2 = _keymaps[i]->getMappedActions(event, array);
+			if (match2 == match) {
+				actions.push_back(array);
+			} else if (match2 > match) {
+				match = match2;
+				actions.clear();
+				actions.push_back(array);
+			}
 		}
+		return match;
 	}
-	return match;
+
+	return Keymap::kKeymapMatchNone;
 }
 
 Keymapper::IncomingEventType Keymapper::convertToIncomingEventType(const Event &ev) const {
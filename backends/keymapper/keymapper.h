@@ -149,8 +149,20 @@ private:
 
 	KeymapArray _keymaps;
 
+	// The active keymaps compiled into flat input-to-action tables, one
+	// for the enabled gui/game keymaps and one for the global keymaps, so
+	// the per-event cost on the hot path is a single hash probe instead
+	// of a walk over every keymap. Rebuilt lazily whenever a keymap is
+	// added, removed or remapped.
+	Keymap::HardwareActionMap _compiledEnabledMap;
+	Keymap::HardwareActionMap _compiledGlobalMap;
+	bool _compiledMapsValid;
+	uint32 _compiledMapsGeneration;
+	Keymap::KeymapType _compiledMapsType;
+
 	bool _joystickAxisPreviouslyPressed[6];
 
+	void ensureCompiledMaps();
 	Keymap::KeymapMatch getMappedActions(const Event &event, Keymap::ActionArray &actions, Keymap::KeymapType keymapType) const;
 	Event executeAction(const Action *act, const Event &incomingEvent);
 	EventType convertStartToEnd(EventType eventType);
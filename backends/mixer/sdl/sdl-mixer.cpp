@@ -38,9 +38,18 @@
 #define SAMPLES_PER_SEC 44100
 #endif
 
+SdlMixerManager::SdlMixerManager()
+	: _adaptiveBufferSize(false), _bufferTunerID(0), _callbackBudget(0), _callbackOverruns(0) {
+}
+
 SdlMixerManager::~SdlMixerManager() {
 	_mixer->setReady(false);
 
+	if (_bufferTunerID) {
+		SDL_RemoveTimer(_bufferTunerID);
+		SDL_QuitSubSystem(SDL_INIT_TIMER);
+	}
+
 	SDL_CloseAudio();
 
 	SDL_QuitSubSystem(SDL_INIT_AUDIO);
@@ -111,10 +120,12 @@ void SdlMixerManager::init() {
 		error("SDL mixer output requires stereo output device");
 #endif
 
-	_mixer = new Audio::MixerImpl(_obtained.freq);
+	_mixer = new Audio::MixerImpl(_obtained.freq, _obtained.samples);
 	assert(_mixer);
 	_mixer->setReady(true);
 
+	_callbackBudget = _obtained.samples * 1000 / _obtained.freq;
+
 	startAudio();
 }
 
@@ -160,13 +171,14 @@ SDL_AudioSpec SdlMixerManager::getAudioSpec(uint32 outputRate) {
 
 	// 256 is an arbitrary minimum; 32768 is the largest power-of-two value
 	// representable with uint16
-	if (samples < 256 || samples > 32768)
-		// By default, hold no more than 45ms worth of samples to avoid
-		// perceptable audio lag (ATSC IS-191). For reference, DOSBox (as of Sep
-		// 2017) uses a buffer size of 1024 samples by default for a 16-bit
-		// stereo 44kHz mixer, which happens to be the next lowest power of two
-		// below 45ms.
-		samples = freq / (1000.0 / 45);
+	if (samples < 256 || samples > 32768) {
+		// By default, start with no more than 20ms worth of samples so that
+		// rhythm-sensitive games see low latency. This is well below the 45ms
+		// lag perception threshold (ATSC IS-191); the buffer tuner grows the
+		// buffer at runtime should the mixer fail to sustain this rate.
+		samples = freq / (1000.0 / 20);
+		_adaptiveBufferSize = true;
+	}
 
 	memset(&desired, 0, sizeof(desired));
 	desired.freq = freq;
@@ -180,13 +192,29 @@ SDL_AudioSpec SdlMixerManager::getAudioSpec(uint32 outputRate) {
 }
 
 void SdlMixerManager::startAudio() {
+	// Monitor the mixing callback so the buffer can be grown if the mixer
+	// cannot keep up with the current size.
+	if (_adaptiveBufferSize && !_bufferTunerID) {
+		if (SDL_InitSubSystem(SDL_INIT_TIMER) == -1)
+			warning("Could not initialize SDL: %s", SDL_GetError());
+		else
+			_bufferTunerID = SDL_AddTimer(1000, &bufferTunerCallback, this);
+	}
+
 	// Start the sound system
 	SDL_PauseAudio(0);
 }
 
 void SdlMixerManager::callbackHandler(byte *samples, int len) {
 	assert(_mixer);
+
+	const uint32 start = SDL_GetTicks();
 	_mixer->mixCallback(samples, len);
+
+	// Mixing which eats more than half the time the buffer lasts is at risk
+	// of underrunning the device; let the buffer tuner know.
+	if (_adaptiveBufferSize && SDL_GetTicks() - start > _callbackBudget / 2)
+		_callbackOverruns++;
 }
 
 void SdlMixerManager::sdlCallback(void *this_, byte *samples, int len) {
@@ -196,9 +224,66 @@ void SdlMixerManager::sdlCallback(void *this_, byte *samples, int len) {
 	manager->callbackHandler(samples, len);
 }
 
-void SdlMixerManager::suspendAudio() {
+void SdlMixerManager::adjustBufferSize() {
+	// The flag is raised before the device is closed, which keeps the tuner
+	// from reopening a suspended device.
+	if (_audioSuspended)
+		return;
+
+	// Keep the audio callback from running while the counter is read back
+	SDL_LockAudio();
+	const uint32 overruns = _callbackOverruns;
+	_callbackOverruns = 0;
+	SDL_UnlockAudio();
+
+	// A single spike is tolerable; only grow on sustained pressure
+	if (overruns < 2)
+		return;
+
+	// 32768 is the largest power-of-two value representable with uint16
+	if (_obtained.samples > 32768 / 2)
+		return;
+
+	// Reopening the device discards whatever SDL has buffered, so wait for a
+	// moment where nothing is playing.
+	for (int i = Audio::Mixer::kPlainSoundType; i <= Audio::Mixer::kSpeechSoundType; ++i)
+		if (_mixer->hasActiveChannelOfType((Audio::Mixer::SoundType)i))
+			return;
+
+	const uint16 oldSamples = _obtained.samples;
+
 	SDL_CloseAudio();
+
+	_obtained.samples = oldSamples * 2;
+	if (SDL_OpenAudio(&_obtained, nullptr) != 0) {
+		// Fall back to the old size rather than losing audio entirely
+		_obtained.samples = oldSamples;
+		if (SDL_OpenAudio(&_obtained, nullptr) != 0) {
+			warning("Could not open audio device: %s", SDL_GetError());
+			_mixer->setReady(false);
+			return;
+		}
+	}
+
+	SDL_PauseAudio(0);
+
+	_callbackBudget = _obtained.samples * 1000 / _obtained.freq;
+	_mixer->setOutputBufSize(_obtained.samples);
+
+	debug(2, "SDL mixer output buffer size grown to %d samples", _obtained.samples);
+}
+
+Uint32 SdlMixerManager::bufferTunerCallback(Uint32 interval, void *this_) {
+	SdlMixerManager *manager = (SdlMixerManager *)this_;
+	assert(manager);
+
+	manager->adjustBufferSize();
+	return interval;
+}
+
+void SdlMixerManager::suspendAudio() {
 	_audioSuspended = true;
+	SDL_CloseAudio();
 }
 
 int SdlMixerManager::resumeAudio() {
@@ -34,6 +34,7 @@
  */
 class SdlMixerManager : public MixerManager {
 public:
+	SdlMixerManager();
 	virtual ~SdlMixerManager();
 
 	/**
@@ -80,6 +81,38 @@ protected:
 	 * by subclasses, so it invokes the non-static function callbackHandler()
 	 */
 	static void sdlCallback(void *this_, byte *samples, int len);
+
+	/**
+	 * Whether the audio buffer size may be grown at runtime. Set when the
+	 * user did not pin a size via the audio_buffer_size setting.
+	 */
+	bool _adaptiveBufferSize;
+
+	/**
+	 * Timer checking periodically whether the audio buffer needs to grow.
+	 */
+	SDL_TimerID _bufferTunerID;
+
+	/**
+	 * Time budget of a single audio callback before it risks underrunning
+	 * the device buffer (in milliseconds).
+	 */
+	uint32 _callbackBudget;
+
+	/**
+	 * Number of over-budget audio callbacks since the last tuner check.
+	 */
+	uint32 _callbackOverruns;
+
+	/**
+	 * Grows the audio buffer when callbacks keep exceeding their budget.
+	 */
+	virtual void adjustBufferSize();
+
+	/**
+	 * The buffer tuner entry point, run from an SDL timer.
+	 */
+	static Uint32 bufferTunerCallback(Uint32 interval, void *this_);
 };
 
 #endif
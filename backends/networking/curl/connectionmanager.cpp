@@ -38,9 +38,37 @@ DECLARE_SINGLETON(Networking::ConnectionManager);
 
 namespace Networking {
 
-ConnectionManager::ConnectionManager(): _multi(nullptr), _timerStarted(false), _frame(0) {
+static void curlShareLockCallback(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
+	((Common::Mutex *)userptr)->lock();
+}
+
+static void curlShareUnlockCallback(CURL *handle, curl_lock_data data, void *userptr) {
+	((Common::Mutex *)userptr)->unlock();
+}
+
+ConnectionManager::ConnectionManager(): _multi(nullptr), _share(nullptr), _timerStarted(false), _frame(0) {
 	curl_global_init(CURL_GLOBAL_ALL);
 	_multi = curl_multi_init();
+
+	// Keep a few finished connections around for reuse instead of
+	// reconnecting (and re-resolving) per request.
+	curl_multi_setopt(_multi, CURLMOPT_MAXCONNECTS, 10L);
+
+	// Share DNS lookups and SSL sessions between all easy handles. A single
+	// lock for all share data is sufficient: easy handles are set up on the
+	// main thread but driven from the timer thread.
+	_share = curl_share_init();
+	if (_share) {
+		curl_share_setopt(_share, CURLSHOPT_USERDATA, &_shareDataMutex);
+		curl_share_setopt(_share, CURLSHOPT_LOCKFUNC, curlShareLockCallback);
+		curl_share_setopt(_share, CURLSHOPT_UNLOCKFUNC, curlShareUnlockCallback);
+		curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+		// Sharing the connection cache itself is available since 7.57.0
+		curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+	}
 }
 
 ConnectionManager::~ConnectionManager() {
@@ -61,8 +89,11 @@ ConnectionManager::~ConnectionManager() {
 
 	//cleanup
 	curl_multi_cleanup(_multi);
+	if (_share)
+		curl_share_cleanup(_share);
 	curl_global_cleanup();
 	_multi = nullptr;
+	_share = nullptr;
 	_handleMutex.unlock();
 }
 
@@ -31,6 +31,7 @@
 
 typedef void CURL;
 typedef void CURLM;
+typedef void CURLSH;
 struct curl_slist;
 
 namespace Networking {
@@ -76,9 +77,10 @@ class ConnectionManager : public Common::Singleton<ConnectionManager> {
 	};
 
 	CURLM *_multi;
+	CURLSH *_share;
 	bool _timerStarted;
 	Common::Array<RequestWithCallback> _requests, _addedRequests;
-	Common::Mutex _handleMutex, _addedRequestsMutex;
+	Common::Mutex _handleMutex, _addedRequestsMutex, _shareDataMutex;
 	uint32 _frame;
 
 	void startTimer(int interval = TIMER_INTERVAL);
@@ -99,6 +101,15 @@ public:
 	 */
 	void registerEasyHandle(CURL *easy) const;
 
+	/**
+	 * Returns the share handle all easy handles should use (via
+	 * CURLOPT_SHARE), so DNS lookups, SSL sessions and connections are
+	 * reused between transfers instead of being redone per request.
+	 *
+	 * May return nullptr when the share handle could not be created.
+	 */
+	CURLSH *getShareHandle() const { return _share; }
+
 	/**
 	 * Use this method to add new Request into manager's queue.
 	 * Manager will periodically call handle() method of these
@@ -101,6 +101,15 @@ void NetworkReadStream::initCurl(const char *url, curl_slist *headersList) {
 		curl_easy_setopt(_easy, CURLOPT_CAINFO, caCertPath);
 	}
 
+	CURLSH *share = ConnMan.getShareHandle();
+	if (share) {
+		// Reuse DNS lookups, SSL sessions and (with newer libcurl)
+		// connections across all easy handles, and keep resolved hosts
+		// around longer than curl's 60 seconds default.
+		curl_easy_setopt(_easy, CURLOPT_SHARE, share);
+		curl_easy_setopt(_easy, CURLOPT_DNS_CACHE_TIMEOUT, 300L);
+	}
+
 #if LIBCURL_VERSION_NUM >= 0x072000
 	// CURLOPT_XFERINFOFUNCTION introduced in libcurl 7.32.0
 	// CURLOPT_PROGRESSFUNCTION is used as a backup plan in case older version is used
@@ -52,12 +52,13 @@ typedef void (*sighandler_t)(int);
 #include "backends/mutex/null/null-mutex.h"
 #include "base/main.h"
 
+#include "backends/mixer/null/null-mixer.h"
+#include "backends/graphics/null/null-graphics.h"
+
 #ifndef NULL_DRIVER_USE_FOR_TEST
 #include "backends/saves/default/default-saves.h"
 #include "backends/timer/default/default-timer.h"
 #include "backends/events/default/default-events.h"
-#include "backends/mixer/null/null-mixer.h"
-#include "backends/graphics/null/null-graphics.h"
 #include "gui/debugger.h"
 #endif
 
@@ -96,6 +97,17 @@ public:
 
 	virtual void addSysArchivesToSearchSet(Common::SearchSet &s, int priority);
 
+#ifdef NULL_DRIVER_USE_FOR_TEST
+	// Minimal manager setup for the unit tests and benchmarks: enough
+	// for code querying the screen format or the mixer, without the
+	// manager checks a full initBackend() would run.
+	void initTestManagers() {
+		_graphicsManager = new NullGraphicsManager();
+		_mixerManager = new NullMixerManager();
+		_mixerManager->init();
+	}
+#endif
+
 private:
 #ifdef POSIX
 	timeval _startTime;
@@ -28,12 +28,43 @@
 #include "backends/plugins/elf/memory-manager.h"
 
 #include "common/debug.h"
+#include "common/endian.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/ptr.h"
 
 #include <malloc.h>	// for memalign()
 
+/**
+ * Header of the prelinked plugin cache written next to the plugin file.
+ * The cached image is only valid for the exact plugin build it was made
+ * from (checked via the source file size and ELF header) and the exact
+ * address the segment was relocated for, so all fields are stored in
+ * native endianness and layout -- the file never travels between targets.
+ */
+struct PrelinkedPluginHeader {
+	uint32 magic;
+	uint32 version;
+	uint32 sourceSize;
+	Elf32_Ehdr sourceEhdr;
+	uint32 segmentAddr;
+	uint32 segmentVMA;
+	uint32 segmentSize;
+	uint32 segmentAlign;
+	uint32 segmentFlags;
+	uint32 symbolCount;
+	uint32 strtabSize;
+};
+
+enum {
+	kPrelinkedCacheMagic = MKTAG('P', 'L', 'N', 'K'),
+	kPrelinkedCacheVersion = 1
+};
+
+static Common::String getPrelinkedCachePath(const char *path) {
+	return Common::String(path) + ".prelink";
+}
+
 DLObject::DLObject() :
 	_file(0),
 	_segment(0),
@@ -42,6 +73,9 @@ DLObject::DLObject() :
 	_segmentSize(0),
 	_segmentOffset(0),
 	_segmentVMA(0),
+	_segmentAlign(0),
+	_segmentFlags(0),
+	_strtabSize(0),
 	_symbol_cnt(0),
 	_symtab_sect(-1),
 	_dtors_start(0),
@@ -61,6 +95,7 @@ void DLObject::discardSymtab() {
 	free(_strtab);
 	_strtab = 0;
 
+	_strtabSize = 0;
 	_symbol_cnt = 0;
 }
 
@@ -181,6 +216,8 @@ bool DLObject::loadSegment(Elf32_Phdr *phdr) {
 	// Get offset to load segment into
 	_segmentSize = phdr->p_memsz;
 	_segmentVMA = phdr->p_vaddr;
+	_segmentAlign = phdr->p_align;
+	_segmentFlags = phdr->p_flags;
 
 	// Set .bss segment to 0 if necessary
 	if (phdr->p_memsz > phdr->p_filesz) {
@@ -301,6 +338,8 @@ bool DLObject::loadStringTable(Elf32_Shdr *shdr) {
 		return false;
 	}
 
+	_strtabSize = shdr[string_sect].sh_size;
+
 	return true;
 }
 
@@ -416,6 +455,143 @@ bool DLObject::load() {
 	return true;
 }
 
+// Restore a previously relocated image from the prelinked cache next to
+// the plugin. The cached image is bound to the address the segment was
+// relocated for, so after allocating the segment we verify that the
+// memory manager handed back the same address (it does, as long as
+// plugins are loaded one at a time) and fall back to a full load
+// otherwise.
+bool DLObject::loadFromCache(const char *path) {
+	assert(_file);
+
+	if (!canCachePrelinkedImage())
+		return false;
+
+	Common::SeekableReadStream *cache =
+			Common::FSNode(getPrelinkedCachePath(path)).createReadStream();
+	if (!cache)
+		return false;
+
+	PrelinkedPluginHeader hdr;
+	Elf32_Ehdr ehdr;
+
+	bool valid = cache->read(&hdr, sizeof(hdr)) == sizeof(hdr) &&
+			hdr.magic == kPrelinkedCacheMagic &&
+			hdr.version == kPrelinkedCacheVersion &&
+			hdr.sourceSize == uint32(_file->size()) &&
+			_file->read(&ehdr, sizeof(ehdr)) == sizeof(ehdr) &&
+			!memcmp(&hdr.sourceEhdr, &ehdr, sizeof(ehdr));
+
+	// Rewind so that a fall back to load() starts from a clean slate
+	_file->seek(0, SEEK_SET);
+
+	if (!valid) {
+		debug(2, "elfloader: Stale prelinked cache for %s", path);
+		delete cache;
+		return false;
+	}
+
+	_segment = (byte *)allocateMemory(hdr.segmentAlign, hdr.segmentSize);
+
+	if (!_segment) {
+		delete cache;
+		return false;
+	}
+
+	if (Elf32_Addr(_segment) != hdr.segmentAddr) {
+		// The relocations in the cached image were resolved for a
+		// different base address, so the image is useless this time
+		debug(2, "elfloader: Prelinked cache for %s made for %x, got %p",
+				path, hdr.segmentAddr, (void *)_segment);
+		deallocateMemory(_segment, hdr.segmentSize);
+		_segment = 0;
+		delete cache;
+		return false;
+	}
+
+	_segmentSize = hdr.segmentSize;
+	_segmentVMA = hdr.segmentVMA;
+	_segmentAlign = hdr.segmentAlign;
+	_segmentFlags = hdr.segmentFlags;
+	_segmentOffset = ptrdiff_t(_segment) - _segmentVMA;
+	_symbol_cnt = hdr.symbolCount;
+	_strtabSize = hdr.strtabSize;
+
+	if (!(_symtab = (Elf32_Sym *)malloc(hdr.symbolCount * sizeof(Elf32_Sym))) ||
+			!(_strtab = (char *)malloc(hdr.strtabSize))) {
+		warning("elfloader: Out of memory.");
+		unload();
+		delete cache;
+		return false;
+	}
+
+	if (cache->read(_segment, hdr.segmentSize) != hdr.segmentSize ||
+			cache->read(_symtab, hdr.symbolCount * sizeof(Elf32_Sym)) !=
+			hdr.symbolCount * sizeof(Elf32_Sym) ||
+			cache->read(_strtab, hdr.strtabSize) != hdr.strtabSize) {
+		warning("elfloader: Prelinked cache for %s is truncated.", path);
+		unload();
+		delete cache;
+		return false;
+	}
+
+	delete cache;
+
+	protectMemory(_segment, _segmentSize, _segmentFlags);
+
+	debug(2, "elfloader: Restored prelinked image for %s", path);
+
+	return true;
+}
+
+// Dump the relocated image to the prelinked cache so the next load is a
+// single read. Failure is not an error -- the plugin directory may well
+// live on read-only media.
+void DLObject::writeCache(const char *path) const {
+	assert(_file);
+
+	if (!canCachePrelinkedImage())
+		return;
+
+	PrelinkedPluginHeader hdr;
+
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = kPrelinkedCacheMagic;
+	hdr.version = kPrelinkedCacheVersion;
+	hdr.sourceSize = uint32(_file->size());
+	hdr.segmentAddr = Elf32_Addr(_segment);
+	hdr.segmentVMA = _segmentVMA;
+	hdr.segmentSize = _segmentSize;
+	hdr.segmentAlign = _segmentAlign;
+	hdr.segmentFlags = _segmentFlags;
+	hdr.symbolCount = _symbol_cnt;
+	hdr.strtabSize = _strtabSize;
+
+	if (!_file->seek(0, SEEK_SET) ||
+			_file->read(&hdr.sourceEhdr, sizeof(hdr.sourceEhdr)) != sizeof(hdr.sourceEhdr))
+		return;
+
+	Common::WriteStream *cache =
+			Common::FSNode(getPrelinkedCachePath(path)).createWriteStream();
+	if (!cache) {
+		debug(2, "elfloader: Cannot write prelinked cache for %s", path);
+		return;
+	}
+
+	cache->write(&hdr, sizeof(hdr));
+	cache->write(_segment, _segmentSize);
+	cache->write(_symtab, _symbol_cnt * sizeof(Elf32_Sym));
+	cache->write(_strtab, _strtabSize);
+	cache->finalize();
+
+	if (cache->err())
+		warning("elfloader: Failed writing prelinked cache for %s", path);
+	else
+		debug(2, "elfloader: Wrote prelinked cache for %s", path);
+
+	delete cache;
+}
+
 bool DLObject::open(const char *path) {
 	void *ctors_start, *ctors_end;
 
@@ -430,10 +606,15 @@ bool DLObject::open(const char *path) {
 
 	debug(2, "elfloader: %s found!", path);
 
-	/*Try to load and relocate*/
-	if (!load()) {
-		unload();
-		return false;
+	// Try the prelinked cache first; on a hit the load is a single read
+	if (!loadFromCache(path)) {
+		/*Try to load and relocate*/
+		if (!load()) {
+			unload();
+			return false;
+		}
+
+		writeCache(path);
 	}
 
 	debug(2, "elfloader: Loaded!");
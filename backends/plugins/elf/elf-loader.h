@@ -52,6 +52,9 @@ protected:
 	uint32 _segmentSize;
 	ptrdiff_t _segmentOffset;
 	uint32 _segmentVMA;
+	uint32 _segmentAlign;
+	uint32 _segmentFlags;
+	uint32 _strtabSize;
 
 	uint32 _symbol_cnt;
 	int32 _symtab_sect;
@@ -70,6 +73,17 @@ protected:
 	virtual void relocateSymbols(ptrdiff_t offset);
 	void discardSegment();
 
+	bool loadFromCache(const char *path);
+	void writeCache(const char *path) const;
+
+	/**
+	 * Whether the relocated image may be dumped to and restored from a
+	 * prelinked cache file next to the plugin. Targets that keep state
+	 * outside the main segment (e.g. the MIPS small data segment) must
+	 * override this to return false.
+	 */
+	virtual bool canCachePrelinkedImage() const { return true; }
+
 	// architecture specific
 
 	/**
@@ -42,6 +42,10 @@ protected:
 	virtual bool loadSegment(Elf32_Phdr *phdr);
 	virtual void unload();
 
+	// The shorts segment and gp-relative relocations live outside the
+	// main segment, so a cached image would be restored incomplete
+	virtual bool canCachePrelinkedImage() const { return false; }
+
 	void freeShortsSegment();
 
 public:
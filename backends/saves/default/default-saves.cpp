@@ -50,6 +50,67 @@
 const char *DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
+namespace {
+
+/**
+ * An OutSaveFile writing to a temporary file which is only moved over the
+ * real savefile once it has been finalized successfully. An interrupted
+ * write (crash, power loss, full disk) thus never destroys the previous
+ * save state.
+ */
+class AtomicOutSaveFile : public Common::OutSaveFile {
+public:
+	AtomicOutSaveFile(Common::WriteStream *w, const Common::String &tempPath, const Common::String &targetPath)
+		: Common::OutSaveFile(w), _tempPath(tempPath), _targetPath(targetPath), _finalized(false) {
+	}
+
+	~AtomicOutSaveFile() override {
+		// Close the underlying file before touching it on disk; some
+		// systems refuse to rename or remove an open file.
+		const bool commit = _finalized && !err();
+		delete _wrapped;
+		_wrapped = nullptr;
+
+		if (!commit) {
+			remove(_tempPath.c_str());
+			return;
+		}
+
+		// ISO C does not guarantee that rename() replaces an existing
+		// target, so retry after removing the old save explicitly.
+		if (rename(_tempPath.c_str(), _targetPath.c_str()) != 0) {
+			remove(_targetPath.c_str());
+			if (rename(_tempPath.c_str(), _targetPath.c_str()) != 0) {
+				warning("AtomicOutSaveFile: failed to commit '%s'", _targetPath.c_str());
+				remove(_tempPath.c_str());
+				return;
+			}
+		}
+
+		// Make sure a subsequent directory listing sees the new file even
+		// within the timestamp granularity.
+		Common::FSNode::clearListingCache();
+
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+		CloudMan.syncSaves();
+#endif
+	}
+
+	void finalize() override {
+		// The commit happens in the destructor, once the underlying file
+		// has been closed; cloud sync is likewise delayed until then.
+		_wrapped->finalize();
+		_finalized = true;
+	}
+
+private:
+	const Common::String _tempPath;
+	const Common::String _targetPath;
+	bool _finalized;
+};
+
+} // End of anonymous namespace
+
 DefaultSaveFileManager::DefaultSaveFileManager() {
 }
 
@@ -157,21 +218,30 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 
 	// Obtain node.
 	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
+	const Common::FSNode savePath(savePathName);
 	Common::FSNode fileNode;
 
 	// If the file did not exist before, we add it to the cache.
 	if (file == _saveFileCache.end()) {
-		const Common::FSNode savePath(savePathName);
 		fileNode = savePath.getChild(filename);
 	} else {
 		fileNode = file->_value;
 	}
 
+	// Write to a temporary file first; it is moved over the previous save
+	// when the stream is finalized and closed.
+	const Common::FSNode tempNode = savePath.getChild(filename + ".tmp");
+
 	// Open the file for saving.
-	Common::SeekableWriteStream *const sf = fileNode.createWriteStream();
+	Common::SeekableWriteStream *const sf = tempNode.createWriteStream();
 	if (!sf)
 		return nullptr;
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	// Favor compression speed over ratio here: large save states (HE games,
+	// event recordings) are written while the user waits, and a fast zlib
+	// level cuts that stall considerably for a modest size increase. The
+	// output is still a plain gzip stream, readable by older versions.
+	Common::WriteStream *const ws = compress ? Common::wrapCompressedWriteStream(sf, 1) : sf;
+	Common::OutSaveFile *const result = new AtomicOutSaveFile(ws, tempNode.getPath(), fileNode.getPath());
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
@@ -215,8 +285,12 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 }
 
 Common::ErrorCode DefaultSaveFileManager::removeFile(const Common::String &filepath) {
-	if (remove(filepath.c_str()) == 0)
+	if (remove(filepath.c_str()) == 0) {
+		// Make sure a subsequent directory listing sees the removal even
+		// within the timestamp granularity.
+		Common::FSNode::clearListingCache();
 		return Common::kNoError;
+	}
 	if (errno == EACCES)
 		return Common::kWritePermissionDenied;
 	if (errno == ENOENT)
@@ -289,6 +363,9 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 
 	// Build the savefile name cache.
 	for (Common::FSList::const_iterator file = children.begin(), end = children.end(); file != end; ++file) {
+		// Never list temporary files left behind by interrupted saves.
+		if (file->getName().hasSuffix(".tmp"))
+			continue;
 		if (_saveFileCache.contains(file->getName())) {
 			warning("DefaultSaveFileManager::assureCached: Name clash when building cache, ignoring file '%s'", file->getName().c_str());
 		} else {
@@ -69,12 +69,23 @@ void speech_pause_callback(size_t msg_id, size_t client_id, SPDNotificationType
 void *SpeechDispatcherManager::startSpeech(void *p) {
 	StartSpeechParams *params = (StartSpeechParams *) p;
 	pthread_mutex_lock(params->mutex);
+	// Claim one submission. If the queue was flushed since this worker was
+	// created, there is nothing left to claim and the utterance at the
+	// front (if any) belongs to a newer worker.
+	if (*params->pendingSubmissions <= 0) {
+		pthread_mutex_unlock(params->mutex);
+		return NULL;
+	}
+	(*params->pendingSubmissions)--;
 	if (!_connection || g_system->getTextToSpeechManager()->isPaused() ||
-			params->speechQueue->front().empty()) {
+			params->speechQueue->empty() || params->speechQueue->front().empty()) {
 		pthread_mutex_unlock(params->mutex);
 		return NULL;
 	}
-	if (spd_say(_connection, SPD_MESSAGE, params->speechQueue->front().c_str()) == -1) {
+	// Encode here on purpose: say() only queues the raw string, so the
+	// game thread never pays for the UTF-8 conversion.
+	Common::String strUtf8 = params->speechQueue->front().encode();
+	if (spd_say(_connection, SPD_MESSAGE, strUtf8.c_str()) == -1) {
 		// close the connection
 		if (_connection != 0) {
 			spd_close(_connection);
@@ -85,12 +96,38 @@ void *SpeechDispatcherManager::startSpeech(void *p) {
 	return NULL;
 }
 
+// Hands the front of the speech queue to a worker thread, so the game
+// thread never blocks on the speech-dispatcher IPC. Must be called without
+// _speechMutex held: a previously created worker may still be waiting for
+// the mutex, and it is joined here first.
+void SpeechDispatcherManager::startSpeechThread() {
+	if (_threadCreated) {
+		pthread_join(_thread, NULL);
+		_threadCreated = false;
+	}
+
+	pthread_mutex_lock(&_speechMutex);
+	_pendingSubmissions++;
+	pthread_mutex_unlock(&_speechMutex);
+
+	_threadCreated = true;
+	if (pthread_create(&_thread, NULL, startSpeech, &_params)) {
+		_threadCreated = false;
+		pthread_mutex_lock(&_speechMutex);
+		_pendingSubmissions--;
+		pthread_mutex_unlock(&_speechMutex);
+		warning("TTS: Cannot start new speech");
+	}
+}
+
 SpeechDispatcherManager::SpeechDispatcherManager()
 	: _speechState(READY) {
 	pthread_mutex_init(&_speechMutex, NULL);
 	_params.mutex = &_speechMutex;
 	_params.speechQueue = &_speechQueue;
+	_params.pendingSubmissions = &_pendingSubmissions;
 	_threadCreated = false;
+	_pendingSubmissions = 0;
 	init();
 }
 
@@ -139,7 +176,8 @@ void SpeechDispatcherManager::updateState(SpeechDispatcherManager::SpeechEvent e
 	if (_speechState == BROKEN)
 		return;
 	switch(event) {
-	case SPEECH_ENDED:
+	case SPEECH_ENDED: {
+		bool startNext = false;
 		pthread_mutex_lock(&_speechMutex);
 		_speechQueue.pop_front();
 		if (_speechQueue.empty())
@@ -148,18 +186,14 @@ void SpeechDispatcherManager::updateState(SpeechDispatcherManager::SpeechEvent e
 			// reinitialize if needed
 			if (!_connection)
 				init();
-			if (_speechState != BROKEN) {
-				if (_threadCreated)
-					pthread_join(_thread, NULL);
-				_threadCreated = true;
-				if (pthread_create(&_thread, NULL, startSpeech, &_params)) {
-					_threadCreated = false;
-					warning("TTS: Cannot start new speech");
-				}
-			}
+			if (_speechState != BROKEN)
+				startNext = true;
 		}
 		pthread_mutex_unlock(&_speechMutex);
+		if (startNext)
+			startSpeechThread();
 		break;
+	}
 	case SPEECH_PAUSED:
 		_speechState = PAUSED;
 		break;
@@ -193,32 +227,41 @@ bool SpeechDispatcherManager::say(const Common::U32String &str, Action action) {
 		return true;
 	}
 
-	Common::String strUtf8 = str.encode();
-
 	if (!_speechQueue.empty() && action == INTERRUPT_NO_REPEAT &&
-			_speechQueue.front() == strUtf8 && isSpeaking()) {
+			_speechQueue.front() == str && isSpeaking()) {
 		_speechQueue.clear();
-		_speechQueue.push_back(strUtf8);
+		_speechQueue.push_back(str);
 		pthread_mutex_unlock(&_speechMutex);
 		return true;
 	}
 
 	if (!_speechQueue.empty() && action == QUEUE_NO_REPEAT &&
-			_speechQueue.back() == strUtf8 && isSpeaking()) {
+			_speechQueue.back() == str && isSpeaking()) {
 		pthread_mutex_unlock(&_speechMutex);
 		return true;
 	}
 
 	pthread_mutex_unlock(&_speechMutex);
-	if (isSpeaking() && (action == INTERRUPT || action == INTERRUPT_NO_REPEAT))
-		stop();
-	if (!strUtf8.empty()) {
+	if (action == INTERRUPT || action == INTERRUPT_NO_REPEAT) {
+		if (isSpeaking()) {
+			stop();
+		} else {
+			// Coalesce: drop utterances that are queued but not submitted
+			// yet, so an interrupting utterance never waits behind stale
+			// ones (the GUI queues one per hovered element).
+			pthread_mutex_lock(&_speechMutex);
+			_speechQueue.clear();
+			_pendingSubmissions = 0;
+			pthread_mutex_unlock(&_speechMutex);
+		}
+	}
+	if (!str.empty()) {
 		pthread_mutex_lock(&_speechMutex);
-		_speechQueue.push_back(strUtf8);
+		_speechQueue.push_back(str);
 		pthread_mutex_unlock(&_speechMutex);
 		if (isReady()) {
 			_speechState = SPEAKING;
-			startSpeech((void *)(&_params));
+			startSpeechThread();
 		}
 	}
 
@@ -231,6 +274,7 @@ bool SpeechDispatcherManager::stop() {
 	_speechState = READY;
 	pthread_mutex_lock(&_speechMutex);
 	_speechQueue.clear();
+	_pendingSubmissions = 0;
 	bool result = spd_cancel(_connection) == -1;
 	pthread_mutex_unlock(&_speechMutex);
 	return result;
@@ -251,17 +295,12 @@ bool SpeechDispatcherManager::pause() {
 bool SpeechDispatcherManager::resume() {
 	if (_speechState == READY || _speechState == SPEAKING || _speechState == BROKEN)
 		return true;
-	// If there is a thread from before pause() waiting, let it finish (it shouln't
-	// do anything). There shouldn't be any other threads getting created,
-	// because the speech is paused, so we don't need to synchronize
-	if (_threadCreated) {
-		pthread_join(_thread, NULL);
-		_threadCreated = false;
-	}
+	// startSpeechThread() joins any thread left over from before pause()
+	// (it shouldn't do anything, its submission was consumed).
 	_speechState = PAUSED;
 	if (!_speechQueue.empty()) {
 		_speechState = SPEAKING;
-		startSpeech((void *) &_params);
+		startSpeechThread();
 	}
 	else
 		_speechState = READY;
@@ -37,7 +37,8 @@
 
 struct StartSpeechParams {
 	pthread_mutex_t *mutex;
-	Common::List<Common::String> *speechQueue;
+	Common::List<Common::U32String> *speechQueue;
+	int *pendingSubmissions;
 };
 
 class SpeechDispatcherManager : public Common::TextToSpeechManager {
@@ -86,13 +87,18 @@ private:
 	void createVoice(int typeNumber, Common::TTSVoice::Gender, Common::TTSVoice::Age, char *description);
 	Common::String strToUtf8(Common::String str, Common::String charset);
 	static void *startSpeech(void *p);
+	void startSpeechThread();
 
 	StartSpeechParams _params;
 	SpeechState _speechState;
-	Common::List<Common::String> _speechQueue;
+	Common::List<Common::U32String> _speechQueue;
 	pthread_mutex_t _speechMutex;
 	pthread_t _thread;
 	bool _threadCreated;
+	// Number of worker submissions that have been requested but not yet
+	// claimed by a worker thread. Zeroed when the queue is flushed, so a
+	// stale worker cannot submit an utterance queued after the flush.
+	int _pendingSubmissions;
 };
 
 #endif
@@ -22,6 +22,7 @@
 
 #include "common/scummsys.h"
 #include "backends/timer/default/default-timer.h"
+#include "common/debug.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -34,29 +35,57 @@ struct TimerSlot {
 	uint32 nextFireTime;	// in milliseconds
 	uint32 nextFireTimeMicro;	// microseconds part of nextFire
 
-	TimerSlot *next;
+	// The slots form a pairing heap ordered by nextFireTime: inserting
+	// a timer is O(1) and only removing the earliest one costs O(log n),
+	// so the work done under the mutex on each tick stays small even when
+	// engines install many high-frequency timers.
+	TimerSlot *firstChild;
+	TimerSlot *nextSibling;
 
-	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0), next(nullptr) {}
+	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0), firstChild(nullptr), nextSibling(nullptr) {}
 };
 
-void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
-	// The head points to a fake anchor TimerSlot; this common
-	// trick allows us to get rid of many special cases.
-
-	const uint32 nextFireTime = newSlot->nextFireTime;
-	TimerSlot *slot = head;
-	newSlot->next = nullptr;
-
-	// Insert the new slot into the sorted list of already scheduled
-	// timers in such a way that the list stays sorted...
-	while (true) {
-		assert(slot);
-		if (slot->next == nullptr || nextFireTime < slot->next->nextFireTime) {
-			newSlot->next = slot->next;
-			slot->next = newSlot;
-			return;
-		}
-		slot = slot->next;
+/** Merge two pairing heaps: the one firing later becomes a child of the other. */
+static TimerSlot *mergeHeaps(TimerSlot *a, TimerSlot *b) {
+	if (!a)
+		return b;
+	if (!b)
+		return a;
+	if (b->nextFireTime < a->nextFireTime)
+		SWAP(a, b);
+	b->nextSibling = a->firstChild;
+	a->firstChild = b;
+	return a;
+}
+
+/** Standard two-pass merge of a pairing heap's sibling list, used after removing the minimum. */
+static TimerSlot *mergeSiblingPairs(TimerSlot *first) {
+	if (!first || !first->nextSibling)
+		return first;
+
+	TimerSlot *a = first;
+	TimerSlot *b = a->nextSibling;
+	TimerSlot *rest = b->nextSibling;
+	a->nextSibling = nullptr;
+	b->nextSibling = nullptr;
+	return mergeHeaps(mergeHeaps(a, b), mergeSiblingPairs(rest));
+}
+
+/** Remove the earliest-firing slot from the heap and return it, detached. */
+static TimerSlot *popMin(TimerSlot *&root) {
+	TimerSlot *min = root;
+	root = mergeSiblingPairs(min->firstChild);
+	min->firstChild = nullptr;
+	min->nextSibling = nullptr;
+	return min;
+}
+
+static void freeHeap(TimerSlot *slot) {
+	while (slot) {
+		TimerSlot *next = slot->nextSibling;
+		freeHeap(slot->firstChild);
+		delete slot;
+		slot = next;
 	}
 }
 
@@ -65,18 +94,16 @@ DefaultTimerManager::DefaultTimerManager() :
 	_timerCallbackNext(0),
 	_head(nullptr) {
 
+	// The head is a fake anchor TimerSlot whose firstChild is the root of
+	// the heap of scheduled timers; this common trick allows us to get rid
+	// of many special cases.
 	_head = new TimerSlot();
 }
 
 DefaultTimerManager::~DefaultTimerManager() {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-	while (slot) {
-		TimerSlot *next = slot->next;
-		delete slot;
-		slot = next;
-	}
+	freeHeap(_head);
 	_head = nullptr;
 }
 
@@ -90,13 +117,23 @@ void DefaultTimerManager::handler() {
 		return;
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
-	TimerSlot *slot = _head->next;
+	TimerSlot *slot = _head->firstChild;
 	while (slot && slot->nextFireTime < curTime) {
-		// Remove the slot from the priority queue
-		_head->next = slot->next;
+		// Remove the slot from the heap
+		popMin(_head->firstChild);
+
+		// Track how late the callback fires; losing one or more whole
+		// intervals counts as a missed deadline.
+		const uint32 lateness = curTime - slot->nextFireTime;
+		++_stats.fires;
+		if (lateness >= slot->interval / 1000 + 1) {
+			++_stats.missedDeadlines;
+			if (lateness > _stats.maxLatenessMillis)
+				_stats.maxLatenessMillis = lateness;
+			debug(9, "DefaultTimerManager: timer '%s' fired %u ms late", slot->id.c_str(), lateness);
+		}
 
-		// Update the fire time and reinsert the TimerSlot into the priority
-		// queue.
+		// Update the fire time and reinsert the TimerSlot into the heap.
 		assert(slot->interval > 0);
 		slot->nextFireTime += (slot->interval / 1000);
 		slot->nextFireTimeMicro += (slot->interval % 1000);
@@ -104,14 +141,14 @@ void DefaultTimerManager::handler() {
 			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
 			slot->nextFireTimeMicro %= 1000;
 		}
-		insertPrioQueue(_head, slot);
+		_head->firstChild = mergeHeaps(_head->firstChild, slot);
 
 		// Invoke the timer callback
 		assert(slot->callback);
 		slot->callback(slot->refCon);
 
 		// Look at the next scheduled timer
-		slot = _head->next;
+		slot = _head->firstChild;
 	}
 }
 
@@ -125,6 +162,16 @@ void DefaultTimerManager::checkTimers(uint32 interval) {
 	}
 }
 
+DefaultTimerManager::TimerStats DefaultTimerManager::getStats() {
+	Common::StackLock lock(_mutex);
+	return _stats;
+}
+
+void DefaultTimerManager::resetStats() {
+	Common::StackLock lock(_mutex);
+	_stats = TimerStats();
+}
+
 bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, void *refCon, const Common::String &id) {
 	assert(interval > 0);
 	Common::StackLock lock(_mutex);
@@ -150,9 +197,8 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 	slot->interval = interval;
 	slot->nextFireTime = g_system->getMillis() + interval / 1000;
 	slot->nextFireTimeMicro = interval % 1000;
-	slot->next = nullptr;
 
-	insertPrioQueue(_head, slot);
+	_head->firstChild = mergeHeaps(_head->firstChild, slot);
 
 	return true;
 }
@@ -160,17 +206,18 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-
-	while (slot->next) {
-		if (slot->next->callback == callback) {
-			TimerSlot *next = slot->next->next;
-			delete slot->next;
-			slot->next = next;
-		} else {
-			slot = slot->next;
-		}
+	// Drain the heap, dropping the slots belonging to the removed callback
+	// and rebuilding the heap from the others.
+	TimerSlot *oldRoot = _head->firstChild;
+	TimerSlot *newRoot = nullptr;
+	while (oldRoot) {
+		TimerSlot *slot = popMin(oldRoot);
+		if (slot->callback == callback)
+			delete slot;
+		else
+			newRoot = mergeHeaps(newRoot, slot);
 	}
+	_head->firstChild = newRoot;
 
 	// We need to remove all names referencing the timer proc here.
 	//
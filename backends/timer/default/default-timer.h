@@ -41,11 +41,33 @@ private:
 	uint32 _timerCallbackNext;
 
 public:
+	/**
+	 * Scheduling statistics, for debugging timer-heavy engines.
+	 */
+	struct TimerStats {
+		uint32 fires;		///< total number of timer callbacks invoked
+		uint32 missedDeadlines;	///< fires that were at least one full timer interval late
+		uint32 maxLatenessMillis;	///< worst observed lateness, in milliseconds
+
+		TimerStats() : fires(0), missedDeadlines(0), maxLatenessMillis(0) {}
+	};
+
 	DefaultTimerManager();
 	virtual ~DefaultTimerManager();
 	virtual bool installTimerProc(TimerProc proc, int32 interval, void *refCon, const Common::String &id);
 	virtual void removeTimerProc(TimerProc proc);
 
+	/** Return a copy of the scheduling statistics gathered so far. */
+	TimerStats getStats();
+
+	/** Reset the scheduling statistics, e.g. after printing them. */
+	void resetStats();
+
+private:
+	TimerStats _stats;
+
+public:
+
 	/**
 	 * Timer callback, to be invoked at regular time intervals by the backend.
 	 */
@@ -0,0 +1,190 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// The benchmark report is meant to be machine-readable output on stdout,
+// just like the listing commands in commandLine.cpp.
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+
+#include "base/benchmark.h"
+
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/events.h"
+#include "common/fs.h"
+#include "common/str.h"
+#include "common/stream.h"
+#include "common/system.h"
+
+namespace Base {
+
+struct BenchmarkPhase {
+	Common::String name;
+	uint32 start;
+	uint32 end;
+};
+
+struct BenchmarkState {
+	Common::Array<BenchmarkPhase> phases;
+	Common::Array<uint32> frameTimes;
+	uint32 maxFrames;
+	uint32 lastFrameTime;
+	bool quitPushed;
+
+	BenchmarkState() : maxFrames(0), lastFrameTime(0), quitPushed(false) {}
+};
+
+// Allocated on demand so that the default build path has no global
+// constructor to run.
+static BenchmarkState *s_benchmark = nullptr;
+
+void benchmarkEnable(uint32 maxFrames) {
+	if (!s_benchmark)
+		s_benchmark = new BenchmarkState();
+	s_benchmark->maxFrames = maxFrames;
+}
+
+bool benchmarkEnabled() {
+	return s_benchmark != nullptr;
+}
+
+void benchmarkPhaseBegin(const char *name) {
+	if (!s_benchmark)
+		return;
+
+	BenchmarkPhase phase;
+	phase.name = name;
+	phase.start = g_system->getMillis();
+	phase.end = phase.start;
+	s_benchmark->phases.push_back(phase);
+}
+
+void benchmarkPhaseEnd(const char *name) {
+	if (!s_benchmark)
+		return;
+
+	// Phases may nest (engine-init inside engine-run would not, but be
+	// safe), so close the most recent open phase with a matching name.
+	for (int i = (int)s_benchmark->phases.size() - 1; i >= 0; --i) {
+		BenchmarkPhase &phase = s_benchmark->phases[i];
+		if (phase.name == name) {
+			phase.end = g_system->getMillis();
+			return;
+		}
+	}
+}
+
+void benchmarkFrame() {
+	if (!s_benchmark)
+		return;
+
+	uint32 now = g_system->getMillis();
+	if (s_benchmark->lastFrameTime != 0)
+		s_benchmark->frameTimes.push_back(now - s_benchmark->lastFrameTime);
+	s_benchmark->lastFrameTime = now;
+
+	if (s_benchmark->maxFrames != 0 && !s_benchmark->quitPushed &&
+			s_benchmark->frameTimes.size() >= s_benchmark->maxFrames) {
+		Common::Event event;
+		event.type = Common::EVENT_QUIT;
+		g_system->getEventManager()->pushEvent(event);
+		s_benchmark->quitPushed = true;
+	}
+}
+
+/**
+ * Return the peak resident set size in kilobytes, or -1 when the
+ * platform offers no way to query it.
+ */
+static long getPeakRSSKb() {
+#if defined(POSIX)
+	// Linux exposes the high water mark in /proc/self/status; on other
+	// POSIX systems the node simply does not exist.
+	Common::FSNode node("/proc/self/status");
+	Common::SeekableReadStream *stream = node.createReadStream();
+	if (!stream)
+		return -1;
+
+	long peakKb = -1;
+	while (!stream->eos()) {
+		Common::String line = stream->readLine();
+		if (line.hasPrefix("VmHWM:")) {
+			peakKb = atol(line.c_str() + 6);
+			break;
+		}
+	}
+	delete stream;
+	return peakKb;
+#else
+	return -1;
+#endif
+}
+
+/** Return the given percentile from an already sorted list of samples. */
+static uint32 percentile(const Common::Array<uint32> &sorted, int pct) {
+	if (sorted.empty())
+		return 0;
+
+	uint index = (uint)((sorted.size() - 1) * pct / 100);
+	return sorted[index];
+}
+
+void benchmarkDump() {
+	if (!s_benchmark)
+		return;
+
+	printf("{\n");
+
+	printf("  \"phases\": [\n");
+	for (uint i = 0; i < s_benchmark->phases.size(); ++i) {
+		const BenchmarkPhase &phase = s_benchmark->phases[i];
+		printf("    {\"name\": \"%s\", \"ms\": %u}%s\n",
+		       phase.name.c_str(), phase.end - phase.start,
+		       (i + 1 < s_benchmark->phases.size()) ? "," : "");
+	}
+	printf("  ],\n");
+
+	Common::Array<uint32> sorted(s_benchmark->frameTimes);
+	Common::sort(sorted.begin(), sorted.end());
+
+	uint32 total = 0;
+	for (uint i = 0; i < sorted.size(); ++i)
+		total += sorted[i];
+
+	printf("  \"frames\": {\n");
+	printf("    \"count\": %u,\n", sorted.size());
+	printf("    \"avg_ms\": %.2f,\n", sorted.empty() ? 0.0 : (double)total / sorted.size());
+	printf("    \"p50_ms\": %u,\n", percentile(sorted, 50));
+	printf("    \"p90_ms\": %u,\n", percentile(sorted, 90));
+	printf("    \"p95_ms\": %u,\n", percentile(sorted, 95));
+	printf("    \"p99_ms\": %u,\n", percentile(sorted, 99));
+	printf("    \"max_ms\": %u\n", sorted.empty() ? 0 : sorted[sorted.size() - 1]);
+	printf("  },\n");
+
+	printf("  \"peak_rss_kb\": %ld\n", getPeakRSSKb());
+
+	printf("}\n");
+
+	delete s_benchmark;
+	s_benchmark = nullptr;
+}
+
+} // End of namespace Base
@@ -0,0 +1,62 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BASE_BENCHMARK_H
+#define BASE_BENCHMARK_H
+
+#include "common/scummsys.h"
+
+namespace Base {
+
+/**
+ * Support for the --benchmark command line option.
+ *
+ * When enabled, startup phases (plugin loading, backend init, game
+ * detection, engine init) and per-frame screen update times are
+ * collected while the target runs. After the given number of frames a
+ * quit event is pushed, and a JSON report with phase timings, frame
+ * time percentiles and the peak resident set size is printed to stdout
+ * on shutdown. This replaces external scripts that used to scrape this
+ * information from debug output.
+ */
+
+/** Enable benchmark collection; quit after maxFrames screen updates (0 = never). */
+void benchmarkEnable(uint32 maxFrames);
+
+/** Whether --benchmark was given. */
+bool benchmarkEnabled();
+
+/** Mark the start of a named startup phase. */
+void benchmarkPhaseBegin(const char *name);
+
+/** Mark the end of the named startup phase. */
+void benchmarkPhaseEnd(const char *name);
+
+/** Record one screen update; called by the backend from updateScreen(). */
+void benchmarkFrame();
+
+/** Print the JSON report to stdout, if benchmarking is enabled. */
+void benchmarkDump();
+
+} // End of namespace Base
+
+#endif
@@ -27,6 +27,7 @@
 
 #include <limits.h>
 
+#include "engines/advancedDetector.h"
 #include "engines/metaengine.h"
 #include "base/commandLine.h"
 #include "base/plugins.h"
@@ -133,6 +134,9 @@ static const char HELP_STRING[] =
 	"  --debugflags=FLAGS       Enable engine specific debug flags\n"
 	"                           (separated by commas)\n"
 	"  --debug-channels-only    Show only the specified debug channels\n"
+	"  --benchmark[=NUM]        Run the target for NUM frames (default: 600), then quit\n"
+	"                           and print phase timings, frame time percentiles and\n"
+	"                           peak memory usage as JSON on stdout\n"
 	"  -u, --dump-scripts       Enable script dumping if a directory called 'dumps'\n"
 	"                           exists in the current directory\n"
 	"\n"
@@ -612,6 +616,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_BOOL("debug-channels-only")
 			END_OPTION
 
+			DO_LONG_OPTION_OPT("benchmark", "600")
+			END_OPTION
+
 			DO_OPTION('e', "music-driver")
 			END_OPTION
 
@@ -1263,6 +1270,9 @@ static Common::String detectGames(const Common::String &path, const Common::Stri
 	Common::FSNode dir(path);
 	DetectedGames candidates = recListGames(dir, engineId, gameId, recursive);
 
+	// Persist the md5s computed during the scan for later runs
+	MD5Man.save();
+
 	if (candidates.empty()) {
 		printf("WARNING: ScummVM could not find any game in %s\n", dir.getPath().c_str());
 		if (noPath) {
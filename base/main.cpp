@@ -33,6 +33,7 @@
 
 #include "engines/engine.h"
 #include "engines/metaengine.h"
+#include "base/benchmark.h"
 #include "base/commandLine.h"
 #include "base/plugins.h"
 #include "base/version.h"
@@ -159,6 +160,8 @@ static Common::Error runGame(const Plugin *plugin, const Plugin *enginePlugin, O
 	assert(plugin);
 	assert(enginePlugin);
 
+	Base::benchmarkPhaseBegin("engine-init");
+
 	// Determine the game data path, for validation and error messages
 	Common::FSNode dir(ConfMan.get("path"));
 	Common::String target = ConfMan.getActiveDomainName();
@@ -316,7 +319,10 @@ static Common::Error runGame(const Plugin *plugin, const Plugin *enginePlugin, O
 	system.getEventManager()->purgeMouseEvents();
 
 	// Run the engine
+	Base::benchmarkPhaseEnd("engine-init");
+	Base::benchmarkPhaseBegin("engine-run");
 	Common::Error result = engine->run();
+	Base::benchmarkPhaseEnd("engine-run");
 
 	// Make sure we do not return to the launcher if this is not possible.
 	if (!engine->hasFeature(Engine::kSupportsReturnToLauncher))
@@ -450,6 +456,13 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	if (settings.contains("debug-channels-only"))
 		gDebugChannelsOnly = true;
 
+	// Enable the benchmark mode before the first measured phase (plugin
+	// loading) starts.
+	if (settings.contains("benchmark")) {
+		Base::benchmarkEnable((uint32)strtoul(settings["benchmark"].c_str(), nullptr, 10));
+		settings.erase("benchmark"); // This option should not be passed to ConfMan.
+	}
+
 
 	// Now we want to enable global flags if any
 	Common::StringTokenizer tokenizer(specialDebug, " ,");
@@ -462,9 +475,11 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	}
 
 	ConfMan.registerDefault("always_run_fallback_detection_extern", true);
+	Base::benchmarkPhaseBegin("plugin-load");
 	PluginManager::instance().init();
  	PluginManager::instance().loadAllPlugins(); // load plugins for cached plugin manager
 	PluginManager::instance().loadDetectionPlugin(); // load detection plugin for uncached plugin manager
+	Base::benchmarkPhaseEnd("plugin-load");
 
 	// If we received an invalid music parameter via command line we check this here.
 	// We can't check this before loading the music plugins.
@@ -506,7 +521,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 
 	// Init the backend. Must take place after all config data (including
 	// the command line params) was read.
+	Base::benchmarkPhaseBegin("backend-init");
 	system.initBackend();
+	Base::benchmarkPhaseEnd("backend-init");
 
 	// If we received an invalid graphics mode parameter via command line
 	// we check this here. We can't do it until after the backend is inited,
@@ -581,7 +598,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 		EngineMan.upgradeTargetIfNecessary(ConfMan.getActiveDomainName());
 
 		// Try to find a MetaEnginePlugin which feels responsible for the specified game.
+		Base::benchmarkPhaseBegin("detection");
 		const Plugin *plugin = detectPlugin();
+		Base::benchmarkPhaseEnd("detection");
 
 		// Then, get the relevant Engine plugin from MetaEngine.
 		const Plugin *enginePlugin = nullptr;
@@ -707,6 +726,10 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 			launcherDialog();
 		}
 	}
+
+	// Emit the benchmark report while the backend is still around
+	Base::benchmarkDump();
+
 #ifdef USE_CLOUD
 #ifdef USE_SDL_NET
 	Networking::LocalWebserver::destroy();
@@ -2,6 +2,7 @@ MODULE := base
 
 MODULE_OBJS := \
 	test_new_standards.o \
+	benchmark.o \
 	main.o \
 	commandLine.o \
 	plugins.o \
@@ -440,12 +440,49 @@ bool PluginManagerUncached::loadPluginByFileName(const Common::String &filename)
 		if (Common::String((*i)->getFileName()) == filename && (*i)->loadPlugin()) {
 			addToPluginsInMemList(*i);
 			_currentPlugin = i;
+			updateConfigWithCurrentPlugin();
+			if (_configDirty) {
+				ConfMan.flushToDisk();
+				_configDirty = false;
+			}
 			return true;
 		}
 	}
 	return false;
 }
 
+/**
+ * Record the engine ID of the currently loaded plugin in the
+ * 'engine_plugin_files' domain. While the one-plugin-at-a-time scans walk
+ * the plugin list anyway, this builds a complete engine ID to plugin file
+ * catalog as a side effect, so later runs can load any engine directly
+ * via loadPluginFromEngineId() instead of scanning every plugin again.
+ *
+ * The config is flushed lazily (see loadNextPlugin()) to avoid writing it
+ * out once per plugin during a scan.
+ **/
+void PluginManagerUncached::updateConfigWithCurrentPlugin() {
+	if (_currentPlugin == _allEnginePlugins.end() || !(*_currentPlugin)->getFileName())
+		return;
+	if ((*_currentPlugin)->getType() != PLUGIN_TYPE_ENGINE)
+		return;
+
+	// For engine plugins the plugin name is the engine ID
+	Common::String engineId = (*_currentPlugin)->getName();
+	if (engineId.empty())
+		return;
+
+	if (!ConfMan.hasMiscDomain("engine_plugin_files"))
+		ConfMan.addMiscDomain("engine_plugin_files");
+
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("engine_plugin_files");
+	assert(domain);
+	if (!domain->contains(engineId) || (*domain)[engineId] != (*_currentPlugin)->getFileName()) {
+		domain->setVal(engineId, (*_currentPlugin)->getFileName());
+		_configDirty = true;
+	}
+}
+
 /**
  * Update the config manager with a plugin file name that we found can handle
  * the engine.
@@ -515,6 +552,7 @@ void PluginManagerUncached::loadFirstPlugin() {
 	for (_currentPlugin = _allEnginePlugins.begin(); _currentPlugin != _allEnginePlugins.end(); ++_currentPlugin) {
 		if ((*_currentPlugin)->loadPlugin()) {
 			addToPluginsInMemList(*_currentPlugin);
+			updateConfigWithCurrentPlugin();
 			break;
 		}
 	}
@@ -529,9 +567,17 @@ bool PluginManagerUncached::loadNextPlugin() {
 	for (++_currentPlugin; _currentPlugin != _allEnginePlugins.end(); ++_currentPlugin) {
 		if ((*_currentPlugin)->loadPlugin()) {
 			addToPluginsInMemList(*_currentPlugin);
+			updateConfigWithCurrentPlugin();
 			return true;
 		}
 	}
+
+	// The scan is complete; write out whatever the catalog picked up along
+	// the way in one go.
+	if (_configDirty) {
+		ConfMan.flushToDisk();
+		_configDirty = false;
+	}
 	return false; // no more in list
 }
 
@@ -727,8 +773,9 @@ DetectionResults EngineManager::detectGames(const Common::FSList &fslist) const
 	// run detection for all of them.
 	plugins = getPlugins(PLUGIN_TYPE_ENGINE_DETECTION);
 
-	// Clear md5 cache before each detection starts, just in case.
-	MD5Man.clear();
+	// The md5 cache is keyed by full file paths, so entries stay valid
+	// across the per-directory calls of a mass add. It is cleared at the
+	// start of each user-initiated detection instead of here.
 
 	// Iterate over all known games and for each check if it might be
 	// the game in the presented directory.
@@ -374,9 +374,11 @@ protected:
 	PluginList::iterator _currentPlugin;
 
 	bool _isDetectionLoaded;
+	bool _configDirty;
 
-	PluginManagerUncached() : _isDetectionLoaded(false), _detectionPlugin(nullptr) {}
+	PluginManagerUncached() : _isDetectionLoaded(false), _detectionPlugin(nullptr), _configDirty(false) {}
 	bool loadPluginByFileName(const Common::String &filename);
+	void updateConfigWithCurrentPlugin();
 
 public:
 	void init() override;
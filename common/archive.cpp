@@ -93,6 +93,7 @@ void SearchSet::insert(const Node &node) {
 			break;
 	}
 	_list.insert(it, node);
+	_lookupCache.clear();
 }
 
 void SearchSet::add(const String &name, Archive *archive, int priority, bool autoFree) {
@@ -174,6 +175,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		_lookupCache.clear();
 	}
 }
 
@@ -188,6 +190,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	_lookupCache.clear();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -206,17 +209,34 @@ void SearchSet::setPriority(const String &name, int priority) {
 	insert(node);
 }
 
-bool SearchSet::hasFile(const Path &path) const {
-	if (path.empty())
-		return false;
+Archive *SearchSet::lookupArchive(const Path &path) const {
+	const String key = path.toString();
+
+	LookupCacheMap::iterator cached = _lookupCache.find(key);
+	if (cached != _lookupCache.end()) {
+		// Cached misses stay misses until the set changes. Cached hits are
+		// re-verified in case the archive contents changed behind our back.
+		if (!cached->_value || cached->_value->hasFile(path))
+			return cached->_value;
+	}
 
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(path))
-			return true;
+		if (it->_arc->hasFile(path)) {
+			_lookupCache[key] = it->_arc;
+			return it->_arc;
+		}
 	}
 
-	return false;
+	_lookupCache[key] = nullptr;
+	return nullptr;
+}
+
+bool SearchSet::hasFile(const Path &path) const {
+	if (path.empty())
+		return false;
+
+	return lookupArchive(path) != nullptr;
 }
 
 int SearchSet::listMatchingMembers(ArchiveMemberList &list, const Path &pattern) const {
@@ -243,22 +263,33 @@ const ArchiveMemberPtr SearchSet::getMember(const Path &path) const {
 	if (path.empty())
 		return ArchiveMemberPtr();
 
-	ArchiveNodeList::const_iterator it = _list.begin();
-	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(path))
-			return it->_arc->getMember(path);
-	}
+	Archive *arc = lookupArchive(path);
+	if (!arc)
+		return ArchiveMemberPtr();
 
-	return ArchiveMemberPtr();
+	return arc->getMember(path);
 }
 
 SeekableReadStream *SearchSet::createReadStreamForMember(const Path &path) const {
 	if (path.empty())
 		return nullptr;
 
+	Archive *arc = lookupArchive(path);
+	if (!arc)
+		return nullptr;
+
+	SeekableReadStream *stream = arc->createReadStreamForMember(path);
+	if (stream)
+		return stream;
+
+	// The resolving archive could not open the member after all; fall back
+	// to the remaining archives as the uncached walk would have done.
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
-		SeekableReadStream *stream = it->_arc->createReadStreamForMember(path);
+		if (it->_arc == arc)
+			continue;
+
+		stream = it->_arc->createReadStreamForMember(path);
 		if (stream)
 			return stream;
 	}
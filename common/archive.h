@@ -24,6 +24,8 @@
 #define COMMON_ARCHIVE_H
 
 #include "common/str.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/list.h"
 #include "common/path.h"
 #include "common/ptr.h"
@@ -162,11 +164,23 @@ class SearchSet : public Archive {
 	typedef List<Node> ArchiveNodeList;
 	ArchiveNodeList _list;
 
+	/**
+	 * Memoized lookup results: the archive that resolved a path, or 0 for
+	 * paths known not to resolve anywhere. Repeated opens and probes for
+	 * missing optional files then cost a single hash lookup instead of a
+	 * walk over all archives. Invalidated whenever the set changes.
+	 */
+	typedef HashMap<String, Archive *> LookupCacheMap;
+	mutable LookupCacheMap _lookupCache;
+
 	ArchiveNodeList::iterator find(const String &name);
 	ArchiveNodeList::const_iterator find(const String &name) const;
 
 	void insert(const Node& node); //!< Add an archive while keeping the list sorted by descending priority.
 
+	/** Finds the archive resolving the given path, using and filling the cache. */
+	Archive *lookupArchive(const Path &path) const;
+
 	bool _ignoreClashes;
 
 public:
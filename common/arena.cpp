@@ -0,0 +1,107 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/arena.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Common {
+
+enum {
+	// Matches the alignment malloc guarantees for ordinary object types.
+	ARENA_ALIGNMENT = 2 * sizeof(void *)
+};
+
+Arena::Arena(size_t blockSize)
+	: _curBlock(0), _next(nullptr), _remaining(0), _blockSize(blockSize) {
+	assert(blockSize > 0);
+}
+
+Arena::~Arena() {
+	for (uint i = 0; i < _blocks.size(); ++i)
+		::free(_blocks[i].start);
+}
+
+void Arena::appendBlock(size_t minSize) {
+	Block block;
+	block.size = MAX(minSize, _blockSize);
+	block.start = (byte *)::malloc(block.size);
+	if (!block.start)
+		error("Arena: failed to allocate a block of %u bytes", (uint)block.size);
+	_blocks.push_back(block);
+
+	// Let the blocks grow so a workload larger than anticipated does not
+	// degenerate into one malloc per blockSize bytes.
+	_blockSize *= 2;
+}
+
+void *Arena::alloc(size_t nbytes) {
+	nbytes = (nbytes + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+	if (nbytes > _remaining) {
+		// Advance to the next retained block able to serve the request,
+		// appending a fresh one when none is left.
+		uint next = _blocks.empty() ? 0 : _curBlock + 1;
+		while (next < _blocks.size() && _blocks[next].size < nbytes)
+			++next;
+		if (next >= _blocks.size()) {
+			appendBlock(nbytes);
+			next = _blocks.size() - 1;
+		}
+		_curBlock = next;
+		_next = _blocks[next].start;
+		_remaining = _blocks[next].size;
+	}
+
+	void *result = _next;
+	_next += nbytes;
+	_remaining -= nbytes;
+	return result;
+}
+
+void Arena::reset() {
+	_curBlock = 0;
+	if (_blocks.empty()) {
+		_next = nullptr;
+		_remaining = 0;
+	} else {
+		_next = _blocks[0].start;
+		_remaining = _blocks[0].size;
+	}
+}
+
+void Arena::releaseUnusedBlocks() {
+	while (_blocks.size() > 1) {
+		::free(_blocks.back().start);
+		_blocks.pop_back();
+	}
+	reset();
+}
+
+size_t Arena::totalSize() const {
+	size_t total = 0;
+	for (uint i = 0; i < _blocks.size(); ++i)
+		total += _blocks[i].size;
+	return total;
+}
+
+} // End of namespace Common
@@ -0,0 +1,118 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_ARENA_H
+#define COMMON_ARENA_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_arena Arena allocator
+ * @ingroup common_memory
+ *
+ * @brief Bump-pointer bulk allocation with wholesale reset.
+ * @{
+ */
+
+/**
+ * A region ("arena") allocator for bulk, short-lived allocations.
+ *
+ * Where MemoryPool serves many objects of one fixed size with individual
+ * free, an Arena serves allocations of arbitrary size with no individual
+ * free at all: alloc() just bumps a pointer inside a block, and reset()
+ * discards everything at once while keeping the blocks for reuse. A steady
+ * allocation pattern — per-frame rect lists, per-room scratch data — thus
+ * settles into doing no heap allocation at all.
+ *
+ * Destructors are NOT run for objects placed in an arena. Only use it for
+ * objects that do not own external resources (Rect, Point, POD structs).
+ */
+class Arena {
+	struct Block {
+		byte *start;
+		size_t size;
+	};
+
+	Array<Block> _blocks;	///< All blocks owned by the arena.
+	uint _curBlock;			///< Index of the block currently being bumped.
+	byte *_next;			///< Next free byte in the current block.
+	size_t _remaining;		///< Bytes left in the current block.
+	size_t _blockSize;		///< Size to use for the next fresh block.
+
+	void appendBlock(size_t minSize);
+
+	Arena(const Arena &);
+	Arena &operator=(const Arena &);
+
+public:
+	/**
+	 * Create an arena. The first block is only allocated when the first
+	 * alloc() call arrives.
+	 *
+	 * @param blockSize  granularity of the underlying block allocations.
+	 */
+	explicit Arena(size_t blockSize = 8192);
+	~Arena();
+
+	/**
+	 * Allocate nbytes from the arena. The result is aligned suitably for
+	 * any ordinary object type. Never returns NULL; like operator new, a
+	 * failure of the underlying allocation is fatal.
+	 */
+	void *alloc(size_t nbytes);
+
+	/**
+	 * Discard all allocations at once. The blocks are kept for reuse.
+	 */
+	void reset();
+
+	/**
+	 * Discard all allocations and release every block but the first back
+	 * to the system. Useful after an exceptional peak, e.g. a room that
+	 * needed far more scratch space than the rest of the game.
+	 */
+	void releaseUnusedBlocks();
+
+	/** Total number of bytes currently held in blocks. */
+	size_t totalSize() const;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+/**
+ * A custom placement new operator allocating from an Arena, mirroring the
+ * MemoryPool one. Keep in mind that the destructor of the object will not
+ * be called when the arena is reset.
+ */
+inline void *operator new(size_t nbytes, Common::Arena &arena) {
+	return arena.alloc(nbytes);
+}
+
+inline void operator delete(void *p, Common::Arena &arena) {
+}
+
+#endif
@@ -399,13 +399,7 @@ TEMPLATE bool BASESTRING::operator>=(const value_type *x) const {
 }
 
 TEMPLATE bool BASESTRING::contains(value_type x) const {
-	for (uint32 i = 0; i < _size; ++i) {
-		if (_str[i] == x) {
-			return true;
-		}
-	}
-
-	return false;
+	return find(x, 0) != npos;
 }
 
 TEMPLATE bool BASESTRING::contains(const BaseString &otherString) const {
@@ -541,6 +535,19 @@ TEMPLATE void BASESTRING::insertString(const BaseString &s, uint32 p) {
 }
 
 TEMPLATE uint32 BASESTRING::find(value_type x, uint32 pos) const {
+	if (pos >= _size)
+		return npos;
+
+	// For the byte-sized instantiation, defer to memchr, which every libc
+	// implements with vectorized scanning. The condition is a compile-time
+	// constant, so the unused branch is discarded.
+	if (sizeof(value_type) == 1) {
+		const void *hit = memchr((const void *)(_str + pos), (int)x, _size - pos);
+		if (!hit)
+			return npos;
+		return (uint32)((const value_type *)hit - _str);
+	}
+
 	for (uint32 i = pos; i < _size; ++i) {
 		if (_str[i] == x) {
 			return i;
@@ -87,29 +87,33 @@ private:
 
 	/** Fill the container with at least @p min bits. */
 	inline void fillContainer(size_t min) {
+		// Once a refill is needed, fill the container up completely rather
+		// than only to the requested minimum, so that the following reads
+		// don't have to come back here for every data value
 		while (_bitsLeft < min) {
-
-			uint64 data;
-			if (_pos + _bitsLeft + valueBits <= _size) {
-				data = readData();
-			} else {
-				// Peeking data out of bounds is well-defined and returns 0 bits.
-				// This is for convenience when using speed-up techniques reading
-				// more bits than actually available. Call eos() to check if data
-				// was actually read out of bounds. Peeking out of bounds does not
-				// set the eos flag.
-				data = 0;
-			}
-
-			// Move the data value to the right position in the bit container
-			if (MSB2LSB)
-				_bitContainer |= data << (64 - valueBits - _bitsLeft);
-			else
-				_bitContainer |= data << _bitsLeft;
-
-			_bitsLeft += valueBits;
+			do {
+				uint64 data;
+				if (_pos + _bitsLeft + valueBits <= _size) {
+					data = readData();
+				} else {
+					// Peeking data out of bounds is well-defined and returns 0 bits.
+					// This is for convenience when using speed-up techniques reading
+					// more bits than actually available. Call eos() to check if data
+					// was actually read out of bounds. Peeking out of bounds does not
+					// set the eos flag.
+					data = 0;
+				}
+
+				// Move the data value to the right position in the bit container
+				if (MSB2LSB)
+					_bitContainer |= data << (64 - valueBits - _bitsLeft);
+				else
+					_bitContainer |= data << _bitsLeft;
+
+				_bitsLeft += valueBits;
+			} while (_bitsLeft + valueBits <= 64);
 		}
-}
+	}
 
 	/** Get @p n bits from the bit container. */
 	inline static uint32 getNBits(uint64 value, size_t n) {
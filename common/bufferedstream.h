@@ -52,6 +52,24 @@ namespace Common {
  */
 ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream);
 
+/**
+ * Take an arbitrary ReadStream and wrap it in a stream that provides
+ * buffering with an adaptive readahead window: every sequential refill
+ * doubles the window, from bufSize up to maxBufSize. This suits streaming
+ * consumers (audio and video playback) reading from slow media, which are
+ * served with few, large requests once the sequential pattern is
+ * established.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ *
+ * @param parentStream        The ReadStream to wrap in a custom stream.
+ * @param bufSize             Initial size of the readahead window.
+ * @param maxBufSize          Upper limit the window may grow to.
+ * @param disposeParentStream Flag indicating whether to dispose of the wrapped stream.
+ */
+ReadStream *wrapAdaptiveBufferedReadStream(ReadStream *parentStream, uint32 bufSize, uint32 maxBufSize, DisposeAfterUse::Flag disposeParentStream);
+
 /**
  * Take an arbitrary SeekableReadStream and wrap it in a custom stream that
  * transparently provides buffering.
@@ -67,6 +85,23 @@ ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, Dis
  */
 SeekableReadStream *wrapBufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream);
 
+/**
+ * Take an arbitrary SeekableReadStream and wrap it in a stream that provides
+ * buffering with an adaptive readahead window, like
+ * wrapAdaptiveBufferedReadStream. A seek outside the buffered area shrinks
+ * the window back to bufSize, so random access does not pay for the larger
+ * reads.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ *
+ * @param parentStream        The SeekableReadStream to wrap in a custom stream.
+ * @param bufSize             Initial size of the readahead window.
+ * @param maxBufSize          Upper limit the window may grow to.
+ * @param disposeParentStream Flag indicating whether to dispose of the wrapped stream.
+ */
+SeekableReadStream *wrapAdaptiveBufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, uint32 maxBufSize, DisposeAfterUse::Flag disposeParentStream);
+
 /**
  * Take an arbitrary WriteStream and wrap it in a custom stream that
  * transparently provides buffering.
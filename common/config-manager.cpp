@@ -50,7 +50,7 @@ char const *const ConfigManager::kCloudDomain = "cloud";
 #pragma mark -
 
 
-ConfigManager::ConfigManager() : _activeDomain(nullptr) {
+ConfigManager::ConfigManager() : _activeDomain(nullptr), _structureDirty(true) {
 }
 
 void ConfigManager::defragment() {
@@ -118,6 +118,9 @@ void ConfigManager::loadConfigFile(const String &filename) {
 void ConfigManager::addDomain(const String &domainName, const ConfigManager::Domain &domain) {
 	if (domainName.empty())
 		return;
+
+	_structureDirty = true;
+
 	if (domainName == kApplicationDomain) {
 		_appDomain = domain;
 	} else if (domainName == kKeymapperDomain) {
@@ -170,38 +173,55 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	// TODO: Detect if a domain occurs multiple times (or likewise, if
 	// a key occurs multiple times inside one domain).
 
-	while (!stream.eos() && !stream.err()) {
+	// Read the whole file into memory at once and parse it from there.
+	// The parser has to look at every byte anyway, and going through the
+	// stream line by line does so via one virtual call per byte, which
+	// adds up with config files containing thousands of game targets.
+	int64 streamSize = stream.size();
+	if (streamSize < 0)
+		streamSize = 0;
+	char *buffer = new char[streamSize + 1];
+	uint32 size = stream.read(buffer, (uint32)streamSize);
+	buffer[size] = '\0';
+
+	const char *ptr = buffer;
+	const char *bufferEnd = buffer + size;
+
+	while (ptr < bufferEnd) {
 		lineno++;
 
-		// Read a line
-		String line = stream.readLine();
+		// Find the end of the current line. As with readLine(), a line may
+		// be terminated by LF, CR or CR/LF.
+		const char *lineEnd = ptr;
+		while (lineEnd < bufferEnd && *lineEnd != '\n' && *lineEnd != '\r')
+			lineEnd++;
 
-		if (line.size() == 0) {
+		if (lineEnd == ptr) {
 			// Do nothing
-		} else if (line[0] == '#') {
+		} else if (*ptr == '#') {
 			// Accumulate comments here. Once we encounter either the start
 			// of a new domain, or a key-value-pair, we associate the value
 			// of the 'comment' variable with that entity.
-			comment += line;
+			comment += String(ptr, lineEnd);
 			comment += "\n";
-		} else if (line[0] == '[') {
+		} else if (*ptr == '[') {
 			// It's a new domain which begins here.
 			// Determine where the previously accumulated domain goes, if we accumulated anything.
 			addDomain(domainName, domain);
 			domain.clear();
-			const char *p = line.c_str() + 1;
+			const char *p = ptr + 1;
 			// Get the domain name, and check whether it's valid (that
 			// is, verify that it only consists of alphanumerics,
 			// dashes and underscores).
-			while (*p && (isAlnum(*p) || *p == '-' || *p == '_'))
+			while (p < lineEnd && (isAlnum(*p) || *p == '-' || *p == '_'))
 				p++;
 
-			if (*p == '\0')
+			if (p == lineEnd)
 				error("Config file buggy: missing ] in line %d", lineno);
 			else if (*p != ']')
 				error("Config file buggy: Invalid character '%c' occurred in section name in line %d", *p, lineno);
 
-			domainName = String(line.c_str() + 1, p);
+			domainName = String(ptr + 1, p);
 
 			domain.setDomainComment(comment);
 			comment.clear();
@@ -210,46 +230,66 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			// This line should be a line with a 'key=value' pair, or an empty one.
 
 			// Skip leading whitespaces
-			const char *t = line.c_str();
-			while (isSpace(*t))
+			const char *t = ptr;
+			while (t < lineEnd && isSpace(*t))
 				t++;
 
 			// Skip empty lines / lines with only whitespace
-			if (*t == 0)
-				continue;
-
-			// If no domain has been set, this config file is invalid!
-			if (domainName.empty()) {
-				error("Config file buggy: Key/value pair found outside a domain in line %d", lineno);
+			if (t != lineEnd) {
+				// If no domain has been set, this config file is invalid!
+				if (domainName.empty()) {
+					error("Config file buggy: Key/value pair found outside a domain in line %d", lineno);
+				}
+
+				// Split string at '=' into 'key' and 'value'. First, find the "=" delimeter.
+				const char *p = t;
+				while (p < lineEnd && *p != '=')
+					p++;
+				if (p == lineEnd)
+					error("Config file buggy: Junk found in line line %d: '%s'", lineno, String(t, lineEnd).c_str());
+
+				// Extract the key/value pair
+				String key(t, p);
+				String value(p + 1, lineEnd);
+
+				// Trim of spaces
+				key.trim();
+				value.trim();
+
+				// Finally, store the key/value pair in the active domain
+				domain.setVal(key, value);
+
+				// Store comment
+				domain.setKVComment(key, comment);
+				comment.clear();
 			}
+		}
 
-			// Split string at '=' into 'key' and 'value'. First, find the "=" delimeter.
-			const char *p = strchr(t, '=');
-			if (!p)
-				error("Config file buggy: Junk found in line line %d: '%s'", lineno, t);
-
-			// Extract the key/value pair
-			String key(t, p);
-			String value(p + 1);
-
-			// Trim of spaces
-			key.trim();
-			value.trim();
-
-			// Finally, store the key/value pair in the active domain
-			domain.setVal(key, value);
-
-			// Store comment
-			domain.setKVComment(key, comment);
-			comment.clear();
+		// Skip the line terminator, treating CR/LF as a single one
+		if (lineEnd < bufferEnd) {
+			if (*lineEnd == '\r' && lineEnd + 1 < bufferEnd && lineEnd[1] == '\n')
+				ptr = lineEnd + 2;
+			else
+				ptr = lineEnd + 1;
+		} else {
+			ptr = lineEnd;
 		}
 	}
 
+	delete[] buffer;
+
 	addDomain(domainName, domain); // Add the last domain found
+
+	// Everything we just loaded is in sync with the file on disk
+	markAllDomainsClean();
 }
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	// Don't rewrite the file if nothing changed since the last load or flush
+	if (!_structureDirty && !anyDomainDirty())
+		return;
+
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -306,9 +346,48 @@ void ConfigManager::flushToDisk() {
 
 	delete stream;
 
+	markAllDomainsClean();
+
 #endif // !__DC__
 }
 
+bool ConfigManager::anyDomainDirty() const {
+	// The transient and defaults domains are never persisted, so their
+	// dirty state is irrelevant here.
+	if (_appDomain.isDirty() || _keymapperDomain.isDirty())
+		return true;
+#ifdef USE_CLOUD
+	if (_cloudDomain.isDirty())
+		return true;
+#endif
+
+	DomainMap::const_iterator d;
+	for (d = _miscDomains.begin(); d != _miscDomains.end(); ++d)
+		if (d->_value.isDirty())
+			return true;
+	for (d = _gameDomains.begin(); d != _gameDomains.end(); ++d)
+		if (d->_value.isDirty())
+			return true;
+
+	return false;
+}
+
+void ConfigManager::markAllDomainsClean() {
+	_appDomain.markClean();
+	_keymapperDomain.markClean();
+#ifdef USE_CLOUD
+	_cloudDomain.markClean();
+#endif
+
+	DomainMap::iterator d;
+	for (d = _miscDomains.begin(); d != _miscDomains.end(); ++d)
+		d->_value.markClean();
+	for (d = _gameDomains.begin(); d != _gameDomains.end(); ++d)
+		d->_value.markClean();
+
+	_structureDirty = false;
+}
+
 void ConfigManager::writeDomain(WriteStream &stream, const String &name, const Domain &domain) {
 	if (domain.empty())
 		return; // Don't bother writing empty domains.
@@ -655,12 +734,16 @@ void ConfigManager::removeGameDomain(const String &domName) {
 		_activeDomainName.clear();
 		_activeDomain = nullptr;
 	}
+	if (_gameDomains.contains(domName))
+		_structureDirty = true;
 	_gameDomains.erase(domName);
 }
 
 void ConfigManager::removeMiscDomain(const String &domName) {
 	assert(!domName.empty());
 	assert(isValidDomainName(domName));
+	if (_miscDomains.contains(domName))
+		_structureDirty = true;
 	_miscDomains.erase(domName);
 }
 
@@ -697,6 +780,8 @@ void ConfigManager::renameDomain(const String &oldName, const String &newName, D
 		newDom.setVal(iter->_key, iter->_value);
 
 	map.erase(oldName);
+
+	_structureDirty = true;
 }
 
 bool ConfigManager::hasGameDomain(const String &domName) const {
@@ -712,6 +797,7 @@ bool ConfigManager::hasMiscDomain(const String &domName) const {
 #pragma mark -
 
 void ConfigManager::Domain::setDomainComment(const String &comment) {
+	_dirty = true;
 	_domainComment = comment;
 }
 const String &ConfigManager::Domain::getDomainComment() const {
@@ -719,6 +805,7 @@ const String &ConfigManager::Domain::getDomainComment() const {
 }
 
 void ConfigManager::Domain::setKVComment(const String &key, const String &comment) {
+	_dirty = true;
 	_keyValueComments[key] = comment;
 }
 const String &ConfigManager::Domain::getKVComment(const String &key) const {
@@ -61,8 +61,11 @@ public:
 		StringMap _entries;
 		StringMap _keyValueComments;
 		String _domainComment;
+		bool _dirty;
 
 	public:
+		Domain() : _dirty(true) {}
+
 		typedef StringMap::const_iterator const_iterator;
 		const_iterator begin() const { return _entries.begin(); } /*!< Return the beginning position of configuration entries. */
 		const_iterator end()   const { return _entries.end(); }   /*!< Return the ending position of configuration entries. */
@@ -79,10 +82,10 @@ public:
 		 */
 		const String &operator[](const String &key) const { return _entries[key]; }
 
-		void           setVal(const String &key, const String &value) { _entries.setVal(key, value); } /*!< Assign a @p value to a @p key. */
+		void           setVal(const String &key, const String &value) { _dirty = true; _entries.setVal(key, value); } /*!< Assign a @p value to a @p key. */
 
-		String &getOrCreateVal(const String &key) { return _entries.getOrCreateVal(key); }
-		String        &getVal(const String &key) { return _entries.getVal(key); } /*!< Retrieve the value of a @p key. */
+		String &getOrCreateVal(const String &key) { _dirty = true; return _entries.getOrCreateVal(key); }
+		String        &getVal(const String &key) { _dirty = true; return _entries.getVal(key); } /*!< Retrieve the value of a @p key. */
 		const String  &getVal(const String &key) const { return _entries.getVal(key); } /*!< @overload */
 		 /**
 		  * Retrieve the value of @p key if it exists and leave the referenced variable unchanged if the key does not exist.
@@ -92,9 +95,12 @@ public:
 		const String &getValOrDefault(const String &key) const { return _entries.getValOrDefault(key); }
 		bool tryGetVal(const String &key, String &out) const { return _entries.tryGetVal(key, out); }
 
-		void           clear() { _entries.clear(); } /*!< Clear all configuration entries in the domain. */
+		void           clear() { _dirty = true; _entries.clear(); } /*!< Clear all configuration entries in the domain. */
+
+		void           erase(const String &key) { _dirty = true; _entries.erase(key); } /*!< Remove a key from the domain. */
 
-		void           erase(const String &key) { _entries.erase(key); } /*!< Remove a key from the domain. */
+		bool           isDirty() const { return _dirty; } /*!< Check whether the domain changed since it was last loaded or flushed. */
+		void           markClean() { _dirty = false; } /*!< Mark the domain as being in sync with the file on disk. */
 
 		void           setDomainComment(const String &comment); /*!< Add a @p comment for this configuration domain. */
 		const String  &getDomainComment() const; /*!< Retrieve the comment of this configuration domain. */
@@ -221,6 +227,9 @@ private:
 	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
 	void			renameDomain(const String &oldName, const String &newName, DomainMap &map);
 
+	bool			anyDomainDirty() const;
+	void			markAllDomainsClean();
+
 	Domain			_transientDomain;
 	DomainMap		_gameDomains;
 	DomainMap		_miscDomains; // Any other domains
@@ -239,6 +248,11 @@ private:
 	Domain *		_activeDomain;
 
 	String			_filename;
+
+	// Set when domains were added, removed or renamed since the last load
+	// or flush; together with the per-domain dirty flags this lets
+	// flushToDisk() skip rewriting an unchanged file.
+	bool			_structureDirty;
 };
 
 /** @} */
@@ -166,6 +166,7 @@ void CoroutineScheduler::reset() {
 
 	// no active processes
 	pCurrent = active->pNext = nullptr;
+	_pidRefs.clear();
 
 	// place first process on free list
 	pFreeProcesses = processList;
@@ -540,6 +541,9 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// set new process id
 	pProc->pid = pid;
 
+	// one more active process with this pid
+	_pidRefs[pid]++;
+
 	// set new process specific info
 	if (sizeParam) {
 		assert(sizeParam > 0 && sizeParam <= CORO_PARAM_SIZE);
@@ -581,6 +585,10 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 	delete pKillProc->state;
 	pKillProc->state = nullptr;
 
+	// one less active process with this pid
+	if (--_pidRefs[pKillProc->pid] <= 0)
+		_pidRefs.erase(pKillProc->pid);
+
 	// Take the process out of the active chain list
 	pKillProc->pPrevious->pNext = pKillProc->pNext;
 	if (pKillProc->pNext)
@@ -630,6 +638,10 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 				delete pProc->state;
 				pProc->state = nullptr;
 
+				// one less active process with this pid
+				if (--_pidRefs[pProc->pid] <= 0)
+					_pidRefs.erase(pProc->pid);
+
 				// make prev point to next to unlink pProc
 				pPrev->pNext = pProc->pNext;
 				if (pProc->pNext)
@@ -664,6 +676,11 @@ void CoroutineScheduler::setResourceCallback(VFPTRPP pFunc) {
 }
 
 PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
+	// The common reason to come here is checking whether something still
+	// runs; reject pids with no active process without walking the list
+	if (!_pidRefs.contains(pid))
+		return nullptr;
+
 	PROCESS *pProc = active->pNext;
 	while ((pProc != nullptr) && (pProc->pid != pid))
 		pProc = pProc->pNext;
@@ -672,14 +689,7 @@ PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
 }
 
 EVENT *CoroutineScheduler::getEvent(uint32 pid) {
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
-		if (evt->pid == pid)
-			return evt;
-	}
-
-	return nullptr;
+	return _eventMap.getValOrDefault(pid, nullptr);
 }
 
 
@@ -691,6 +701,7 @@ uint32 CoroutineScheduler::createEvent(bool bManualReset, bool bInitialState) {
 	evt->pulsing = false;
 
 	_events.push_back(evt);
+	_eventMap[evt->pid] = evt;
 	return evt->pid;
 }
 
@@ -698,6 +709,7 @@ void CoroutineScheduler::closeEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (evt) {
 		_events.remove(evt);
+		_eventMap.erase(pidEvent);
 		delete evt;
 	}
 }
@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/singleton.h"
 
@@ -362,6 +363,14 @@ private:
 	/** Event list. */
 	Common::List<EVENT *> _events;
 
+	/** Number of active processes per process ID, letting getProcess()
+	 * reject absent pids without walking the active list. Several
+	 * processes may share a pid (e.g. Tinsel's PID_TCODE). */
+	Common::HashMap<uint32, int> _pidRefs;
+
+	/** Event lookup by process ID. */
+	Common::HashMap<uint32, EVENT *> _eventMap;
+
 #ifdef DEBUG
 	/** Diagnostic process counters. */
 	int numProcs;
@@ -0,0 +1,85 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/cpuinfo.h"
+
+#if (defined(__i386__) || defined(__x86_64__)) && (defined(__GNUC__) || defined(__clang__))
+#define SCUMMVM_CPUINFO_X86_CPUID
+#include <cpuid.h>
+#elif (defined(_M_IX86) || defined(_M_X64)) && defined(_MSC_VER)
+#define SCUMMVM_CPUINFO_X86_CPUID_MSVC
+#include <intrin.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+struct CpuFeatures {
+	bool sse2;
+	bool avx2;
+	bool neon;
+
+	CpuFeatures() : sse2(false), avx2(false), neon(false) {
+#if defined(SCUMMVM_CPUINFO_X86_CPUID)
+		unsigned int eax, ebx, ecx, edx;
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+			sse2 = (edx & (1 << 26)) != 0;
+		if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+			avx2 = (ebx & (1 << 5)) != 0;
+#elif defined(SCUMMVM_CPUINFO_X86_CPUID_MSVC)
+		int regs[4];
+		__cpuid(regs, 0);
+		const int maxLeaf = regs[0];
+		__cpuid(regs, 1);
+		sse2 = (regs[3] & (1 << 26)) != 0;
+		if (maxLeaf >= 7) {
+			__cpuidex(regs, 7, 0);
+			avx2 = (regs[1] & (1 << 5)) != 0;
+		}
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+		neon = true;
+#endif
+	}
+};
+
+const CpuFeatures &getCpuFeatures() {
+	static const CpuFeatures features;
+	return features;
+}
+
+} // End of anonymous namespace
+
+bool hasCpuFeatureSSE2() {
+	return getCpuFeatures().sse2;
+}
+
+bool hasCpuFeatureAVX2() {
+	return getCpuFeatures().avx2;
+}
+
+bool hasCpuFeatureNEON() {
+	return getCpuFeatures().neon;
+}
+
+} // End of namespace Common
@@ -0,0 +1,72 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_CPUINFO_H
+#define COMMON_CPUINFO_H
+
+#include "common/scummsys.h"
+
+/**
+ * @defgroup common_cpuinfo Runtime CPU feature detection
+ * @ingroup common
+ *
+ * @brief  Helpers to query SIMD capabilities of the host CPU at runtime.
+ *
+ * Code with vectorized fast paths should use these queries to pick a kernel
+ * once (e.g. into a function pointer) and keep a scalar fallback for CPUs
+ * that lack the extension. The results are computed on first use and cached,
+ * so the queries are cheap enough for lazy one-time dispatch.
+ *
+ * @{
+ */
+
+namespace Common {
+
+/**
+ * Returns true if the host CPU supports SSE2 instructions.
+ *
+ * Always true on x86_64, detected via CPUID on 32-bit x86,
+ * and false on other architectures.
+ */
+bool hasCpuFeatureSSE2();
+
+/**
+ * Returns true if the host CPU supports AVX2 instructions.
+ *
+ * Detected via CPUID on x86/x86_64, false elsewhere.
+ */
+bool hasCpuFeatureAVX2();
+
+/**
+ * Returns true if the host CPU supports NEON instructions.
+ *
+ * Always true on AArch64; on 32-bit ARM this is a compile-time
+ * property of the target, since there is no portable way to query
+ * it at runtime.
+ */
+bool hasCpuFeatureNEON();
+
+} // End of namespace Common
+
+/** @} */
+
+#endif
@@ -179,38 +179,62 @@ CRC<T>::CRC(T poly, T init_remainder, T final_xor, bool reflect) :
  *********************************************************************/
 template<typename T>
 T CRC<T>::init() {
-	/*
-	 * Compute the remainder of each possible dividend.
-	 */
-	for (int dividend = 0; dividend < 256; ++dividend) {
+	if (_reflect) {
 		/*
-		 * Start with the dividend followed by zeros.
+		 * For reflected CRCs, compute a reflected lookup table and keep the
+		 * running remainder in reflected form. This way neither the message
+		 * bytes nor the final remainder need to be reflected bit by bit
+		 * while processing; the result is identical.
 		 */
-		T remainder = dividend << (_width - 8);
+		T reflectedPoly = (T)reflect(_poly, _width);
+
+		for (int dividend = 0; dividend < 256; ++dividend) {
+			T remainder = dividend;
+
+			for (byte bit = 8; bit > 0; --bit) {
+				if (remainder & 1) {
+					remainder = (remainder >> 1) ^ reflectedPoly;
+				} else {
+					remainder = (remainder >> 1);
+				}
+			}
 
+			_crcTable[dividend] = remainder;
+		}
+	} else {
 		/*
-		 * Perform modulo-2 division, a bit at a time.
+		 * Compute the remainder of each possible dividend.
 		 */
-		for (byte bit = 8; bit > 0; --bit) {
+		for (int dividend = 0; dividend < 256; ++dividend) {
 			/*
-			 * Try to divide the current data bit.
+			 * Start with the dividend followed by zeros.
 			 */
-			if (remainder & _topbit) {
-				remainder = (remainder << 1) ^ _poly;
-			} else {
-				remainder = (remainder << 1);
+			T remainder = dividend << (_width - 8);
+
+			/*
+			 * Perform modulo-2 division, a bit at a time.
+			 */
+			for (byte bit = 8; bit > 0; --bit) {
+				/*
+				 * Try to divide the current data bit.
+				 */
+				if (remainder & _topbit) {
+					remainder = (remainder << 1) ^ _poly;
+				} else {
+					remainder = (remainder << 1);
+				}
 			}
-		}
 
-		/*
-		 * Store the result into the table.
-		 */
-		_crcTable[dividend] = remainder;
+			/*
+			 * Store the result into the table.
+			 */
+			_crcTable[dividend] = remainder;
+		}
 	}
 
 	_inited = true;
 
-	return _init_remainder;
+	return reflectRemainder(_init_remainder);
 }
 
 
@@ -227,7 +251,7 @@ T CRC<T>::init() {
  *********************************************************************/
 template<typename T>
 T CRC<T>::crcFast(byte const message[], int nBytes) {
-	T remainder = _init_remainder;
+	T remainder = reflectRemainder(_init_remainder);
 
 	if (!_inited)
 		error("CRC::crcFast(): init method must be called first");
@@ -235,29 +259,40 @@ T CRC<T>::crcFast(byte const message[], int nBytes) {
 	/*
 	 * Divide the message by the polynomial, a byte at a time.
 	 */
-	for (int b = 0; b < nBytes; ++b) {
-		byte data = reflectData(message[b] ^ (remainder >> (_width - 8)));
-		remainder = _crcTable[data] ^ (remainder << 8);
+	if (_reflect) {
+		for (int b = 0; b < nBytes; ++b) {
+			byte data = (byte)(message[b] ^ remainder);
+			remainder = _crcTable[data] ^ (remainder >> 8);
+		}
+	} else {
+		for (int b = 0; b < nBytes; ++b) {
+			byte data = message[b] ^ (remainder >> (_width - 8));
+			remainder = _crcTable[data] ^ (remainder << 8);
+		}
 	}
 
 	/*
 	 * The final remainder is the CRC.
 	 */
-	return reflectRemainder(remainder) ^ _final_xor;
+	return remainder ^ _final_xor;
 
 }
 
 template<typename T>
 T CRC<T>::processByte(byte byteVal, T remainder) {
-	byte data = reflectData(byteVal) ^ (remainder >> (_width - 8));
-
-	remainder = _crcTable[data] ^ (remainder << 8);
+	if (_reflect) {
+		byte data = (byte)(byteVal ^ remainder);
+		remainder = _crcTable[data] ^ (remainder >> 8);
+	} else {
+		byte data = byteVal ^ (remainder >> (_width - 8));
+		remainder = _crcTable[data] ^ (remainder << 8);
+	}
 	return remainder;
 }
 
 template<typename T>
 T CRC<T>::finalize(T remainder) {
-	return reflectRemainder(remainder) ^ _final_xor;
+	return remainder ^ _final_xor;
 }
 
 class CRC_CCITT : public CRC<uint16> {
@@ -50,6 +50,18 @@ EventMapper::~EventMapper() {}
 
 EventManager::~EventManager() {}
 
+uint EventManager::pollEvents(Array<Event> &events) {
+	uint count = 0;
+	Event event;
+
+	while (pollEvent(event)) {
+		events.push_back(event);
+		++count;
+	}
+
+	return count;
+}
+
 EventDispatcher::EventDispatcher() : _mapper(nullptr) {
 }
 
@@ -68,12 +80,18 @@ EventDispatcher::~EventDispatcher() {
 void EventDispatcher::dispatch() {
 	Event event;
 
+	// All events drained in this pass share one timestamp; querying the
+	// clock per event would dominate the cost of high-rate input batches.
+	const uint32 time = g_system->getMillis(true);
+
 	dispatchPoll();
 
 	for (List<SourceEntry>::iterator i = _sources.begin(); i != _sources.end(); ++i) {
 		if (i->ignore)
 			continue;
 		while (i->source->pollEvent(event)) {
+			if (event.timestamp == 0)
+				event.timestamp = time;
 			// We only try to process the events via the setup event mapper, when
 			// we have a setup mapper and when the event source allows mapping.
 			if (i->source->allowMapping()) {
@@ -90,7 +108,9 @@ void EventDispatcher::dispatch() {
 				List<Event> mappedEvents = _mapper->mapEvent(event);
 
 				for (List<Event>::iterator j = mappedEvents.begin(); j != mappedEvents.end(); ++j) {
-					const Event mappedEvent = *j;
+					Event mappedEvent = *j;
+					if (mappedEvent.timestamp == 0)
+						mappedEvent.timestamp = event.timestamp;
 					dispatchEvent(mappedEvent);
 				}
 			} else {
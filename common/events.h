@@ -23,6 +23,7 @@
 #ifndef COMMON_EVENTS_H
 #define COMMON_EVENTS_H
 
+#include "common/array.h"
 #include "common/keyboard.h"
 #include "common/queue.h"
 #include "common/rect.h"
@@ -235,7 +236,18 @@ struct Event {
 	 */
 	JoystickState joystick;
 
-	Event() : type(EVENT_INVALID), kbdRepeat(false), customType(0) {
+	/**
+	 * The time in milliseconds when the event was generated, in the
+	 * g_system->getMillis(true) time base. 0 when unknown.
+	 *
+	 * Events that reach the client through the EventDispatcher are
+	 * stamped when the backend queue is drained, so all events of one
+	 * dispatch pass share a timestamp. This is sufficient for engines
+	 * to do sub-frame interpolation between batches.
+	 */
+	uint32 timestamp;
+
+	Event() : type(EVENT_INVALID), kbdRepeat(false), customType(0), timestamp(0) {
 	}
 };
 
@@ -477,6 +489,22 @@ public:
 	 */
 	virtual bool pollEvent(Event &event) = 0;
 
+	/**
+	 * Retrieve all pending events in one pass.
+	 *
+	 * Compared to calling pollEvent() until it returns false, this
+	 * drains the backend queue and runs the event mapper over the whole
+	 * batch with a single dispatch, which keeps the per-event overhead
+	 * low with high-rate input devices (touch, gyro, remapped mice).
+	 * The retrieved events are appended to the array, which stays valid
+	 * until the next call, so engines can iterate it as a contiguous
+	 * buffer.
+	 *
+	 * @param events	Array the pending events are appended to.
+	 * @return Number of events appended.
+	 */
+	virtual uint pollEvents(Array<Event> &events);
+
 	/**
 	 * Push a "fake" event into the event queue.
 	 */
@@ -0,0 +1,165 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/extractcache.h"
+#include "common/memstream.h"
+#include "common/memtrack.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(ExtractedMemberCache);
+
+namespace {
+
+struct FreeDeleter {
+	void operator()(byte *ptr) {
+		free(ptr);
+	}
+};
+
+/**
+ * Stream over a cached buffer. Holds a reference to the buffer, so the
+ * data stays valid if the member is evicted while the stream is open.
+ */
+class CachedMemberReadStream : public MemoryReadStream {
+public:
+	CachedMemberReadStream(const SharedPtr<byte> &data, uint32 size) :
+			MemoryReadStream(data.get(), size), _data(data) {}
+
+private:
+	SharedPtr<byte> _data;
+};
+
+String makeKey(const String &archiveName, const String &member) {
+	return archiveName + '/' + member;
+}
+
+} // End of anonymous namespace
+
+ExtractedMemberCache::ExtractedMemberCache() :
+		_totalSize(0),
+		_budget(kDefaultBudget),
+		_useCounter(0) {
+	_memTag = MemTrackMan.registerTag("common.extractcache");
+	MemTrackMan.setBudgetCallback(_memTag, memBudgetExceeded, this);
+}
+
+ExtractedMemberCache::~ExtractedMemberCache() {
+	clear();
+	MemTrackMan.setBudgetCallback(_memTag, nullptr, nullptr);
+}
+
+SeekableReadStream *ExtractedMemberCache::createReadStream(const String &archiveName, const String &member) {
+	StackLock lock(_mutex);
+
+	EntryMap::iterator it = _entries.find(makeKey(archiveName, member));
+	if (it == _entries.end())
+		return nullptr;
+
+	it->_value.lastUse = ++_useCounter;
+
+	return new CachedMemberReadStream(it->_value.data, it->_value.size);
+}
+
+SeekableReadStream *ExtractedMemberCache::storeAndCreateReadStream(const String &archiveName, const String &member, byte *data, uint32 size) {
+	if (size > _budget)
+		// Too large to cache; hand the buffer to the stream instead.
+		return new MemoryReadStream(data, size, DisposeAfterUse::YES);
+
+	SharedPtr<byte> dataPtr(data, FreeDeleter());
+	uint32 freed;
+
+	_mutex.lock();
+
+	// Make room for the new member, then add it. If the same member was
+	// stored concurrently, this simply replaces it.
+	freed = evictTo(_budget - size);
+
+	Entry &entry = _entries[makeKey(archiveName, member)];
+	if (entry.size > 0) {
+		freed += entry.size;
+		_totalSize -= entry.size;
+	}
+	entry.data = dataPtr;
+	entry.size = size;
+	entry.lastUse = ++_useCounter;
+	_totalSize += size;
+
+	_mutex.unlock();
+
+	// Report outside the lock, so an eviction triggered by the budget
+	// callback can re-enter the cache.
+	if (freed > 0)
+		MemTrackMan.subUsage(_memTag, freed);
+	MemTrackMan.addUsage(_memTag, size);
+
+	return new CachedMemberReadStream(dataPtr, size);
+}
+
+void ExtractedMemberCache::setBudget(uint32 budget) {
+	_mutex.lock();
+	_budget = budget;
+	uint32 freed = evictTo(_budget);
+	_mutex.unlock();
+
+	if (freed > 0)
+		MemTrackMan.subUsage(_memTag, freed);
+}
+
+void ExtractedMemberCache::clear() {
+	_mutex.lock();
+	uint32 freed = _totalSize;
+	_entries.clear();
+	_totalSize = 0;
+	_mutex.unlock();
+
+	if (freed > 0)
+		MemTrackMan.subUsage(_memTag, freed);
+}
+
+uint32 ExtractedMemberCache::evictTo(uint32 maxSize) {
+	uint32 freed = 0;
+
+	while (_totalSize > maxSize && !_entries.empty()) {
+		// Find the least recently used member.
+		EntryMap::iterator lru = _entries.end();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+			if (lru == _entries.end() || it->_value.lastUse < lru->_value.lastUse)
+				lru = it;
+		}
+
+		freed += lru->_value.size;
+		_totalSize -= lru->_value.size;
+		_entries.erase(lru);
+	}
+
+	return freed;
+}
+
+void ExtractedMemberCache::memBudgetExceeded(void *refCon, uint64 usage, uint64 budget) {
+	ExtractedMemberCache *cache = (ExtractedMemberCache *)refCon;
+
+	// Shrink the cache to the assigned memory budget.
+	cache->setBudget(MIN<uint64>(cache->_budget, budget));
+}
+
+} // End of namespace Common
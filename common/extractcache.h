@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_EXTRACTCACHE_H
+#define COMMON_EXTRACTCACHE_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+namespace Common {
+
+class SeekableReadStream;
+
+/**
+ * @defgroup common_extractcache Extracted member cache
+ * @ingroup common
+ *
+ * @brief  Cache for members extracted from compressed archives.
+ * @{
+ */
+
+/**
+ * Process-wide cache for members extracted from compressed archives
+ * (ARJ archives, InstallShield cabinets).
+ *
+ * The archive classes decompress a member in full on every open, and the
+ * archive objects themselves are typically created twice per launch: once
+ * for game detection and once when the engine starts. This cache keeps the
+ * decompressed data of recently extracted members, keyed by archive name
+ * and member name, so repeated extractions are served from memory.
+ *
+ * The cache has a size budget; the least recently used members are evicted
+ * when it is exceeded, and members larger than the budget are not cached
+ * at all. Streams returned by the cache stay valid when the member they
+ * read from is evicted.
+ */
+class ExtractedMemberCache : public Singleton<ExtractedMemberCache> {
+public:
+	/** The default size budget for cached member data, in bytes. */
+	static const uint32 kDefaultBudget = 16 * 1024 * 1024;
+
+	ExtractedMemberCache();
+	~ExtractedMemberCache();
+
+	/**
+	 * Returns a stream over the cached data of the specified member, or
+	 * nullptr if the member is not in the cache.
+	 *
+	 * @param archiveName The name of the archive containing the member.
+	 * @param member The name of the member within the archive.
+	 */
+	SeekableReadStream *createReadStream(const String &archiveName, const String &member);
+
+	/**
+	 * Adds extracted member data to the cache and returns a stream over it.
+	 * The cache takes ownership of the buffer, which must have been
+	 * allocated with malloc. If the member is too large for the cache
+	 * budget, it is not cached and the returned stream frees the buffer
+	 * when it is deleted.
+	 *
+	 * @param archiveName The name of the archive containing the member.
+	 * @param member The name of the member within the archive.
+	 * @param data The decompressed member data; ownership is transferred.
+	 * @param size The size of the decompressed member data.
+	 */
+	SeekableReadStream *storeAndCreateReadStream(const String &archiveName, const String &member, byte *data, uint32 size);
+
+	/** Changes the cache size budget, evicting members if necessary. */
+	void setBudget(uint32 budget);
+
+	/** Removes all cached members. */
+	void clear();
+
+private:
+	struct Entry {
+		SharedPtr<byte> data;
+		uint32 size;
+		uint32 lastUse;
+
+		Entry() : size(0), lastUse(0) {}
+	};
+
+	typedef HashMap<String, Entry, IgnoreCase_Hash, IgnoreCase_EqualTo> EntryMap;
+
+	/**
+	 * Evicts least recently used members until the cache holds at most
+	 * maxSize bytes. Must be called with the mutex held; returns the
+	 * number of bytes freed, so the caller can report them to the memory
+	 * tracker outside the lock.
+	 */
+	uint32 evictTo(uint32 maxSize);
+
+	/**
+	 * Memory budget callback (@see MemoryTracker::setBudgetCallback).
+	 * Clamps the cache budget to the assigned memory budget and evicts.
+	 */
+	static void memBudgetExceeded(void *refCon, uint64 usage, uint64 budget);
+
+	EntryMap _entries;
+	uint32 _totalSize;
+	uint32 _budget;
+	uint32 _useCounter;
+	int _memTag;
+
+	Mutex _mutex;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+/** Shortcut for accessing the extracted member cache. */
+#define ExtractCacheMan		(::Common::ExtractedMemberCache::instance())
+
+#endif
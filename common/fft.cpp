@@ -42,12 +42,18 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 	_tmpBuf = new Complex[n];
 	_expTab = new Complex[n / 2];
 	_revTab = new uint16[n];
+	_revTabInv = new uint16[n];
 
 	_splitRadix = 1;
 
 	for (int i = 0; i < n; i++)
 		_revTab[-splitRadixPermutation(i, n, _inverse) & (n - 1)] = i;
 
+	// Inverse of _revTab, so permute() can gather with sequential writes
+	// instead of scattering into the temporary buffer
+	for (int i = 0; i < n; i++)
+		_revTabInv[_revTab[i]] = i;
+
 	for (int i = 0; i < ARRAYSIZE(_cosTables); i++) {
 		if (i + 4 <= _bits) {
 			nPoints = 1 << (i + 4);
@@ -64,6 +70,7 @@ FFT::~FFT() {
 	}
 
 	delete[] _revTab;
+	delete[] _revTabInv;
 	delete[] _expTab;
 	delete[] _tmpBuf;
 }
@@ -77,7 +84,7 @@ void FFT::permute(Complex *z) {
 
 	if (_tmpBuf) {
 		for (int j = 0; j < np; j++)
-			_tmpBuf[_revTab[j]] = z[j];
+			_tmpBuf[j] = z[_revTabInv[j]];
 
 		memcpy(z, _tmpBuf, np * sizeof(Complex));
 
@@ -73,6 +73,7 @@ private:
 	int _inverse;
 
 	uint16 *_revTab;
+	uint16 *_revTabInv;
 
 	Complex *_expTab;
 	Complex *_tmpBuf;
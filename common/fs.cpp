@@ -28,6 +28,35 @@
 
 namespace Common {
 
+namespace {
+
+/**
+ * Process-wide cache of directory listings, keyed by listing parameters
+ * and path, validated against the directory modification time. Backends
+ * that cannot report a modification time bypass it entirely.
+ */
+struct DirListingCacheEntry {
+	uint32 mtime;
+	FSList children;
+
+	DirListingCacheEntry() : mtime(0) {}
+};
+
+typedef HashMap<String, DirListingCacheEntry> DirListingCache;
+
+DirListingCache *s_dirListingCache = nullptr;
+
+String listingCacheKey(const String &path, FSNode::ListMode mode, bool hidden) {
+	return String::format("%d%d:", (int)mode, hidden ? 1 : 0) + path;
+}
+
+} // End of anonymous namespace
+
+void FSNode::clearListingCache() {
+	delete s_dirListingCache;
+	s_dirListingCache = nullptr;
+}
+
 FSNode::FSNode() {
 }
 
@@ -74,6 +103,25 @@ bool FSNode::getChildren(FSList &fslist, ListMode mode, bool hidden) const {
 	if (!_realNode || !_realNode->isDirectory())
 		return false;
 
+	// A modification time of 0 means the backend cannot provide one, in
+	// which case we cannot tell a stale listing from a fresh one and must
+	// list every time.
+	const uint32 mtime = _realNode->lastModified();
+	String cacheKey;
+
+	if (mtime != 0) {
+		cacheKey = listingCacheKey(_realNode->getPath(), mode, hidden);
+
+		if (!s_dirListingCache)
+			s_dirListingCache = new DirListingCache();
+
+		DirListingCache::const_iterator it = s_dirListingCache->find(cacheKey);
+		if (it != s_dirListingCache->end() && it->_value.mtime == mtime) {
+			fslist = it->_value.children;
+			return true;
+		}
+	}
+
 	AbstractFSList tmp;
 
 	if (!_realNode->getChildren(tmp, mode, hidden))
@@ -84,6 +132,12 @@ bool FSNode::getChildren(FSList &fslist, ListMode mode, bool hidden) const {
 		fslist.push_back(FSNode(*i));
 	}
 
+	if (mtime != 0) {
+		DirListingCacheEntry &entry = (*s_dirListingCache)[cacheKey];
+		entry.mtime = mtime;
+		entry.children = fslist;
+	}
+
 	return true;
 }
 
@@ -115,6 +169,10 @@ String FSNode::getPath() const {
 	return _realNode->getPath();
 }
 
+uint32 FSNode::lastModified() const {
+	return _realNode ? _realNode->lastModified() : 0;
+}
+
 bool FSNode::isDirectory() const {
 	return _realNode && _realNode->isDirectory();
 }
@@ -142,6 +200,26 @@ SeekableReadStream *FSNode::createReadStream() const {
 	return _realNode->createReadStream();
 }
 
+SeekableReadStream *FSNode::createMappedReadStream() const {
+	if (_realNode == nullptr)
+		return nullptr;
+
+	if (!_realNode->exists()) {
+		warning("FSNode::createMappedReadStream: '%s' does not exist", getName().c_str());
+		return nullptr;
+	} else if (_realNode->isDirectory()) {
+		warning("FSNode::createMappedReadStream: '%s' is a directory", getName().c_str());
+		return nullptr;
+	}
+
+	SeekableReadStream *stream = _realNode->createMappedReadStream();
+	if (stream)
+		return stream;
+
+	// No memory mapping on this backend, or mapping failed
+	return _realNode->createReadStream();
+}
+
 SeekableWriteStream *FSNode::createWriteStream() const {
 	if (_realNode == nullptr)
 		return nullptr;
@@ -151,6 +229,10 @@ SeekableWriteStream *FSNode::createWriteStream() const {
 		return nullptr;
 	}
 
+	// The parent directory changes under us; the timestamp check alone
+	// would miss a file created within its granularity.
+	clearListingCache();
+
 	return _realNode->createWriteStream();
 }
 
@@ -167,6 +249,8 @@ bool FSNode::createDirectory() const {
 		return false;
 	}
 
+	clearListingCache();
+
 	return _realNode->createDirectory();
 }
 
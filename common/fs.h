@@ -144,10 +144,26 @@ public:
 	 * Return a list of all child nodes of this directory node. If called on a node
 	 * that does not represent a directory, false is returned.
 	 *
+	 * On backends that can report directory modification times, the
+	 * listing is served from a process-wide cache as long as the
+	 * directory is unmodified, so repeated traversals of the same tree
+	 * (e.g. several detection passes during Mass Add) only hit the file
+	 * system once.
+	 *
 	 * @return True if successful, false otherwise (e.g. when the directory does not exist).
 	 */
 	bool getChildren(FSList &fslist, ListMode mode = kListDirectoriesOnly, bool hidden = true) const;
 
+	/**
+	 * Drop all cached directory listings.
+	 *
+	 * Invalidation is normally automatic via the directory modification
+	 * time; this exists for code that modifies the file system and must
+	 * observe the change immediately, before the one second timestamp
+	 * granularity catches up.
+	 */
+	static void clearListingCache();
+
 	/**
 	 * Return a human-readable string for this node, usable for display (e.g.
 	 * in the GUI code). Do *not* rely on it being usable for anything else,
@@ -181,6 +197,15 @@ public:
 	 */
 	String getPath() const;
 
+	/**
+	 * Get the time of the last modification of this node, in a backend
+	 * dependent unit (seconds since the epoch where available).
+	 *
+	 * @return The last modification time, or 0 if the backend cannot
+	 *         provide one.
+	 */
+	uint32 lastModified() const;
+
 	/**
 	 * Get the parent node of this node. If this node has no parent node,
 	 * then it returns a duplicate of this node.
@@ -233,6 +258,17 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStream() const;
 
+	/**
+	 * Create a SeekableReadStream instance backed by a read-only memory
+	 * mapping of the file referred by this node, so that reads are plain
+	 * memory accesses. This is worthwhile for large archives that are
+	 * accessed in many small reads. On backends without memory mapping
+	 * support, this transparently falls back to createReadStream().
+	 *
+	 * @return Pointer to the stream object, 0 in case of a failure.
+	 */
+	SeekableReadStream *createMappedReadStream() const;
+
 	/**
 	 * Create a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
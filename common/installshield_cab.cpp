@@ -45,6 +45,7 @@
 
 #include "common/archive.h"
 #include "common/debug.h"
+#include "common/extractcache.h"
 #include "common/hash-str.h"
 #include "common/installshield_cab.h"
 #include "common/memstream.h"
@@ -241,6 +242,18 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 
 	const FileEntry &entry = _map[name];
 
+#ifdef USE_ZLIB
+	// Serve repeated extractions of compressed members from the cache. The
+	// cabinet is usually opened once for detection and once by the engine,
+	// so without the cache every member is inflated at least twice per
+	// launch.
+	if (entry.flags & 0x04) {
+		SeekableReadStream *cached = ExtractCacheMan.createReadStream(_baseName, name);
+		if (cached)
+			return cached;
+	}
+#endif
+
 	ScopedPtr<SeekableReadStream> stream(SearchMan.createReadStreamForMember(getVolumeName((entry.volume == 0) ? 1 : entry.volume)));
 	if (!stream) {
 		warning("Failed to open volume for file '%s'", name.c_str());
@@ -270,7 +283,7 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 		return nullptr;
 	}
 
-	return new MemoryReadStream(dst, entry.uncompressedSize, DisposeAfterUse::YES);
+	return ExtractCacheMan.storeAndCreateReadStream(_baseName, name, dst, entry.uncompressedSize);
 #else
 	warning("zlib required to extract compressed CAB file '%s'", name.c_str());
 	return 0;
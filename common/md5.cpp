@@ -249,17 +249,22 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length) {
 #ifdef DISABLE_MD5
 	memset(digest, 0, 16);
 #else
+	// Read the stream in large chunks, so hashing a whole file spends its
+	// time hashing instead of in stream read calls.
+	const uint32 bufSize = 64 * 1024;
+
 	md5_context ctx;
 	int i;
-	unsigned char buf[1000];
 	bool restricted = (length != 0);
 	uint32 readlen;
 
-	if (!restricted || sizeof(buf) <= length)
-		readlen = sizeof(buf);
+	if (!restricted || bufSize <= length)
+		readlen = bufSize;
 	else
 		readlen = length;
 
+	unsigned char *buf = new unsigned char[readlen];
+
 	md5_starts(&ctx);
 
 	while ((i = stream.read(buf, readlen)) > 0) {
@@ -270,12 +275,14 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length) {
 			if (length == 0)
 				break;
 
-			if (sizeof(buf) > length)
+			if (readlen > length)
 				readlen = length;
 		}
 	}
 
 	md5_finish(&ctx, digest);
+
+	delete[] buf;
 #endif
 	return true;
 }
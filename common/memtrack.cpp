@@ -0,0 +1,158 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/memtrack.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(MemoryTracker);
+
+MemoryTracker::MemoryTracker() : _tagCount(0), _tagStackDepth(0) {
+	memset(_tags, 0, sizeof(_tags));
+}
+
+int MemoryTracker::registerTag(const char *name) {
+	StackLock lock(_mutex);
+
+	for (uint i = 0; i < _tagCount; ++i) {
+		if (!strcmp(_tags[i].name, name))
+			return i;
+	}
+
+	if (_tagCount == kMaxTags) {
+		warning("MemoryTracker: tag table full, dropping tag '%s'", name);
+		return -1;
+	}
+
+	Tag &tag = _tags[_tagCount];
+	tag.name = name;
+	tag.usage = 0;
+	tag.peakUsage = 0;
+	tag.budget = 0;
+	tag.callback = nullptr;
+	tag.callbackRefCon = nullptr;
+	tag.inCallback = false;
+	return _tagCount++;
+}
+
+void MemoryTracker::addUsage(int tag, uint64 bytes) {
+	if (tag < 0)
+		return;
+
+	{
+		StackLock lock(_mutex);
+		Tag &t = _tags[tag];
+		t.usage += bytes;
+		t.peakUsage = MAX(t.peakUsage, t.usage);
+	}
+
+	checkBudget(tag);
+}
+
+void MemoryTracker::subUsage(int tag, uint64 bytes) {
+	if (tag < 0)
+		return;
+
+	StackLock lock(_mutex);
+	Tag &t = _tags[tag];
+	if (bytes > t.usage) {
+		warning("MemoryTracker: tag '%s' released more than it reported", t.name);
+		t.usage = 0;
+	} else {
+		t.usage -= bytes;
+	}
+}
+
+void MemoryTracker::addUsageScoped(uint64 bytes) {
+	addUsage(currentTag(), bytes);
+}
+
+void MemoryTracker::subUsageScoped(uint64 bytes) {
+	subUsage(currentTag(), bytes);
+}
+
+void MemoryTracker::setBudget(int tag, uint64 bytes) {
+	if (tag < 0)
+		return;
+
+	{
+		StackLock lock(_mutex);
+		_tags[tag].budget = bytes;
+	}
+
+	checkBudget(tag);
+}
+
+void MemoryTracker::setBudgetCallback(int tag, BudgetCallback callback, void *refCon) {
+	if (tag < 0)
+		return;
+
+	StackLock lock(_mutex);
+	_tags[tag].callback = callback;
+	_tags[tag].callbackRefCon = refCon;
+}
+
+void MemoryTracker::checkBudget(int tag) {
+	BudgetCallback callback;
+	void *refCon;
+	uint64 usage, budget;
+
+	{
+		StackLock lock(_mutex);
+		Tag &t = _tags[tag];
+		// The callback frees memory and thus re-enters the tracker, so
+		// it must run unlocked, and only one invocation at a time
+		if (!t.budget || t.usage <= t.budget || !t.callback || t.inCallback)
+			return;
+		t.inCallback = true;
+		callback = t.callback;
+		refCon = t.callbackRefCon;
+		usage = t.usage;
+		budget = t.budget;
+	}
+
+	callback(refCon, usage, budget);
+
+	StackLock lock(_mutex);
+	_tags[tag].inCallback = false;
+}
+
+void MemoryTracker::pushTag(int tag) {
+	if (_tagStackDepth < kMaxTagDepth)
+		_tagStack[_tagStackDepth] = tag;
+	++_tagStackDepth;
+}
+
+void MemoryTracker::popTag() {
+	assert(_tagStackDepth > 0);
+	--_tagStackDepth;
+}
+
+int MemoryTracker::currentTag() const {
+	if (_tagStackDepth == 0 || _tagStackDepth > kMaxTagDepth)
+		return -1;
+	return _tagStack[_tagStackDepth - 1];
+}
+
+} // End of namespace Common
@@ -0,0 +1,145 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_MEMTRACK_H
+#define COMMON_MEMTRACK_H
+
+#include "common/scummsys.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_memtrack Memory accounting
+ * @ingroup common
+ *
+ * @brief  Per-subsystem memory accounting and budgets.
+ *
+ * Subsystems that own sizable memory (resource caches, decoded frame
+ * caches, ...) register a named tag and report their usage as it grows
+ * and shrinks. The live totals can be inspected with the GUI debugger's
+ * "memstats" command, which can also assign a budget to a tag. When a
+ * tag's usage exceeds its budget, a callback registered by the owning
+ * subsystem is invoked so its cache can evict; this gives ports with
+ * tight memory a single knob instead of each cache evicting blindly
+ * against its own hardcoded limit.
+ *
+ * Accounting is voluntary: untagged allocations are not tracked, so the
+ * totals cover only the instrumented subsystems.
+ * @{
+ */
+
+/**
+ * Registry of per-subsystem memory usage, budgets and eviction callbacks.
+ */
+class MemoryTracker : public Singleton<MemoryTracker> {
+public:
+	enum {
+		kMaxTags = 32,
+		kMaxTagDepth = 16
+	};
+
+	/**
+	 * Invoked (from the thread that reported the usage) when a tag's
+	 * usage first exceeds its budget. The callback should evict until
+	 * usage is back under budget; usage it releases is re-reported
+	 * through subUsage as usual.
+	 */
+	typedef void (*BudgetCallback)(void *refCon, uint64 usage, uint64 budget);
+
+	/** Accounting state for one named tag. */
+	struct Tag {
+		const char *name;
+		uint64 usage;
+		uint64 peakUsage;
+		uint64 budget; /*!< 0 if no budget is assigned. */
+		BudgetCallback callback;
+		void *callbackRefCon;
+		bool inCallback;
+	};
+
+	MemoryTracker();
+
+	/**
+	 * Register a tag name, returning its id.
+	 *
+	 * Returns the existing id if the name is already registered, or -1
+	 * if the tag table is full.
+	 */
+	int registerTag(const char *name);
+
+	void addUsage(int tag, uint64 bytes);
+	void subUsage(int tag, uint64 bytes);
+
+	/** Report usage against the innermost scoped tag, if any. */
+	void addUsageScoped(uint64 bytes);
+	void subUsageScoped(uint64 bytes);
+
+	/** Assign a budget to a tag; 0 removes the budget. */
+	void setBudget(int tag, uint64 bytes);
+
+	/** Subscribe the tag's owner to budget-exceeded notifications. */
+	void setBudgetCallback(int tag, BudgetCallback callback, void *refCon);
+
+	uint getTagCount() const { return _tagCount; }
+	const Tag &getTag(uint id) const { return _tags[id]; }
+
+	/**
+	 * Scoped tag stack, for call trees where the allocation site does
+	 * not know which subsystem it is working for. Use via ScopedMemTag.
+	 * The stack is not thread-safe; only use it from the main thread.
+	 */
+	void pushTag(int tag);
+	void popTag();
+	int currentTag() const;
+
+private:
+	void checkBudget(int tag);
+
+	mutable Mutex _mutex;
+	Tag _tags[kMaxTags];
+	uint _tagCount;
+	int _tagStack[kMaxTagDepth];
+	uint _tagStackDepth;
+};
+
+/** Makes a tag the current scoped tag for the lifetime of a C++ scope. */
+class ScopedMemTag {
+public:
+	ScopedMemTag(int tag) {
+		MemoryTracker::instance().pushTag(tag);
+	}
+
+	~ScopedMemTag() {
+		MemoryTracker::instance().popTag();
+	}
+};
+
+/** @} */
+
+} // End of namespace Common
+
+/** Shortcut for accessing the memory tracker. */
+#define MemTrackMan		(::Common::MemoryTracker::instance())
+
+#endif
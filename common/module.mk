@@ -3,13 +3,16 @@ MODULE := common
 MODULE_OBJS := \
 	achievements.o \
 	archive.o \
+	arena.o \
 	base-str.o \
 	config-manager.o \
 	coroutines.o \
+	cpuinfo.o \
 	dcl.o \
 	debug.o \
 	error.o \
 	events.o \
+	extractcache.o \
 	file.o \
 	fs.o \
 	gui_options.o \
@@ -23,12 +26,14 @@ MODULE_OBJS := \
 	localization.o \
 	macresman.o \
 	memorypool.o \
+	memtrack.o \
 	md5.o \
 	mdct.o \
 	mutex.o \
 	osd_message_queue.o \
 	path.o \
 	platform.o \
+	profiler.o \
 	punycode.o \
 	quicktime.o \
 	random.o \
@@ -0,0 +1,126 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#include "common/profiler.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+#if defined(POSIX)
+#include <time.h>
+#endif
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+bool g_profilerEnabled = false;
+
+Profiler::Profiler() : _probeCount(0), _ringPos(0), _ringCount(0) {
+	memset(_probes, 0, sizeof(_probes));
+	memset(_ring, 0, sizeof(_ring));
+}
+
+void Profiler::setEnabled(bool enabled) {
+	g_profilerEnabled = enabled;
+}
+
+int Profiler::registerProbe(const char *name) {
+	StackLock lock(_mutex);
+
+	for (uint i = 0; i < _probeCount; ++i) {
+		if (!strcmp(_probes[i].name, name))
+			return i;
+	}
+
+	if (_probeCount == kMaxProbes) {
+		warning("Profiler: probe table full, dropping probe '%s'", name);
+		return -1;
+	}
+
+	Probe &probe = _probes[_probeCount];
+	probe.name = name;
+	probe.count = 0;
+	probe.totalMicros = 0;
+	probe.maxMicros = 0;
+	return _probeCount++;
+}
+
+void Profiler::addSample(int probeId, uint64 startMicros, uint64 durationMicros) {
+	StackLock lock(_mutex);
+
+	Probe &probe = _probes[probeId];
+	++probe.count;
+	probe.totalMicros += durationMicros;
+	probe.maxMicros = MAX(probe.maxMicros, durationMicros);
+
+	Sample &sample = _ring[_ringPos];
+	sample.startMicros = startMicros;
+	sample.durationMicros = (uint32)durationMicros;
+	sample.probeId = (uint8)probeId;
+
+	_ringPos = (_ringPos + 1) % kRingSize;
+	_ringCount = MIN<uint>(_ringCount + 1, kRingSize);
+}
+
+void Profiler::addCount(int probeId, uint32 amount) {
+	StackLock lock(_mutex);
+	_probes[probeId].count += amount;
+}
+
+void Profiler::reset() {
+	StackLock lock(_mutex);
+
+	for (uint i = 0; i < _probeCount; ++i) {
+		_probes[i].count = 0;
+		_probes[i].totalMicros = 0;
+		_probes[i].maxMicros = 0;
+	}
+	_ringPos = 0;
+	_ringCount = 0;
+}
+
+uint Profiler::getSamples(Sample *dst, uint maxCount) const {
+	StackLock lock(_mutex);
+
+	uint count = MIN(_ringCount, maxCount);
+	uint pos = (_ringPos + kRingSize - count) % kRingSize;
+	for (uint i = 0; i < count; ++i) {
+		dst[i] = _ring[pos];
+		pos = (pos + 1) % kRingSize;
+	}
+	return count;
+}
+
+uint64 Profiler::getTimeMicros() {
+#if defined(POSIX)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+	return (uint64)g_system->getMillis() * 1000;
+#endif
+}
+
+} // End of namespace Common
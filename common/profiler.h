@@ -0,0 +1,196 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_profiler Hot-path profiling probes
+ * @ingroup common
+ *
+ * @brief  Lightweight scoped timers and counters for performance work.
+ *
+ * Probes are placed in hot paths with the PROFILER_SCOPE and PROFILER_COUNT
+ * macros. While the profiler is disabled (the default), a probe costs a
+ * single test of a global flag. When enabled, each scope records its
+ * duration into a per-probe aggregate (call count, total and maximum time)
+ * and into a fixed-size ring buffer of recent samples, so both summaries
+ * and short traces can be extracted without re-running the game.
+ *
+ * The profiler is driven from the GUI debugger's "profiler" command, which
+ * toggles it, prints the aggregates and exports the ring buffer as CSV.
+ * Ports that are tight on space can define DISABLE_PROFILER to compile the
+ * probes and the debugger command out entirely.
+ * @{
+ */
+
+/**
+ * Global enable flag for the probe macros.
+ *
+ * Kept outside the Profiler singleton so that a disabled probe neither
+ * takes a lock nor instantiates the singleton (probes may fire on the
+ * audio thread, where lazily constructing it would be unsafe).
+ */
+extern bool g_profilerEnabled;
+
+/**
+ * Collects timing samples and counters from the probe macros.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	enum {
+		kMaxProbes = 64,
+		kRingSize = 2048
+	};
+
+	/** Aggregate statistics for one named probe. */
+	struct Probe {
+		const char *name;
+		uint32 count;
+		uint64 totalMicros;
+		uint64 maxMicros;
+	};
+
+	/** One timed scope, as kept in the ring buffer of recent samples. */
+	struct Sample {
+		uint64 startMicros;
+		uint32 durationMicros;
+		uint8 probeId;
+	};
+
+	Profiler();
+
+	void setEnabled(bool enabled);
+	bool isEnabled() const { return g_profilerEnabled; }
+
+	/**
+	 * Register a probe name, returning its id.
+	 *
+	 * Returns the existing id if the name is already registered, or -1
+	 * if the probe table is full.
+	 */
+	int registerProbe(const char *name);
+
+	/** Record one timed scope against a probe. Safe to call from any thread. */
+	void addSample(int probeId, uint64 startMicros, uint64 durationMicros);
+
+	/** Bump a probe's counter without timing anything. */
+	void addCount(int probeId, uint32 amount);
+
+	/** Clear the aggregates and the ring buffer. Registered probes are kept. */
+	void reset();
+
+	uint getProbeCount() const { return _probeCount; }
+	const Probe &getProbe(uint id) const { return _probes[id]; }
+
+	/**
+	 * Copy the buffered samples into dst, oldest first.
+	 *
+	 * Returns the number of samples copied, at most maxCount.
+	 */
+	uint getSamples(Sample *dst, uint maxCount) const;
+
+	/**
+	 * Monotonic time in microseconds.
+	 *
+	 * Uses the POSIX monotonic clock where available and falls back to
+	 * OSystem::getMillis elsewhere, so the resolution may be no better
+	 * than a millisecond on some ports.
+	 */
+	static uint64 getTimeMicros();
+
+private:
+	mutable Mutex _mutex;
+	Probe _probes[kMaxProbes];
+	uint _probeCount;
+	Sample _ring[kRingSize];
+	uint _ringPos;
+	uint _ringCount;
+};
+
+/**
+ * Times the enclosing C++ scope against a probe. Use via PROFILER_SCOPE.
+ *
+ * The probe id reference points at a function-local static initialized
+ * to -2, so the name lookup happens only once per probe site.
+ */
+class ScopedProbe {
+public:
+	ScopedProbe(int &probeId, const char *name) : _startMicros(0), _probeId(-1) {
+		if (!g_profilerEnabled)
+			return;
+		if (probeId == -2)
+			probeId = Profiler::instance().registerProbe(name);
+		if (probeId < 0)
+			return;
+		_probeId = probeId;
+		_startMicros = Profiler::getTimeMicros();
+	}
+
+	~ScopedProbe() {
+		if (_probeId >= 0)
+			Profiler::instance().addSample(_probeId, _startMicros,
+				Profiler::getTimeMicros() - _startMicros);
+	}
+
+private:
+	uint64 _startMicros;
+	int _probeId;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#ifndef DISABLE_PROFILER
+
+/** Time the current scope against the probe named @p name. */
+#define PROFILER_SCOPE(name) \
+	static int profilerScopeId_ = -2; \
+	Common::ScopedProbe profilerScope_(profilerScopeId_, name)
+
+/** Add @p amount to the counter probe named @p name. */
+#define PROFILER_COUNT(name, amount) \
+	do { \
+		if (Common::g_profilerEnabled) { \
+			static int profilerCountId_ = -2; \
+			if (profilerCountId_ == -2) \
+				profilerCountId_ = Common::Profiler::instance().registerProbe(name); \
+			if (profilerCountId_ >= 0) \
+				Common::Profiler::instance().addCount(profilerCountId_, amount); \
+		} \
+	} while (false)
+
+#else
+
+#define PROFILER_SCOPE(name) do {} while (false)
+#define PROFILER_COUNT(name, amount) do {} while (false)
+
+#endif // DISABLE_PROFILER
+
+#endif
@@ -574,13 +574,17 @@ int QuickTimeParser::readSTSC(Atom atom) {
 	if (!track->sampleToChunk)
 		return -1;
 
+	byte *data = new byte[track->sampleToChunkCount * 12];
+	_fd->read(data, track->sampleToChunkCount * 12);
+
 	for (uint32 i = 0; i < track->sampleToChunkCount; i++) {
-		track->sampleToChunk[i].first = _fd->readUint32BE() - 1;
-		track->sampleToChunk[i].count = _fd->readUint32BE();
-		track->sampleToChunk[i].id = _fd->readUint32BE();
+		track->sampleToChunk[i].first = READ_BE_UINT32(data + i * 12) - 1;
+		track->sampleToChunk[i].count = READ_BE_UINT32(data + i * 12 + 4);
+		track->sampleToChunk[i].id = READ_BE_UINT32(data + i * 12 + 8);
 		//warning("Sample to Chunk[%d]: First = %d, Count = %d", i, track->sampleToChunk[i].first, track->sampleToChunk[i].count);
 	}
 
+	delete[] data;
 	return 0;
 }
 
@@ -599,8 +603,10 @@ int QuickTimeParser::readSTSS(Atom atom) {
 	if (!track->keyframes)
 		return -1;
 
+	_fd->read(track->keyframes, track->keyframeCount * 4);
+
 	for (uint32 i = 0; i < track->keyframeCount; i++) {
-		track->keyframes[i] = _fd->readUint32BE() - 1; // Adjust here, the frames are based on 1
+		track->keyframes[i] = FROM_BE_32(track->keyframes[i]) - 1; // Adjust here, the frames are based on 1
 		debug(6, "keyframes[%d] = %d", i, track->keyframes[i]);
 
 	}
@@ -626,8 +632,10 @@ int QuickTimeParser::readSTSZ(Atom atom) {
 	if (!track->sampleSizes)
 		return -1;
 
+	_fd->read(track->sampleSizes, track->sampleCount * 4);
+
 	for(uint32 i = 0; i < track->sampleCount; i++) {
-		track->sampleSizes[i] = _fd->readUint32BE();
+		track->sampleSizes[i] = FROM_BE_32(track->sampleSizes[i]);
 		debug(6, "sampleSizes[%d] = %d", i, track->sampleSizes[i]);
 	}
 
@@ -646,15 +654,20 @@ int QuickTimeParser::readSTTS(Atom atom) {
 
 	debug(0, "track[%d].stts.entries = %d", _tracks.size() - 1, track->timeToSampleCount);
 
+	byte *data = new byte[track->timeToSampleCount * 8];
+	_fd->read(data, track->timeToSampleCount * 8);
+
 	for (int32 i = 0; i < track->timeToSampleCount; i++) {
-		track->timeToSample[i].count = _fd->readUint32BE();
-		track->timeToSample[i].duration = _fd->readUint32BE();
+		track->timeToSample[i].count = READ_BE_UINT32(data + i * 8);
+		track->timeToSample[i].duration = READ_BE_UINT32(data + i * 8 + 4);
 
 		debug(1, "\tCount = %d, Duration = %d", track->timeToSample[i].count, track->timeToSample[i].duration);
 
 		totalSampleCount += track->timeToSample[i].count;
 	}
 
+	delete[] data;
+
 	track->frameCount = totalSampleCount;
 	return 0;
 }
@@ -671,11 +684,15 @@ int QuickTimeParser::readSTCO(Atom atom) {
 	if (!track->chunkOffsets)
 		return -1;
 
+	// Read the table in one block and swap in place; per-entry stream
+	// reads dominate open latency on movies with huge sample tables.
+	_fd->read(track->chunkOffsets, track->chunkCount * 4);
+
 	for (uint32 i = 0; i < track->chunkCount; i++) {
 		// WORKAROUND/HACK: The offsets in Riven videos (ones inside the Mohawk archives themselves)
 		// have offsets relative to the archive and not the video. This is quite nasty. We subtract
 		// the initial offset of the stream to get the correct value inside of the stream.
-		track->chunkOffsets[i] = _fd->readUint32BE() - _beginOffset;
+		track->chunkOffsets[i] = FROM_BE_32(track->chunkOffsets[i]) - _beginOffset;
 	}
 
 	return 0;
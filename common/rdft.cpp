@@ -79,10 +79,13 @@ void RDFT::calc(float *data) {
 		od.re =  k2 * (data[i1 + 1] + data[i2 + 1]);
 
 		/* Apply twiddle factors to the odd FFT and add to the even FFT */
-		data[i1    ] =  ev.re + od.re * _tCos[i] - od.im * _tSin[i];
-		data[i1 + 1] =  ev.im + od.im * _tCos[i] + od.re * _tSin[i];
-		data[i2    ] =  ev.re - od.re * _tCos[i] + od.im * _tSin[i];
-		data[i2 + 1] = -ev.im + od.im * _tCos[i] + od.re * _tSin[i];
+		float odsum = od.re * _tCos[i] - od.im * _tSin[i];
+		float oddif = od.im * _tCos[i] + od.re * _tSin[i];
+
+		data[i1    ] =  ev.re + odsum;
+		data[i1 + 1] =  ev.im + oddif;
+		data[i2    ] =  ev.re - odsum;
+		data[i2 + 1] = -ev.im + oddif;
 	}
 
 	data[2 * i + 1] = _signConvention * data[2 * i + 1];
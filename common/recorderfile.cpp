@@ -48,6 +48,9 @@ PlaybackFile::PlaybackFile()
 	_recordCount = 0;
 	_eventsSize = 0;
 	_version = RECORD_VERSION;
+	_haveLastScreenshotMD5 = false;
+	memset(_lastScreenshotMD5, 0, sizeof(_lastScreenshotMD5));
+	_screenshotIndexBuilt = false;
 	memset(_tmpBuffer.data(), 1, kRecordBuffSize);
 
 	_playbackParseState = kFileStateCheckFormat;
@@ -63,6 +66,7 @@ bool PlaybackFile::openWrite(const String &fileName) {
 	_writeStream = wrapBufferedWriteStream(g_system->getSavefileManager()->openForSaving(fileName), 128 * 1024);
 	_headerDumped = false;
 	_recordCount = 0;
+	_haveLastScreenshotMD5 = false;
 	if (_writeStream == NULL) {
 		return false;
 	}
@@ -75,6 +79,8 @@ bool PlaybackFile::openRead(const String &fileName) {
 	_header.fileName = fileName;
 	_eventsSize = 0;
 	_tmpPlaybackFile.seek(0);
+	_screenshotIndex.clear();
+	_screenshotIndexBuilt = false;
 	_readStream = wrapBufferedSeekableReadStream(g_system->getSavefileManager()->openForLoading(fileName), 128 * 1024, DisposeAfterUse::YES);
 	if (_readStream == NULL) {
 		debugC(1, kDebugLevelEventRec, "playback:action=\"Load File\" result=fail reason=\"file %s not found\"", fileName.c_str());
@@ -458,6 +464,14 @@ void PlaybackFile::saveScreenShot(Graphics::Surface &screen, byte md5[16]) {
 	_writeStream->writeUint32BE(kMD5Tag);
 	_writeStream->writeUint32BE(16);
 	_writeStream->write(md5, 16);
+	// The hash above is all the playback verification needs; the thumbnail
+	// only serves as a preview in the recorder dialog. Skip storing it again
+	// while the screen contents are unchanged, which keeps long recordings
+	// of mostly static screens (dialogue, idle waiting) small.
+	if (_haveLastScreenshotMD5 && memcmp(_lastScreenshotMD5, md5, 16) == 0)
+		return;
+	memcpy(_lastScreenshotMD5, md5, 16);
+	_haveLastScreenshotMD5 = true;
 	Graphics::saveThumbnail(*_writeStream, screen);
 }
 
@@ -662,14 +676,25 @@ int PlaybackFile::getScreensCount() {
 	if (_mode != kRead) {
 		return 0;
 	}
+	buildScreenshotIndex();
+	return _screenshotIndex.size();
+}
+
+void PlaybackFile::buildScreenshotIndex() {
+	if (_screenshotIndexBuilt) {
+		return;
+	}
+	// Scan the file once and remember where each screenshot chunk starts,
+	// so thumbnail lookups can seek to it directly instead of rescanning
+	// the whole file for every single preview.
+	_screenshotIndex.clear();
 	_readStream->seek(0);
-	int result = 0;
 	while (skipToNextScreenshot()) {
+		_screenshotIndex.push_back(_readStream->pos() - 4);
 		uint32 size = _readStream->readUint32BE();
 		_readStream->skip(size - 8);
-		++result;
 	}
-	return result;
+	_screenshotIndexBuilt = true;
 }
 
 bool PlaybackFile::skipToNextScreenshot() {
@@ -691,21 +716,13 @@ Graphics::Surface *PlaybackFile::getScreenShot(int number) {
 	if (_mode != kRead) {
 		return NULL;
 	}
-	_readStream->seek(0);
-	int screenCount = 1;
-	while (skipToNextScreenshot()) {
-		if (screenCount == number) {
-			screenCount++;
-			_readStream->seek(-4, SEEK_CUR);
-			Graphics::Surface *thumbnail;
-			return Graphics::loadThumbnail(*_readStream, thumbnail) ? thumbnail : NULL;
-		} else {
-			uint32 size = _readStream->readUint32BE();
-			_readStream->skip(size - 8);
-			screenCount++;
-		}
+	buildScreenshotIndex();
+	if ((number < 1) || (number > (int)_screenshotIndex.size())) {
+		return NULL;
 	}
-	return NULL;
+	_readStream->seek(_screenshotIndex[number - 1]);
+	Graphics::Surface *thumbnail;
+	return Graphics::loadThumbnail(*_readStream, thumbnail) ? thumbnail : NULL;
 }
 
 void PlaybackFile::updateHeader() {
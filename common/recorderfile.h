@@ -173,6 +173,14 @@ private:
 	bool _headerDumped;
 	int _recordCount;
 	uint32 _eventsSize;
+	// MD5 of the last screenshot actually stored; used to skip writing
+	// duplicate thumbnails while the screen contents do not change.
+	byte _lastScreenshotMD5[16];
+	bool _haveLastScreenshotMD5;
+	// Offsets of the screenshot chunks, built on first use so thumbnail
+	// lookups can seek directly instead of rescanning the whole file.
+	Array<uint32> _screenshotIndex;
+	bool _screenshotIndexBuilt;
 	PlaybackFileHeader _header;
 	PlaybackFileState _playbackParseState;
 	uint32 _version;
@@ -203,6 +211,7 @@ private:
 	void readHashMap(ChunkHeader chunk);
 
 	bool skipToNextScreenshot();
+	void buildScreenshotIndex();
 	void readEvent(RecorderEvent& event);
 	void readEventsToBuffer(uint32 size);
 	bool grabScreenAndComputeMD5(Graphics::Surface &screen, uint8 md5[16]);
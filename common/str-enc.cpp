@@ -23,14 +23,93 @@
 #include "common/str.h"
 #include "common/ustr.h"
 #include "common/util.h"
+#include "common/cpuinfo.h"
 #include "common/endian.h"
 #include "common/error.h"
 #include "common/system.h"
 #include "common/enc-internal.h"
 #include "common/file.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define STRENC_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define STRENC_SIMD
+#endif
+
 namespace Common {
 
+#ifdef STRENC_SIMD
+
+#if defined(__SSE2__)
+
+static inline bool strEncHasSIMD() {
+	return hasCpuFeatureSSE2();
+}
+
+/**
+ * Widen a run of ASCII bytes to UTF-32, 16 bytes at a time. Stops at the
+ * first block containing a byte with the high bit set. Returns the number
+ * of bytes converted (a multiple of 16); the caller decodes the rest.
+ */
+static uint decodeASCIIRun(const char *src, uint avail, u32char_type_t *dst) {
+	const __m128i zero = _mm_setzero_si128();
+	uint done = 0;
+
+	while (done + 16 <= avail) {
+		const __m128i chunk = _mm_loadu_si128((const __m128i *)(src + done));
+		if (_mm_movemask_epi8(chunk) != 0)
+			break;
+
+		const __m128i lo16 = _mm_unpacklo_epi8(chunk, zero);
+		const __m128i hi16 = _mm_unpackhi_epi8(chunk, zero);
+		_mm_storeu_si128((__m128i *)(dst + done),      _mm_unpacklo_epi16(lo16, zero));
+		_mm_storeu_si128((__m128i *)(dst + done + 4),  _mm_unpackhi_epi16(lo16, zero));
+		_mm_storeu_si128((__m128i *)(dst + done + 8),  _mm_unpacklo_epi16(hi16, zero));
+		_mm_storeu_si128((__m128i *)(dst + done + 12), _mm_unpackhi_epi16(hi16, zero));
+		done += 16;
+	}
+
+	return done;
+}
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+static inline bool strEncHasSIMD() {
+	return true;
+}
+
+static uint decodeASCIIRun(const char *src, uint avail, u32char_type_t *dst) {
+	uint done = 0;
+
+	while (done + 16 <= avail) {
+		const uint8x16_t chunk = vld1q_u8((const uint8_t *)(src + done));
+
+		// Stop on the first block with a non-ASCII byte
+		uint8x8_t m = vpmax_u8(vget_low_u8(chunk), vget_high_u8(chunk));
+		m = vpmax_u8(m, m);
+		m = vpmax_u8(m, m);
+		m = vpmax_u8(m, m);
+		if (vget_lane_u8(m, 0) > 0x7F)
+			break;
+
+		const uint16x8_t lo16 = vmovl_u8(vget_low_u8(chunk));
+		const uint16x8_t hi16 = vmovl_u8(vget_high_u8(chunk));
+		vst1q_u32((uint32_t *)(dst + done),      vmovl_u16(vget_low_u16(lo16)));
+		vst1q_u32((uint32_t *)(dst + done + 4),  vmovl_u16(vget_high_u16(lo16)));
+		vst1q_u32((uint32_t *)(dst + done + 8),  vmovl_u16(vget_low_u16(hi16)));
+		vst1q_u32((uint32_t *)(dst + done + 12), vmovl_u16(vget_high_u16(hi16)));
+		done += 16;
+	}
+
+	return done;
+}
+
+#endif
+
+#endif // STRENC_SIMD
+
 // //TODO: This is a quick and dirty converter. Refactoring needed:
 // 1. Original version has an option for performing strict / nonstrict
 //    conversion for the 0xD800...0xDFFF interval
@@ -39,13 +118,17 @@ namespace Common {
 //
 // More comprehensive one lives in wintermute/utils/convert_utf.cpp
 void U32String::decodeUTF8(const char *src, uint32 len) {
-	ensureCapacity(len, false);
+	ensureCapacity(_size + len, false);
 
 	// The String class, and therefore the Font class as well, assume one
 	// character is one byte, but in this case it's actually an UTF-8
 	// string with up to 4 bytes per character. To work around this,
 	// convert it to an U32String before drawing it, because our Font class
 	// can handle that.
+	//
+	// The output can never exceed one character per input byte, so after
+	// the ensureCapacity call above the decoded characters are written
+	// straight into the storage instead of going through operator+=.
 	for (uint i = 0; i < len;) {
 		uint32 chr = 0;
 		uint num = 1;
@@ -56,6 +139,18 @@ void U32String::decodeUTF8(const char *src, uint32 len) {
 			num = 3;
 		} else if ((src[i] & 0xE0) == 0xC0) {
 			num = 2;
+		} else if (!(src[i] & 0x80)) {
+			// ASCII fast path: copy the whole run in one go
+#ifdef STRENC_SIMD
+			if (strEncHasSIMD()) {
+				const uint done = decodeASCIIRun(src + i, len - i, _str + _size);
+				i += done;
+				_size += done;
+			}
+#endif
+			while (i < len && !(src[i] & 0x80))
+				_str[_size++] = (value_type)src[i++];
+			continue;
 		}
 
 		if (len - i >= num) {
@@ -86,8 +181,9 @@ void U32String::decodeUTF8(const char *src, uint32 len) {
 			break;
 		}
 
-		operator+=(chr);
+		_str[_size++] = chr;
 	}
+	_str[_size] = 0;
 }
 
 const uint16 invalidCode = 0xFFFD;
@@ -587,7 +683,19 @@ void String::encodeUTF8(const U32String &src) {
 
 		uint32 ch = src[i++];
 		if (ch < (uint32)0x80) {
-			bytesToWrite = 1;
+			// ASCII fast path: narrow the whole run with a single
+			// capacity check instead of one string append per character.
+			uint runEnd = i;
+			while (runEnd < src.size() && src[runEnd] < (uint32)0x80)
+				runEnd++;
+			const uint runLen = 1 + (runEnd - i);
+
+			ensureCapacity(_size + runLen, true);
+			_str[_size++] = (char)ch;
+			for (; i < runEnd; i++)
+				_str[_size++] = (char)src[i];
+			_str[_size] = 0;
+			continue;
 		} else if (ch < (uint32)0x800) {
 			bytesToWrite = 2;
 		} else if (ch < (uint32)0x10000) {
@@ -300,6 +300,12 @@ namespace {
  * Wrapper class which adds buffering to any given ReadStream.
  * Users can specify how big the buffer should be, and whether the
  * wrapped stream should be disposed when the wrapper is disposed.
+ *
+ * If maxBufSize is larger than bufSize, the readahead window adapts to the
+ * access pattern: every sequential refill doubles the window up to
+ * maxBufSize, and a seek outside the buffer shrinks it back to bufSize.
+ * Streaming consumers then hit the (possibly slow) parent stream with few,
+ * large requests, while random access keeps the small window.
  */
 class BufferedReadStream : virtual public ReadStream {
 protected:
@@ -309,9 +315,11 @@ protected:
 	bool _eos; // end of stream
 	uint32 _bufSize;
 	uint32 _realBufSize;
+	uint32 _initialBufSize;
+	uint32 _maxBufSize;
 
 public:
-	BufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream);
+	BufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream, uint32 maxBufSize = 0);
 	virtual ~BufferedReadStream();
 
 	bool eos() const override { return _eos; }
@@ -321,15 +329,17 @@ public:
 	uint32 read(void *dataPtr, uint32 dataSize) override;
 };
 
-BufferedReadStream::BufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
+BufferedReadStream::BufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream, uint32 maxBufSize)
 	: _parentStream(parentStream, disposeParentStream),
 	_pos(0),
 	_eos(false),
 	_bufSize(0),
-	_realBufSize(bufSize) {
+	_realBufSize(bufSize),
+	_initialBufSize(bufSize),
+	_maxBufSize(MAX(bufSize, maxBufSize)) {
 
 	assert(parentStream);
-	_buf = new byte[bufSize];
+	_buf = new byte[_maxBufSize];
 	assert(_buf);
 }
 
@@ -370,6 +380,12 @@ uint32 BufferedReadStream::read(void *dataPtr, uint32 dataSize) {
 			return alreadyRead + n;
 		}
 
+		// The buffer was consumed sequentially, so widen the readahead
+		// window (if the stream allows for it) before refilling; streaming
+		// consumers then trigger fewer refills as they go.
+		if (_realBufSize < _maxBufSize)
+			_realBufSize = MIN(_realBufSize * 2, _maxBufSize);
+
 		// Refill the buffer.
 		// If we didn't read as many bytes as requested, the reason
 		// is EOF or an error. In that case we truncate the buffer
@@ -402,6 +418,12 @@ ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, Dis
 	return nullptr;
 }
 
+ReadStream *wrapAdaptiveBufferedReadStream(ReadStream *parentStream, uint32 bufSize, uint32 maxBufSize, DisposeAfterUse::Flag disposeParentStream) {
+	if (parentStream)
+		return new BufferedReadStream(parentStream, bufSize, disposeParentStream, maxBufSize);
+	return nullptr;
+}
+
 #pragma mark -
 
 namespace {
@@ -414,7 +436,7 @@ class BufferedSeekableReadStream : public BufferedReadStream, public SeekableRea
 protected:
 	SeekableReadStream *_parentStream;
 public:
-	BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream = DisposeAfterUse::NO);
+	BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream = DisposeAfterUse::NO, uint32 maxBufSize = 0);
 
 	int64 pos() const override { return _parentStream->pos() - (_bufSize - _pos); }
 	int64 size() const override { return _parentStream->size(); }
@@ -422,8 +444,8 @@ public:
 	bool seek(int64 offset, int whence = SEEK_SET) override;
 };
 
-BufferedSeekableReadStream::BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
-	: BufferedReadStream(parentStream, bufSize, disposeParentStream),
+BufferedSeekableReadStream::BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream, uint32 maxBufSize)
+	: BufferedReadStream(parentStream, bufSize, disposeParentStream, maxBufSize),
 	_parentStream(parentStream) {
 }
 
@@ -465,6 +487,9 @@ bool BufferedSeekableReadStream::seek(int64 offset, int whence) {
 		// full advantage of the buffer by saving its actual start position.
 		// This seems not worth the effort for this seemingly uncommon use.
 		_pos = _bufSize = 0;
+		// The access pattern is not sequential after all, so shrink the
+		// readahead window back to its initial size.
+		_realBufSize = _initialBufSize;
 		_parentStream->seek(offset, whence);
 	}
 
@@ -479,6 +504,12 @@ SeekableReadStream *wrapBufferedSeekableReadStream(SeekableReadStream *parentStr
 	return nullptr;
 }
 
+SeekableReadStream *wrapAdaptiveBufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, uint32 maxBufSize, DisposeAfterUse::Flag disposeParentStream) {
+	if (parentStream)
+		return new BufferedSeekableReadStream(parentStream, bufSize, disposeParentStream, maxBufSize);
+	return nullptr;
+}
+
 #pragma mark -
 
 namespace {
@@ -28,6 +28,7 @@
 #include "common/archive.h"
 #include "common/debug.h"
 #include "common/unarj.h"
+#include "common/extractcache.h"
 #include "common/file.h"
 #include "common/hash-str.h"
 #include "common/memstream.h"
@@ -779,6 +780,16 @@ SeekableReadStream *ArjArchive::createReadStreamForMember(const Path &path) cons
 
 	ArjHeader *hdr = _headers[name];
 
+	// Serve repeated extractions of compressed members from the cache. The
+	// archive is usually opened once for detection and once by the engine,
+	// so without the cache every member is decompressed at least twice per
+	// launch.
+	if (hdr->method != 0) {
+		SeekableReadStream *cached = ExtractCacheMan.createReadStream(_arjFilename, name);
+		if (cached)
+			return cached;
+	}
+
 	File archiveFile;
 	archiveFile.open(_arjFilename);
 	archiveFile.seek(hdr->pos, SEEK_SET);
@@ -807,6 +818,8 @@ SeekableReadStream *ArjArchive::createReadStreamForMember(const Path &path) cons
 			decoder->decode_f(hdr->origSize);
 
 		delete decoder;
+
+		return ExtractCacheMan.storeAndCreateReadStream(_arjFilename, name, uncompressedData, hdr->origSize);
 	}
 
 	return new MemoryReadStream(uncompressedData, hdr->origSize, DisposeAfterUse::YES);
@@ -105,7 +105,7 @@ typedef struct {
 
 #include "common/fs.h"
 #include "common/unzip.h"
-#include "common/memstream.h"
+#include "common/substream.h"
 
 #include "common/hashmap.h"
 #include "common/hash-str.h"
@@ -393,6 +393,10 @@ typedef struct {
 	uLong offset_central_dir;		/* offset of start of central directory with
 									respect to the starting disk number */
 
+	uLong next_num_file;			/* number of the next central dir entry to index*/
+	uLong next_pos_in_central_dir;	/* pos of that entry in the central dir*/
+	uLong dir_fully_indexed;		/* flag set once every entry is in the hash*/
+
 	unz_file_info cur_file_info;					/* public info about the current file in zip*/
 	unz_file_info_internal cur_file_info_internal;	/* private info about it*/
 	file_in_zip_read_info_s* pfile_in_zip_read;		/* structure about the current
@@ -607,25 +611,14 @@ unzFile unzOpen(Common::SeekableReadStream *stream) {
 
 	err = unzGoToFirstFile((unzFile)us);
 
-	while (err == UNZ_OK) {
-		// Get the file details
-		char szCurrentFileName[UNZ_MAXFILENAMEINZIP+1];
-		unzGetCurrentFileInfo(us, nullptr, szCurrentFileName, sizeof(szCurrentFileName) - 1,
-							nullptr, 0, nullptr, 0);
-
-		// Save details into the hash
-		cached_file_in_zip fe;
-		fe.num_file = us->num_file;
-		fe.pos_in_central_dir = us->pos_in_central_dir;
-		fe.current_file_ok = us->current_file_ok;
-		fe.cur_file_info = us->cur_file_info;
-		fe.cur_file_info_internal = us->cur_file_info_internal;
+	// The filename hash is filled in lazily: entries are parsed out of the
+	// central directory the first time they are looked up (see
+	// unzlocal_IndexMoreFiles), so opening an archive does not pay for
+	// members that are never accessed.
+	us->next_num_file = 0;
+	us->next_pos_in_central_dir = us->offset_central_dir;
+	us->dir_fully_indexed = (err != UNZ_OK);
 
-		us->_hash[Common::String(szCurrentFileName)] = fe;
-
-		// Move to the next file
-		err = unzGoToNextFile((unzFile)us);
-	}
 	return (unzFile)us;
 }
 
@@ -906,6 +899,60 @@ int unzGoToNextFile(unzFile file) {
 	return err;
 }
 
+/*
+  Parse central directory entries into the filename hash, resuming from
+  where the previous scan stopped. The scan stops early once szFileName
+  has been indexed; pass NULL to index the whole remaining directory.
+
+  return 1 if szFileName was found, 0 otherwise
+*/
+static int unzlocal_IndexMoreFiles(unz_s *s, const char *szFileName) {
+	uLong saved_pos_in_central_dir = s->pos_in_central_dir;
+	int found = 0;
+
+	while (!s->dir_fully_indexed) {
+		unz_file_info file_info;
+		unz_file_info_internal file_info_internal;
+		char szCurrentFileName[UNZ_MAXFILENAMEINZIP+1];
+
+		s->pos_in_central_dir = s->next_pos_in_central_dir;
+		if (unzlocal_GetCurrentFileInfoInternal((unzFile)s, &file_info, &file_info_internal,
+				szCurrentFileName, sizeof(szCurrentFileName) - 1,
+				nullptr, 0, nullptr, 0) != UNZ_OK) {
+			// Cannot parse any further; treat the remaining entries as absent
+			s->dir_fully_indexed = 1;
+			break;
+		}
+
+		// Save details into the hash
+		cached_file_in_zip fe;
+		fe.num_file = s->next_num_file;
+		fe.pos_in_central_dir = s->next_pos_in_central_dir;
+		fe.current_file_ok = 1;
+		fe.cur_file_info = file_info;
+		fe.cur_file_info_internal = file_info_internal;
+
+		s->_hash[Common::String(szCurrentFileName)] = fe;
+
+		// Advance the scan cursor to the next entry
+		s->next_num_file++;
+		s->next_pos_in_central_dir += SIZECENTRALDIRITEM + file_info.size_filename +
+				file_info.size_file_extra + file_info.size_file_comment;
+		if (s->next_num_file == s->gi.number_entry)
+			s->dir_fully_indexed = 1;
+
+		// Matching mirrors the hash lookup below, which has always been
+		// case insensitive.
+		if (szFileName != nullptr && scumm_stricmp(szCurrentFileName, szFileName) == 0) {
+			found = 1;
+			break;
+		}
+	}
+
+	s->pos_in_central_dir = saved_pos_in_central_dir;
+	return found;
+}
+
 /*
   Try locate the file szFileName in the zipfile.
   For the iCaseSensitivity signification, see unzipStringFileNameCompare
@@ -927,10 +974,17 @@ int unzLocateFile(unzFile file, const char *szFileName, int iCaseSensitivity) {
 	if (!s->current_file_ok)
 		return UNZ_END_OF_LIST_OF_FILE;
 
-	// Check to see if the entry exists
+	// Check to see if the entry has been indexed already
 	ZipHash::iterator i = s->_hash.find(Common::String(szFileName));
-	if (i == s->_hash.end())
-		return UNZ_END_OF_LIST_OF_FILE;
+	if (i == s->_hash.end()) {
+		// Not seen so far; keep parsing the central directory until the
+		// entry turns up (or the directory is exhausted)
+		if (!unzlocal_IndexMoreFiles(s, szFileName))
+			return UNZ_END_OF_LIST_OF_FILE;
+		i = s->_hash.find(Common::String(szFileName));
+		if (i == s->_hash.end())
+			return UNZ_END_OF_LIST_OF_FILE;
+	}
 
 	// Found it, so reset the details in the main structure
 	cached_file_in_zip &fe = i->_value;
@@ -1453,6 +1507,154 @@ public:
 };
 */
 
+#ifdef USE_ZLIB
+
+/**
+ * A stream which inflates a deflated zip member on the fly from the shared
+ * archive stream, instead of decompressing the whole member into memory up
+ * front. Every input refill re-seeks the archive stream, so multiple member
+ * streams of the same archive can be used independently (much like a
+ * SafeSeekableSubReadStream, and with the same caveat that the archive must
+ * only be used from a single thread).
+ */
+class ZipMemberReadStream : public SeekableReadStream {
+	enum {
+		BUFSIZE = UNZ_BUFSIZE
+	};
+
+	byte _buf[BUFSIZE];
+
+	SeekableReadStream *_archive;	// not owned, shared with the unz_s handle
+	z_stream _stream;
+	int _zlibErr;
+	uint32 _compStart;	// offset of the compressed data in the archive stream
+	uint32 _compSize;	// size of the compressed data
+	uint32 _compPos;	// compressed bytes consumed so far
+	uint32 _uncompSize;	// size of the uncompressed data
+	uint32 _pos;
+	bool _eos;
+
+public:
+	ZipMemberReadStream(SeekableReadStream *archive, uint32 compStart, uint32 compSize, uint32 uncompSize)
+		: _archive(archive), _stream(), _compStart(compStart), _compSize(compSize), _compPos(0),
+		  _uncompSize(uncompSize), _pos(0), _eos(false) {
+		// windowBits is passed < 0 to tell zlib that zip members are raw
+		// deflate data without a zlib header.
+		_zlibErr = inflateInit2(&_stream, -MAX_WBITS);
+
+		_stream.next_in = _buf;
+		_stream.avail_in = 0;
+	}
+
+	~ZipMemberReadStream() {
+		inflateEnd(&_stream);
+	}
+
+	bool err() const override { return (_zlibErr != Z_OK) && (_zlibErr != Z_STREAM_END); }
+	void clearErr() override {
+		// only reset _eos; I/O errors are not recoverable
+		_eos = false;
+	}
+
+	uint32 read(void *dataPtr, uint32 dataSize) override {
+		uint32 toRead = dataSize;
+		if (toRead > _uncompSize - _pos)
+			toRead = _uncompSize - _pos;
+
+		_stream.next_out = (byte *)dataPtr;
+		_stream.avail_out = toRead;
+
+		// Keep going while we get no error
+		while (_zlibErr == Z_OK && _stream.avail_out) {
+			if (_stream.avail_in == 0 && _compPos < _compSize) {
+				// If we are out of input data: Read more data, if available.
+				uint32 uReadThis = BUFSIZE;
+				if (uReadThis > _compSize - _compPos)
+					uReadThis = _compSize - _compPos;
+				// The archive stream is shared, so position it explicitly.
+				_archive->seek(_compStart + _compPos, SEEK_SET);
+				if (_archive->read(_buf, uReadThis) != uReadThis) {
+					_zlibErr = Z_ERRNO;
+					break;
+				}
+				_compPos += uReadThis;
+				_stream.next_in = _buf;
+				_stream.avail_in = uReadThis;
+			}
+			_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+			// A raw deflate stream is not followed by the extra "dummy" byte
+			// inflate wants before reporting Z_STREAM_END, so completion is
+			// detected from the known uncompressed size instead (see the
+			// matching comment in unzOpenCurrentFile).
+			if (_zlibErr == Z_BUF_ERROR && _stream.avail_in == 0 && _compPos == _compSize)
+				break;
+		}
+
+		// Update the position counter
+		uint32 readBytes = toRead - _stream.avail_out;
+		_pos += readBytes;
+
+		if (readBytes < dataSize)
+			_eos = true;
+
+		return readBytes;
+	}
+
+	bool eos() const override {
+		return _eos;
+	}
+	int64 pos() const override {
+		return _pos;
+	}
+	int64 size() const override {
+		return _uncompSize;
+	}
+	bool seek(int64 offset, int whence = SEEK_SET) override {
+		int32 newPos = 0;
+		switch (whence) {
+		default:
+			// fallthrough intended
+		case SEEK_SET:
+			newPos = offset;
+			break;
+		case SEEK_CUR:
+			newPos = _pos + offset;
+			break;
+		case SEEK_END:
+			newPos = size() + offset;
+			break;
+		}
+
+		assert(newPos >= 0);
+
+		if ((uint32)newPos < _pos) {
+			// To seek backward, we have to restart the decompression from
+			// the start of the member, just like GZipReadStream does.
+			_zlibErr = inflateReset(&_stream);
+			if (_zlibErr != Z_OK)
+				return false;
+			_pos = 0;
+			_compPos = 0;
+			_stream.next_in = _buf;
+			_stream.avail_in = 0;
+		}
+
+		offset = newPos - _pos;
+
+		// Skip the given amount of data (very inefficient if one tries to skip
+		// huge amounts of data, but usually client code will only skip a few
+		// bytes, so this should be fine.
+		byte tmpBuf[1024];
+		while (!err() && offset > 0)
+			offset -= read(tmpBuf, MIN((int64)sizeof(tmpBuf), offset));
+
+		_eos = false;
+		return true;
+	}
+};
+
+#endif	// USE_ZLIB
+
 ZipArchive::ZipArchive(unzFile zipFile) : _zipFile(zipFile) {
 	assert(_zipFile);
 }
@@ -1469,7 +1671,11 @@ bool ZipArchive::hasFile(const Path &path) const {
 int ZipArchive::listMembers(ArchiveMemberList &list) const {
 	int members = 0;
 
-	const unz_s *const archive = (const unz_s *)_zipFile;
+	unz_s *const archive = (unz_s *)_zipFile;
+
+	// Listing needs the whole central directory in the hash
+	unzlocal_IndexMoreFiles(archive, nullptr);
+
 	for (ZipHash::const_iterator i = archive->_hash.begin(), end = archive->_hash.end();
 	     i != end; ++i) {
 		list.push_back(ArchiveMemberList::value_type(new GenericArchiveMember(i->_key, this)));
@@ -1492,32 +1698,37 @@ SeekableReadStream *ZipArchive::createReadStreamForMember(const Path &path) cons
 	if (unzLocateFile(_zipFile, name.c_str(), 2) != UNZ_OK)
 		return nullptr;
 
-	unz_file_info fileInfo;
-	if (unzOpenCurrentFile(_zipFile) != UNZ_OK)
-		return nullptr;
+	unz_s *s = (unz_s *)_zipFile;
 
-	if (unzGetCurrentFileInfo(_zipFile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK)
+	// Find the start of the member data by checking the local header, the
+	// same way unzOpenCurrentFile does.
+	uInt iSizeVar;
+	uLong offset_local_extrafield;
+	uInt size_local_extrafield;
+	if (unzlocal_CheckCurrentFileCoherencyHeader(s, &iSizeVar,
+				&offset_local_extrafield, &size_local_extrafield) != UNZ_OK)
 		return nullptr;
 
-	byte *buffer = (byte *)malloc(fileInfo.uncompressed_size);
-	assert(buffer);
-
-	if (unzReadCurrentFile(_zipFile, buffer, fileInfo.uncompressed_size) != (int)fileInfo.uncompressed_size) {
-		free(buffer);
-		return nullptr;
-	}
+	uint32 dataStart = s->cur_file_info_internal.offset_curfile +
+			SIZEZIPLOCALHEADER + iSizeVar + s->byte_before_the_zipfile;
 
-	if (unzCloseCurrentFile(_zipFile) != UNZ_OK) {
-		free(buffer);
-		return nullptr;
+	if (s->cur_file_info.compression_method == 0) {
+		// Stored members are served straight out of the archive stream. The
+		// substream re-seeks on every read, so independently opened members
+		// do not disturb each other.
+		return new SafeSeekableSubReadStream(s->_stream, dataStart,
+				dataStart + s->cur_file_info.uncompressed_size, DisposeAfterUse::NO);
 	}
 
-	return new MemoryReadStream(buffer, fileInfo.uncompressed_size, DisposeAfterUse::YES);
+#ifdef USE_ZLIB
+	if (s->cur_file_info.compression_method == Z_DEFLATED)
+		return new ZipMemberReadStream(s->_stream, dataStart,
+				s->cur_file_info.compressed_size, s->cur_file_info.uncompressed_size);
+#endif
 
-	// FIXME: instead of reading all into a memory stream, we could
-	// instead create a new ZipStream class. But then we have to be
-	// careful to handle the case where the client code opens multiple
-	// files in the archive and tries to use them independently.
+	// Cannot decompress the member (unsupported method, or zlib is not
+	// linked in).
+	return nullptr;
 }
 
 Archive *makeZipArchive(const String &name) {
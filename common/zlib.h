@@ -149,10 +149,19 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
  * stream is returned unmodified (and in particular, not wrapped).
  * The created stream also becomes responsible for freeing the passed stream.
  *
+ * The compression level can be tuned: levels 1 to 9 map to the zlib levels
+ * of the same name, while the default of -1 selects zlib's own default. A
+ * low level compresses considerably faster at a modest size cost, which
+ * matters for big writers such as save states; the output stays an ordinary
+ * gzip stream either way, so older readers are not affected.
+ *
  * It is safe to call this with a NULL parameter (in this case, NULL is
  * returned).
+ *
+ * @param toBeWrapped		the stream to wrap with compression
+ * @param compressionLevel	zlib compression level (1-9), or -1 for the zlib default
  */
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped);
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, int compressionLevel = -1);
 
 /** @} */
 
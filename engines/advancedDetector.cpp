@@ -495,6 +495,98 @@ namespace Common {
 	DECLARE_SINGLETON(MD5CacheManager);
 }
 
+/** Return the path of the persistent md5 cache, next to the configuration file. */
+static Common::String md5CacheFilePath() {
+	Common::String configFile = g_system->getDefaultConfigFileName();
+
+	for (int i = configFile.size() - 1; i >= 0; i--) {
+		if (configFile[i] == '/' || configFile[i] == '\\')
+			return Common::String(configFile.c_str(), i + 1) + "md5cache.txt";
+	}
+
+	return "md5cache.txt";
+}
+
+void MD5CacheManager::clear() {
+	// Entries with a modification time are revalidated on every lookup
+	// and thus can be kept; only drop those we cannot check.
+	Common::StringArray unverifiable;
+	for (FileHashMap::const_iterator i = md5HashMap.begin(); i != md5HashMap.end(); ++i) {
+		if (getMtime(i->_key) == 0)
+			unverifiable.push_back(i->_key);
+	}
+
+	for (uint i = 0; i < unverifiable.size(); i++) {
+		md5HashMap.erase(unverifiable[i]);
+		sizeHashMap.erase(unverifiable[i]);
+		mtimeHashMap.erase(unverifiable[i]);
+	}
+}
+
+void MD5CacheManager::load() {
+	if (_loaded)
+		return;
+	_loaded = true;
+
+	Common::SeekableReadStream *stream = Common::FSNode(md5CacheFilePath()).createReadStream();
+	if (!stream)
+		return;
+
+	// One entry per line: md5, size and mtime, then the cache key, which
+	// may itself contain spaces.
+	while (!stream->eos()) {
+		Common::String line = stream->readLine();
+
+		char md5[64];
+		long long size = 0;
+		unsigned int mtime = 0;
+		int keyPos = -1;
+		if (sscanf(line.c_str(), "%63s %lld %u %n", md5, &size, &mtime, &keyPos) < 3 || keyPos < 0)
+			continue;
+
+		Common::String key(line.c_str() + keyPos);
+		if (key.empty() || mtime == 0)
+			continue;
+
+		md5HashMap.setVal(key, Common::String(md5));
+		sizeHashMap.setVal(key, size);
+		mtimeHashMap.setVal(key, mtime);
+	}
+
+	delete stream;
+	_dirty = false;
+}
+
+void MD5CacheManager::save() {
+	if (!_dirty)
+		return;
+
+	Common::DumpFile f;
+	Common::String path = md5CacheFilePath();
+	if (!f.open(path, true)) {
+		warning("MD5CacheManager: failed to open '%s' for writing", path.c_str());
+		return;
+	}
+
+	for (FileHashMap::const_iterator i = md5HashMap.begin(); i != md5HashMap.end(); ++i) {
+		uint32 mtime = getMtime(i->_key);
+		if (mtime == 0)
+			continue;
+
+		Common::String line = Common::String::format("%s %lld %u %s\n",
+		        i->_value.c_str(), (long long)sizeHashMap.getVal(i->_key), mtime, i->_key.c_str());
+		if (f.write(line.c_str(), line.size()) != line.size()) {
+			warning("MD5CacheManager: failed to write '%s'", path.c_str());
+			return;
+		}
+	}
+
+	f.flush();
+	f.finalize();
+	f.close();
+	_dirty = false;
+}
+
 // Sync with engines/game.cpp
 static char flagsToMD5Prefix(uint32 flags) {
 	if (flags & ADGF_MACRESFORK) {
@@ -511,9 +603,26 @@ static char flagsToMD5Prefix(uint32 flags) {
 static bool getFilePropertiesIntern(uint md5Bytes, const AdvancedMetaEngine::FileMap &allFiles, const ADGameDescription &game, const Common::String fname, FileProperties &fileProps);
 
 bool AdvancedMetaEngineDetection::getFileProperties(const FileMap &allFiles, const ADGameDescription &game, const Common::String fname, FileProperties &fileProps) const {
-	Common::String hashname = Common::String::format("%c:%s:%d", flagsToMD5Prefix(game.flags), fname.c_str(), _md5Bytes);
-
-	if (MD5Man.contains(hashname)) {
+	MD5Man.load();
+
+	// Key the cache by the path of the physical file rather than its name
+	// within the scanned directory: that way hashes survive across the
+	// per-directory detection runs of a mass add, and a file picked up by
+	// several nested scans is read and hashed only once per session.
+	// Files reached through Mac resource fork variants are not in allFiles
+	// under their requested name and are left uncached.
+	Common::String hashname;
+	uint32 mtime = 0;
+	if (allFiles.contains(fname)) {
+		const Common::FSNode &node = allFiles[fname];
+		hashname = Common::String::format("%c:%s:%d", flagsToMD5Prefix(game.flags), node.getPath().c_str(), _md5Bytes);
+		mtime = node.lastModified();
+	}
+
+	// A cached entry is only trusted while the file's modification time
+	// matches the recorded one, so entries persisted by earlier runs are
+	// revalidated without reading the file's contents.
+	if (!hashname.empty() && MD5Man.contains(hashname) && MD5Man.getMtime(hashname) == mtime) {
 		fileProps.md5 = MD5Man.getMD5(hashname);
 		fileProps.size = MD5Man.getSize(hashname);
 		return true;
@@ -521,9 +630,10 @@ bool AdvancedMetaEngineDetection::getFileProperties(const FileMap &allFiles, con
 
 	bool res = getFilePropertiesIntern(_md5Bytes, allFiles, game, fname, fileProps);
 
-	if (res) {
+	if (res && !hashname.empty()) {
 		MD5Man.setMD5(hashname, fileProps.md5);
 		MD5Man.setSize(hashname, fileProps.size);
+		MD5Man.setMtime(hashname, mtime);
 	}
 
 	return res;
@@ -523,6 +523,7 @@ class MD5CacheManager : public Common::Singleton<MD5CacheManager> {
 public:
 	void setMD5(Common::String fname, Common::String md5) {
 		md5HashMap.setVal(fname, md5);
+		_dirty = true;
 	}
 
 	Common::String getMD5(Common::String fname) {
@@ -537,26 +538,55 @@ public:
 		return sizeHashMap.getVal(fname);
 	}
 
+	void setMtime(Common::String fname, uint32 mtime) {
+		mtimeHashMap.setVal(fname, mtime);
+	}
+
+	uint32 getMtime(Common::String fname) {
+		return mtimeHashMap.getValOrDefault(fname);
+	}
+
 	bool contains(Common::String fname) {
 		return (md5HashMap.contains(fname) && sizeHashMap.contains(fname));
 	}
 
-	MD5CacheManager() {
-		clear();
+	MD5CacheManager() : _loaded(false), _dirty(false) {
 	}
 
-	void clear() {
-		md5HashMap.clear(true);
-		sizeHashMap.clear(true);
-	}
+	/**
+	 * Drop the entries that cannot be revalidated against the file
+	 * system. Entries with a recorded modification time are kept: they
+	 * are checked against the file's current mtime on every lookup, so
+	 * they can never go stale.
+	 */
+	void clear();
+
+	/**
+	 * Load the cache persisted next to the configuration file, if any.
+	 * No-op after the first call.
+	 */
+	void load();
+
+	/**
+	 * Persist the cache next to the configuration file, so repeat
+	 * detections of unchanged files are metadata-only. Only entries
+	 * with a modification time are written; without one an entry
+	 * cannot be revalidated on a later run. No-op when nothing changed.
+	 */
+	void save();
 
 private:
 	friend class Common::Singleton<MD5CacheManager>;
 
 	typedef Common::HashMap<Common::String, Common::String, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileHashMap;
 	typedef Common::HashMap<Common::String, int64, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SizeHashMap;
+	typedef Common::HashMap<Common::String, uint32, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> MtimeHashMap;
 	FileHashMap md5HashMap;
 	SizeHashMap sizeHashMap;
+	MtimeHashMap mtimeHashMap;
+
+	bool _loaded;
+	bool _dirty;
 };
 
 /** Convenience shortcut for accessing the MD5CacheManager. */
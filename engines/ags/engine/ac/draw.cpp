@@ -713,7 +713,7 @@ void invalidate_cached_walkbehinds() {
 // of it with transparent pixels where there are walk-behind areas
 // Returns whether any pixels were updated
 int sort_out_walk_behinds(Bitmap *sprit, int xx, int yy, int basel, Bitmap *copyPixelsFrom = nullptr, Bitmap *checkPixelsFrom = nullptr, int zoom = 100) {
-	if (_G(noWalkBehindsAtAll))
+	if (_G(noWalkBehindsAtAll) || _G(walkBehindColOffset).empty())
 		return 0;
 
 	if ((!_GP(thisroom).WalkBehindMask->IsMemoryBitmap()) ||
@@ -761,59 +761,66 @@ int sort_out_walk_behinds(Bitmap *sprit, int xx, int yy, int basel, Bitmap *copy
 		if (rr < 0)
 			rr = 0;
 
-		for (; rr < toheight; rr++) {
-
-			// we're ok with _getpixel because we've checked the screen edges
-			//tmm = _getpixel(_GP(thisroom).WalkBehindMask,ee+xx,rr+yy);
-			// actually, _getpixel is well inefficient, do it ourselves
-			// since we know it's 8-bit bitmap
-			tmm = _GP(thisroom).WalkBehindMask->GetScanLine(rr + yy)[ee + xx];
-			if (tmm < 1) continue;
+		// iterate the vertical runs baked from the mask by
+		// recache_walk_behinds, rather than re-reading the mask per pixel
+		const int firstrow = rr;
+		for (int run = _G(walkBehindColOffset)[ee + xx]; run < _G(walkBehindColOffset)[ee + xx + 1]; run++) {
+			tmm = _G(walkBehindRunId)[run];
 			if (_G(croom)->walkbehind_base[tmm] <= basel) continue;
 
-			if (copyPixelsFrom != nullptr) {
-				if (spcoldep <= 8) {
-					if (checkPixelsFrom->GetScanLine((rr * 100) / zoom)[(ee * 100) / zoom] != maskcol) {
-						sprit->GetScanLineForWriting(rr)[ee] = copyPixelsFrom->GetScanLine(rr + yy)[ee + xx];
-						pixelsChanged = 1;
-					}
-				} else if (spcoldep <= 16) {
-					shptr = (short *)&sprit->GetScanLine(rr)[0];
-					shptr2 = (short *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
-					if (shptr2[(ee * 100) / zoom] != maskcol) {
-						shptr[ee] = ((short *)(&copyPixelsFrom->GetScanLine(rr + yy)[0]))[ee + xx];
-						pixelsChanged = 1;
-					}
-				} else if (spcoldep == 24) {
-					char *chptr = (char *)&sprit->GetScanLine(rr)[0];
-					char *chptr2 = (char *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
-					if (memcmp(&chptr2[((ee * 100) / zoom) * 3], &maskcol, 3) != 0) {
-						memcpy(&chptr[ee * 3], &copyPixelsFrom->GetScanLine(rr + yy)[(ee + xx) * 3], 3);
-						pixelsChanged = 1;
-					}
-				} else if (spcoldep <= 32) {
-					loptr = (int *)&sprit->GetScanLine(rr)[0];
-					loptr2 = (int *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
-					if (loptr2[(ee * 100) / zoom] != maskcol) {
-						loptr[ee] = ((int *)(&copyPixelsFrom->GetScanLine(rr + yy)[0]))[ee + xx];
-						pixelsChanged = 1;
+			int rowfrom = _G(walkBehindRunTop)[run] - yy;
+			int rowto = _G(walkBehindRunBottom)[run] - yy;
+			if (rowfrom < firstrow)
+				rowfrom = firstrow;
+			if (rowto > toheight)
+				rowto = toheight;
+
+			for (rr = rowfrom; rr < rowto; rr++) {
+
+				if (copyPixelsFrom != nullptr) {
+					if (spcoldep <= 8) {
+						if (checkPixelsFrom->GetScanLine((rr * 100) / zoom)[(ee * 100) / zoom] != maskcol) {
+							sprit->GetScanLineForWriting(rr)[ee] = copyPixelsFrom->GetScanLine(rr + yy)[ee + xx];
+							pixelsChanged = 1;
+						}
+					} else if (spcoldep <= 16) {
+						shptr = (short *)&sprit->GetScanLine(rr)[0];
+						shptr2 = (short *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
+						if (shptr2[(ee * 100) / zoom] != maskcol) {
+							shptr[ee] = ((short *)(&copyPixelsFrom->GetScanLine(rr + yy)[0]))[ee + xx];
+							pixelsChanged = 1;
+						}
+					} else if (spcoldep == 24) {
+						char *chptr = (char *)&sprit->GetScanLine(rr)[0];
+						char *chptr2 = (char *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
+						if (memcmp(&chptr2[((ee * 100) / zoom) * 3], &maskcol, 3) != 0) {
+							memcpy(&chptr[ee * 3], &copyPixelsFrom->GetScanLine(rr + yy)[(ee + xx) * 3], 3);
+							pixelsChanged = 1;
+						}
+					} else if (spcoldep <= 32) {
+						loptr = (int *)&sprit->GetScanLine(rr)[0];
+						loptr2 = (int *)&checkPixelsFrom->GetScanLine((rr * 100) / zoom)[0];
+						if (loptr2[(ee * 100) / zoom] != maskcol) {
+							loptr[ee] = ((int *)(&copyPixelsFrom->GetScanLine(rr + yy)[0]))[ee + xx];
+							pixelsChanged = 1;
+						}
 					}
+				} else {
+					pixelsChanged = 1;
+					if (spcoldep <= 8)
+						sprit->GetScanLineForWriting(rr)[ee] = maskcol;
+					else if (spcoldep <= 16) {
+						shptr = (short *)&sprit->GetScanLine(rr)[0];
+						shptr[ee] = maskcol;
+					} else if (spcoldep == 24) {
+						char *chptr = (char *)&sprit->GetScanLine(rr)[0];
+						memcpy(&chptr[ee * 3], &maskcol, 3);
+					} else if (spcoldep <= 32) {
+						loptr = (int *)&sprit->GetScanLine(rr)[0];
+						loptr[ee] = maskcol;
+					} else
+						quit("!Sprite colour depth >32 ??");
 				}
-			} else {
-				pixelsChanged = 1;
-				if (spcoldep <= 8)
-					sprit->GetScanLineForWriting(rr)[ee] = maskcol;
-				else if (spcoldep <= 16) {
-					shptr = (short *)&sprit->GetScanLine(rr)[0];
-					shptr[ee] = maskcol;
-				} else if (spcoldep == 24) {
-					char *chptr = (char *)&sprit->GetScanLine(rr)[0];
-					memcpy(&chptr[ee * 3], &maskcol, 3);
-				} else if (spcoldep <= 32) {
-					loptr = (int *)&sprit->GetScanLine(rr)[0];
-					loptr[ee] = maskcol;
-				} else
-					quit("!Sprite colour depth >32 ??");
 			}
 		}
 	}
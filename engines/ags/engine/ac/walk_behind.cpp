@@ -97,8 +97,17 @@ void recache_walk_behinds() {
 
 	update_polled_stuff_if_runtime();
 
+	// Bake the mask into vertical runs per column while scanning it, so the
+	// per-frame sprite compositing doesn't have to re-read the mask per pixel.
+	_G(walkBehindColOffset).clear();
+	_G(walkBehindRunTop).clear();
+	_G(walkBehindRunBottom).clear();
+	_G(walkBehindRunId).clear();
+
 	for (ee = 0; ee < _GP(thisroom).WalkBehindMask->GetWidth(); ee++) {
 		_G(walkBehindExists)[ee] = 0;
+		_G(walkBehindColOffset).push_back((int)_G(walkBehindRunTop).size());
+		int run_id = 0;
 		for (rr = 0; rr < _GP(thisroom).WalkBehindMask->GetHeight(); rr++) {
 			tmm = _GP(thisroom).WalkBehindMask->GetScanLine(rr)[ee];
 			//tmm = _getpixel(_GP(thisroom).WalkBehindMask,ee,rr);
@@ -110,13 +119,25 @@ void recache_walk_behinds() {
 				}
 				_G(walkBehindEndY)[ee] = rr + 1;  // +1 to allow bottom line of screen to work
 
+				if (tmm != run_id) {
+					_G(walkBehindRunTop).push_back(rr);
+					_G(walkBehindRunBottom).push_back(rr + 1);
+					_G(walkBehindRunId).push_back(tmm);
+				} else {
+					_G(walkBehindRunBottom).back() = rr + 1;
+				}
+				run_id = tmm;
+
 				if (ee < _G(walkBehindLeft)[tmm]) _G(walkBehindLeft)[tmm] = ee;
 				if (rr < _G(walkBehindTop)[tmm]) _G(walkBehindTop)[tmm] = rr;
 				if (ee > _G(walkBehindRight)[tmm]) _G(walkBehindRight)[tmm] = ee;
 				if (rr > _G(walkBehindBottom)[tmm]) _G(walkBehindBottom)[tmm] = rr;
+			} else {
+				run_id = 0;
 			}
 		}
 	}
+	_G(walkBehindColOffset).push_back((int)_G(walkBehindRunTop).size());
 
 	if (_G(walkBehindMethod) == DrawAsSeparateSprite) {
 		update_walk_behind_images();
@@ -41,6 +41,9 @@ using namespace AGS;
 #define CC_STACK_SIZE       250
 #define CC_STACK_DATA_SIZE  (1000 * sizeof(int32_t))
 #define MAX_CALL_STACK      100
+// Size of the direct-mapped decoded-op cache kept per instance; must be a
+// power of two since entries are selected with (pc & (size - 1)).
+#define CC_OP_CACHE_SIZE    1024
 
 // 256 because we use 8 bits to hold instance number
 #define MAX_LOADED_INSTANCES 256
@@ -72,6 +75,20 @@ struct ScriptOperation {
 	int                 ArgCount;
 };
 
+// A decoded operation remembered by the interpreter, tagged with the bytecode
+// address it was decoded from and the import table generation it was decoded
+// under (see SystemImports::GetGeneration()).
+struct ScriptCachedOp {
+	ScriptCachedOp() {
+		at_pc = -1;
+		import_gen = 0;
+	}
+
+	int32_t         at_pc;      // bytecode address, -1 marks an empty slot
+	uint32_t        import_gen;
+	ScriptOperation op;
+};
+
 struct ScriptVariable {
 	ScriptVariable() {
 		ScAddress = -1; // address = 0 is valid one, -1 means undefined
@@ -144,6 +161,11 @@ public:
 
 	char *code_fixups;
 
+	// Direct-mapped cache of decoded operations, indexed by pc. Operations
+	// with stack-relative arguments are never stored here, since their
+	// decoded value depends on the stack pointer at execution time.
+	ScriptCachedOp *op_cache;
+
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
 	// create a runnable instance of the supplied script
@@ -29,6 +29,8 @@ extern void quit(const char *);
 int SystemImports::add(const String &name, const RuntimeScriptValue &value, ccInstance *anotherscr) {
 	int ixof;
 
+	generation++;
+
 	if ((ixof = get_index_of(name)) >= 0) {
 		// Only allow override if not a script-exported function
 		if (anotherscr == nullptr) {
@@ -59,6 +61,7 @@ void SystemImports::remove(const String &name) {
 	int idx = get_index_of(name);
 	if (idx < 0)
 		return;
+	generation++;
 	btree.erase(imports[idx].Name);
 	imports[idx].Name = nullptr;
 	imports[idx].Value.Invalidate();
@@ -118,6 +121,7 @@ void SystemImports::RemoveScriptExports(ccInstance *inst) {
 		return;
 	}
 
+	generation++;
 	for (size_t i = 0; i < imports.size(); ++i) {
 		if (imports[i].Name == nullptr)
 			continue;
@@ -132,6 +136,7 @@ void SystemImports::RemoveScriptExports(ccInstance *inst) {
 }
 
 void SystemImports::clear() {
+	generation++;
 	btree.clear();
 	imports.clear();
 }
@@ -51,13 +51,21 @@ private:
 
 	std::vector<ScriptImport> imports;
 	IndexMap btree;
+	// Bumped whenever the table changes; lets dependent caches (such as
+	// ccInstance's decoded-op cache) notice that resolved imports are stale.
+	uint32_t generation;
 
 public:
+	SystemImports() : generation(0) {}
+
 	int  add(const String &name, const RuntimeScriptValue &value, ccInstance *inst);
 	void remove(const String &name);
 	const ScriptImport *getByName(const String &name);
 	int  get_index_of(const String &name);
 	const ScriptImport *getByIndex(int index);
+	uint32_t GetGeneration() const {
+		return generation;
+	}
 	String findName(const RuntimeScriptValue &value);
 	void RemoveScriptExports(ccInstance *inst);
 	void clear();
@@ -1360,6 +1360,14 @@ public:
 
 	char *_walkBehindExists = nullptr;  // whether a WB area is in this column
 	int *_walkBehindStartY = nullptr, *_walkBehindEndY = nullptr;
+	// Vertical walk-behind spans baked per mask column by recache_walk_behinds;
+	// _walkBehindColOffset[x] .. _walkBehindColOffset[x + 1] delimit column x's
+	// runs in the three run arrays below. Saves re-reading the mask per pixel
+	// when compositing sprites against walk-behinds each frame.
+	std::vector<int> _walkBehindColOffset;
+	std::vector<int> _walkBehindRunTop;
+	std::vector<int> _walkBehindRunBottom; // exclusive
+	std::vector<int8> _walkBehindRunId;
 	int8 _noWalkBehindsAtAll = 0;
 	int _walkBehindLeft[MAX_WALK_BEHINDS], _walkBehindTop[MAX_WALK_BEHINDS];
 	int _walkBehindRight[MAX_WALK_BEHINDS], _walkBehindBottom[MAX_WALK_BEHINDS];
@@ -167,6 +167,48 @@ void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 	int xStart = (dstRect.left < destRect.left) ? dstRect.left - destRect.left : 0;
 	int yStart = (dstRect.top < destRect.top) ? dstRect.top - destRect.top : 0;
 
+	// Fast path for the most common sprite draws: same format on both
+	// sides, no flipping and no blending. Sprites are converted to the
+	// game's color depth when they are loaded, so nearly every draw
+	// qualifies, and the generic per-pixel loop below is far too slow
+	// for it.
+	if (sameFormat && srcAlpha == -1 && !horizFlip && !vertFlip) {
+		const int bpp = format.bytesPerPixel;
+		const int visW = MIN(dstRect.width() + xStart, (int)destArea.w);
+		const int visH = MIN(dstRect.height() + yStart, (int)destArea.h);
+
+		for (int destY = 0; destY < visH; ++destY) {
+			const byte *srcP = (const byte *)src.getBasePtr(
+			                       srcArea.left - xStart, srcArea.top - yStart + destY);
+			byte *destP = (byte *)destArea.getBasePtr(0, destY);
+
+			if (!skipTrans) {
+				memcpy(destP, srcP, visW * bpp);
+			} else if (bpp == 4) {
+				const uint32 *srcPix = (const uint32 *)srcP;
+				uint32 *destPix = (uint32 *)destP;
+				for (int destX = 0; destX < visW; ++destX, ++srcPix, ++destPix) {
+					if ((*srcPix & alphaMask) != transColor)
+						*destPix = *srcPix;
+				}
+			} else if (bpp == 2) {
+				const uint16 *srcPix = (const uint16 *)srcP;
+				uint16 *destPix = (uint16 *)destP;
+				for (int destX = 0; destX < visW; ++destX, ++srcPix, ++destPix) {
+					if ((*srcPix & alphaMask) != transColor)
+						*destPix = *srcPix;
+				}
+			} else {
+				for (int destX = 0; destX < visW; ++destX) {
+					if (srcP[destX] != (byte)transColor)
+						destP[destX] = srcP[destX];
+				}
+			}
+		}
+
+		return;
+	}
+
 	for (int destY = yStart, yCtr = 0; yCtr < dstRect.height(); ++destY, ++yCtr) {
 		if (destY < 0 || destY >= destArea.h)
 			continue;
@@ -66,6 +66,7 @@ Screen::~Screen() {
 	_backBuffer.free();
 
 	clearTransTables();
+	clearGraphicCache();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -94,11 +95,42 @@ void Screen::drawTransparent(ResourceId resourceId, uint32 frameIndex, const Com
 
 void Screen::draw(ResourceId resourceId, uint32 frameIndex, const Common::Point &source, DrawFlags flags, ResourceId resourceIdDestination, const Common::Point &destination, bool colorKey) {
 	// Get the frame to draw
-	GraphicResource *resource = new GraphicResource(_vm, resourceId);
+	GraphicResource *resource = getGraphicResource(resourceId);
 
 	draw(resource, frameIndex, source, flags, resourceIdDestination, destination, colorKey);
+}
 
-	delete resource;
+GraphicResource *Screen::getGraphicResource(ResourceId resourceId) {
+	// Check for an already decoded copy of the resource
+	for (uint32 i = 0; i < _graphicCache.size(); i++) {
+		if (_graphicCache[i]->getResourceId() == resourceId) {
+			// Move the entry to the front of the cache
+			if (i > 0) {
+				GraphicResource *resource = _graphicCache[i];
+				_graphicCache.remove_at(i);
+				_graphicCache.insert_at(0, resource);
+			}
+
+			return _graphicCache[0];
+		}
+	}
+
+	// Decode the resource, evicting the least recently used entry if needed
+	if (_graphicCache.size() >= kGraphicCacheSize) {
+		delete _graphicCache[_graphicCache.size() - 1];
+		_graphicCache.remove_at(_graphicCache.size() - 1);
+	}
+
+	_graphicCache.insert_at(0, new GraphicResource(_vm, resourceId));
+
+	return _graphicCache[0];
+}
+
+void Screen::clearGraphicCache() {
+	for (uint32 i = 0; i < _graphicCache.size(); i++)
+		delete _graphicCache[i];
+
+	_graphicCache.clear();
 }
 
 void Screen::draw(GraphicResource *resource, uint32 frameIndex, const Common::Point &source, DrawFlags flags, bool colorKey) {
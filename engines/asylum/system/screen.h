@@ -127,6 +127,12 @@ public:
 	void deleteGraphicFromQueue(ResourceId resourceId);
 	bool isGraphicQueueEmpty() { return _queueItems.empty(); }
 
+	/**
+	 * Clears the decoded graphic resource cache (called when a scene
+	 * resource pack is unloaded)
+	 */
+	void clearGraphicCache();
+
 	// Used by Video
 	void copyToBackBuffer(const byte *buffer, int32 pitch, int16 x, int16 y, uint16 width, uint16 height, bool mirrored = false);
 
@@ -179,6 +185,13 @@ private:
 	// Graphic queue
 	static bool graphicQueueItemComparator(const GraphicQueueItem &item1, const GraphicQueueItem &item2);
 
+	// Decoded graphic resource cache, most recently used entry first. The
+	// graphic queue references the same handful of resources on every frame,
+	// so reloading and re-decoding them for each queue item is wasted work
+	static const uint32 kGraphicCacheSize = 16;
+	Common::Array<GraphicResource *> _graphicCache;
+	GraphicResource *getGraphicResource(ResourceId resourceId);
+
 	// Misc
 	void clip(Common::Rect *source, Common::Rect *destination, int32 flags) const;
 
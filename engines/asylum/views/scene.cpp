@@ -82,6 +82,9 @@ Scene::~Scene() {
 	// Unload the associated resources
 	getResource()->unload(_packId);
 
+	// Drop any graphics decoded from the unloaded pack
+	getScreen()->clearGraphicCache();
+
 	// Clear script queue
 	getScript()->reset();
 
@@ -62,6 +62,17 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	// All-zero tables correspond to a zero increment, which keeps the
+	// lookup table cache coherent from the first draw on
+	memset(_m11lookup, 0, sizeof(_m11lookup));
+	memset(_m12lookup, 0, sizeof(_m12lookup));
+	memset(_m21lookup, 0, sizeof(_m21lookup));
+	memset(_m22lookup, 0, sizeof(_m22lookup));
+	_m11lookupInc = 0;
+	_m12lookupInc = 0;
+	_m21lookupInc = 0;
+	_m22lookupInc = 0;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -363,12 +374,19 @@ void SliceLineIterator::advance() {
 	_sliceMatrix._m[1][2] += _field_38 * 64.0f;
 }
 
-static void setupLookupTable(int t[256], int inc) {
+static void setupLookupTable(int t[256], int inc, int &cachedInc) {
+	// The table is a pure function of the increment, which only changes
+	// when the actor's facing or scale or the camera changes, so tables
+	// from the previous frame are usually still valid
+	if (inc == cachedInc) {
+		return;
+	}
 	int v = 0;
 	for (int i = 0; i != 256; ++i) {
 		t[i] = v;
 		v += inc;
 	}
+	cachedInc = inc;
 }
 
 void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer) {
@@ -420,11 +438,11 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 	_setEffectColor.g = setEffectColor.g * 31.0f * 65536.0f;
 	_setEffectColor.b = setEffectColor.b * 31.0f * 65536.0f;
 
-	setupLookupTable(_m12lookup, sliceLineIterator._sliceMatrix(0, 1));
-	setupLookupTable(_m11lookup, sliceLineIterator._sliceMatrix(0, 0));
+	setupLookupTable(_m12lookup, sliceLineIterator._sliceMatrix(0, 1), _m12lookupInc);
+	setupLookupTable(_m11lookup, sliceLineIterator._sliceMatrix(0, 0), _m11lookupInc);
 	_m13 = sliceLineIterator._sliceMatrix(0, 2);
-	setupLookupTable(_m21lookup, sliceLineIterator._sliceMatrix(1, 0));
-	setupLookupTable(_m22lookup, sliceLineIterator._sliceMatrix(1, 1));
+	setupLookupTable(_m21lookup, sliceLineIterator._sliceMatrix(1, 0), _m21lookupInc);
+	setupLookupTable(_m22lookup, sliceLineIterator._sliceMatrix(1, 1), _m22lookupInc);
 	_m23 = sliceLineIterator._sliceMatrix(1, 2);
 
 	if (_animationsShadowEnabled[_animation]) {
@@ -513,11 +531,11 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 
 	Matrix3x2 m = mScaleFixed * (mTranslate * (mScale * (mRotation * mFrame)));
 
-	setupLookupTable(_m11lookup, m(0, 0));
-	setupLookupTable(_m12lookup, m(0, 1));
+	setupLookupTable(_m11lookup, m(0, 0), _m11lookupInc);
+	setupLookupTable(_m12lookup, m(0, 1), _m12lookupInc);
 	_m13 = m(0, 2);
-	setupLookupTable(_m21lookup, m(1, 0));
-	setupLookupTable(_m22lookup, m(1, 1));
+	setupLookupTable(_m21lookup, m(1, 0), _m21lookupInc);
+	setupLookupTable(_m22lookup, m(1, 1), _m22lookupInc);
 	_m23 = m(1, 2);
 
 	int frameY = screenY + (size / 2.0f * frameHeight);
@@ -545,6 +563,11 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// The whole slice goes to one scanline, so clip the row and compute its
+	// base address once instead of per pixel
+	byte *dstLine = (byte *)surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	const int bytesPerPixel = surface.format.bytesPerPixel;
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -586,12 +609,12 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
+					const int endX = MIN<int>(vertexX, surface.w);
+					for (int x = previousVertexX; x < endX; ++x) {
 						if (vertexZ < zbufferLine[x]) {
 							zbufferLine[x] = (uint16)vertexZ;
 
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+							drawPixel(surface, dstLine + x * bytesPerPixel, outColor);
 						}
 					}
 				}
@@ -81,6 +81,13 @@ class SliceRenderer {
 	int _m22lookup[256];
 	int _m23;
 
+	// Increments the lookup tables above were last built from, so tables
+	// that have not changed since the previous frame are not rebuilt
+	int _m11lookupInc;
+	int _m12lookupInc;
+	int _m21lookupInc;
+	int _m22lookupInc;
+
 	bool _animationsShadowEnabled[997];
 
 	Vector3 _shadowPolygonDefault[12];
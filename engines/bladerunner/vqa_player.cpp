@@ -28,6 +28,7 @@
 
 #include "audio/decoders/raw.h"
 
+#include "common/bufferedstream.h"
 #include "common/system.h"
 
 namespace BladeRunner {
@@ -38,6 +39,13 @@ bool VQAPlayer::open() {
 		return false;
 	}
 
+	// The decoder reads each frame in small chunks and the audio pre-queue
+	// seeks up to kMaxAudioPreloadedFrames ahead of the video frame on
+	// every update. Buffering the stream keeps that interleave window in
+	// memory, so most of the per-chunk reads and short seeks never reach
+	// the underlying storage.
+	_s = Common::wrapBufferedSeekableReadStream(_s, 128 * 1024, DisposeAfterUse::YES);
+
 	if (!_decoder.loadStream(_s)) {
 		delete _s;
 		_s = nullptr;
@@ -140,6 +140,11 @@ const Graphics::Surface *AVIFrames::getFrame(int frameIndex) {
 		_tempFrame = copy;
 	}
 
+	// Remember the frame we just decoded, so asking for it again doesn't
+	// seek and decode it once more
+	_lastFrame = copy;
+	_lastFrameIndex = frameIndex;
+
 	return copy;
 }
 
@@ -171,6 +176,13 @@ bool AVIFrames::flushFrameCache() {
 		}
 	}
 
+	// Drop the stale entries, so a flushed or reopened cache can't hand
+	// out pointers to freed frames
+	_cachedFrames.clear();
+
+	_lastFrame = nullptr;
+	_lastFrameIndex = -1;
+
 	return true;
 }
 
@@ -186,6 +198,11 @@ void AVIFrames::addFrameToCache(int frameIndex, Graphics::Surface *frame) {
 	if (_cachedFrames.size() >= _maxCachedFrames) {
 		CachedFrame &cachedFrame = _cachedFrames.front();
 		if (cachedFrame.frame) {
+			if (cachedFrame.frame == _lastFrame) {
+				_lastFrame = nullptr;
+				_lastFrameIndex = -1;
+			}
+
 			cachedFrame.frame->free();
 			delete cachedFrame.frame;
 		}
@@ -205,16 +205,20 @@ bool SceneViewWindow::showCompletionScene() {
 }
 
 bool SceneViewWindow::getSceneStaticData(const Location &location, LocationStaticData &sceneStaticData) {
-	int curTimeZone = -1;
-	int curEnvironment = -1;
+	Common::Array<LocationStaticData> *navDatabase = nullptr;
 
-	if (!_currentNavigationDatabase.empty()) {
-		curTimeZone = _currentNavigationDatabase[0].location.timeZone;
-		curEnvironment = _currentNavigationDatabase[0].location.environment;
+	for (uint32 i = 0; i < _navigationDatabases.size(); i++) {
+		if (location.timeZone == _navigationDatabases[i].timeZone &&
+				location.environment == _navigationDatabases[i].environment) {
+			navDatabase = &_navigationDatabases[i].data;
+			break;
+		}
 	}
 
-	if (location.timeZone != curTimeZone || location.environment != curEnvironment) {
-		_currentNavigationDatabase.clear();
+	if (!navDatabase) {
+		NavigationDatabase newDatabase;
+		newDatabase.timeZone = location.timeZone;
+		newDatabase.environment = location.environment;
 
 		int resID = _vm->computeNavDBResourceID(location.timeZone, location.environment);
 		Common::SeekableReadStream *resource = _vm->getNavData(resID);
@@ -292,21 +296,30 @@ bool SceneViewWindow::getSceneStaticData(const Location &location, LocationStati
 			locationStaticData.cycleStartFrame = resource->readSint32LE();
 			locationStaticData.cycleFrameCount = resource->readSint32LE();
 
-			_currentNavigationDatabase.push_back(locationStaticData);
+			newDatabase.data.push_back(locationStaticData);
 		}
 
-		if (_currentNavigationDatabase.empty())
+		delete resource;
+
+		if (newDatabase.data.empty())
 			return false;
+
+		if (_navigationDatabases.size() >= kMaxCachedNavDatabases)
+			_navigationDatabases.remove_at(0);
+
+		_navigationDatabases.push_back(newDatabase);
+		navDatabase = &_navigationDatabases.back().data;
 	}
 
-	for (uint32 i = 0; i < _currentNavigationDatabase.size(); i++) {
-		if (location.timeZone == _currentNavigationDatabase[i].location.timeZone &&
-				location.environment == _currentNavigationDatabase[i].location.environment &&
-				location.node == _currentNavigationDatabase[i].location.node &&
-				location.facing == _currentNavigationDatabase[i].location.facing &&
-				location.orientation == _currentNavigationDatabase[i].location.orientation &&
-				location.depth == _currentNavigationDatabase[i].location.depth) {
-			sceneStaticData = _currentNavigationDatabase[i];
+	for (uint32 i = 0; i < navDatabase->size(); i++) {
+		const LocationStaticData &candidate = (*navDatabase)[i];
+		if (location.timeZone == candidate.location.timeZone &&
+				location.environment == candidate.location.environment &&
+				location.node == candidate.location.node &&
+				location.facing == candidate.location.facing &&
+				location.orientation == candidate.location.orientation &&
+				location.depth == candidate.location.depth) {
+			sceneStaticData = candidate;
 			return true;
 		}
 	}
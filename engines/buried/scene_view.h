@@ -168,9 +168,21 @@ public:
 	const SceneBase *getCurrentScene() const { return _currentScene; }
 
 private:
+	// A parsed navigation database for one environment. Transitions ask for
+	// static data from both the source and the destination environment, and
+	// jumps frequently return to an environment visited before, so several
+	// parsed databases are kept around instead of just the current one.
+	struct NavigationDatabase {
+		int timeZone;
+		int environment;
+		Common::Array<LocationStaticData> data;
+	};
+
+	static const uint kMaxCachedNavDatabases = 8;
+
 	Graphics::Surface *_preBuffer;
 	SceneBase *_currentScene;
-	Common::Array<LocationStaticData> _currentNavigationDatabase;
+	Common::Array<NavigationDatabase> _navigationDatabases;
 	GlobalFlags _globalFlags;
 	VideoWindow *_walkMovie;
 
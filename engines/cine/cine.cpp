@@ -63,6 +63,8 @@ CineEngine::CineEngine(OSystem *syst, const CINEGameDescription *gameDesc)
 	}
 	_restartRequested = false;
 	_preLoad = false;
+	_unpackedCacheSize = 0;
+	_unpackedCacheTick = 0;
 	setDefaultGameSpeed();
 }
 
@@ -93,6 +93,14 @@ struct VolumeResource {
 
 typedef Common::HashMap<Common::String, Common::Array<VolumeResource> > StringToVolumeResourceArrayHashMap;
 
+/** An unpacked bundle entry kept resident by the cache in readBundleFile(). */
+struct UnpackedCacheEntry {
+	Common::Array<byte> data;
+	uint32 lastUsed;
+};
+
+typedef Common::HashMap<Common::String, UnpackedCacheEntry> StringToUnpackedCacheEntryHashMap;
+
 class CineConsole;
 
 class CineEngine : public Engine {
@@ -137,6 +145,13 @@ public:
 
 	StringToVolumeResourceArrayHashMap _volumeEntriesMap;
 
+	// Cache of unpacked bundle entries keyed by part and entry name, so
+	// that part transitions which re-request animation banks don't hit
+	// the disk and the unpacker again
+	StringToUnpackedCacheEntryHashMap _unpackedCache;
+	uint32 _unpackedCacheSize;
+	uint32 _unpackedCacheTick;
+
 	TextHandler _textHandler;
 
 	bool _restartRequested;
@@ -252,24 +252,63 @@ void readFromPart(int16 idx, byte *dataPtr, uint32 maxSize) {
 	g_cine->_partFileHandle.read(dataPtr, g_cine->_partBuffer[idx].packedSize);
 }
 
+// How many bytes of unpacked bundle entries to keep resident. Bundle
+// contents are immutable, so cached entries stay valid across part
+// switches and switching back doesn't unpack everything again.
+static const uint32 kUnpackedCacheBudget = 2 * 1024 * 1024;
+
 byte *readBundleFile(int16 foundFileIdx, uint32 *size) {
 	assert(foundFileIdx >= 0 && foundFileIdx < (int32)g_cine->_partBuffer.size());
 	bool error = false;
-	byte *dataPtr = (byte *)calloc(g_cine->_partBuffer[foundFileIdx].unpackedSize, 1);
+	uint32 unpackedSize = g_cine->_partBuffer[foundFileIdx].unpackedSize;
+	byte *dataPtr = (byte *)calloc(unpackedSize, 1);
+	assert(dataPtr);
+
+	// Set the size variable if a pointer to it has been given
+	if (size != nullptr) {
+		*size = unpackedSize;
+	}
+
+	Common::String cacheKey = Common::String::format("%s/%s", currentPartName, g_cine->_partBuffer[foundFileIdx].partName);
+	StringToUnpackedCacheEntryHashMap::iterator cacheIt = g_cine->_unpackedCache.find(cacheKey);
+	if (cacheIt != g_cine->_unpackedCache.end() && cacheIt->_value.data.size() == unpackedSize) {
+		memcpy(dataPtr, &cacheIt->_value.data.front(), unpackedSize);
+		cacheIt->_value.lastUsed = ++g_cine->_unpackedCacheTick;
+		return dataPtr;
+	}
+
 	byte *packedData = (byte *)calloc(g_cine->_partBuffer[foundFileIdx].packedSize, 1);
-	assert(dataPtr && packedData);
+	assert(packedData);
 	readFromPart(foundFileIdx, packedData, g_cine->_partBuffer[foundFileIdx].packedSize);
 	CineUnpacker cineUnpacker;
-	error = !cineUnpacker.unpack(packedData, g_cine->_partBuffer[foundFileIdx].packedSize, dataPtr, g_cine->_partBuffer[foundFileIdx].unpackedSize);
+	error = !cineUnpacker.unpack(packedData, g_cine->_partBuffer[foundFileIdx].packedSize, dataPtr, unpackedSize);
 	free(packedData);
 
 	if (error) {
 		warning("Error unpacking '%s' from bundle file '%s'", g_cine->_partBuffer[foundFileIdx].partName, currentPartName);
+		return dataPtr;
 	}
 
-	// Set the size variable if a pointer to it has been given
-	if (size != nullptr) {
-		*size = g_cine->_partBuffer[foundFileIdx].unpackedSize;
+	// Keep a copy of the unpacked entry, evicting the least recently used
+	// entries if the budget is exceeded
+	if (unpackedSize > 0 && unpackedSize <= kUnpackedCacheBudget / 4) {
+		UnpackedCacheEntry &entry = g_cine->_unpackedCache[cacheKey];
+		// Replacing an entry (e.g. after a failed size match) frees its old copy
+		g_cine->_unpackedCacheSize -= entry.data.size();
+		entry.data.resize(unpackedSize);
+		memcpy(&entry.data.front(), dataPtr, unpackedSize);
+		entry.lastUsed = ++g_cine->_unpackedCacheTick;
+		g_cine->_unpackedCacheSize += unpackedSize;
+
+		while (g_cine->_unpackedCacheSize > kUnpackedCacheBudget) {
+			StringToUnpackedCacheEntryHashMap::iterator oldest = g_cine->_unpackedCache.end();
+			for (StringToUnpackedCacheEntryHashMap::iterator it = g_cine->_unpackedCache.begin(); it != g_cine->_unpackedCache.end(); ++it) {
+				if (oldest == g_cine->_unpackedCache.end() || it->_value.lastUsed < oldest->_value.lastUsed)
+					oldest = it;
+			}
+			g_cine->_unpackedCacheSize -= oldest->_value.data.size();
+			g_cine->_unpackedCache.erase(oldest);
+		}
 	}
 
 	return dataPtr;
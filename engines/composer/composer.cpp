@@ -64,6 +64,7 @@ ComposerEngine::~ComposerEngine() {
 		delete i->_archive;
 	for (Common::List<Sprite>::iterator i = _sprites.begin(); i != _sprites.end(); i++)
 		i->_surface.free();
+	clearSpriteCache();
 
 	delete _rnd;
 }
@@ -434,6 +435,9 @@ void ComposerEngine::loadLibrary(uint id) {
 		error("failed to open '%s'", filename.c_str());
 	_libraries.push_front(library);
 
+	// The new library takes precedence for sprite lookups
+	clearSpriteCache();
+
 	Library &newLib = _libraries.front();
 
 	Common::Array<uint16> buttonResources = library._archive->getResourceIDList(ID_BUTN);
@@ -518,6 +522,7 @@ void ComposerEngine::unloadLibrary(uint id) {
 			j->_surface.free();
 		}
 		_sprites.clear();
+		clearSpriteCache();
 		i->_buttons.clear();
 
 		_lastButton = nullptr;
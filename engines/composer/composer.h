@@ -188,6 +188,15 @@ private:
 	Graphics::Surface _screen;
 	Common::List<Sprite> _sprites;
 
+	// Cache of sprites decoded from the loaded libraries, most recently
+	// used entry first. Pipe sprites are not cached, since a pipe can
+	// stream new contents for an id it already used
+	struct CachedSprite {
+		uint16 _id;
+		Graphics::Surface _surface;
+	};
+	Common::List<CachedSprite> _spriteCache;
+
 	uint _directoriesToStrip;
 	Common::INIFile _bookIni;
 	Common::String _bookGroup;
@@ -262,7 +271,8 @@ private:
 	void setBackground(uint16 id);
 	void decompressBitmap(uint16 type, Common::SeekableReadStream *stream, byte *buffer, uint32 size, uint width, uint height);
 	bool initSprite(Sprite &sprite);
-	Common::SeekableReadStream *getStreamForSprite(uint16 id);
+	Common::SeekableReadStream *getStreamForSprite(uint16 id, bool &fromPipe);
+	void clearSpriteCache();
 	void drawSprite(const Sprite &sprite);
 };
 
@@ -788,11 +788,13 @@ void ComposerEngine::decompressBitmap(uint16 type, Common::SeekableReadStream *s
 	}
 }
 
-Common::SeekableReadStream *ComposerEngine::getStreamForSprite(uint16 id) {
+Common::SeekableReadStream *ComposerEngine::getStreamForSprite(uint16 id, bool &fromPipe) {
+	fromPipe = false;
 	for (Common::List<Pipe *>::iterator k = _pipes.begin(); k != _pipes.end(); k++) {
 		Pipe *pipe = *k;
 		if (!pipe->hasResource(ID_BMAP, id))
 			continue;
+		fromPipe = true;
 		return pipe->getResource(ID_BMAP, id, true);
 	}
 	if (hasResource(ID_BMAP, id))
@@ -801,10 +803,31 @@ Common::SeekableReadStream *ComposerEngine::getStreamForSprite(uint16 id) {
 }
 
 bool ComposerEngine::initSprite(Sprite &sprite) {
-	Common::SeekableReadStream *stream = getStreamForSprite(sprite._id);
+	// Animations add and remove the same library sprites over and over, so
+	// library sprites are served from a decoded cache. Pipe sprites bypass
+	// it: a pipe can stream new contents for an id, and the scripts depend
+	// on getting the fresh version
+	bool fromPipe;
+	Common::SeekableReadStream *stream = getStreamForSprite(sprite._id, fromPipe);
 	if (!stream)
 		return false;
 
+	if (!fromPipe) {
+		for (Common::List<CachedSprite>::iterator i = _spriteCache.begin(); i != _spriteCache.end(); i++) {
+			if (i->_id != sprite._id)
+				continue;
+			sprite._surface.copyFrom(i->_surface);
+			// Move the entry to the front of the cache
+			if (i != _spriteCache.begin()) {
+				CachedSprite entry = *i;
+				_spriteCache.erase(i);
+				_spriteCache.push_front(entry);
+			}
+			delete stream;
+			return true;
+		}
+	}
+
 	uint16 type = stream->readUint16LE();
 	int16 height = stream->readSint16LE();
 	int16 width = stream->readSint16LE();
@@ -825,9 +848,29 @@ bool ComposerEngine::initSprite(Sprite &sprite) {
 	}
 	delete stream;
 
+	if (!fromPipe) {
+		// Keep a copy of the decoded sprite, evicting the least recently
+		// used entry if the cache is full
+		const uint kSpriteCacheSize = 16;
+		if (_spriteCache.size() >= kSpriteCacheSize) {
+			_spriteCache.back()._surface.free();
+			_spriteCache.pop_back();
+		}
+		CachedSprite entry;
+		entry._id = sprite._id;
+		entry._surface.copyFrom(sprite._surface);
+		_spriteCache.push_front(entry);
+	}
+
 	return true;
 }
 
+void ComposerEngine::clearSpriteCache() {
+	for (Common::List<CachedSprite>::iterator i = _spriteCache.begin(); i != _spriteCache.end(); i++)
+		i->_surface.free();
+	_spriteCache.clear();
+}
+
 void ComposerEngine::drawSprite(const Sprite &sprite) {
 	int x = sprite._pos.x;
 	int y = sprite._pos.y;
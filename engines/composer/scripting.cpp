@@ -705,7 +705,8 @@ int16 ComposerEngine::scriptFuncCall(uint16 id, int16 param1, int16 param2, int1
 		width = 0;
 		height = 0;
 		{
-		Common::SeekableReadStream *stream = getStreamForSprite(param1);
+		bool fromPipe;
+		Common::SeekableReadStream *stream = getStreamForSprite(param1, fromPipe);
 		if (stream) {
 			stream->readUint16LE();
 			height = stream->readSint16LE();
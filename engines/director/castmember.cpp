@@ -201,16 +201,25 @@ void BitmapCastMember::copyStretchImg(Graphics::Surface *surface, const Common::
 		int scaleX = SCALE_THRESHOLD * _initialRect.width() / bbox.width();
 		int scaleY = SCALE_THRESHOLD * _initialRect.height() / bbox.height();
 
-		for (int y = 0, scaleYCtr = 0; y < bbox.height(); y++, scaleYCtr += scaleY) {
-			if (g_director->_wm->_pixelformat.bytesPerPixel == 1) {
+		// This copy runs every time a channel re-instantiates the widget,
+		// so work on row pointers instead of going through getBasePtr()
+		// for every pixel
+		const Graphics::Surface *imgSurface = _img->getSurface();
+
+		if (g_director->_wm->_pixelformat.bytesPerPixel == 1) {
+			for (int y = 0, scaleYCtr = 0; y < bbox.height(); y++, scaleYCtr += scaleY) {
+				const byte *src = (const byte *)imgSurface->getBasePtr(0, scaleYCtr / SCALE_THRESHOLD);
+				byte *dst = (byte *)surface->getBasePtr(0, y);
 				for (int x = 0, scaleXCtr = 0; x < bbox.width(); x++, scaleXCtr += scaleX) {
-					const byte *src = (const byte *)_img->getSurface()->getBasePtr(scaleXCtr / SCALE_THRESHOLD, scaleYCtr / SCALE_THRESHOLD);
-					*(byte *)surface->getBasePtr(x, y) = *src;
+					dst[x] = src[scaleXCtr / SCALE_THRESHOLD];
 				}
-			} else {
+			}
+		} else {
+			for (int y = 0, scaleYCtr = 0; y < bbox.height(); y++, scaleYCtr += scaleY) {
+				const int *src = (const int *)imgSurface->getBasePtr(0, scaleYCtr / SCALE_THRESHOLD);
+				int *dst = (int *)surface->getBasePtr(0, y);
 				for (int x = 0, scaleXCtr = 0; x < bbox.width(); x++, scaleXCtr += scaleX) {
-					const int *src = (const int *)_img->getSurface()->getBasePtr(scaleXCtr / SCALE_THRESHOLD, scaleYCtr / SCALE_THRESHOLD);
-					*(int *)surface->getBasePtr(x, y) = *src;
+					dst[x] = src[scaleXCtr / SCALE_THRESHOLD];
 				}
 			}
 		}
@@ -234,9 +243,10 @@ void BitmapCastMember::createMatte(Common::Rect &bbox) {
 	bool colorFound = false;
 
 	if (g_director->_pixelformat.bytesPerPixel == 1) {
-		for (int y = 0; y < tmp.h; y++) {
+		for (int y = 0; y < tmp.h && !colorFound; y++) {
+			const byte *row = (const byte *)tmp.getBasePtr(0, y);
 			for (int x = 0; x < tmp.w; x++) {
-				byte color = *(byte *)tmp.getBasePtr(x, y);
+				byte color = row[x];
 
 				if (g_director->getPalette()[color * 3 + 0] == 0xff &&
 						g_director->getPalette()[color * 3 + 1] == 0xff &&
@@ -350,12 +350,14 @@ void Channel::setCast(CastMemberID memberID) {
 	replaceWidget();
 }
 
-void Channel::setClean(Sprite *nextSprite, int spriteId, bool partial) {
+void Channel::setClean(Sprite *nextSprite, int spriteId, bool partial, bool dirty) {
 	if (!nextSprite)
 		return;
 
+	// The caller already ran the change detection for this frame, so reuse
+	// its result instead of evaluating isDirty() a second time
 	CastMemberID previousCastId(0, 0);
-	bool replace = isDirty(nextSprite);
+	bool replace = dirty;
 
 	// for dirty situation that we need to replace widget.
 	// if cast are modified, then we need to replace it
@@ -61,7 +61,7 @@ public:
 	void setHeight(int h);
 	void setBbox(int l, int t, int r, int b);
 	void setCast(CastMemberID memberID);
-	void setClean(Sprite *nextSprite, int spriteId, bool partial = false);
+	void setClean(Sprite *nextSprite, int spriteId, bool partial, bool dirty);
 	void setEditable(bool editable);
 	void replaceSprite(Sprite *nextSprite);
 	void replaceWidget(CastMemberID previousCastId = CastMemberID(0, 0), bool force = false);
@@ -1205,10 +1205,16 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				(*_localvars)[name] = value;
-				return;
+			// Variable accesses are the hottest part of Lingo execution, so
+			// avoid copying the name and resolve each map through a single
+			// find() instead of a contains()/operator[] pair
+			const Common::String &name = *var.u.s;
+			if (_localvars) {
+				DatumHash::iterator it = _localvars->find(name);
+				if (it != _localvars->end()) {
+					it->_value = value;
+					return;
+				}
 			}
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				_currentMe.u.obj->setProp(name, value);
@@ -1226,9 +1232,10 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				(*_localvars)[name] = value;
+			const Common::String &name = *var.u.s;
+			DatumHash::iterator it = _localvars ? _localvars->find(name) : DatumHash::iterator();
+			if (_localvars && it != _localvars->end()) {
+				it->_value = value;
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
 			}
@@ -1236,7 +1243,7 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				_currentMe.u.obj->setProp(name, value);
 			} else {
@@ -1316,17 +1323,20 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 
-			if (_localvars && _localvars->contains(name)) {
-				return (*_localvars)[name];
+			if (_localvars) {
+				DatumHash::const_iterator it = _localvars->find(name);
+				if (it != _localvars->end()) {
+					return it->_value;
+				}
 			}
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				return _currentMe.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 
 			if (!silent)
@@ -1336,9 +1346,10 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			const Common::String &name = *var.u.s;
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 			warning("varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1346,9 +1357,12 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				return (*_localvars)[name];
+			const Common::String &name = *var.u.s;
+			if (_localvars) {
+				DatumHash::const_iterator it = _localvars->find(name);
+				if (it != _localvars->end()) {
+					return it->_value;
+				}
 			}
 			warning("varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1356,7 +1370,7 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				return _currentMe.u.obj->getProp(name);
 			}
@@ -556,11 +556,13 @@ void Score::renderSprites(uint16 frameId, RenderMode mode) {
 			_movie->_videoPlayback = true;
 		}
 
-		if (channel->isDirty(nextSprite) || widgetRedrawn || mode == kRenderForceUpdate) {
+		bool channelDirty = channel->isDirty(nextSprite);
+
+		if (channelDirty || widgetRedrawn || mode == kRenderForceUpdate) {
 			if (!currentSprite->_trails)
 				_window->addDirtyRect(channel->getBbox());
 
-			channel->setClean(nextSprite, i);
+			channel->setClean(nextSprite, i, false, channelDirty);
 			// Check again to see if a video has just been started by setClean.
 			if (channel->isActiveVideo())
 				_movie->_videoPlayback = true;
@@ -568,7 +570,7 @@ void Score::renderSprites(uint16 frameId, RenderMode mode) {
 			_window->addDirtyRect(channel->getBbox());
 			debugC(2, kDebugImages, "Score::renderSprites(): CH: %-3d castId: %s [ink: %d, puppet: %d, moveable: %d, visible: %d] [bbox: %d,%d,%d,%d] [type: %d fg: %d bg: %d] [script: %s]", i, currentSprite->_castId.asString().c_str(), currentSprite->_ink, currentSprite->_puppet, currentSprite->_moveable, channel->_visible, PRINT_RECT(channel->getBbox()), currentSprite->_spriteType, currentSprite->_foreColor, currentSprite->_backColor, currentSprite->_scriptId.asString().c_str());
 		} else {
-			channel->setClean(nextSprite, i, true);
+			channel->setClean(nextSprite, i, true, false);
 		}
 
 		// update editable text channel after we render the sprites. because for the current frame, we may get those sprites only when we finished rendering
@@ -150,19 +150,24 @@ void Screen::copyRectToSurface(const void *buffer, int srcPitch, int srcWidth, i
 	assert(height > 0 && destY + height <= _backSurface->h);
 	assert(width > 0 && destX + width <= _backSurface->w);
 
-	// Copy buffer data to internal buffer
+	// Copy buffer data to internal buffer. The source start offset and step
+	// are computed up front so the per-pixel loop doesn't have to re-derive
+	// the flipped index for every pixel
 	const byte *src = (const byte *)buffer;
 	byte *dst = (byte *)_backSurface->getBasePtr(destX, destY);
+	const int32 srcStart = flipX ? (srcWidth - (srcXOffset * 2) - 1) * 2 : 0;
+	const int32 srcStep = flipX ? -2 : 2;
 	for (int i = 0; i < height; i++) {
-		for (int j = 0; j < width; j++) {
-			int32 srcIdx = flipX ? srcWidth - (srcXOffset * 2) - j - 1 : j;
-			if (src[srcIdx * 2] != 0 || src[srcIdx * 2 + 1] != 0) {
-				if ((src[srcIdx * 2 + 1] & 0x80) == 0 || alpha == NONE) {
+		const byte *srcPixel = src + srcStart;
+		byte *dstPixel = dst;
+		for (int j = 0; j < width; j++, srcPixel += srcStep, dstPixel += 2) {
+			if (srcPixel[0] != 0 || srcPixel[1] != 0) {
+				if ((srcPixel[1] & 0x80) == 0 || alpha == NONE) {
 					// only copy opaque pixels
-					dst[j * 2] = src[srcIdx * 2];
-					dst[j * 2 + 1] = src[srcIdx * 2 + 1];
+					dstPixel[0] = srcPixel[0];
+					dstPixel[1] = srcPixel[1];
 				} else {
-					WRITE_SCREEN(&dst[j * 2], alphaBlendRGB555(READ_SCREEN(&src[srcIdx * 2]), READ_SCREEN(&dst[j * 2]), 128));
+					WRITE_SCREEN(dstPixel, alphaBlendRGB555(READ_SCREEN(srcPixel), READ_SCREEN(dstPixel), 128));
 					// semi-transparent pixels.
 				}
 			}
@@ -180,22 +185,45 @@ void Screen::copyRectToSurface8bpp(const void *buffer, const byte* palette, int
 	assert(height > 0 && destY + height <= _backSurface->h);
 	assert(width > 0 && destX + width <= _backSurface->w);
 
-	// Copy buffer data to internal buffer
+	// Copy buffer data to internal buffer. The source start offset and step
+	// are hoisted out of the pixel loop, and the common fully-opaque case
+	// gets its own loop without the per-pixel blend-mode checks - the
+	// sprite-heavy scenes spend most of their frame time in here
 	const byte *src = (const byte *)buffer;
 	byte *dst = (byte *)_backSurface->getBasePtr(destX, destY);
+	const int32 srcStart = flipX ? srcWidth - (srcXOffset * 2) - 1 : 0;
+	const int32 srcStep = flipX ? -1 : 1;
+	if (alpha == NONE) {
+		for (int i = 0; i < height; i++) {
+			const byte *srcPixel = src + srcStart;
+			byte *dstPixel = dst;
+			for (int j = 0; j < width; j++, srcPixel += srcStep, dstPixel += 2) {
+				uint16 c = READ_LE_UINT16(&palette[*srcPixel * 2]);
+				if (c != 0) {
+					// only copy opaque pixels
+					WRITE_SCREEN(dstPixel, c & ~0x8000);
+				}
+			}
+			src += srcPitch;
+			dst += _backSurface->pitch;
+		}
+		return;
+	}
+
 	for (int i = 0; i < height; i++) {
-		for (int j = 0; j < width; j++) {
-			int32 srcIdx = flipX ? srcWidth - (srcXOffset * 2) - j - 1 : j;
-			uint16 c = READ_LE_UINT16(&palette[src[srcIdx] * 2]);
+		const byte *srcPixel = src + srcStart;
+		byte *dstPixel = dst;
+		for (int j = 0; j < width; j++, srcPixel += srcStep, dstPixel += 2) {
+			uint16 c = READ_LE_UINT16(&palette[*srcPixel * 2]);
 			if (c != 0) {
-				if (!(c & 0x8000) || alpha == NONE) {
+				if (!(c & 0x8000)) {
 					// only copy opaque pixels
-					WRITE_SCREEN(&dst[j * 2], c & ~0x8000);
+					WRITE_SCREEN(dstPixel, c);
 				} else {
 					// semi-transparent pixels.
-					WRITE_SCREEN(&dst[j * 2], alpha == NORMAL
-						? alphaBlendRGB555(c & 0x7fff, READ_SCREEN(&dst[j * 2]) & 0x7fff, 128)
-						: alphaBlendAdditiveRGB555(c & 0x7fff, READ_SCREEN(&dst[j * 2]) & 0x7fff));
+					WRITE_SCREEN(dstPixel, alpha == NORMAL
+						? alphaBlendRGB555(c & 0x7fff, READ_SCREEN(dstPixel) & 0x7fff, 128)
+						: alphaBlendAdditiveRGB555(c & 0x7fff, READ_SCREEN(dstPixel) & 0x7fff));
 				}
 			}
 		}
@@ -424,9 +452,14 @@ void Screen::copyRectToSurface8bppWrappedX(const Graphics::Surface &srcSurface,
 
 	byte *dst = (byte *)_backSurface->getBasePtr(0, 0);
 	for (int i = 0; i < height; i++) {
+		// Step along the row with an increment-and-wrap instead of the
+		// per-pixel modulo on the source index
+		const byte *rowSrc = src + (i + srcRect.top) * srcSurface.w;
+		int32 srcX = srcRect.left % srcSurface.w;
 		for (int j = 0; j < width; j++) {
-			int32 srcIdx = (i + srcRect.top) * srcSurface.w + ((j + srcRect.left) % srcSurface.w);
-			uint16 c = READ_LE_UINT16(&palette[src[srcIdx] * 2]);
+			uint16 c = READ_LE_UINT16(&palette[rowSrc[srcX] * 2]);
+			if (++srcX == srcSurface.w)
+				srcX = 0;
 			if (c != 0) {
 				if (!(c & 0x8000) || alpha == NONE) {
 					// only copy opaque pixels
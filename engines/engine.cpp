@@ -151,6 +151,10 @@ Engine::Engine(OSystem *syst)
 		_pauseStartTime(0),
 		_saveSlotToLoad(-1),
 		_autoSaving(false),
+		_pendingSaveFile(nullptr),
+		_pendingSaveData(nullptr),
+		_pendingSaveSize(0),
+		_pendingSavePos(0),
 		_engineStartTime(_system->getMillis()),
 		_mainMenuDialog(NULL),
 		_debugger(NULL),
@@ -187,6 +191,8 @@ Engine::Engine(OSystem *syst)
 }
 
 Engine::~Engine() {
+	flushPendingSave();
+
 	_mixer->stopAll();
 
 	delete _debugger;
@@ -551,11 +557,20 @@ void Engine::warnMissingExtractedCDAudio() {
 	dialog.runModal();
 }
 
+// How much of a buffered autosave is compressed and written out per frame
+static const uint32 kAutosaveCommitChunkSize = 64 * 1024;
+
 void Engine::handleAutoSave() {
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processAutosave())
 		return;
 #endif
+	// Keep committing a buffered autosave, one chunk per frame
+	if (_pendingSaveFile) {
+		commitPendingSaveChunk(kAutosaveCommitChunkSize);
+		return;
+	}
+
 	const int diff = _system->getMillis() - _lastAutosaveTime;
 
 	if (_autosaveInterval != 0 && diff > (_autosaveInterval * 1000)) {
@@ -603,6 +618,10 @@ void Engine::saveAutosaveIfEnabled() {
 	// (as is the case with the AGS engine for example, or when showing a prompt).
 	if (_autoSaving || _autosaveInterval == 0)
 		return;
+
+	// The slot metadata checked below must not see a half-written file
+	flushPendingSave();
+
 	const int autoSaveSlot = getAutosaveSlot();
 	if (autoSaveSlot < 0)
 		return;
@@ -802,6 +821,8 @@ void Engine::flipMute() {
 }
 
 Common::Error Engine::loadGameState(int slot) {
+	flushPendingSave();
+
 	// In case autosaves are on, do a save first before loading the new save
 	saveAutosaveIfEnabled();
 
@@ -832,22 +853,75 @@ bool Engine::canLoadGameStateCurrently() {
 }
 
 Common::Error Engine::saveGameState(int slot, const Common::String &desc, bool isAutosave) {
-	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
+	// Finish any autosave still being committed before touching the slots
+	flushPendingSave();
 
-	if (!saveFile)
-		return Common::kWritingFailed;
+	// Serialize into memory first: the game state and the thumbnail must
+	// be captured now, but the compression and the disk write need not
+	Common::MemoryWriteStreamDynamic buffer(DisposeAfterUse::NO);
 
-	Common::Error result = saveGameStream(saveFile, isAutosave);
-	if (result.getCode() == Common::kNoError) {
-		getMetaEngine()->appendExtendedSave(saveFile, getTotalPlayTime() / 1000, desc, isAutosave);
+	Common::Error result = saveGameStream(&buffer, isAutosave);
+	if (result.getCode() != Common::kNoError) {
+		free(buffer.getData());
+		return result;
+	}
+
+	getMetaEngine()->appendExtendedSaveToStream(&buffer, getTotalPlayTime() / 1000, desc, isAutosave);
+
+	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
+	if (!saveFile) {
+		free(buffer.getData());
+		return Common::kWritingFailed;
+	}
 
-		saveFile->finalize();
+	if (isAutosave) {
+		// Hand the buffer over to handleAutoSave(), which commits it in
+		// chunks over the following frames
+		_pendingSaveFile = saveFile;
+		_pendingSaveData = buffer.getData();
+		_pendingSaveSize = buffer.size();
+		_pendingSavePos = 0;
+		return Common::kNoError;
 	}
 
+	saveFile->write(buffer.getData(), buffer.size());
+	saveFile->finalize();
+	free(buffer.getData());
+
+	result = saveFile->err() ? Common::kWritingFailed : Common::kNoError;
 	delete saveFile;
 	return result;
 }
 
+void Engine::flushPendingSave() {
+	if (_pendingSaveFile)
+		commitPendingSaveChunk(_pendingSaveSize - _pendingSavePos);
+}
+
+void Engine::commitPendingSaveChunk(uint32 maxBytes) {
+	const uint32 n = MIN(maxBytes, _pendingSaveSize - _pendingSavePos);
+	_pendingSaveFile->write(_pendingSaveData + _pendingSavePos, n);
+	_pendingSavePos += n;
+
+	if (_pendingSavePos < _pendingSaveSize && !_pendingSaveFile->err())
+		return;
+
+	bool success = !_pendingSaveFile->err();
+	if (success) {
+		_pendingSaveFile->finalize();
+		success = !_pendingSaveFile->err();
+	}
+
+	delete _pendingSaveFile;
+	_pendingSaveFile = nullptr;
+	free(_pendingSaveData);
+	_pendingSaveData = nullptr;
+	_pendingSaveSize = _pendingSavePos = 0;
+
+	if (!success)
+		g_system->displayMessageOnOSD(_("Error occurred making autosave"));
+}
+
 Common::Error Engine::saveGameStream(Common::WriteStream *stream, bool isAutosave) {
 	// Default to returning an error when not implemented
 	return Common::kWritingFailed;
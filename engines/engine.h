@@ -43,6 +43,7 @@ class EventManager;
 class SaveFileManager;
 class TimerManager;
 class FSNode;
+class OutSaveFile;
 class SeekableReadStream;
 class WriteStream;
 }
@@ -223,6 +224,19 @@ private:
 	 */
 	bool _autoSaving;
 
+	/**
+	 * An autosave that is still being committed to disk.
+	 *
+	 * Autosaves are serialized (including the thumbnail) into this
+	 * buffer synchronously, but the compression and disk write happen
+	 * in bounded chunks from handleAutoSave() over the following
+	 * frames, so the frame that triggered the autosave doesn't hitch.
+	 */
+	Common::OutSaveFile *_pendingSaveFile;
+	byte *_pendingSaveData;
+	uint32 _pendingSaveSize;
+	uint32 _pendingSavePos;
+
 	/**
 	 * Optional debugger for the engine.
 	 */
@@ -623,6 +637,19 @@ public:
 	 */
 	void saveAutosaveIfEnabled();
 
+	/**
+	 * Finish committing any autosave that is still being written out
+	 * incrementally. Called before anything that could conflict with
+	 * the half-written file: a new save, a load, or engine shutdown.
+	 */
+	void flushPendingSave();
+
+	/**
+	 * Write out at most maxBytes of the pending autosave, closing the
+	 * file once everything is committed.
+	 */
+	void commitPendingSaveChunk(uint32 maxBytes);
+
 	/**
 	 * Indicate whether an autosave can currently be done.
 	 */
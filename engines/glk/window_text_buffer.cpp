@@ -38,7 +38,7 @@ namespace Glk {
 
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(windows, rock),
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
-		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
+		_lastSeen(0), _scrollPos(0), _scrollMax(0), _linesHead(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
 		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
 		_copyBuf(nullptr), _copyPos(0) {
@@ -129,7 +129,7 @@ void TextBufferWindow::reflow() {
 	if (_height < 4 || _width < 20)
 		return;
 
-	_lines[0]._len = _numChars;
+	lineRow(0)._len = _numChars;
 
 	// allocate temp buffers
 	Attributes *attrbuf = new Attributes[SCROLLBACK * TBLINELEN];
@@ -159,35 +159,37 @@ void TextBufferWindow::reflow() {
 	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
 
 	for (k = s; k >= 0; k--) {
+		TextBufferRow &row = lineRow(k);
+
 		if (k == 0 && _lineRequest)
 			inputbyte = p + _inFence;
 
-		if (_lines[k]._lPic) {
+		if (row._lPic) {
 			offsetbuf[x] = p;
 			alignbuf[x] = imagealign_MarginLeft;
-			pictbuf[x] = _lines[k]._lPic;
+			pictbuf[x] = row._lPic;
 
 			if (pictbuf[x]) pictbuf[x]->increment();
-			hyperbuf[x] = _lines[k]._lHyper;
+			hyperbuf[x] = row._lHyper;
 			x++;
 		}
 
-		if (_lines[k]._rPic) {
+		if (row._rPic) {
 			offsetbuf[x] = p;
 			alignbuf[x] = imagealign_MarginRight;
-			pictbuf[x] = _lines[k]._rPic;
+			pictbuf[x] = row._rPic;
 			if (pictbuf[x]) pictbuf[x]->increment();
-			hyperbuf[x] = _lines[k]._rHyper;
+			hyperbuf[x] = row._rHyper;
 			x++;
 		}
 
-		for (i = 0; i < _lines[k]._len; i++) {
-			attrbuf[p] = curattr = _lines[k]._attrs[i];
-			charbuf[p] = _lines[k]._chars[i];
+		for (i = 0; i < row._len; i++) {
+			attrbuf[p] = curattr = row._attrs[i];
+			charbuf[p] = row._chars[i];
 			p++;
 		}
 
-		if (_lines[k]._newLine) {
+		if (row._newLine) {
 			attrbuf[p] = curattr;
 			charbuf[p] = '\n';
 			p++;
@@ -242,31 +244,31 @@ void TextBufferWindow::touchScroll() {
 	_windows->repaint(_bbox);
 
 	for (int i = 0; i < _scrollMax; i++)
-		_lines[i]._dirty = true;
+		lineRow(i)._dirty = true;
 }
 
 bool TextBufferWindow::putPicture(Picture *pic, uint align, uint linkval) {
 	if (align == imagealign_MarginRight) {
-		if (_lines[0]._rPic || _numChars)
+		if (lineRow(0)._rPic || _numChars)
 			return false;
 
 		_radjw = (pic->w + g_conf->_tMarginX) * GLI_SUBPIX;
 		_radjn = (pic->h + _font._cellH - 1) / _font._cellH;
-		_lines[0]._rPic = pic;
-		_lines[0]._rm = _radjw;
-		_lines[0]._rHyper = linkval;
+		lineRow(0)._rPic = pic;
+		lineRow(0)._rm = _radjw;
+		lineRow(0)._rHyper = linkval;
 	} else {
 		if (align != imagealign_MarginLeft && _numChars)
 			putCharUni('\n');
 
-		if (_lines[0]._lPic || _numChars)
+		if (lineRow(0)._lPic || _numChars)
 			return false;
 
 		_ladjw = (pic->w + g_conf->_tMarginX) * GLI_SUBPIX;
 		_ladjn = (pic->h + _font._cellH - 1) / _font._cellH;
-		_lines[0]._lPic = pic;
-		_lines[0]._lm = _ladjw;
-		_lines[0]._lHyper = linkval;
+		lineRow(0)._lPic = pic;
+		lineRow(0)._lm = _ladjw;
+		lineRow(0)._lHyper = linkval;
 
 		if (align != imagealign_MarginLeft)
 			flowBreak();
@@ -369,7 +371,7 @@ void TextBufferWindow::putTextUni(const uint32 *buf, int len, int pos, int oldle
 }
 
 void TextBufferWindow::touch(int line) {
-	_lines[line]._dirty = true;
+	lineRow(line)._dirty = true;
 	g_vm->_selection->clearSelection();
 
 	int y = _bbox.top + g_conf->_tMarginY + (_height - line - 1) * _font._leading;
@@ -644,7 +646,7 @@ void TextBufferWindow::requestLineEvent(char *buf, uint maxlen, uint initlen) {
 	}
 
 	// WORKAROUND: Mark bottom line as dirty so caret will be drawn
-	_lines[0]._dirty = true;
+	lineRow(0)._dirty = true;
 
 	_echoLineInput = _echoLineInputBase;
 
@@ -826,7 +828,7 @@ void TextBufferWindow::redraw() {
 
 	Window::redraw();
 
-	_lines[0]._len = _numChars;
+	lineRow(0)._len = _numChars;
 	sx0 = sx1 = selleft = selright = 0;
 
 	x0 = (_bbox.left + g_conf->_tMarginX) * GLI_SUBPIX;
@@ -855,9 +857,9 @@ void TextBufferWindow::redraw() {
 
 		// mark selected line dirty
 		if (selrow)
-			_lines[i]._dirty = true;
+			lineRow(i)._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
+		TextBufferRow ln(lineRow(i));
 
 		// skip if we can
 		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
@@ -870,10 +872,10 @@ void TextBufferWindow::redraw() {
 
 		// keep selected line dirty and flag for repaint
 		if (!selrow) {
-			_lines[i]._dirty = false;
-			_lines[i]._repaint = false;
+			lineRow(i)._dirty = false;
+			lineRow(i)._repaint = false;
 		} else {
-			_lines[i]._repaint = true;
+			lineRow(i)._repaint = true;
 		}
 
 		// leave bottom line blank for [more] prompt
@@ -1088,7 +1090,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		TextBufferRow ln(lineRow(i));
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1547,14 +1549,24 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 		_dashed = 0;
 	_spaced = 0;
 
-	_lines[0]._len = _numChars;
-	_lines[0]._newLine = forced;
+	lineRow(0)._len = _numChars;
+	lineRow(0)._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// Rotate the ring buffer backwards instead of moving every row: the
+	// oldest row drops out of the scrollback and is recycled as the new
+	// bottom line
+	_linesHead--;
+	if (_linesHead < 0)
+		_linesHead += _lines.size();
+
+	TextBufferRow &bottom = _lines[_linesHead];
+	if (bottom._lPic)
+		bottom._lPic->decrement();
+	if (bottom._rPic)
+		bottom._rPic->decrement();
+
+	for (int i = 1; i < _height; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1566,14 +1578,17 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 		_ladjw = 0;
 
 	touch(0);
-	_lines[0]._len = 0;
-	_lines[0]._newLine = 0;
-	_lines[0]._lm = _ladjw;
-	_lines[0]._rm = _radjw;
-	_lines[0]._lPic = nullptr;
-	_lines[0]._rPic = nullptr;
-	_lines[0]._lHyper = 0;
-	_lines[0]._rHyper = 0;
+	bottom._len = 0;
+	bottom._newLine = 0;
+	bottom._lm = _ladjw;
+	bottom._rm = _radjw;
+	bottom._lPic = nullptr;
+	bottom._rPic = nullptr;
+	bottom._lHyper = 0;
+	bottom._rHyper = 0;
+
+	_chars = bottom._chars;
+	_attrs = bottom._attrs;
 
 	Common::fill(_chars, _chars + TBLINELEN, ' ');
 	Attributes *a = _attrs;
@@ -1589,8 +1604,16 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.clear();
-	_lines.resize(_scrollBack + SCROLLBACK);
+	// Grow the scrollback, linearizing the ring buffer so the bottom
+	// line is back in slot 0
+	TextBufferRows newLines;
+	newLines.resize(_scrollBack + SCROLLBACK);
+
+	for (i = 0; i < _scrollBack; i++)
+		newLines[i] = lineRow(i);
+
+	_lines = newLines;
+	_linesHead = 0;
 
 	_chars = _lines[0]._chars;
 	_attrs = _lines[0]._attrs;
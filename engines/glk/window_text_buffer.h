@@ -57,6 +57,19 @@ class TextBufferWindow : public TextWindow, Speech {
 private:
 	PropFontInfo &_font;
 private:
+	/**
+	 * Return the row for a logical line number. The rows are stored as a
+	 * ring buffer so that scrolling in a new line does not have to move
+	 * the whole scrollback; logical line 0 is the bottom line currently
+	 * being built.
+	 */
+	TextBufferRow &lineRow(int index) {
+		int pos = _linesHead + index;
+		if (pos >= (int)_lines.size())
+			pos -= _lines.size();
+		return _lines[pos];
+	}
+
 	void reflow();
 	void touchScroll();
 	bool putPicture(Picture *pic, uint align, uint linkval);
@@ -98,6 +111,7 @@ public:
 	int _dashed;
 
 	TextBufferRows _lines;
+	int _linesHead;       ///< index of the bottom line (logical line 0) within _lines
 	int _scrollBack;
 
 	int _numChars;        ///< number of chars in last line: lines[0]
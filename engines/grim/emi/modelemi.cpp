@@ -226,12 +226,19 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 	for (int i = 0; i < _numBoneInfos; i++) {
 		_vertexBoneInfo[i] = _skeleton->findJointIndex(_boneNames[_boneInfos[i]._joint]);
 	}
+	_skinnedPoseGeneration = 0;
 }
 
 void EMIModel::prepareForRender() {
 	if (!_skeleton || !_vertexBoneInfo)
 		return;
 
+	// Re-skin only when the skeleton was re-posed since the last time;
+	// draw() calls this every frame for every model
+	if (_skinnedPoseGeneration == _skeleton->getPoseGeneration())
+		return;
+	_skinnedPoseGeneration = _skeleton->getPoseGeneration();
+
 	for (int i = 0; i < _numVertices; i++) {
 		_drawVertices[i].set(0.0f, 0.0f, 0.0f);
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
@@ -445,6 +452,7 @@ EMIModel::EMIModel(const Common::String &filename, Common::SeekableReadStream *d
 	_numBoneInfos = 0;
 	_vertexBoneInfo = nullptr;
 	_skeleton = nullptr;
+	_skinnedPoseGeneration = 0;
 	_radius = 0;
 	_center = new Math::Vector3d();
 	_boxData = new Math::Vector3d();
@@ -128,6 +128,7 @@ public:
 
 	void *_userData;
 	bool _lightingDirty;
+	int _skinnedPoseGeneration;
 
 public:
 	EMIModel(const Common::String &filename, Common::SeekableReadStream *data, EMICostume *costume);
@@ -34,7 +34,8 @@ namespace Grim {
 #define TRANSLATE_OP 3
 
 Skeleton::Skeleton(const Common::String &filename, Common::SeekableReadStream *data) :
-		_numJoints(0), _joints(nullptr), _animLayers(nullptr) {
+		_numJoints(0), _joints(nullptr), _animLayers(nullptr), _poseGeneration(1),
+		_restPose(false) {
 	loadSkeleton(data);
 }
 
@@ -67,6 +68,9 @@ void Skeleton::loadSkeleton(Common::SeekableReadStream *data) {
 	}
 	initBones();
 	resetAnim();
+	// Give the joints a valid rest pose right away, so meshes skinned
+	// before the first animate() call do not read uninitialized matrices
+	commitAnim();
 }
 
 void Skeleton::initBone(int index) {
@@ -113,6 +117,14 @@ void Skeleton::resetAnim() {
 }
 
 void Skeleton::animate() {
+	// Without active animations the joints keep the rest pose produced by
+	// the previous call, so the whole blend pass can be skipped. Static
+	// props in particular go through here every frame.
+	if (_activeAnims.empty() && _restPose)
+		return;
+	_restPose = _activeAnims.empty();
+	++_poseGeneration;
+
 	resetAnim();
 
 	// This first pass over the animations calculates bone-specific sums of blend weights for all
@@ -88,6 +88,13 @@ public:
 	void removeAnimation(AnimationStateEmi *anim);
 	int findJointIndex(const Common::String &name) const;
 	bool hasJoint(const Common::String &name) const;
+
+	/**
+	 * Monotonically increasing counter that is bumped whenever animate()
+	 * re-poses the joints. Meshes compare it against the generation they
+	 * last skinned with, so unchanged poses skip the CPU re-skinning.
+	 */
+	int getPoseGeneration() const { return _poseGeneration; }
 	Joint *getJointNamed(const Common::String &name) const;
 	Joint *getParentJoint(const Joint *j) const;
 	int getJointIndex(const Joint *j) const;
@@ -95,6 +102,8 @@ public:
 private:
 	AnimationLayer *_animLayers;
 	Common::List<AnimationStateEmi*> _activeAnims;
+	int _poseGeneration;
+	bool _restPose;
 };
 
 } // end of namespace Grim
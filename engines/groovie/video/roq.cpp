@@ -576,6 +576,33 @@ bool ROQPlayer::processBlockQuadCodebook(ROQBlockHeader &blockHeader) {
 	// Read the 4x4 codebook
 	_file->read(_codebook4, _num4blocks * 4);
 
+	// Expand the whole 4x4 codebook ahead of time, so that painting a
+	// block is a matter of copying rows. This only needs to be redone
+	// when a new codebook chunk arrives, not per painted block. All the
+	// entries are expanded since a chunk may update the 2x2 colors
+	// without rewriting the 4x4 entries referencing them.
+	for (int i = 0; i < 256; i++) {
+		const byte *block4 = &_codebook4[i * 4];
+		uint32 *pix = &_codebook4Pixels[i * 16];
+		uint32 *up = &_codebook4Upsampled[i * 64];
+
+		for (int j = 0; j < 4; j++) {
+			const uint32 *block2 = _codebook2 + block4[j] * 4;
+			int x = (j & 1) * 2;
+			int y = (j >> 1) * 2;
+
+			pix[y * 4 + x] = block2[0];
+			pix[y * 4 + x + 1] = block2[1];
+			pix[(y + 1) * 4 + x] = block2[2];
+			pix[(y + 1) * 4 + x + 1] = block2[3];
+		}
+
+		for (int y = 0; y < 8; y++) {
+			for (int x = 0; x < 8; x++)
+				up[y * 8 + x] = pix[(y >> 1) * 4 + (x >> 1)];
+		}
+	}
+
 	return true;
 }
 
@@ -830,12 +857,14 @@ void ROQPlayer::paint4(byte i, int destx, int desty) {
 		error("Groovie::ROQ: Invalid 4x4 block %d (%d available)", i, _num4blocks);
 	}
 
-	byte *block4 = &_codebook4[i * 4];
-	for (int origy = 0; origy < 4; origy += 2) {
-		for (int origx = 0; origx < 4; origx += 2) {
-			paint2(*block4, destx + origx, desty + origy);
-			block4++;
-		}
+	const uint32 *src = &_codebook4Pixels[i * 16];
+	uint32 *ptr = (uint32 *)_currBuf->getBasePtr(destx, desty);
+	uint32 pitch = _currBuf->pitch / 4;
+
+	for (int y = 0; y < 4; y++) {
+		memcpy(ptr, src, 4 * sizeof(uint32));
+		ptr += pitch;
+		src += 4;
 	}
 }
 
@@ -844,20 +873,14 @@ void ROQPlayer::paint8(byte i, int destx, int desty) {
 		error("Groovie::ROQ: Invalid 4x4 block %d (%d available)", i, _num4blocks);
 	}
 
-	byte *block4 = &_codebook4[i * 4];
-	for (int y4 = 0; y4 < 2; y4++) {
-		for (int x4 = 0; x4 < 2; x4++) {
-			uint32 *block2 = _codebook2 + *block4++ * 4;
+	const uint32 *src = &_codebook4Upsampled[i * 64];
+	uint32 *ptr = (uint32 *)_currBuf->getBasePtr(destx, desty);
+	uint32 pitch = _currBuf->pitch / 4;
 
-			for (int y2 = 0; y2 < 2; y2++) {
-				for (int x2 = 0; x2 < 2; x2++) {
-					uint32 *ptr = (uint32 *)_currBuf->getBasePtr(destx + x4 * 4 + x2 * 2, desty + y4 * 4 + y2 * 2);
-					uint32 pitch = _currBuf->pitch / 4;
-					uint32 color = *block2++;
-					ptr[0] = ptr[1] = ptr[pitch] = ptr[pitch + 1] = color;
-				}
-			}
-		}
+	for (int y = 0; y < 8; y++) {
+		memcpy(ptr, src, 8 * sizeof(uint32));
+		ptr += pitch;
+		src += 8;
 	}
 }
 
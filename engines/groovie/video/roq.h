@@ -91,6 +91,11 @@ private:
 	uint16 _num4blocks;
 	uint32 _codebook2[256 * 4];
 	byte _codebook4[256 * 4];
+	// Expanded versions of the 4x4 codebook, rebuilt whenever a codebook
+	// chunk arrives: each entry resolved to its 4x4 pixels, plus the same
+	// pixels upsampled to 8x8. Painting then reduces to row copies.
+	uint32 _codebook4Pixels[256 * 16];
+	uint32 _codebook4Upsampled[256 * 64];
 
 	// Flags
 	bool _flagOne;	 //!< Play only first frame and do not print the image to the screen
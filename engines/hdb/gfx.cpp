@@ -357,9 +357,30 @@ void Gfx::fillScreen(uint32 color) {
 	g_system->fillScreen(color);
 }
 
+void Gfx::markDirty(const Common::Rect &r) {
+	if (_dirtyRect.isEmpty())
+		_dirtyRect = r;
+	else
+		_dirtyRect.extend(r);
+}
+
+void Gfx::flushDirty() {
+	if (_dirtyRect.isEmpty())
+		return;
+
+	_dirtyRect.clip(_globalSurface.getBounds());
+	if (!_dirtyRect.isEmpty())
+		g_system->copyRectToScreen(_globalSurface.getBasePtr(_dirtyRect.left, _dirtyRect.top), _globalSurface.pitch, _dirtyRect.left, _dirtyRect.top, _dirtyRect.width(), _dirtyRect.height());
+
+	_dirtyRect = Common::Rect();
+}
+
 void Gfx::updateVideo() {
 	updateFade();
 
+	// Push everything drawn since the last frame in one go
+	flushDirty();
+
 	if (!g_hdb->_progressGfx)
 		return;
 
@@ -1095,7 +1116,7 @@ void Gfx::drawText(const char *string) {
 		clip.moveTo(_cursorX, _cursorY);
 		clip.clip(_globalSurface.getBounds());
 		if (!clip.isEmpty()) {
-			g_system->copyRectToScreen(_globalSurface.getBasePtr(clip.left, clip.top), _globalSurface.pitch, clip.left, clip.top, clip.width(), clip.height());
+			markDirty(clip);
 		}
 
 		// Advance the cursor
@@ -1379,7 +1400,7 @@ int Picture::draw(int x, int y) {
 	clip.moveTo(x, y);
 	clip.clip(g_hdb->_gfx->_globalSurface.getBounds());
 	if (!clip.isEmpty()) {
-		g_system->copyRectToScreen(g_hdb->_gfx->_globalSurface.getBasePtr(clip.left, clip.top), g_hdb->_gfx->_globalSurface.pitch, clip.left, clip.top, clip.width(), clip.height());
+		g_hdb->_gfx->markDirty(clip);
 		return 1;
 	}
 	return 0;
@@ -1392,7 +1413,7 @@ int Picture::drawMasked(int x, int y, int alpha) {
 	clip.moveTo(x, y);
 	clip.clip(g_hdb->_gfx->_globalSurface.getBounds());
 	if (!clip.isEmpty()) {
-		g_system->copyRectToScreen(g_hdb->_gfx->_globalSurface.getBasePtr(clip.left, clip.top), g_hdb->_gfx->_globalSurface.pitch, clip.left, clip.top, clip.width(), clip.height());
+		g_hdb->_gfx->markDirty(clip);
 		return 1;
 	}
 	return 0;
@@ -1441,7 +1462,7 @@ int Tile::draw(int x, int y) {
 	clip.moveTo(x, y);
 	clip.clip(g_hdb->_gfx->_globalSurface.getBounds());
 	if (!clip.isEmpty()) {
-		g_system->copyRectToScreen(g_hdb->_gfx->_globalSurface.getBasePtr(clip.left, clip.top), g_hdb->_gfx->_globalSurface.pitch, clip.left, clip.top, clip.width(), clip.height());
+		g_hdb->_gfx->markDirty(clip);
 		return 1;
 	}
 	return 0;
@@ -1454,7 +1475,7 @@ int Tile::drawMasked(int x, int y, int alpha) {
 	clip.moveTo(x, y);
 	clip.clip(g_hdb->_gfx->_globalSurface.getBounds());
 	if (!clip.isEmpty()) {
-		g_system->copyRectToScreen(g_hdb->_gfx->_globalSurface.getBasePtr(clip.left, clip.top), g_hdb->_gfx->_globalSurface.pitch, clip.left, clip.top, clip.width(), clip.height());
+		g_hdb->_gfx->markDirty(clip);
 		return 1;
 	}
 	return 0;
@@ -82,6 +82,12 @@ public:
 	void loadSaveFile(Common::InSaveFile *in);
 	void fillScreen(uint32 color);
 	void updateVideo();
+
+	// Accumulate an area of _globalSurface that changed; the union is
+	// pushed to the backend once per frame instead of one
+	// copyRectToScreen call per tile/sprite blit
+	void markDirty(const Common::Rect &r);
+	void flushDirty();
 	void setPointerState(int value);
 	void drawPointer();
 	void showPointer(bool status) {
@@ -212,6 +218,9 @@ private:
 		uint32 totalTime;
 	} _starsInfo;
 
+	// Changed region of _globalSurface awaiting a push to the backend
+	Common::Rect _dirtyRect;
+
 	// Cursor
 	int _cursorX, _cursorY;
 	Picture *_mousePointer[8];	// Gfx for screen pointer (4 Animations)
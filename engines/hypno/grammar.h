@@ -87,6 +87,10 @@ public:
 	bool loop;
 	HypnoSmackerDecoder *decoder;
 	const Graphics::Surface *currentFrame;
+	// screen-format colors for the decoder's current palette, rebuilt
+	// whenever the video delivers a new palette chunk
+	uint32 screenPalette[256];
+	bool screenPaletteValid;
 };
 
 typedef Common::Array<MVideo> Videos;
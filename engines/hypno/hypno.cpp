@@ -49,6 +49,8 @@ HypnoEngine *g_hypno;
 MVideo::MVideo(Common::String path_, Common::Point position_, bool transparent_, bool scaled_, bool loop_) {
 	decoder = nullptr;
 	currentFrame = nullptr;
+	memset(screenPalette, 0, sizeof(screenPalette));
+	screenPaletteValid = false;
 	path = path_;
 	position = position_;
 	scaled = scaled_;
@@ -381,29 +383,74 @@ void HypnoEngine::changeScreenMode(const Common::String &mode) {
 void HypnoEngine::updateScreen(MVideo &video) {
 	const Graphics::Surface *frame = video.decoder->decodeNextFrame();
 	video.currentFrame = frame;
-	if (frame->h == 0 || frame->w == 0 || video.decoder->getPalette() == nullptr)
+	bool paletteChanged = video.decoder->hasDirtyPalette();
+	const byte *palette = video.decoder->getPalette();
+	if (frame->h == 0 || frame->w == 0 || palette == nullptr)
 		return;
 
-	Graphics::Surface *sframe, *cframe;
+	if (video.scaled || frame->format.bytesPerPixel != 1) {
+		Graphics::Surface *sframe, *cframe;
 
-	if (video.scaled) {
-		sframe = frame->scale(_screenW, _screenH);
-		cframe = sframe->convertTo(_pixelFormat, video.decoder->getPalette());
-	} else
-		cframe = frame->convertTo(_pixelFormat, video.decoder->getPalette());
+		if (video.scaled) {
+			sframe = frame->scale(_screenW, _screenH);
+			cframe = sframe->convertTo(_pixelFormat, palette);
+		} else {
+			sframe = nullptr;
+			cframe = frame->convertTo(_pixelFormat, palette);
+		}
 
-	if (video.transparent)
-		_compositeSurface->transBlitFrom(*cframe, video.position, _transparentColor);
-	else
-		_compositeSurface->blitFrom(*cframe, video.position);
+		if (video.transparent)
+			_compositeSurface->transBlitFrom(*cframe, video.position, _transparentColor);
+		else
+			_compositeSurface->blitFrom(*cframe, video.position);
+
+		if (sframe) {
+			sframe->free();
+			delete sframe;
+		}
+
+		cframe->free();
+		delete cframe;
+		return;
+	}
 
-	if (video.scaled) {
-		sframe->free();
-		delete sframe;
+	// Compose the 8bpp frame directly onto the composite surface through a
+	// cached palette-to-screen-color table. This does the conversion and
+	// the color-key test in a single pass and avoids allocating, converting
+	// and freeing a whole surface per video per frame, which is what killed
+	// the frame rate on arcade levels with several overlapping videos.
+	if (paletteChanged || !video.screenPaletteValid) {
+		for (int c = 0; c < 256; c++)
+			video.screenPalette[c] = _pixelFormat.RGBToColor(palette[3 * c], palette[3 * c + 1], palette[3 * c + 2]);
+		video.screenPaletteValid = true;
 	}
 
-	cframe->free();
-	delete cframe;
+	Common::Rect dst(video.position.x, video.position.y, video.position.x + frame->w, video.position.y + frame->h);
+	dst.clip(Common::Rect(0, 0, _screenW, _screenH));
+	if (dst.isEmpty())
+		return;
+
+	const int srcX = dst.left - video.position.x;
+	const int srcY = dst.top - video.position.y;
+
+	for (int y = 0; y < dst.height(); y++) {
+		const byte *src = (const byte *)frame->getBasePtr(srcX, srcY + y);
+		if (_pixelFormat.bytesPerPixel == 2) {
+			uint16 *out = (uint16 *)_compositeSurface->getBasePtr(dst.left, dst.top + y);
+			for (int x = 0; x < dst.width(); x++) {
+				uint32 color = video.screenPalette[src[x]];
+				if (!video.transparent || color != _transparentColor)
+					out[x] = (uint16)color;
+			}
+		} else {
+			uint32 *out = (uint32 *)_compositeSurface->getBasePtr(dst.left, dst.top + y);
+			for (int x = 0; x < dst.width(); x++) {
+				uint32 color = video.screenPalette[src[x]];
+				if (!video.transparent || color != _transparentColor)
+					out[x] = color;
+			}
+		}
+	}
 }
 
 void HypnoEngine::drawScreen() {
@@ -433,6 +480,7 @@ void HypnoEngine::playVideo(MVideo &video) {
 	//error("Video %s was not previously closed and deallocated", video.path.c_str());
 
 	video.decoder = new HypnoSmackerDecoder();
+	video.screenPaletteValid = false;
 
 	if (!video.decoder->loadStream(file))
 		error("unable to load video %s", path.c_str());
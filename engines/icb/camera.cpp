@@ -108,6 +108,7 @@ void _game_session::Build_camera_table() {
 	Zdebug("\n***********building camera table**************");
 
 	num_cameras = 0; // reset
+	set_prefetch_cursor = 0; // new camera table, start the prefetch sweep over
 
 	// reset extra cams table
 	for (j = 0; j < MAX_floors; j++)
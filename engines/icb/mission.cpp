@@ -390,6 +390,9 @@ uint32 _mission::Game_cycle() {
 	// call the camera director which will pick a view depending upon the player objects position
 	session->Camera_director();
 
+	// pull the sets the player may cut to into the background pool
+	session->Prefetch_set_clusters();
+
 	return (mission_status);
 }
 
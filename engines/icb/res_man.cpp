@@ -362,6 +362,15 @@ void res_man::Advance_time_stamp() {
 	current_time_frame++;
 }
 
+bool8 res_man::Res_resident(uint32 url_hash, uint32 cluster_hash) {
+	// just probe the pool - no loading, no age stamping
+
+	if (FindFile(url_hash, cluster_hash, MAKE_TOTAL_HASH(cluster_hash, url_hash)) != -1)
+		return TRUE8;
+
+	return FALSE8;
+}
+
 res_man::res_man() {
 	memory_base = nullptr;
 	max_mem_blocks = 0;
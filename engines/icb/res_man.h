@@ -168,6 +168,11 @@ public:
 	bool8 Test_file(const char *url);
 	bool8 Test_file(const char *url, uint32 url_hash, const char *cluster_url, uint32 cluster_hash);
 
+	// true if the resource is already sitting in the memory pool
+	// unlike Res_open this never loads anything and leaves the ages
+	// alone, so it can be polled every cycle by the set prefetcher
+	bool8 Res_resident(uint32 url_hash, uint32 cluster_hash);
+
 	uint32 Fetch_files_open();
 	uint32 Fetch_total_pool_size();
 	uint32 Fetch_free_memory();
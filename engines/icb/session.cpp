@@ -434,10 +434,64 @@ void _game_session::Initialise_set(const char *name, const char *cluster_name) {
 	// init the set
 	set.Init(name, cluster_name);
 
+	// restart the set prefetcher so the sets reachable from the new
+	// camera get pulled into the background pool over the next cycles
+	set_prefetch_cursor = 0;
+
 	// decide which props to sleep and which to wake
 	Setup_prop_sleep_states();
 }
 
+void _game_session::Prefetch_set_clusters() {
+	// warm the background resource pool with the other sets of this session
+	// so later camera cuts find their set file already in memory instead of
+	// stalling on a disk read
+	// at most one set is loaded per call to bound the per-cycle cost
+
+	// no set up yet - the pool is about to be filled by the first cut anyway
+	if (!set.OK())
+		return;
+
+	// And the name of the set file within the cluster
+	pxString p_rcvf = "p.rcvf";
+	uint32 p_rcvf_hash = HashString(p_rcvf);
+
+	while (set_prefetch_cursor < num_cameras) {
+		uint32 cam = set_prefetch_cursor++;
+
+		// the set on display is in the pool by definition
+		if (cam == cur_camera_number)
+			continue;
+
+		char cluster[ENGINE_STRING_LEN];
+		sprintf(cluster, SET_PATH, Fetch_h_session_name(), camera_cluster_list[cam]);
+		uint32 cluster_hash = HashString(cluster);
+
+		// already pulled in on an earlier cycle or cut?
+		if (rs_bg->Res_resident(p_rcvf_hash, cluster_hash))
+			continue;
+
+		// sets can legitimately be missing - Camera_director nethacks those
+		if (!rs_bg->Test_file(cluster))
+			continue;
+
+		// only use genuinely free pool space - never force the sets we are
+		// actually using out of memory for one the player may not visit
+		uint32 size = rs_bg->Fetch_size(p_rcvf, p_rcvf_hash, cluster, cluster_hash);
+		if ((!size) || (size + (size >> 2) > rs_bg->Fetch_free_memory())) {
+			// reading the cluster header may still have shuffled the pool
+			set.RefreshSetPointers();
+			return;
+		}
+
+		rs_bg->Res_open(p_rcvf, p_rcvf_hash, cluster, cluster_hash);
+
+		// loading may have shuffled the pool under the current set header
+		set.RefreshSetPointers();
+		return;
+	}
+}
+
 void _game_session::Setup_prop_sleep_states() {
 	// initialise the new set object
 
@@ -852,6 +852,9 @@ public:
 	uint32 floor_to_camera_index[MAX_floors];
 	_floor_cam_list cam_floor_list[MAX_floors];
 
+	uint32 set_prefetch_cursor; // next camera in the list to consider pre-loading
+
+	void Prefetch_set_clusters();
 	void Build_camera_table();
 	void Camera_director();
 	void Reset_camera_director();
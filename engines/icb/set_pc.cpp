@@ -625,6 +625,27 @@ bool8 _set::Init(const char *camera_name, const char *clustered_camera_name) {
 	return TRUE8;
 }
 
+void _set::RefreshSetPointers() {
+	if (!m_setOk)
+		return;
+
+	// And the name of the set file within the cluster
+	pxString p_rcvf = "p.rcvf";
+	uint32 p_rcvf_hash = HashString(p_rcvf);
+
+	_pcSetHeader *header = (_pcSetHeader *)rs_bg->Res_open(p_rcvf, p_rcvf_hash, set_cluster, set_cluster_hash);
+
+	// Nothing moved, so the prop file pointers are still good
+	if (header == m_currentCamera)
+		return;
+
+	m_currentCamera = header;
+
+	// Rebuild the prop file, whose tables point into the set header block
+	delete m_props;
+	m_props = new pcPropFile(((uint8 *)m_currentCamera) + m_currentCamera->propOffset);
+}
+
 void _set::Reset() {
 	// Free all the prop surface that have been created.
 	if (m_setOk) {
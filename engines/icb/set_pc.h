@@ -87,6 +87,11 @@ public:
 	void Reset();
 	bool8 DoesCameraExist(const char *camera_name, const char *camera_cluster_name);
 
+	// re-fetch the set header from the resource manager - must be called
+	// after anything else has been loaded into the background pool, as
+	// that may have shuffled the block the header lives in
+	void RefreshSetPointers();
+
 private:
 	void HackMakeCamera();
 
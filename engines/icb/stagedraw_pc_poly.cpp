@@ -861,6 +861,20 @@ void StageDrawPoly(SDactor *actors, uint32 actorQty) {
 				}
 			}
 
+			// Resolve the current state of every prop once up front - the
+			// name lookup in Fetch_prop_state is far too expensive to be
+			// repeated per prop for every used tile below
+			uint32 propQty = propFile->GetPropQty();
+			pcPropRGBState *propStates[MAX_PROP_STATES];
+			for (uint32 p = 0; p < propQty; p++) {
+				// Get this prop
+				pcPropRGB *pProp = propFile->GetProp(p);
+				// Get the state for this prop
+				uint32 stat = g_mission->session->Fetch_prop_state(const_cast<char *>(pProp->GetName()));
+				// Get the state
+				propStates[p] = pProp->GetState(stat);
+			}
+
 			// Now composit the whole kit a cabudal
 			uint32 tileOffset = 0;
 			uint32 rowOffset = 0;
@@ -872,15 +886,9 @@ void StageDrawPoly(SDactor *actors, uint32 actorQty) {
 				// Go through all the tiles the actor is occupying
 				for (int32 zTx = TILES_WIDE; zTx; --zTx) {
 					if (pUsedTiles[tileOffset]) {
-						// This tile is used, so Get the prop quantity
-						uint32 propQty = propFile->GetPropQty();
+						// This tile is used, so run through the prop states
 						for (uint32 p = 0; p < propQty; p++) {
-							// Get this prop
-							pcPropRGB *pProp = propFile->GetProp(p);
-							// Get the state for this prop
-							uint32 stat = g_mission->session->Fetch_prop_state(const_cast<char *>(pProp->GetName()));
-							// Get the state
-							pcPropRGBState *pStat = pProp->GetState(stat);
+							pcPropRGBState *pStat = propStates[p];
 							// Get a pointer to the z table
 							uint16 *zTable = pStat->GetZTileTable(tileOffset);
 
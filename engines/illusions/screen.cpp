@@ -66,7 +66,7 @@ void SpriteDecompressQueue::decompress(SpriteDecompressQueueItem *item) {
 // SpriteDrawQueue
 
 SpriteDrawQueue::SpriteDrawQueue(Screen *screen)
-	: _screen(screen) {
+	: _screen(screen), _nextOrderIndex(0) {
 }
 
 SpriteDrawQueue::~SpriteDrawQueue() {
@@ -74,11 +74,10 @@ SpriteDrawQueue::~SpriteDrawQueue() {
 
 bool SpriteDrawQueue::draw(SpriteDrawQueueItem *item) {
 
-	// Check if the sprite has finished decompressing
-	if (item->_kind != 0 && (*item->_drawFlags & 1)) {
-		insert(item, item->_priority);
+	// Check if the sprite has finished decompressing; if not, it is kept
+	// in the queue for the next frame
+	if (item->_kind != 0 && (*item->_drawFlags & 1))
 		return false;
-	}
 
 	if (!_screen->isDisplayOn()) {
 		if (item->_drawFlags)
@@ -101,14 +100,31 @@ bool SpriteDrawQueue::draw(SpriteDrawQueueItem *item) {
 }
 
 void SpriteDrawQueue::drawAll() {
-	SpriteDrawQueueListIterator it = _queue.begin();
-	while (it != _queue.end()) {
-		if (draw(*it)) {
-			delete *it;
-			it = _queue.erase(it);
-		} else
-			++it;
+	// The queue is rebuilt every frame, so it is cheaper to sort it once
+	// here than to keep it ordered while inserting each item
+	Common::sort(_queue.begin(), _queue.end(), itemCompare);
+
+	uint keptCount = 0;
+	for (uint i = 0; i < _queue.size(); ++i) {
+		SpriteDrawQueueItem *item = _queue[i];
+		if (draw(item))
+			delete item;
+		else
+			_queue[keptCount++] = item;
 	}
+	_queue.resize(keptCount);
+
+	if (_queue.empty())
+		_nextOrderIndex = 0;
+}
+
+bool SpriteDrawQueue::itemCompare(const SpriteDrawQueueItem *item1, const SpriteDrawQueueItem *item2) {
+	// Draw in ascending priority order; of two items with the same
+	// priority, the one queued later is drawn first, matching the
+	// insertion position used by the former sorted list
+	if (item1->_priority != item2->_priority)
+		return item1->_priority < item2->_priority;
+	return item1->_orderIndex > item2->_orderIndex;
 }
 
 void SpriteDrawQueue::insertSprite(byte *drawFlags, Graphics::Surface *surface, WidthHeight &dimensions,
@@ -161,9 +177,8 @@ void SpriteDrawQueue::insertTextSurface(Graphics::Surface *surface, WidthHeight
 }
 
 void SpriteDrawQueue::insert(SpriteDrawQueueItem *item, uint32 priority) {
-	SpriteDrawQueueListIterator insertionPos = Common::find_if(_queue.begin(), _queue.end(),
-		FindInsertionPosition(priority));
-	_queue.insert(insertionPos, item);
+	item->_orderIndex = _nextOrderIndex++;
+	_queue.push_back(item);
 }
 
 bool SpriteDrawQueue::calcItemRect(SpriteDrawQueueItem *item, Common::Rect &srcRect, Common::Rect &dstRect) {
@@ -24,6 +24,7 @@
 #define ILLUSIONS_SCREEN_H
 
 #include "illusions/graphics.h"
+#include "common/array.h"
 #include "common/list.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
@@ -63,6 +64,7 @@ struct SpriteDrawQueueItem {
 	int16 _scale;
 	uint16 _flags;
 	uint32 _priority;
+	uint32 _orderIndex;
 	Graphics::Surface *_surface;
 	WidthHeight _dimensions;
 	Common::Point _drawPosition;
@@ -82,17 +84,11 @@ public:
 	void insertTextSurface(Graphics::Surface *surface, WidthHeight &dimensions,
 		Common::Point &drawPosition, uint32 priority);
 protected:
-	typedef Common::List<SpriteDrawQueueItem*> SpriteDrawQueueList;
-	typedef SpriteDrawQueueList::iterator SpriteDrawQueueListIterator;
-	struct FindInsertionPosition : public Common::UnaryFunction<const SpriteDrawQueueItem*, bool> {
-		uint32 _priority;
-		FindInsertionPosition(uint32 priority) : _priority(priority) {}
-		bool operator()(const SpriteDrawQueueItem *item) const {
-			return item->_priority >= _priority;
-		}
-	};
+	typedef Common::Array<SpriteDrawQueueItem*> SpriteDrawQueueList;
 	Screen *_screen;
 	SpriteDrawQueueList _queue;
+	uint32 _nextOrderIndex;
+	static bool itemCompare(const SpriteDrawQueueItem *item1, const SpriteDrawQueueItem *item2);
 	void insert(SpriteDrawQueueItem *item, uint32 priority);
 	bool calcItemRect(SpriteDrawQueueItem *item, Common::Rect &srcRect, Common::Rect &dstRect);
 };
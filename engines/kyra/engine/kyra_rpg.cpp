@@ -60,6 +60,12 @@ KyraRpgEngine::KyraRpgEngine(OSystem *system, const GameFlags &flags) : KyraEngi
 	_blockBrightness = _wllVcnOffset = _wllVcnOffset2 = _wllVcnRmdOffset = 0;
 	_blockDrawingBuffer = 0;
 	_sceneWindowBuffer = 0;
+	_vcnCacheDrawingBuffer = 0;
+	_vcnCacheBlocks = 0;
+	_vcnCacheLevel = 0;
+	_vcnCacheBrightness = 0;
+	_vcnCacheWllVcnOffset = 0;
+	_vcnCacheValid = false;
 	_monsterShapes = _monsterPalettes = 0;
 
 	_doorShapes = 0;
@@ -151,6 +157,7 @@ KyraRpgEngine::~KyraRpgEngine() {
 	delete[] _vcnShift;
 	delete[] _blockDrawingBuffer;
 	delete[] _sceneWindowBuffer;
+	delete[] _vcnCacheDrawingBuffer;
 	delete _vcnDrawLine;
 
 	delete[] _lvlShapeTop;
@@ -179,6 +186,7 @@ Common::Error KyraRpgEngine::init() {
 	_wllWallFlags = new uint8[256]();
 
 	_blockDrawingBuffer = new uint16[1320]();
+	_vcnCacheDrawingBuffer = new uint16[1320]();
 	int windowBufferSize = _flags.useHiColorMode ? 42240 : 21120;
 	_sceneWindowBuffer = new uint8[windowBufferSize]();
 
@@ -306,6 +306,16 @@ protected:
 	uint8 _vcnBpp;
 	uint16 *_blockDrawingBuffer;
 	uint8 *_sceneWindowBuffer;
+	// Copy of the state that produced the current contents of
+	// _sceneWindowBuffer. It allows drawVcnBlocks() to skip recomposing
+	// the wall set blocks when nothing has changed since the last scene
+	// redraw (e.g. redraws caused by monster or flying object updates).
+	uint16 *_vcnCacheDrawingBuffer;
+	const uint8 *_vcnCacheBlocks;
+	uint8 _vcnCacheLevel;
+	uint8 _vcnCacheBrightness;
+	uint8 _vcnCacheWllVcnOffset;
+	bool _vcnCacheValid;
 	uint8 _blockBrightness;
 	uint8 _wllVcnOffset;
 	uint8 _wllVcnOffset2;
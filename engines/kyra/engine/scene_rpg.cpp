@@ -345,6 +345,16 @@ uint16 KyraRpgEngine::calcNewBlockPosition(uint16 curBlock, uint16 direction) {
 }
 
 void KyraRpgEngine::drawVcnBlocks() {
+	// The composed scene window only depends on the block drawing buffer,
+	// the level data and the brightness. Skip the expensive block
+	// composition if none of these have changed since the last redraw.
+	if (_vcnCacheValid && _vcnCacheBlocks == _vcnBlocks && _vcnCacheLevel == _currentLevel &&
+	        _vcnCacheBrightness == _blockBrightness && _vcnCacheWllVcnOffset == _wllVcnOffset &&
+	        !memcmp(_vcnCacheDrawingBuffer, _blockDrawingBuffer, 1320 * sizeof(uint16))) {
+		screen()->copyBlockToPage(_sceneDrawPage1, _sceneXoffset, 0, 176, 120, _sceneWindowBuffer);
+		return;
+	}
+
 	uint8 *d = _sceneWindowBuffer;
 	uint16 *bdb = _blockDrawingBuffer;
 
@@ -420,6 +430,13 @@ void KyraRpgEngine::drawVcnBlocks() {
 		d += 1232 * _vcnBpp;
 	}
 
+	memcpy(_vcnCacheDrawingBuffer, _blockDrawingBuffer, 1320 * sizeof(uint16));
+	_vcnCacheBlocks = _vcnBlocks;
+	_vcnCacheLevel = _currentLevel;
+	_vcnCacheBrightness = _blockBrightness;
+	_vcnCacheWllVcnOffset = _wllVcnOffset;
+	_vcnCacheValid = true;
+
 	screen()->copyBlockToPage(_sceneDrawPage1, _sceneXoffset, 0, 176, 120, _sceneWindowBuffer);
 }
 
@@ -1002,10 +1002,16 @@ void Screen::copyRegion(int x1, int y1, int x2, int y2, int w, int h, int srcPag
 	copyOverlayRegion(x1, y1, x2, y2, w, h, srcPage, dstPage);
 
 	if (flags & CR_NO_P_CHECK) {
-		while (h--) {
-			memmove(dst, src, w * _bytesPerPixel);
-			src += SCREEN_W * _bytesPerPixel;
-			dst += SCREEN_W * _bytesPerPixel;
+		if (w == SCREEN_W && x1 == 0 && x2 == 0) {
+			// Full width regions are contiguous in the page buffers,
+			// so all the rows can be copied in one go.
+			memmove(dst, src, h * SCREEN_W * _bytesPerPixel);
+		} else {
+			while (h--) {
+				memmove(dst, src, w * _bytesPerPixel);
+				src += SCREEN_W * _bytesPerPixel;
+				dst += SCREEN_W * _bytesPerPixel;
+			}
 		}
 	} else {
 		while (h--) {
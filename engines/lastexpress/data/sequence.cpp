@@ -341,6 +341,9 @@ void Sequence::reset() {
 	_frames.clear();
 	delete _stream;
 	_stream = nullptr;
+	delete _cachedFrame;
+	_cachedFrame = nullptr;
+	_cachedFrameIndex = 0;
 }
 
 Sequence *Sequence::load(Common::String name, Common::SeekableReadStream *stream, byte field30) {
@@ -420,6 +423,19 @@ AnimFrame *Sequence::getFrame(uint16 index) {
 	return new AnimFrame(_stream, *frame);
 }
 
+AnimFrame *Sequence::getCachedFrame(uint16 index) {
+	if (_cachedFrame && _cachedFrameIndex == index)
+		return _cachedFrame;
+
+	// Entities animate one frame at a time, so only the last decoded frame
+	// is worth keeping around
+	delete _cachedFrame;
+	_cachedFrame = getFrame(index);
+	_cachedFrameIndex = index;
+
+	return _cachedFrame;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // SequenceFrame
 SequenceFrame::~SequenceFrame() {
@@ -434,15 +450,15 @@ Common::Rect SequenceFrame::draw(Graphics::Surface *surface) {
 	if (!_sequence || _frame >= _sequence->count())
 		return Common::Rect();
 
-	AnimFrame *f = _sequence->getFrame(_frame);
+	// The decoded frame is owned by the sequence, which keeps it until the
+	// animation moves on to another frame. The graphics manager redraws
+	// every queued frame whenever the overlay changes, so without the cache
+	// each redraw would decompress every visible frame again
+	AnimFrame *f = _sequence->getCachedFrame(_frame);
 	if (!f)
 		return Common::Rect();
 
-	Common::Rect rect = f->draw(surface);
-
-	delete f;
-
-	return rect;
+	return f->draw(surface);
 }
 
 bool SequenceFrame::setFrame(uint16 frame) {
@@ -151,7 +151,7 @@ private:
 
 class Sequence {
 public:
-	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15) {}
+	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15), _cachedFrame(NULL), _cachedFrameIndex(0) {}
 	~Sequence();
 
 	static Sequence *load(Common::String name, Common::SeekableReadStream *stream = NULL, byte field30 = 15);
@@ -160,6 +160,14 @@ public:
 
 	uint16 count() const { return (uint16)_frames.size(); }
 	AnimFrame *getFrame(uint16 index = 0);
+
+	/**
+	 * Returns a decoded frame owned by the sequence. The frame stays valid
+	 * until another frame of the same sequence is requested or the sequence
+	 * is destroyed, so redrawing the current frame of an animation doesn't
+	 * decompress it again
+	 */
+	AnimFrame *getCachedFrame(uint16 index = 0);
 	FrameInfo *getFrameInfo(uint16 index = 0);
 
 	Common::String getName() { return _name; }
@@ -179,6 +187,9 @@ private:
 
 	Common::String _name;
 	byte _field30; // used when copying sequences
+
+	AnimFrame *_cachedFrame;
+	uint16 _cachedFrameIndex;
 };
 
 class SequenceFrame : public Drawable {
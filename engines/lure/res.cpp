@@ -60,6 +60,7 @@ Resources::~Resources() {
 
 void Resources::freeData() {
 	_activeHotspots.clear();
+	_activeHotspotIndex.clear();
 	_roomData.clear();
 	_hotspotData.clear();
 	_hotspotOverrides.clear();
@@ -452,14 +453,41 @@ HotspotData *Resources::getHotspot(uint16 hotspotId) {
 }
 
 Hotspot *Resources::getActiveHotspot(uint16 hotspotId) {
-	HotspotList::iterator i;
+	// The index is kept up to date by the hotspot add/deactivate methods,
+	// saving a scan of the active list for every lookup
+	HotspotIndex::iterator entry = _activeHotspotIndex.find(hotspotId);
+	return (entry != _activeHotspotIndex.end()) ? entry->_value : nullptr;
+}
+
+void Resources::indexActiveHotspot(Hotspot *hotspot) {
+	// First activation wins, matching the in-order list scan previously done
+	// by getActiveHotspot - destination placeholders can share the Id 0xffff
+	if (!_activeHotspotIndex.contains(hotspot->hotspotId()))
+		_activeHotspotIndex[hotspot->hotspotId()] = hotspot;
+}
+
+void Resources::unindexActiveHotspot(Hotspot *hotspot) {
+	HotspotIndex::iterator entry = _activeHotspotIndex.find(hotspot->hotspotId());
+	if ((entry == _activeHotspotIndex.end()) || (entry->_value != hotspot))
+		return;
+
+	_activeHotspotIndex.erase(entry);
 
-	for (i = _activeHotspots.begin(); i != _activeHotspots.end(); ++i) {
+	// Reinstate the next active hotspot with the same Id, if there is one
+	for (HotspotList::iterator i = _activeHotspots.begin(); i != _activeHotspots.end(); ++i) {
 		Hotspot *rec = (*i).get();
-		if (rec->hotspotId() == hotspotId) return rec;
+		if ((rec->hotspotId() == hotspot->hotspotId()) && (rec != hotspot)) {
+			_activeHotspotIndex[rec->hotspotId()] = rec;
+			break;
+		}
 	}
+}
 
-	return nullptr;
+void Resources::rebuildHotspotIndex() {
+	_activeHotspotIndex.clear();
+
+	for (HotspotList::iterator i = _activeHotspots.begin(); i != _activeHotspots.end(); ++i)
+		indexActiveHotspot((*i).get());
 }
 
 
@@ -658,6 +686,7 @@ Hotspot *Resources::addHotspot(uint16 hotspotId) {
 	assert(hData);
 	Hotspot *hotspot = new Hotspot(hData);
 	_activeHotspots.push_back(HotspotList::value_type(hotspot));
+	indexActiveHotspot(hotspot);
 
 	if (hotspotId < FIRST_NONCHARACTER_ID) {
 		// Default characters to facing upwards until they start moving
@@ -675,6 +704,7 @@ Hotspot *Resources::addHotspot(uint16 hotspotId) {
 
 void Resources::addHotspot(Hotspot *hotspot) {
 	_activeHotspots.push_back(HotspotList::value_type(hotspot));
+	indexActiveHotspot(hotspot);
 }
 
 void Resources::deactivateHotspot(uint16 hotspotId, bool isDestId) {
@@ -684,6 +714,7 @@ void Resources::deactivateHotspot(uint16 hotspotId, bool isDestId) {
 		Hotspot const &h = **i;
 		if ((!isDestId && (h.hotspotId() == hotspotId)) ||
 			(isDestId && (h.destHotspotId() == hotspotId) && (h.hotspotId() == 0xffff))) {
+			unindexActiveHotspot((*i).get());
 			_activeHotspots.erase(i);
 			break;
 		}
@@ -698,6 +729,7 @@ void Resources::deactivateHotspot(Hotspot *hotspot) {
 	while (i != _activeHotspots.end()) {
 		Hotspot *h = (*i).get();
 		if (h == hotspot) {
+			unindexActiveHotspot(h);
 			_activeHotspots.erase(i);
 			break;
 		}
@@ -807,6 +839,7 @@ void Resources::loadFromStream(Common::ReadStream *stream) {
 	_hotspotData.loadFromStream(stream);
 	debugC(ERROR_DETAILED, kLureDebugScripts, "Loading active hotspots");
 	_activeHotspots.loadFromStream(stream);
+	rebuildHotspotIndex();
 	debugC(ERROR_DETAILED, kLureDebugScripts, "Loading fields");
 	_fieldList.loadFromStream(stream);
 	debugC(ERROR_DETAILED, kLureDebugScripts, "Loading random actions");
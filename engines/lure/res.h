@@ -31,6 +31,7 @@
 
 #include "common/array.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/random.h"
 
@@ -64,6 +65,8 @@ private:
 	uint16 *_hotspotScriptData;
 	RoomExitJoinList _exitJoins;
 	HotspotList _activeHotspots;
+	typedef Common::HashMap<uint16, Hotspot *> HotspotIndex;
+	HotspotIndex _activeHotspotIndex;
 	ValueTableData _fieldList;
 	HotspotActionSet _actionsList;
 	TalkHeaderList _talkHeaders;
@@ -94,6 +97,9 @@ private:
 
 	void reloadData();
 	void freeData();
+	void indexActiveHotspot(Hotspot *hotspot);
+	void unindexActiveHotspot(Hotspot *hotspot);
+	void rebuildHotspotIndex();
 public:
 	Resources();
 	~Resources();
@@ -173,6 +179,10 @@ public:
 	void addHotspot(Hotspot *hotspot);
 	void deactivateHotspot(uint16 hotspotId, bool isDestId = false);
 	void deactivateHotspot(Hotspot *hotspot);
+	void deactivateAllHotspots() {
+		_activeHotspots.clear();
+		_activeHotspotIndex.clear();
+	}
 	void saveToStream(Common::WriteStream *stream);
 	void loadFromStream(Common::ReadStream *stream);
 };
@@ -138,12 +138,10 @@ void Room::leaveRoom() {
 	HotspotList &list = r.activeHotspots();
 	HotspotList::iterator i = list.begin();
 	while (i != list.end()) {
-		Hotspot const &h = **i;
-		if (!h.persistant()) {
-			i = list.erase(i);
-		} else {
-			++i;
-		}
+		Hotspot *h = (*i).get();
+		++i;
+		if (!h->persistant())
+			r.deactivateHotspot(h);
 	}
 }
 
@@ -1167,7 +1167,7 @@ bool RestartRestoreDialog::show() {
 		s->copyTo(&screen.screen(), 0, MENUBAR_Y_SIZE);
 		delete s;
 
-		res.activeHotspots().clear();
+		res.deactivateAllHotspots();
 		Hotspot *btnHotspot = new Hotspot();
 
 		// Restart button
@@ -54,19 +54,30 @@ typedef Common::List<DepthEntry> DepthList;
 
 /*------------------------------------------------------------------------*/
 
-MSprite::MSprite() : MSurface() {
+MSprite::MSprite() : MSurface(), _flippedCopy(nullptr) {
 	_transparencyIndex = TRANSPARENT_COLOR_INDEX;
 }
 
 MSprite::MSprite(Common::SeekableReadStream *source, const Common::Array<RGB6> &palette,
 		const Common::Rect &bounds): MSurface(), _transparencyIndex(TRANSPARENT_COLOR_INDEX),
-	  _offset(Common::Point(bounds.left, bounds.top)) {
+	  _offset(Common::Point(bounds.left, bounds.top)), _flippedCopy(nullptr) {
 	// Load the sprite data
 	create(bounds.width(), bounds.height());
 	loadSprite(source, palette);
 }
 
 MSprite::~MSprite() {
+	if (_flippedCopy) {
+		_flippedCopy->free();
+		delete _flippedCopy;
+	}
+}
+
+BaseSurface *MSprite::flippedCopy() {
+	if (!_flippedCopy)
+		_flippedCopy = flipHorizontal();
+
+	return _flippedCopy;
 }
 
 void MSprite::loadSprite(Common::SeekableReadStream *source,
@@ -337,20 +348,11 @@ void SpriteSlots::drawSprites(MSurface *s) {
 				s->copyFrom(*sprite, Common::Point(xp, yp), slot._depth, &scene._depthSurface,
 					-1, flipped, sprite->getTransparencyIndex());
 			} else {
-				BaseSurface *spr = sprite;
-				if (flipped) {
-					// Create a flipped copy of the sprite temporarily
-					spr = sprite->flipHorizontal();
-				}
+				// Use the cached flipped copy if needed
+				BaseSurface *spr = flipped ? sprite->flippedCopy() : sprite;
 
 				// No depth, so simply draw the image
 				s->transBlitFrom(*spr, Common::Point(xp, yp), sprite->getTransparencyIndex());
-
-				// Free sprite if it was a flipped one
-				if (flipped) {
-					spr->free();
-					delete spr;
-				}
 			}
 		}
 	}
@@ -109,6 +109,8 @@ struct SpriteFrameHeader {
 
 class MSprite : public MSurface {
 private:
+	BaseSurface *_flippedCopy;
+
 	void loadSprite(Common::SeekableReadStream *source, const Common::Array<RGB6> &palette);
 public:
 	MSprite();
@@ -120,6 +122,13 @@ public:
 	int _transparencyIndex;
 
 	byte getTransparencyIndex() const;
+
+	/**
+	 * Returns a horizontally flipped copy of the sprite. The copy is built
+	 * on first use and kept, since a sprite that is drawn flipped once
+	 * tends to be drawn flipped on every following frame as well
+	 */
+	BaseSurface *flippedCopy();
 };
 
 class SpriteSlotSubset {
@@ -161,11 +161,9 @@ void UISlots::draw(bool updateFlag, bool delFlag) {
 					MSprite *sprite = asset->getFrame(frameNumber - 1);
 
 					if (flipped) {
-						BaseSurface *spr = sprite->flipHorizontal();
+						BaseSurface *spr = sprite->flippedCopy();
 						userInterface.mergeFrom(spr, spr->getBounds(), slot._position,
 							sprite->getTransparencyIndex());
-						spr->free();
-						delete spr;
 					} else {
 						userInterface.mergeFrom(sprite, sprite->getBounds(), slot._position,
 							sprite->getTransparencyIndex());
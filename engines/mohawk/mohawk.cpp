@@ -22,6 +22,7 @@
 
 #include "common/scummsys.h"
 #include "common/error.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
@@ -40,6 +41,7 @@ MohawkEngine::MohawkEngine(OSystem *syst, const MohawkGameDescription *gamedesc)
 
 	_pauseDialog = nullptr;
 	_cursor = nullptr;
+	_cachedResourceSize = 0;
 }
 
 MohawkEngine::~MohawkEngine() {
@@ -59,6 +61,21 @@ void MohawkEngine::pauseGame() {
 }
 
 Common::SeekableReadStream *MohawkEngine::getResource(uint32 tag, uint16 id) {
+	// Serve prefetched resources from memory
+	for (Common::List<CachedResource>::iterator it = _resourceCache.begin(); it != _resourceCache.end(); it++) {
+		if (it->tag == tag && it->id == id) {
+			byte *data = (byte *)malloc(it->size);
+			memcpy(data, it->data, it->size);
+
+			// Keep the most recently used entries at the front
+			CachedResource res = *it;
+			_resourceCache.erase(it);
+			_resourceCache.push_front(res);
+
+			return new Common::MemoryReadStream(data, res.size, DisposeAfterUse::YES);
+		}
+	}
+
 	for (uint32 i = 0; i < _mhk.size(); i++)
 		if (_mhk[i]->hasResource(tag, id))
 			return _mhk[i]->getResource(tag, id);
@@ -66,6 +83,50 @@ Common::SeekableReadStream *MohawkEngine::getResource(uint32 tag, uint16 id) {
 	error("Could not find a '%s' resource with ID %04x", tag2str(tag), id);
 }
 
+void MohawkEngine::cacheResource(uint32 tag, uint16 id) {
+	for (Common::List<CachedResource>::const_iterator it = _resourceCache.begin(); it != _resourceCache.end(); it++)
+		if (it->tag == tag && it->id == id)
+			return; // already cached
+
+	if (!hasResource(tag, id))
+		return;
+
+	Common::SeekableReadStream *stream = getResource(tag, id);
+
+	CachedResource res;
+	res.tag = tag;
+	res.id = id;
+	res.size = stream->size();
+
+	// Don't let a single large resource flush the whole cache
+	if (res.size > kResourceCacheLimit / 4) {
+		delete stream;
+		return;
+	}
+
+	res.data = (byte *)malloc(res.size);
+	stream->read(res.data, res.size);
+	delete stream;
+
+	_resourceCache.push_front(res);
+	_cachedResourceSize += res.size;
+
+	// Evict the least recently used entries until we fit the budget again
+	while (_cachedResourceSize > kResourceCacheLimit) {
+		CachedResource &evict = _resourceCache.back();
+		_cachedResourceSize -= evict.size;
+		free(evict.data);
+		_resourceCache.pop_back();
+	}
+}
+
+void MohawkEngine::clearResourceCache() {
+	for (Common::List<CachedResource>::iterator it = _resourceCache.begin(); it != _resourceCache.end(); it++)
+		free(it->data);
+	_resourceCache.clear();
+	_cachedResourceSize = 0;
+}
+
 bool MohawkEngine::hasResource(uint32 tag, uint16 id) {
 	for (uint32 i = 0; i < _mhk.size(); i++)
 		if (_mhk[i]->hasResource(tag, id))
@@ -108,6 +169,9 @@ Common::String MohawkEngine::getResourceName(uint32 tag, uint16 id) {
 }
 
 void MohawkEngine::closeAllArchives() {
+	// The cached resources belong to the archives being closed
+	clearResourceCache();
+
 	for (uint32 i = 0; i < _mhk.size(); i++)
 		delete _mhk[i];
 
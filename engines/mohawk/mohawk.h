@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/array.h"
+#include "common/list.h"
 
 #include "engines/engine.h"
 
@@ -75,6 +76,17 @@ public:
 	CursorManager *_cursor;
 
 	virtual Common::SeekableReadStream *getResource(uint32 tag, uint16 id);
+
+	/**
+	 * Read a resource's raw data into the budgeted resource cache.
+	 *
+	 * Subsequent getResource() calls for it are served from memory
+	 * instead of hitting storage. The least recently used entries are
+	 * evicted once the budget is exhausted. The cache is flushed when
+	 * the archives are closed.
+	 */
+	void cacheResource(uint32 tag, uint16 id);
+
 	bool hasResource(uint32 tag, uint16 id);
 	bool hasResource(uint32 tag, const Common::String &resName);
 	uint32 getResourceOffset(uint32 tag, uint16 id);
@@ -87,6 +99,22 @@ public:
 private:
 	PauseDialog *_pauseDialog;
 
+	struct CachedResource {
+		uint32 tag;
+		uint16 id;
+		byte *data;
+		uint32 size;
+	};
+
+	void clearResourceCache();
+
+	// Raw resource data kept in memory by cacheResource(), most recently
+	// used entries first
+	Common::List<CachedResource> _resourceCache;
+	uint32 _cachedResourceSize;
+
+	static const uint32 kResourceCacheLimit = 8 * 1024 * 1024;
+
 protected:
 	// An array holding the main Mohawk archives require by the games
 	Common::Array<Archive *> _mhk;
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/debug-channels.h"
 #include "common/events.h"
@@ -230,6 +231,13 @@ void MohawkEngine_Riven::doFrame() {
 
 	_inventory->onFrame();
 
+	// Prefetch one of the linked cards' resources per frame while the
+	// game is idle
+	if (!_prefetchQueue.empty()) {
+		cacheResource(ID_TBMP, _prefetchQueue.back());
+		_prefetchQueue.pop_back();
+	}
+
 	// Update the screen once per frame
 	_system->updateScreen();
 	uint32 loopElapsed = _system->getMillis() - loopStart;
@@ -385,6 +393,9 @@ void MohawkEngine_Riven::changeToStack(uint16 stackId) {
 
 	// Clear the graphics cache; images aren't used across stack boundaries
 	_gfx->clearCache();
+	// Resource ids are stack relative, prefetching queued ones would load
+	// the wrong resources
+	_prefetchQueue.clear();
 
 	// Clear the old stack files out
 	closeAllArchives();
@@ -631,6 +642,11 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	_card = new RivenCard(this, dest);
 	_card->enter(true);
 
+	// Queue the bitmaps of the cards reachable from this one for
+	// prefetching into the resource cache, one per frame, so that the
+	// next card change doesn't have to wait for storage
+	queueLinkedCardResources();
+
 	// Now we need to redraw the cursor if necessary and handle mouse over scripts
 	_stack->queueMouseCursorRefresh();
 
@@ -642,6 +658,31 @@ Common::SeekableReadStream *MohawkEngine_Riven::getExtrasResource(uint32 tag, ui
 	return _extrasFile->getResource(tag, id);
 }
 
+void MohawkEngine_Riven::queueLinkedCardResources() {
+	_prefetchQueue.clear();
+
+	Common::Array<uint16> linkedCards = _card->getChangeCardTargets();
+	for (uint i = 0; i < linkedCards.size(); i++) {
+		if (!hasResource(ID_PLST, linkedCards[i]))
+			continue;
+
+		// The picture list enumerates the bitmaps the linked card can draw
+		Common::SeekableReadStream *plst = getResource(ID_PLST, linkedCards[i]);
+		uint16 recordCount = plst->readUint16BE();
+
+		for (uint16 j = 0; j < recordCount; j++) {
+			plst->readUint16BE(); // index
+			uint16 bitmapId = plst->readUint16BE();
+			plst->skip(8); // rect
+
+			if (Common::find(_prefetchQueue.begin(), _prefetchQueue.end(), bitmapId) == _prefetchQueue.end())
+				_prefetchQueue.push_back(bitmapId);
+		}
+
+		delete plst;
+	}
+}
+
 Common::Array<uint16> MohawkEngine_Riven::getResourceIDList(uint32 type) const {
 	Common::Array<uint16> ids;
 
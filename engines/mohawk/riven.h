@@ -149,6 +149,11 @@ private:
 	uint32 _lastSaveTime;
 	Common::Language _currentLanguage;
 
+	// Picture resources of the cards linked from the current card, queued
+	// for prefetching into the engine's resource cache
+	Common::Array<uint16> _prefetchQueue;
+	void queueLinkedCardResources();
+
 	// Variables
 	void initVars();
 
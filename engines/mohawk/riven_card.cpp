@@ -926,6 +926,20 @@ RivenHotspot *RivenCard::getCurHotspot() const {
 	return _hoveredHotspot;
 }
 
+Common::Array<uint16> RivenCard::getChangeCardTargets() const {
+	Common::Array<uint16> cardIds;
+
+	for (uint i = 0; i < _scripts.size(); i++) {
+		_scripts[i].script->collectChangeCardTargets(cardIds);
+	}
+
+	for (uint i = 0; i < _hotspots.size(); i++) {
+		_hotspots[i]->collectChangeCardTargets(cardIds);
+	}
+
+	return cardIds;
+}
+
 RivenScriptPtr RivenCard::onMouseDown(const Common::Point &mouse) {
 	RivenScriptPtr script = onMouseMove(mouse);
 	updateMouseCursor();
@@ -1301,6 +1315,12 @@ RivenScriptPtr RivenHotspot::getScript(uint16 scriptType) const {
 	return RivenScriptPtr();
 }
 
+void RivenHotspot::collectChangeCardTargets(Common::Array<uint16> &cardIds) const {
+	for (uint16 i = 0; i < _scripts.size(); i++) {
+		_scripts[i].script->collectChangeCardTargets(cardIds);
+	}
+}
+
 void RivenHotspot::applyPropertiesPatches(uint32 cardGlobalId) {
 	// In Jungle island, one of the bridge hotspots does not have a name
 	// This breaks keyboard navigation. Set the proper name.
@@ -110,6 +110,9 @@ public:
 	/** Get the currently hovered hotspot if any */
 	RivenHotspot *getCurHotspot() const;
 
+	/** Collect the ids of the cards the card's scripts and hotspots may switch to */
+	Common::Array<uint16> getChangeCardTargets() const;
+
 	/** Get all the hotspots in the card. To be used for debugging features only */
 	Common::Array<RivenHotspot *> getHotspots() const;
 
@@ -228,6 +231,9 @@ public:
 	/** Get the one of the hotspot's scripts */
 	RivenScriptPtr getScript(uint16 scriptType) const;
 
+	/** Collect the ids of the cards the hotspot's scripts may switch to */
+	void collectChangeCardTargets(Common::Array<uint16> &cardIds) const;
+
 	/** Enable or disable the hotspot */
 	void enable(bool e);
 
@@ -385,6 +385,12 @@ void RivenScript::applyCardPatches(MohawkEngine_Riven *vm, uint32 cardGlobalId,
 	}
 }
 
+void RivenScript::collectChangeCardTargets(Common::Array<uint16> &cardIds) const {
+	for (uint i = 0; i < _commands.size(); i++) {
+		_commands[i]->collectChangeCardTargets(cardIds);
+	}
+}
+
 RivenScriptPtr &operator+=(RivenScriptPtr &lhs, const RivenScriptPtr &rhs) {
 	if (rhs) {
 		*lhs += *rhs;
@@ -831,6 +837,11 @@ RivenCommandType RivenSimpleCommand::getType() const {
 	return _type;
 }
 
+void RivenSimpleCommand::collectChangeCardTargets(Common::Array<uint16> &cardIds) const {
+	if (_type == kRivenCommandChangeCard)
+		cardIds.push_back(_arguments[0]);
+}
+
 RivenSwitchCommand::RivenSwitchCommand(MohawkEngine_Riven *vm) :
 		RivenCommand(vm),
 		_variableId(0) {
@@ -918,6 +929,12 @@ void RivenSwitchCommand::applyCardPatches(uint32 globalId, int scriptType, uint1
 	}
 }
 
+void RivenSwitchCommand::collectChangeCardTargets(Common::Array<uint16> &cardIds) const {
+	for (uint i = 0; i < _branches.size(); i++) {
+		_branches[i].script->collectChangeCardTargets(cardIds);
+	}
+}
+
 RivenStackChangeCommand::RivenStackChangeCommand(MohawkEngine_Riven *vm, uint16 stackId, uint32 globalCardId,
 												 bool byStackId, bool byStackCardId) :
 		RivenCommand(vm),
@@ -278,8 +278,32 @@ void Node::update() {
 		// Alloc the target surface if necessary
 		if (!face->_finalBitmap) {
 			face->_finalBitmap = new Graphics::Surface();
+			face->_finalBitmap->copyFrom(*face->_bitmap);
+		} else {
+			// Only the pixels covered by the effects and by this frame's
+			// dirty rect can differ from the previous copy, so restoring
+			// just those areas avoids re-copying the whole face bitmap on
+			// every effect step
+			Common::Rect copyRect;
+			if (face->isTextureDirty()) {
+				copyRect = face->getTextureDirtyRect();
+			}
+			for (uint i = 0; i < _effects.size(); i++) {
+				if (!_effects[i]->hasFace(faceId))
+					continue;
+
+				Common::Rect effectRect = _effects[i]->getUpdateRectForFace(faceId);
+				if (copyRect.isEmpty()) {
+					copyRect = effectRect;
+				} else {
+					copyRect.extend(effectRect);
+				}
+			}
+			copyRect.clip(Common::Rect(face->_bitmap->w, face->_bitmap->h));
+			if (!copyRect.isEmpty()) {
+				face->_finalBitmap->copyRectToSurface(*face->_bitmap, copyRect.left, copyRect.top, copyRect);
+			}
 		}
-		face->_finalBitmap->copyFrom(*face->_bitmap);
 
 		if (effectsForFace == 1) {
 			_effects[0]->applyForFace(faceId, face->_bitmap, face->_finalBitmap);
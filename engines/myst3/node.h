@@ -51,6 +51,7 @@ public:
 
 	void addTextureDirtyRect(const Common::Rect &rect);
 	bool isTextureDirty() { return _textureDirty; }
+	const Common::Rect &getTextureDirtyRect() const { return _textureDirtyRect; }
 
 	void uploadTexture();
 
@@ -51,7 +51,8 @@ Textbox::Textbox(RenderObject &redrawFrom) :
 		_needsTextRedraw(false),
 		_scrollbar(nullptr),
 		_scrollbarPos(0),
-		_numLines(0) {}
+		_numLines(0),
+		_numDrawnLines(0) {}
 
 Textbox::~Textbox() {
 	delete _scrollbar;
@@ -135,14 +136,14 @@ void Textbox::handleInput(NancyInput &input) {
 void Textbox::drawTextbox() {
 	using namespace Common;
 
-	_numLines = 0;
-
 	const Font *font = g_nancy->_graphicsManager->getFont(_fontID);
 
 	uint maxWidth = _fullSurface.w - _maxWidthDifference - _borderWidth - 2;
 	uint lineDist = _lineHeight + _lineHeight / 4 + (g_nancy->getGameType() == kGameTypeVampire ? 1 : 0);
 
-	for (uint lineID = 0; lineID < _textLines.size(); ++lineID) {
+	// Lines that have already been laid out are still rendered inside
+	// _fullSurface, so only the ones added since the last draw need work
+	for (uint lineID = _numDrawnLines; lineID < _textLines.size(); ++lineID) {
 		Common::String currentLine = _textLines[lineID];
 
 		uint horizontalOffset = 0;
@@ -253,6 +254,8 @@ void Textbox::drawTextbox() {
 		++_numLines;
 	}
 
+	_numDrawnLines = _textLines.size();
+
 	setVisible(true);
 	_needsTextRedraw = false;
 }
@@ -263,6 +266,7 @@ void Textbox::clear() {
 	_hotspots.clear();
 	_scrollbar->resetPosition();
 	_numLines = 0;
+	_numDrawnLines = 0;
 	onScrollbarMove();
 	_needsRedraw = true;
 }
@@ -74,6 +74,8 @@ private:
 	uint16 _borderWidth;
 	uint16 _maxWidthDifference;
 	uint16 _numLines;
+	// Number of _textLines entries already rendered into _fullSurface
+	uint16 _numDrawnLines;
 	uint16 _fontID;
 
 	bool _needsTextRedraw;
@@ -83,6 +83,7 @@ AVFDecoder::AVFVideoTrack::AVFVideoTrack(Common::SeekableReadStream *stream, uin
 	_curFrame = -1;
 	_refFrame = -1;
 	_reversed = false;
+	_nextCacheSlot = 0;
 	_dec = new Decompressor;
 
 	_frameCount = stream->readUint16LE();
@@ -142,6 +143,10 @@ AVFDecoder::AVFVideoTrack::~AVFVideoTrack() {
 	_surface->free();
 	delete _surface;
 	delete _dec;
+
+	for (uint i = 0; i < kDecodedFrameCacheSize; ++i) {
+		delete[] _frameCache[i].buf;
+	}
 }
 
 bool AVFDecoder::AVFVideoTrack::seek(const Audio::Timestamp &time) {
@@ -210,6 +215,33 @@ bool AVFDecoder::AVFVideoTrack::decode(byte *outBuf, uint32 frameSize, Common::R
 }
 
 const Graphics::Surface *AVFDecoder::AVFVideoTrack::decodeFrame(uint frameNr) {
+	// Check the ring of recently decoded frames first, so that jumping back
+	// to a frame we just left only costs a memcpy
+	for (uint i = 0; i < kDecodedFrameCacheSize; ++i) {
+		if (_frameCache[i].frameNr == (int)frameNr) {
+			memcpy(_surface->getPixels(), _frameCache[i].buf, _frameSize);
+			_refFrame = frameNr;
+			return _surface;
+		}
+	}
+
+	const Graphics::Surface *frame = decodeChunk(frameNr);
+
+	if (frame) {
+		// Keep a copy of the decoded frame in the next ring slot
+		CachedFrame &slot = _frameCache[_nextCacheSlot];
+		if (!slot.buf) {
+			slot.buf = new byte[_frameSize];
+		}
+		memcpy(slot.buf, frame->getPixels(), _frameSize);
+		slot.frameNr = frameNr;
+		_nextCacheSlot = (_nextCacheSlot + 1) % kDecodedFrameCacheSize;
+	}
+
+	return frame;
+}
+
+const Graphics::Surface *AVFDecoder::AVFVideoTrack::decodeChunk(uint frameNr) {
 	if (frameNr >= _chunkInfo.size()) {
 		warning("Frame %d doesn't exist", frameNr);
 		return nullptr;
@@ -264,7 +296,8 @@ const Graphics::Surface *AVFDecoder::AVFVideoTrack::decodeFrame(uint frameNr) {
 }
 
 const Graphics::Surface *AVFDecoder::AVFVideoTrack::decodeNextFrame() {
-	return decodeFrame(_reversed ? _curFrame-- : ++_curFrame);
+	// Sequential playback rarely revisits a frame, so it bypasses the cache
+	return decodeChunk(_reversed ? _curFrame-- : ++_curFrame);
 }
 
 } // End of namespace Nancy
@@ -79,7 +79,20 @@ private:
 			byte type;
 		};
 
+		// Ring of recently decoded frames. Only used by the random access
+		// decodeFrame() path, so that panning back and forth across a scene
+		// background doesn't decompress the same chunks over and over
+		struct CachedFrame {
+			int frameNr;
+			byte *buf;
+
+			CachedFrame() : frameNr(-1), buf(nullptr) {}
+		};
+
+		static const uint kDecodedFrameCacheSize = 8;
+
 		bool decode(byte *outBuf, uint32 frameSize, Common::ReadStream &inBuf) const;
+		const Graphics::Surface *decodeChunk(uint frameNr);
 
 		Common::SeekableReadStream *_fileStream;
 		Graphics::PixelFormat _pixelFormat;
@@ -92,6 +105,8 @@ private:
 		Common::Array<ChunkInfo> _chunkInfo;
 		Decompressor *_dec;
 		bool _reversed;
+		CachedFrame _frameCache[kDecodedFrameCacheSize];
+		uint _nextCacheSlot;
 	};
 };
 
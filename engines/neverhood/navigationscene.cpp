@@ -150,6 +150,15 @@ void NavigationScene::createMouseCursor() {
 	sendPointMessage(_mouseCursor, 0x4002, _vm->getMousePos());
 }
 
+void NavigationScene::prefetchNavigationCursor() {
+	// Load the next navigation point's mouse cursor while the turn movie
+	// plays, instead of stalling once it has finished
+	uint32 mouseCursorFileHash = (*_navigationList)[_navigationIndex].mouseCursorFileHash;
+	if (mouseCursorFileHash == 0)
+		mouseCursorFileHash = 0x63A40028;
+	_vm->_res->prefetchResource(mouseCursorFileHash, _vm->applyResourceFixes());
+}
+
 void NavigationScene::handleNavigation(const NPoint &mousePos) {
 	const NavigationItem &navigationItem = (*_navigationList)[_navigationIndex];
 	bool oldIsWalkingForward = _isWalkingForward;
@@ -169,6 +178,7 @@ void NavigationScene::handleNavigation(const NPoint &mousePos) {
 					_navigationIndex = _navigationList->size() - 1;
 			} while (!(*_navigationList)[_navigationIndex].interactive);
 			setGlobalVar(V_NAVIGATION_INDEX, _navigationIndex);
+			prefetchNavigationCursor();
 		} else {
 			_vm->_screen->setSmackerDecoder(nullptr);
 			sendMessage(_parentModule, 0x1009, _navigationIndex);
@@ -186,6 +196,7 @@ void NavigationScene::handleNavigation(const NPoint &mousePos) {
 					_navigationIndex = 0;
 			} while (!(*_navigationList)[_navigationIndex].interactive);
 			setGlobalVar(V_NAVIGATION_INDEX, _navigationIndex);
+			prefetchNavigationCursor();
 		} else {
 			_vm->_screen->setSmackerDecoder(nullptr);
 			sendMessage(_parentModule, 0x1009, _navigationIndex);
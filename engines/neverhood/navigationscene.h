@@ -55,6 +55,7 @@ protected:
 	void update();
 	uint32 handleMessage(int messageNum, const MessageParam &param, Entity *sender);
 	void createMouseCursor();
+	void prefetchNavigationCursor();
 	void handleNavigation(const NPoint &mousePos);
 };
 
@@ -20,10 +20,17 @@
  *
  */
 
+#include "common/algorithm.h"
+
 #include "neverhood/resourceman.h"
 
 namespace Neverhood {
 
+// Resources that nothing references anymore are kept around up to this many
+// bytes, most recently used first, so that walking back into the previous
+// scene does not re-read and unpack everything from the BLB archives.
+static const uint32 kRetainedResourceBudget = 8 * 1024 * 1024;
+
 ResourceHandle::ResourceHandle()
 	: _resourceFileEntry(nullptr), _data(nullptr) {
 }
@@ -31,7 +38,7 @@ ResourceHandle::ResourceHandle()
 ResourceHandle::~ResourceHandle() {
 }
 
-ResourceMan::ResourceMan() {
+ResourceMan::ResourceMan() : _purgeGeneration(0) {
 }
 
 ResourceMan::~ResourceMan() {
@@ -151,12 +158,27 @@ void ResourceMan::loadResource(ResourceHandle &resourceHandle, bool applyResourc
 
 			resourceData->data = new byte[entry->size];
 			resourceHandle._resourceFileEntry->archive->load(entry, resourceData->data, 0);
+			resourceData->dataSize = entry->size;
 			resourceData->dataRefCount = 1;
 		}
+		resourceData->lastUsedGen = _purgeGeneration;
 		resourceHandle._data = resourceData->data;
 	}
 }
 
+void ResourceMan::prefetchResource(uint32 fileHash, bool applyResourceFixes) {
+	// Pull the resource into the retained cache without holding a reference,
+	// so that the load which actually uses it becomes a cache hit. Modules
+	// call this for resources they know will be needed shortly, at a moment
+	// where the load is hidden (e.g. while a transition movie is playing).
+	ResourceHandle resourceHandle;
+	queryResource(fileHash, resourceHandle);
+	if (!resourceHandle.isValid())
+		return;
+	loadResource(resourceHandle, applyResourceFixes);
+	unloadResource(resourceHandle);
+}
+
 void ResourceMan::unloadResource(ResourceHandle &resourceHandle) {
 	if (resourceHandle.isValid()) {
 		ResourceData *resourceData = _data[resourceHandle.fileHash()];
@@ -167,10 +189,29 @@ void ResourceMan::unloadResource(ResourceHandle &resourceHandle) {
 	}
 }
 
+static bool resourceDataNewerFirst(const ResourceData *a, const ResourceData *b) {
+	return a->lastUsedGen > b->lastUsedGen;
+}
+
 void ResourceMan::purgeResources() {
+	Common::Array<ResourceData*> unused;
+	uint32 retainedSize = 0;
+
+	_purgeGeneration++;
+
 	for (Common::HashMap<uint32, ResourceData*>::iterator it = _data.begin(); it != _data.end(); ++it) {
 		ResourceData *resourceData = (*it)._value;
-		if (resourceData->dataRefCount == 0) {
+		if (resourceData->data != nullptr && resourceData->dataRefCount == 0)
+			unused.push_back(resourceData);
+	}
+
+	// Keep the most recently used unreferenced resources within the budget
+	// and free the rest
+	Common::sort(unused.begin(), unused.end(), resourceDataNewerFirst);
+	for (uint i = 0; i < unused.size(); i++) {
+		ResourceData *resourceData = unused[i];
+		retainedSize += resourceData->dataSize;
+		if (retainedSize > kRetainedResourceBudget) {
 			delete[] resourceData->data;
 			resourceData->data = nullptr;
 		}
@@ -45,7 +45,9 @@ struct Resource {
 struct ResourceData {
 	byte *data;
 	int dataRefCount;
-	ResourceData() : data(NULL), dataRefCount() {}
+	uint32 dataSize;
+	uint32 lastUsedGen;
+	ResourceData() : data(NULL), dataRefCount(), dataSize(0), lastUsedGen(0) {}
 };
 
 class ResourceMan;
@@ -80,6 +82,7 @@ public:
 	void queryResource(uint32 fileHash, ResourceHandle &resourceHandle);
 	void loadResource(ResourceHandle &resourceHandle, bool applyResourceFixes);
 	void unloadResource(ResourceHandle &resourceHandle);
+	void prefetchResource(uint32 fileHash, bool applyResourceFixes);
 	void purgeResources();
 protected:
 	typedef Common::HashMap<uint32, ResourceFileEntry> EntriesMap;
@@ -87,6 +90,7 @@ protected:
 	EntriesMap _entries;
 	Common::HashMap<uint32, ResourceData*> _data;
 	Common::Array<Resource*> _resources;
+	uint32 _purgeGeneration;
 };
 
 } // End of namespace Neverhood
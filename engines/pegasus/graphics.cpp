@@ -45,6 +45,7 @@ GraphicsManager::GraphicsManager(PegasusEngine *vm) : _vm(vm) {
 	_firstDisplayElement = _lastDisplayElement = nullptr;
 	_workArea.create(640, 480, _vm->_system->getScreenFormat());
 	_curSurface = &_workArea;
+	_numDirtyRects = 0;
 	_erase = false;
 	_updatesEnabled = true;
 	_screenFader = new ScreenFader();
@@ -59,17 +60,32 @@ void GraphicsManager::invalRect(const Common::Rect &rect) {
 	// We're using a simpler algorithm for dirty rect handling than the original
 	// The original was way too overcomplicated for what we need here now.
 
-	if (_dirtyRect.width() == 0 || _dirtyRect.height() == 0) {
-		// We have no dirty rect, so this is now our dirty rect
-		_dirtyRect = rect;
-	} else {
-		// Expand our dirty rect to include rect
-		_dirtyRect.extend(rect);
-	}
+	Common::Rect dirtyRect = rect;
 
 	// Sanity check: clip our rect to the screen
-	_dirtyRect.right = MIN<int>(640, _dirtyRect.right);
-	_dirtyRect.bottom = MIN<int>(480, _dirtyRect.bottom);
+	dirtyRect.right = MIN<int>(640, dirtyRect.right);
+	dirtyRect.bottom = MIN<int>(480, dirtyRect.bottom);
+
+	if (dirtyRect.isEmpty())
+		return;
+
+	// Merge with every rect we touch. A merge can grow the rect into
+	// one we already passed, so rescan from the start after each one.
+	for (int i = 0; i < _numDirtyRects; i++) {
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects[i]);
+			_dirtyRects[i] = _dirtyRects[--_numDirtyRects];
+			i = -1;
+		}
+	}
+
+	if (_numDirtyRects == kMaxDirtyRects) {
+		// The screen is too fragmented; fall back to one union rect
+		while (_numDirtyRects > 0)
+			dirtyRect.extend(_dirtyRects[--_numDirtyRects]);
+	}
+
+	_dirtyRects[_numDirtyRects++] = dirtyRect;
 }
 
 void GraphicsManager::addDisplayElement(DisplayElement *newElement) {
@@ -151,10 +167,12 @@ void GraphicsManager::removeDisplayElement(DisplayElement *oldElement) {
 }
 
 void GraphicsManager::updateDisplay() {
-	if (!_dirtyRect.isEmpty()) {
+	for (int i = 0; i < _numDirtyRects; i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+
 		// Fill the dirty area with black if erase mode is enabled
 		if (_erase)
-			_workArea.fillRect(_dirtyRect, _workArea.format.RGBToColor(0, 0, 0));
+			_workArea.fillRect(dirtyRect, _workArea.format.RGBToColor(0, 0, 0));
 
 		for (DisplayElement *runner = _firstDisplayElement; runner != nullptr; runner = runner->_nextElement) {
 			Common::Rect bounds;
@@ -162,18 +180,18 @@ void GraphicsManager::updateDisplay() {
 
 			// TODO: Better logic; it does a bit more work than it probably needs to
 			// but it should work fine for now.
-			if (bounds.intersects(_dirtyRect) && runner->validToDraw(_backLayer, _frontLayer)) {
+			if (bounds.intersects(dirtyRect) && runner->validToDraw(_backLayer, _frontLayer)) {
 				runner->draw(bounds);
 			}
 		}
 
 		// Copy only the dirty rect to the screen
-		g_system->copyRectToScreen((byte *)_workArea.getBasePtr(_dirtyRect.left, _dirtyRect.top), _workArea.pitch, _dirtyRect.left, _dirtyRect.top, _dirtyRect.width(), _dirtyRect.height());
-
-		// Clear the dirty rect
-		_dirtyRect = Common::Rect();
+		g_system->copyRectToScreen((byte *)_workArea.getBasePtr(dirtyRect.left, dirtyRect.top), _workArea.pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
 	}
 
+	// Everything is now clean
+	_numDirtyRects = 0;
+
 	if (_updatesEnabled)
 		g_system->updateScreen();
 }
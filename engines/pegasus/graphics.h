@@ -72,7 +72,14 @@ private:
 	PegasusEngine *_vm;
 
 	bool _erase;
-	Common::Rect _dirtyRect;
+
+	// Dirty region tracking. Disjoint invalidations are kept as separate
+	// rects so that a ticking movie and a far-away interface element don't
+	// get merged into one big rect covering all the chrome between them.
+	static const int kMaxDirtyRects = 8;
+	Common::Rect _dirtyRects[kMaxDirtyRects];
+	int _numDirtyRects;
+
 	DisplayOrder _backLayer, _frontLayer;
 	DisplayElement *_firstDisplayElement, *_lastDisplayElement;
 	Graphics::Surface _workArea, *_curSurface;
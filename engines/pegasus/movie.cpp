@@ -24,6 +24,7 @@
  */
 
 #include "common/system.h"
+#include "graphics/conversion.h"
 #include "graphics/surface.h"
 #include "video/qt_decoder.h"
 #include "video/video_decoder.h"
@@ -91,22 +92,25 @@ void Movie::redrawMovieWorld() {
 		if (!frame)
 			return;
 
-		// Make sure we have a surface in the current pixel format
-		Graphics::Surface *convertedFrame = nullptr;
-
-		if (frame->format != g_system->getScreenFormat()) {
-			convertedFrame = frame->convertTo(g_system->getScreenFormat());
-			frame = convertedFrame;
-		}
-
 		// Copy to the surface using _movieBox
 		uint16 width = MIN<int>(frame->w, _movieBox.width());
 		uint16 height = MIN<int>(frame->h, _movieBox.height());
 
-		for (uint16 y = 0; y < height; y++)
-			memcpy((byte *)_surface->getBasePtr(_movieBox.left, _movieBox.top + y), (const byte *)frame->getBasePtr(0, y), width * frame->format.bytesPerPixel);
+		if (frame->format == _surface->format) {
+			for (uint16 y = 0; y < height; y++)
+				memcpy((byte *)_surface->getBasePtr(_movieBox.left, _movieBox.top + y), (const byte *)frame->getBasePtr(0, y), width * frame->format.bytesPerPixel);
+		} else if (frame->format.bytesPerPixel > 1) {
+			// Convert the frame directly into our surface, without going
+			// through a temporary surface for every frame
+			Graphics::crossBlit((byte *)_surface->getBasePtr(_movieBox.left, _movieBox.top), (const byte *)frame->getPixels(),
+					_surface->pitch, frame->pitch, width, height, _surface->format, frame->format);
+		} else {
+			// Paletted frames can't be cross blitted
+			Graphics::Surface *convertedFrame = frame->convertTo(_surface->format, _video->getPalette());
+
+			for (uint16 y = 0; y < height; y++)
+				memcpy((byte *)_surface->getBasePtr(_movieBox.left, _movieBox.top + y), (const byte *)convertedFrame->getBasePtr(0, y), width * convertedFrame->format.bytesPerPixel);
 
-		if (convertedFrame) {
 			convertedFrame->free();
 			delete convertedFrame;
 		}
@@ -156,14 +156,21 @@ Graphics::Surface *Animation::getFrame(int frameIndex) {
 	if (frameIndex < _frameCount) {
 		if (_frameList[frameIndex]._isCompressed) {
 			Decompressor dec;
-			byte *ddata = (byte *)malloc(_frameList[frameIndex]._dataSize);
-			dec.decompress(_frameList[frameIndex]._compressedData, ddata, _frameList[frameIndex]._dataSize);
-			int frameHeight = _frameList[frameIndex]._surface->h;
-			int frameWidth = _frameList[frameIndex]._surface->w;
-			for (uint16 i = 0; i < frameHeight; i++) {
-				memcpy(_frameList[frameIndex]._surface->getBasePtr(0, i), ddata + frameWidth * i, frameWidth);
+			Graphics::Surface *surface = _frameList[frameIndex]._surface;
+			if (surface->pitch == surface->w && _frameList[frameIndex]._dataSize == (uint32)(surface->w * surface->h)) {
+				// The rows are contiguous, so decompress straight into the
+				// surface instead of through a temporary buffer
+				dec.decompress(_frameList[frameIndex]._compressedData, (byte *)surface->getPixels(), _frameList[frameIndex]._dataSize);
+			} else {
+				byte *ddata = (byte *)malloc(_frameList[frameIndex]._dataSize);
+				dec.decompress(_frameList[frameIndex]._compressedData, ddata, _frameList[frameIndex]._dataSize);
+				int frameHeight = surface->h;
+				int frameWidth = surface->w;
+				for (uint16 i = 0; i < frameHeight; i++) {
+					memcpy(surface->getBasePtr(0, i), ddata + frameWidth * i, frameWidth);
+				}
+				free(ddata);
 			}
-			free(ddata);
 			free(_frameList[frameIndex]._compressedData);
 			_frameList[frameIndex]._compressedData = nullptr;
 			_frameList[frameIndex]._dataSize = 0;
@@ -93,20 +93,34 @@ void GraphicsMan::draw(Graphics::Surface *screen, const Graphics::Surface *s) {
 	change();
 }
 
+/**
+ * Clips a sprite-sized blit against the screen surface, so that the per-pixel
+ * loops don't have to bounds check every pixel. Returns false if the sprite
+ * is completely off-screen.
+ */
+bool GraphicsMan::clipBlit(Graphics::Surface *screen, int32 posX, int32 posY, int32 width, int32 height,
+		int &xStart, int &xEnd, int &yStart, int &yEnd) {
+	xStart = MAX<int>(0, -posX);
+	xEnd = MIN<int>(width, screen->w - posX);
+	yStart = MAX<int>(0, -posY);
+	yEnd = MIN<int>(height, screen->h - posY);
+	return xStart < xEnd && yStart < yEnd;
+}
+
 // Black (value = 0) as a primary transparent color, fix for FLC animations
 void GraphicsMan::drawTransparentSurface(Graphics::Surface *screen, int32 posX, int32 posY, const Graphics::Surface *s, int secondTransColor) {
-	const byte *src1 = (const byte *)s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(posX, posY);
-	for (int y = 0; y < s->h; y++) {
-		if (y + posY < screen->h && y + posY >= 0) {
-			const byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < s->w; x++, src2++, dst2++) {
-				if (*src2 && *src2 != secondTransColor) {
-					if (x + posX < screen->w && x + posX >= 0) {
-						*dst2 = *src2;
-					}
-				}
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, posX, posY, s->w, s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
+	const byte *src1 = (const byte *)s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(posX + xStart, posY + yStart);
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 && *src2 != secondTransColor) {
+				*dst2 = *src2;
 			}
 		}
 		src1 += s->pitch;
@@ -120,18 +134,18 @@ void GraphicsMan::drawTransparentSurface(Graphics::Surface *screen, int32 posX,
  * and kShadowColor (191) as a transparent color.
  */
 void GraphicsMan::drawAsShadowSurface(Graphics::Surface *screen, int32 posX, int32 posY, const Graphics::Surface *s, byte *shadowTable) {
-	const byte *src1 = (const byte *)s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(posX, posY);
-	for (int y = 0; y < s->h; y++) {
-		if (y + posY < screen->h && y + posY >= 0) {
-			const byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < s->w; x++, src2++, dst2++) {
-				if (*src2 == kShadowColor) {
-					if (x + posX < screen->w && x + posX >= 0) {
-						*dst2 = *(shadowTable + *dst2);
-					}
-				}
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, posX, posY, s->w, s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
+	const byte *src1 = (const byte *)s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(posX + xStart, posY + yStart);
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 == kShadowColor) {
+				*dst2 = *(shadowTable + *dst2);
 			}
 		}
 		src1 += s->pitch;
@@ -144,22 +158,22 @@ void GraphicsMan::drawAsShadowSurface(Graphics::Surface *screen, int32 posX, int
  * use black (0) as a transparent color.
  */
 void GraphicsMan::drawTransparentWithBlendSurface(Graphics::Surface *screen, int32 posX, int32 posY, const Graphics::Surface *s) {
-	const byte *src1 = (const byte *)s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(posX, posY);
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, posX, posY, s->w, s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
+	const byte *src1 = (const byte *)s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(posX + xStart, posY + yStart);
 	byte *blendTable = (byte *)malloc(256);
 	for (int i = 0; i < 256; i++) {
 		blendTable[i] = 255;
 	}
-	for (int y = 0; y < s->h; y++) {
-		if (y + posY < screen->h && y + posY >= 0) {
-			const byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < s->w; x++, src2++, dst2++) {
-				if (*src2) {
-					if (x + posX < screen->w && x + posX >= 0) {
-						*dst2 = getBlendTableColor(*src2, *dst2, blendTable);
-					}
-				}
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2) {
+				*dst2 = getBlendTableColor(*src2, *dst2, blendTable);
 			}
 		}
 		src1 += s->pitch;
@@ -174,18 +188,18 @@ void GraphicsMan::drawTransparentWithBlendSurface(Graphics::Surface *screen, int
  * and white (255) as transparent color.
  */
 void GraphicsMan::drawTransparentDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
-	byte *src1 = (byte *)drawNode->s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
-	for (int y = 0; y < drawNode->s->h; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < drawNode->s->w; x++, src2++, dst2++) {
-				if (*src2 != 255) {
-					if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-						*dst2 = *src2;
-					}
-				}
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, drawNode->posX, drawNode->posY, drawNode->s->w, drawNode->s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
+	const byte *src1 = (const byte *)drawNode->s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 != 255) {
+				*dst2 = *src2;
 			}
 		}
 		src1 += drawNode->s->pitch;
@@ -201,76 +215,64 @@ void GraphicsMan::drawTransparentDrawNode(Graphics::Surface *screen, DrawNode *d
  * and sprite's edge pixel color.
  */
 void GraphicsMan::drawTransparentWithTransDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, drawNode->posX, drawNode->posY, drawNode->s->w, drawNode->s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
 	// pos of first pixel for each row of source sprite
-	byte *src1 = (byte *)drawNode->s->getBasePtr(0, 0);
+	const byte *src1 = (const byte *)drawNode->s->getBasePtr(xStart, yStart);
 	// pos of drawing first pixel for each row on screen surface
-	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
+	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
 	// trasition table for calculating new color value
 	byte *transTableData = (byte *)drawNode->data;
-	for (int y = 0; y < drawNode->s->h; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			// current pixel in row of source sprite
-			byte *src2 = src1;
-			// current pixel in row of screen surface
-			byte *dst2 = dst1;
-			for (int x = 0; x < drawNode->s->w; x++, src2++, dst2++) {
-				if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-					if (*src2 != 255) {
-						// if source sprite pixel is not mask color than draw it normally
-						*dst2 = *src2;
-					} else {
-						// check for making jagged line
-						if (x) {
-							// not first pixel in row
-							if (*(src2 - 1) == 255) {
-								// if it has mask color to the left - check right
-								if (x != drawNode->s->w - 1) {
-									// not last pixel in row
-									if (*(src2 + 1) == 255) {
-										// pixel to the right with mask color - no anti-alias
-										continue;
-									}
-									// it's not mask color to the right - we continue checking
-								} else {
-									// last pixel in row, no right check - no anti-alias
-									continue;
-								}
-							}
-							// it's not mask color to the left - we continue checking
-						} else if (x != drawNode->s->w - 1) {
-							// first pixel in row but not last - just right pixel checking
+	for (int y = yStart; y < yEnd; y++) {
+		// current pixel in row of source sprite
+		const byte *src2 = src1;
+		// current pixel in row of screen surface
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 != 255) {
+				// if source sprite pixel is not mask color than draw it normally
+				*dst2 = *src2;
+			} else {
+				// check for making jagged line
+				if (x) {
+					// not first pixel in row
+					if (*(src2 - 1) == 255) {
+						// if it has mask color to the left - check right
+						if (x != drawNode->s->w - 1) {
+							// not last pixel in row
 							if (*(src2 + 1) == 255) {
 								// pixel to the right with mask color - no anti-alias
 								continue;
 							}
 							// it's not mask color to the right - we continue checking
 						} else {
-							// it's first and last pixel in row at the same time (width = 1) - no anti-alias
+							// last pixel in row, no right check - no anti-alias
 							continue;
 						}
-						byte value = 0;
-						if (y != drawNode->s->h - 1) {
-							// not last row
-							// check pixel below of current src2 pixel
-							value = *(src2 + drawNode->s->pitch);
-							if (value == 255) {
-								// pixel below with mask color - check above
-								if (y) {
-									// not first row
-									value = *(src2 - drawNode->s->pitch);
-									if (value == 255) {
-										// pixel above with mask color - no anti-alias
-										continue;
-									}
-									// it's not mask color above - we draw as transition color
-								} else {
-									// first row - no anti-alias
-									continue;
-								}
-							}
-							// it's not mask color below - we draw as transition color
-						} else if (y) {
-							// last row - just check above
+					}
+					// it's not mask color to the left - we continue checking
+				} else if (x != drawNode->s->w - 1) {
+					// first pixel in row but not last - just right pixel checking
+					if (*(src2 + 1) == 255) {
+						// pixel to the right with mask color - no anti-alias
+						continue;
+					}
+					// it's not mask color to the right - we continue checking
+				} else {
+					// it's first and last pixel in row at the same time (width = 1) - no anti-alias
+					continue;
+				}
+				byte value = 0;
+				if (y != drawNode->s->h - 1) {
+					// not last row
+					// check pixel below of current src2 pixel
+					value = *(src2 + drawNode->s->pitch);
+					if (value == 255) {
+						// pixel below with mask color - check above
+						if (y) {
+							// not first row
 							value = *(src2 - drawNode->s->pitch);
 							if (value == 255) {
 								// pixel above with mask color - no anti-alias
@@ -278,13 +280,25 @@ void GraphicsMan::drawTransparentWithTransDrawNode(Graphics::Surface *screen, Dr
 							}
 							// it's not mask color above - we draw as transition color
 						} else {
-							// first and last row at the same time (height = 1) - no anti-alias
+							// first row - no anti-alias
 							continue;
 						}
-						// new color value based on original screen surface color and sprite's edge pixel color
-						*dst2 = transTableData[*dst2 * 256 + value];
 					}
+					// it's not mask color below - we draw as transition color
+				} else if (y) {
+					// last row - just check above
+					value = *(src2 - drawNode->s->pitch);
+					if (value == 255) {
+						// pixel above with mask color - no anti-alias
+						continue;
+					}
+					// it's not mask color above - we draw as transition color
+				} else {
+					// first and last row at the same time (height = 1) - no anti-alias
+					continue;
 				}
+				// new color value based on original screen surface color and sprite's edge pixel color
+				*dst2 = transTableData[*dst2 * 256 + value];
 			}
 		}
 		// adding pitch to jump to next row of pixels
@@ -294,51 +308,50 @@ void GraphicsMan::drawTransparentWithTransDrawNode(Graphics::Surface *screen, Dr
 }
 
 void GraphicsMan::drawMaskDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, drawNode->posX, drawNode->posY, drawNode->width, drawNode->height, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
 	byte *maskData = (byte *)drawNode->data;
-	byte *src1 = (byte *)drawNode->originalRoomSurface->getBasePtr(drawNode->posX, drawNode->posY);
-	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
+	const byte *src1 = (const byte *)drawNode->originalRoomSurface->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
 	int maskWidth = drawNode->width >> 3;
-	int maskPostion = 0;
-	int maskCounter = 128;
-	for (int y = 0; y < drawNode->height; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			byte *src2 = src1;
-			byte *dst2 = dst1;
-			int tempMaskPostion = maskPostion;
-			for (int x = 0; x < drawNode->width; x++, src2++, dst2++) {
-				if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-					if ((maskData[tempMaskPostion] & maskCounter) != 0) {
-						*dst2 = *src2;
-					}
-				}
-				maskCounter >>= 1;
-				if (maskCounter == 0) {
-					maskCounter = 128;
-					tempMaskPostion++;
-				}
+	int maskPostion = yStart * maskWidth;
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		int tempMaskPostion = maskPostion + (xStart >> 3);
+		int maskCounter = 128 >> (xStart & 7);
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if ((maskData[tempMaskPostion] & maskCounter) != 0) {
+				*dst2 = *src2;
+			}
+			maskCounter >>= 1;
+			if (maskCounter == 0) {
+				maskCounter = 128;
+				tempMaskPostion++;
 			}
 		}
 		src1 += drawNode->originalRoomSurface->pitch;
 		dst1 += screen->pitch;
 		maskPostion += maskWidth;
-		maskCounter = 128;
 	}
 }
 
 void GraphicsMan::drawAsShadowDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, drawNode->posX, drawNode->posY, drawNode->s->w, drawNode->s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
 	byte *shadowData = (byte *)drawNode->data;
-	byte *src1 = (byte *)drawNode->s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
-	for (int y = 0; y < drawNode->s->h; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < drawNode->s->w; x++, src2++, dst2++) {
-				if (*src2 == kShadowColor) {
-					if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-						*dst2 = *(shadowData + *dst2);
-					}
-				}
+	const byte *src1 = (const byte *)drawNode->s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 == kShadowColor) {
+				*dst2 = *(shadowData + *dst2);
 			}
 		}
 		src1 += drawNode->s->pitch;
@@ -347,20 +360,18 @@ void GraphicsMan::drawAsShadowDrawNode(Graphics::Surface *screen, DrawNode *draw
 }
 
 void GraphicsMan::drawBackSpriteDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
-	byte *src1 = (byte *)drawNode->s->getBasePtr(0, 0);
-	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
-	for (int y = 0; y < drawNode->s->h; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < drawNode->s->w; x++, src2++, dst2++) {
-				if (*src2 != 255) {
-					if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-						if (*dst2 == 255) {
-							*dst2 = *src2;
-						}
-					}
-				}
+	int xStart, xEnd, yStart, yEnd;
+	if (!clipBlit(screen, drawNode->posX, drawNode->posY, drawNode->s->w, drawNode->s->h, xStart, xEnd, yStart, yEnd)) {
+		return;
+	}
+	const byte *src1 = (const byte *)drawNode->s->getBasePtr(xStart, yStart);
+	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX + xStart, drawNode->posY + yStart);
+	for (int y = yStart; y < yEnd; y++) {
+		const byte *src2 = src1;
+		byte *dst2 = dst1;
+		for (int x = xStart; x < xEnd; x++, src2++, dst2++) {
+			if (*src2 != 255 && *dst2 == 255) {
+				*dst2 = *src2;
 			}
 		}
 		src1 += drawNode->s->pitch;
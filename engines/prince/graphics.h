@@ -56,6 +56,9 @@ public:
 
 	byte getBlendTableColor(byte pixelColor, byte backgroundPixelColor, byte *blendTable);
 
+	static bool clipBlit(Graphics::Surface *screen, int32 posX, int32 posY, int32 width, int32 height,
+		int &xStart, int &xEnd, int &yStart, int &yEnd);
+
 	Graphics::Surface *_frontScreen;
 	Graphics::Surface *_screenForInventory;
 	Graphics::Surface *_mapScreen;
@@ -98,6 +98,7 @@ IsoMap::IsoMap(SagaEngine *vm) : _vm(vm) {
 	_viewScroll.y = (128 - 8) * 16 - 64;
 	_viewDiff = 1;
 	_platformHeight = 0;
+	_composeCacheValid = false;
 	_queueCount = _readCount = 0;
 
 	for (int i = 0; i < SAGA_DRAGON_SEARCH_DIAMETER; i++)
@@ -274,6 +275,8 @@ void IsoMap::clear() {
 	_multiTable.clear();
 	_tileData.clear();
 	_multiTableData.clear();
+	_composeCache.clear();
+	_composeCacheValid = false;
 }
 
 void IsoMap::adjustScroll(bool jump) {
@@ -366,10 +369,102 @@ int16 IsoMap::findMulti(int16 tileIndex, int16 absU, int16 absV, int16 absH) {
 	return 1;
 }
 
+void IsoMap::saveComposeCache(const Rect &clip) {
+	const byte *backBuffer = _vm->_gfx->getBackBufferPixels();
+	uint16 pitch = _vm->_gfx->getBackBufferPitch();
+	int rowBytes = clip.width();
+	byte *cache;
+	int y;
+
+	if (clip.isEmpty()) {
+		_composeCacheValid = false;
+		return;
+	}
+
+	_composeCache.resize(rowBytes * clip.height());
+	cache = &_composeCache.front();
+	for (y = clip.top; y < clip.bottom; y++) {
+		memcpy(cache, backBuffer + y * pitch + clip.left, rowBytes);
+		cache += rowBytes;
+	}
+	_composeCacheScroll = _viewScroll;
+	_composeCacheClip = clip;
+	_composeCacheValid = true;
+}
+
 void IsoMap::draw() {
-	_tileClip = _vm->_scene->getSceneClip();
+	Rect clip = _vm->_scene->getSceneClip();
+	byte *backBuffer = _vm->_gfx->getBackBufferPixels();
+	uint16 pitch = _vm->_gfx->getBackBufferPitch();
+	int rowBytes = clip.width();
+	const byte *cache;
+	int y;
+
+	if (_composeCacheValid && clip == _composeCacheClip) {
+		Point delta(_viewScroll.x - _composeCacheScroll.x, _viewScroll.y - _composeCacheScroll.y);
+
+		if (delta.x == 0 && delta.y == 0) {
+			// nothing in the static background changed since the last
+			// frame - put the cached composition back and let the actors
+			// be drawn over it as usual
+			cache = &_composeCache.front();
+			for (y = clip.top; y < clip.bottom; y++) {
+				memcpy(backBuffer + y * pitch + clip.left, cache, rowBytes);
+				cache += rowBytes;
+			}
+			_vm->_render->addDirtyRect(clip);
+			return;
+		}
+
+		if (ABS(delta.x) < rowBytes / 2 && ABS(delta.y) < clip.height() / 2) {
+			// the view scrolled by less than half a screen: every tile
+			// moves by exactly (-delta.x, -delta.y) on screen (see
+			// tileCoordsToScreenPoint), so shift the overlapping part of
+			// the cached composition and recompose only the strips that
+			// scrolled into view
+			int dstX = (delta.x > 0) ? clip.left : clip.left - delta.x;
+			int width = rowBytes - ABS(delta.x);
+
+			for (y = clip.top; y < clip.bottom; y++) {
+				int srcY = y + delta.y;
+				if (srcY < clip.top || srcY >= clip.bottom) {
+					continue;
+				}
+				memcpy(backBuffer + y * pitch + dstX,
+					&_composeCache[(srcY - clip.top) * rowBytes + (dstX + delta.x - clip.left)], width);
+			}
+
+			if (delta.x != 0) {
+				if (delta.x > 0) {
+					_tileClip = Rect(clip.right - delta.x, clip.top, clip.right, clip.bottom);
+				} else {
+					_tileClip = Rect(clip.left, clip.top, clip.left - delta.x, clip.bottom);
+				}
+				_vm->_gfx->drawRect(_tileClip, 0);
+				drawTiles(nullptr);
+			}
+
+			if (delta.y != 0) {
+				if (delta.y > 0) {
+					_tileClip = Rect(clip.left, clip.bottom - delta.y, clip.right, clip.bottom);
+				} else {
+					_tileClip = Rect(clip.left, clip.top, clip.right, clip.top - delta.y);
+				}
+				_vm->_gfx->drawRect(_tileClip, 0);
+				drawTiles(nullptr);
+			}
+
+			_tileClip = clip;
+			saveComposeCache(clip);
+			_vm->_render->addDirtyRect(clip);
+			return;
+		}
+	}
+
+	_tileClip = clip;
 	_vm->_gfx->drawRect(_tileClip, 0);
 	drawTiles(nullptr);
+	saveComposeCache(clip);
 }
 
 void IsoMap::setMapPosition(int x, int y) {
@@ -1616,6 +1711,9 @@ void IsoMap::setTileDoorState(int doorNumber, int doorState) {
 
 	multiTileEntryData = &_multiTable[doorNumber];
 	multiTileEntryData->currentState = doorState;
+
+	// the door tiles are part of the cached composition
+	_composeCacheValid = false;
 }
 
 bool IsoMap::nextTileTarget(ActorData* actor) {
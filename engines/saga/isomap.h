@@ -183,6 +183,7 @@ private:
 	void drawPlatform(uint16 platformIndex, const Point &point, int16 absU, int16 absV, int16 absH);
 	void drawSpritePlatform(uint16 platformIndex, const Point &point, const Location &location, int16 absU, int16 absV, int16 absH);
 	void drawTile(uint16 tileIndex, const Point &point, const Location *location);
+	void saveComposeCache(const Rect &clip);
 	int16 smoothSlide(int16 value, int16 min, int16 max) {
 		if (value < min) {
 			if (value < min - 100 || value > min - 4) {
@@ -279,6 +280,16 @@ private:
 	Point _viewScroll;
 	Rect _tileClip;
 
+	// Cache of the composed static tile background. While the view stands
+	// still only the actors change, so draw() can restore the previous
+	// composition with a copy instead of walking every platform again;
+	// on a small scroll it shifts the overlap and recomposes just the
+	// strips that came into view.
+	ByteArray _composeCache;
+	Point _composeCacheScroll;
+	Rect _composeCacheClip;
+	bool _composeCacheValid;
+
 	SagaEngine *_vm;
 };
 
@@ -928,6 +928,60 @@ Common::String Kernel::lookupText(reg_t address, int index) {
 	error("Index %d out of bounds in text.%03d", _index, address.getOffset());
 }
 
+// Pre-resolves the operand formats into fetch plans for every extended
+// opcode, so that readPMachineInstruction() does not have to re-derive the
+// operand width from the format and the opcode's low bit for every operand
+// of every executed instruction.
+static void buildOpcodePlans() {
+	if (g_sci->_opcode_plans == nullptr)
+		g_sci->_opcode_plans = new byte[256][4];
+
+	for (int extOpcode = 0; extOpcode < 256; ++extOpcode) {
+		const opcode_format *formats = g_sci->_opcode_formats[extOpcode >> 1];
+		byte *plan = g_sci->_opcode_plans[extOpcode];
+		int planPos = 0;
+
+		for (int i = 0; formats[i]; ++i) {
+			assert(i < 3);
+			switch (formats[i]) {
+			case Script_Byte:
+				plan[planPos++] = kOperandByte;
+				break;
+			case Script_SByte:
+				plan[planPos++] = kOperandSByte;
+				break;
+			case Script_Word:
+				plan[planPos++] = kOperandWord;
+				break;
+			case Script_SWord:
+				plan[planPos++] = kOperandSWord;
+				break;
+			case Script_Variable:
+			case Script_Property:
+			case Script_Local:
+			case Script_Temp:
+			case Script_Global:
+			case Script_Param:
+			case Script_Offset:
+				plan[planPos++] = (extOpcode & 1) ? kOperandByte : kOperandWord;
+				break;
+			case Script_SVariable:
+			case Script_SRelative:
+				plan[planPos++] = (extOpcode & 1) ? kOperandSByte : kOperandSWord;
+				break;
+			case Script_End:
+				break;
+			case Script_Invalid:
+			default:
+				plan[planPos++] = kOperandInvalid;
+				break;
+			}
+		}
+
+		plan[planPos] = kOperandEnd;
+	}
+}
+
 // TODO: script_adjust_opcode_formats should probably be part of the
 // constructor (?) of a VirtualMachine or a ScriptManager class.
 void script_adjust_opcode_formats() {
@@ -935,6 +989,10 @@ void script_adjust_opcode_formats() {
 	g_sci->_opcode_formats = new opcode_format[128][4];
 	memcpy(g_sci->_opcode_formats, g_base_opcode_formats, 128*4*sizeof(opcode_format));
 
+	// The lofs detection below runs script code, so an initial set of fetch
+	// plans has to exist before the formats get adjusted
+	buildOpcodePlans();
+
 	if (g_sci->_features->detectLofsType() != SCI_VERSION_0_EARLY) {
 		g_sci->_opcode_formats[op_lofsa][0] = Script_Offset;
 		g_sci->_opcode_formats[op_lofss][0] = Script_Offset;
@@ -957,6 +1015,8 @@ void script_adjust_opcode_formats() {
 		g_sci->_opcode_formats[op_superP][0] = Script_None;
 	}
 #endif
+
+	buildOpcodePlans();
 }
 
 } // End of namespace Sci
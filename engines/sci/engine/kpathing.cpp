@@ -1560,6 +1560,76 @@ static reg_t output_path(PathfindingState *p, EngineState *s) {
 	return output;
 }
 
+/**
+ * Scripts commonly re-plan the same walk several times per game cycle
+ * without the endpoints or the polygon set having changed, and building
+ * the visibility information dominates the cost of each call. Remember
+ * the last query together with its result, so an exact repeat replays
+ * the stored path instead of recomputing it. The polygon set is part of
+ * the key, so obstacle changes simply miss the cache.
+ */
+struct AvoidPathMemo {
+	bool valid;
+	int roomNumber;
+	int width, height, opt;
+	Common::Point start, end;
+	Common::Array<byte> polygons;       ///< serialized polygon list
+	Common::Array<Common::Point> path;  ///< stored output, including sentinel
+	int allocSize;                      ///< output array size, in points
+};
+
+static AvoidPathMemo s_avoidPathMemo;
+
+/**
+ * Serializes the polygon list for use as a cache key, mirroring the
+ * traversal done by convert_polygon_set(). Returns false for input the
+ * cache should stay away from (e.g. released point data).
+ */
+static bool buildAvoidPathKey(EngineState *s, reg_t poly_list, Common::Array<byte> &key) {
+	SegManager *segMan = s->_segMan;
+
+	if (!poly_list.getSegment())
+		return true;
+
+	List *list = segMan->lookupList(poly_list);
+	Node *node = segMan->lookupNode(list->first);
+
+	while (node) {
+		if (!node->value.isNull()) {
+			reg_t points = readSelector(segMan, node->value, SELECTOR(points));
+			int size = readSelectorValue(segMan, node->value, SELECTOR(size));
+			int type = readSelectorValue(segMan, node->value, SELECTOR(type));
+
+#ifdef ENABLE_SCI32
+			if (segMan->isHeapObject(points))
+				points = readSelector(segMan, points, SELECTOR(data));
+#endif
+
+			SegmentRef pointList = segMan->dereference(points);
+			if (size > 0 && (!pointList.isValid() || pointList.skipByte || pointList.maxSize < size * POLY_POINT_SIZE))
+				return false;
+
+			key.push_back((byte)type);
+			key.push_back((byte)(size & 0xFF));
+			key.push_back((byte)((size >> 8) & 0xFF));
+			for (int i = 0; i < size; i++) {
+				const Common::Point point = readPoint(pointList, i);
+				key.push_back((byte)(point.x & 0xFF));
+				key.push_back((byte)((point.x >> 8) & 0xFF));
+				key.push_back((byte)(point.y & 0xFF));
+				key.push_back((byte)((point.y >> 8) & 0xFF));
+			}
+		} else {
+			// Null node, matching the skip in convert_polygon_set()
+			key.push_back(0xFF);
+		}
+
+		node = segMan->lookupNode(node->succ);
+	}
+
+	return true;
+}
+
 reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 	Common::Point start = Common::Point(argv[0].toSint16(), argv[1].toSint16());
 
@@ -1625,6 +1695,26 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			}
 		}
 
+		AvoidPathMemo &memo = s_avoidPathMemo;
+		Common::Array<byte> memoKey;
+		const bool memoUsable = !DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath) &&
+				buildAvoidPathKey(s, poly_list, memoKey);
+
+		if (memoUsable && memo.valid &&
+				memo.roomNumber == s->currentRoomNumber() &&
+				memo.width == width && memo.height == height && memo.opt == opt &&
+				memo.start == start && memo.end == end &&
+				memo.polygons == memoKey) {
+			output = allocateOutputArray(s->_segMan, memo.allocSize);
+			SegmentRef arrayRef = s->_segMan->dereference(output);
+			assert(arrayRef.isValid() && !arrayRef.skipByte);
+
+			for (uint i = 0; i < memo.path.size(); ++i)
+				writePoint(arrayRef, i, memo.path[i]);
+
+			return output;
+		}
+
 		PathfindingState *p = convert_polygon_set(s, poly_list, start, end, width, height, opt);
 
 		if (!p) {
@@ -1648,6 +1738,30 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 		output = output_path(p, s);
 		delete p;
 
+		if (memoUsable) {
+			SegmentRef arrayRef = s->_segMan->dereference(output);
+			if (arrayRef.isValid() && !arrayRef.skipByte) {
+				memo.valid = true;
+				memo.roomNumber = s->currentRoomNumber();
+				memo.width = width;
+				memo.height = height;
+				memo.opt = opt;
+				memo.start = start;
+				memo.end = end;
+				memo.polygons = memoKey;
+				memo.allocSize = arrayRef.maxSize / POLY_POINT_SIZE;
+				memo.path.clear();
+				for (int i = 0; i < memo.allocSize; ++i) {
+					const Common::Point point = readPoint(arrayRef, i);
+					memo.path.push_back(point);
+					if (point == Common::Point(POLY_LAST_POINT, POLY_LAST_POINT))
+						break;
+				}
+			} else {
+				memo.valid = false;
+			}
+		}
+
 		// Memory is freed by explicit calls to Memory
 		return output;
 	}
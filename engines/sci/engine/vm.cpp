@@ -465,59 +465,31 @@ int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4])
 
 	memset(opparams, 0, 4*sizeof(int16));
 
-	for (int i = 0; g_sci->_opcode_formats[opcode][i]; ++i) {
-		//debugN("Opcode: 0x%x, Opnumber: 0x%x, temp: %d\n", opcode, opcode, temp);
-		assert(i < 3);
-		switch (g_sci->_opcode_formats[opcode][i]) {
-
-		case Script_Byte:
+	// The operand widths have been pre-resolved per extended opcode by
+	// script_adjust_opcode_formats(), so each operand costs a single fetch
+	// here instead of re-deriving its width from the format table and the
+	// opcode's low bit on every executed instruction
+	const byte *plan = g_sci->_opcode_plans[extOpcode];
+	for (int i = 0; plan[i] != kOperandEnd; ++i) {
+		switch (plan[i]) {
+
+		case kOperandByte:
 			opparams[i] = src[offset++];
 			break;
-		case Script_SByte:
+		case kOperandSByte:
 			opparams[i] = (int8)src[offset++];
 			break;
 
-		case Script_Word:
+		case kOperandWord:
 			opparams[i] = READ_SCI11ENDIAN_UINT16(src + offset);
 			offset += 2;
 			break;
-		case Script_SWord:
+		case kOperandSWord:
 			opparams[i] = (int16)READ_SCI11ENDIAN_UINT16(src + offset);
 			offset += 2;
 			break;
 
-		case Script_Variable:
-		case Script_Property:
-
-		case Script_Local:
-		case Script_Temp:
-		case Script_Global:
-		case Script_Param:
-
-		case Script_Offset:
-			if (extOpcode & 1) {
-				opparams[i] = src[offset++];
-			} else {
-				opparams[i] = READ_SCI11ENDIAN_UINT16(src + offset);
-				offset += 2;
-			}
-			break;
-
-		case Script_SVariable:
-		case Script_SRelative:
-			if (extOpcode & 1) {
-				opparams[i] = (int8)src[offset++];
-			} else {
-				opparams[i] = (int16)READ_SCI11ENDIAN_UINT16(src + offset);
-				offset += 2;
-			}
-			break;
-
-		case Script_None:
-		case Script_End:
-			break;
-
-		case Script_Invalid:
+		case kOperandInvalid:
 		default:
 			error("opcode %02x: Invalid", extOpcode);
 		}
@@ -232,6 +232,19 @@ enum opcode_format {
 	Script_End
 };
 
+// Operand fetch kinds, pre-resolved from the opcode formats for each
+// extended opcode by script_adjust_opcode_formats(). Unlike opcode_format,
+// these already encode the operand width, which for most formats depends on
+// the low bit of the extended opcode.
+enum OperandFetch {
+	kOperandEnd = 0,
+	kOperandByte,
+	kOperandSByte,
+	kOperandWord,
+	kOperandSWord,
+	kOperandInvalid
+};
+
 
 } // End of namespace Sci
 
@@ -346,6 +346,21 @@ private:
 	 */
 	PlaneList _visiblePlanes;
 
+	/**
+	 * Reusable per-plane draw and erase lists for frameOut and
+	 * palMorphFrameOut. SSCI allocated these as static arrays of 100
+	 * pointers to ScreenItemList / RectList; keeping them as members avoids
+	 * reallocating the backing arrays on every rendered frame.
+	 */
+	ScreenItemListList _screenItemLists;
+	EraseListList _eraseLists;
+
+	/**
+	 * Empties the reusable draw and erase lists and resizes them to match
+	 * the current plane list, so a frame starts from clean scratch state.
+	 */
+	void resetFrameLists();
+
 	/**
 	 * Calculates the location and dimensions of dirty rects over the entire
 	 * screen for rendering the next frame. The draw and erase lists in
@@ -185,7 +185,7 @@ bool SingleRemap::updateSaturationAndBrightness() {
 }
 
 bool SingleRemap::apply() {
-	const GfxRemap32 *const gfxRemap32 = g_sci->_gfxRemap32;
+	GfxRemap32 *const gfxRemap32 = g_sci->_gfxRemap32;
 	const uint8 remapStartColor = gfxRemap32->getStartColor();
 
 	// Blocked colors are not allowed to be used as target colors for the remap
@@ -226,7 +226,17 @@ bool SingleRemap::apply() {
 			continue;
 		}
 
-		const int16 bestColor = matchColor(_idealColors[i], _matchDistances[i], distance, blockedColors);
+		int16 bestColor;
+		if (!gfxRemap32->lookupMatch(_idealColors[i], bestColor, distance)) {
+			bestColor = matchColor(_idealColors[i], _matchDistances[i], distance, blockedColors);
+			// A match exists whenever at least one target color is
+			// unblocked, and then it does not depend on the incoming
+			// minimum distance, so the result can be shared with the other
+			// remaps of this pass
+			if (bestColor != -1) {
+				gfxRemap32->cacheMatch(_idealColors[i], bestColor, distance);
+			}
+		}
 
 		if (bestColor != -1 && _remapColors[i] != bestColor) {
 			updated = true;
@@ -454,6 +464,10 @@ bool GfxRemap32::remapAllTables(const bool paletteUpdated) {
 
 	bool updated = false;
 
+	// The memoized matches are only valid against the palette and blocked
+	// colors of a single pass
+	_matchCache.clear();
+
 	for (SingleRemapsList::iterator it = _remaps.begin(); it != _remaps.end(); ++it) {
 		if (it->_type != kRemapNone) {
 			updated |= it->update();
@@ -25,6 +25,7 @@
 
 #include "common/algorithm.h"
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "common/scummsys.h"
 #include "sci/graphics/helpers.h"
 
@@ -341,6 +342,33 @@ public:
 	 */
 	bool remapAllTables(const bool paletteUpdated);
 
+	/**
+	 * Looks up a match memoized earlier in the current remapAllTables pass.
+	 * Returns true and fills `bestColor` and `distance` on a hit.
+	 */
+	inline bool lookupMatch(const Color &color, int16 &bestColor, int &distance) const {
+		const uint32 key = (color.r << 16) | (color.g << 8) | color.b;
+		MatchCache::const_iterator it = _matchCache.find(key);
+		if (it == _matchCache.end()) {
+			return false;
+		}
+		bestColor = it->_value.bestColor;
+		distance = it->_value.distance;
+		return true;
+	}
+
+	/**
+	 * Memoizes the result of a SingleRemap::matchColor scan for reuse by
+	 * other entries and remaps in the same remapAllTables pass.
+	 */
+	inline void cacheMatch(const Color &color, const int16 bestColor, const int distance) {
+		const uint32 key = (color.r << 16) | (color.g << 8) | color.b;
+		CachedMatch match;
+		match.bestColor = bestColor;
+		match.distance = distance;
+		_matchCache.setVal(key, match);
+	}
+
 private:
 	typedef Common::Array<SingleRemap> SingleRemapsList;
 
@@ -380,6 +408,21 @@ private:
 	 * potential targets for remapping.
 	 */
 	int16 _blockedRangeCount;
+
+	/**
+	 * Nearest-color matches memoized for the duration of one
+	 * remapAllTables pass. The candidate palette and the set of blocked
+	 * target colors cannot change while the pass runs, so a given ideal
+	 * color always resolves to the same target, and remaps with identical
+	 * settings (e.g. the stacked shadow remaps in QFG4) share one palette
+	 * scan per distinct color instead of redoing it per entry.
+	 */
+	struct CachedMatch {
+		int16 bestColor;
+		int distance;
+	};
+	typedef Common::HashMap<uint32, CachedMatch> MatchCache;
+	MatchCache _matchCache;
 };
 } // End of namespace Sci
 #endif
@@ -882,9 +882,8 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 		// Merge view palette in...
 		_palette->set(&_viewPalette, false);
 
-	Common::Array<uint16> scalingX, scalingY;
-	createScalingTable(scalingX, celWidth, _screen->getWidth(), scaleX);
-	createScalingTable(scalingY, celHeight, _screen->getHeight(), scaleY);
+	const Common::Array<uint16> &scalingX = getScalingTable(_scalingXCache, celWidth, _screen->getWidth(), scaleX);
+	const Common::Array<uint16> &scalingY = getScalingTable(_scalingYCache, celHeight, _screen->getHeight(), scaleY);
 
 	int16 scaledWidth = MIN(clipRect.width(), (int16)scalingX.size());
 	int16 scaledHeight = MIN(clipRect.height(), (int16)scalingY.size());
@@ -905,6 +904,16 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 	}
 }
 
+const Common::Array<uint16> &GfxView::getScalingTable(ScalingTableCache &cache, int16 celSize, uint16 maxSize, int16 scale) {
+	if (cache.celSize != celSize || cache.maxSize != maxSize || cache.scale != scale) {
+		createScalingTable(cache.table, celSize, maxSize, scale);
+		cache.celSize = celSize;
+		cache.maxSize = maxSize;
+		cache.scale = scale;
+	}
+	return cache.table;
+}
+
 void GfxView::createScalingTable(Common::Array<uint16> &table, int16 celSize, uint16 maxSize, int16 scale) {
 	const int16 scaledSize = (celSize * scale) >> 7;
 	const int16 clippedScaledSize = CLIP<int16>(scaledSize, 0, maxSize);
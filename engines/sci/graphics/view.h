@@ -89,6 +89,25 @@ private:
 
 	static void createScalingTable(Common::Array<uint16> &table, int16 celSize, uint16 maxSize, int16 scale);
 
+	/**
+	 * Cache of the last scaling table built for one axis, so an actor that
+	 * keeps getting drawn at the same scale (the common case while it
+	 * walks) reuses the table instead of rebuilding and reallocating it on
+	 * every drawScaled() call.
+	 */
+	struct ScalingTableCache {
+		int16 celSize;
+		uint16 maxSize;
+		int16 scale;
+		Common::Array<uint16> table;
+		ScalingTableCache() : celSize(-1), maxSize(0), scale(-1) {}
+	};
+
+	const Common::Array<uint16> &getScalingTable(ScalingTableCache &cache, int16 celSize, uint16 maxSize, int16 scale);
+
+	ScalingTableCache _scalingXCache;
+	ScalingTableCache _scalingYCache;
+
 	ResourceManager *_resMan;
 	GfxCoordAdjuster16 *_coordAdjuster;
 	GfxScreen *_screen;
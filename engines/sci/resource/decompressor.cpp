@@ -53,11 +53,32 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked,
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+	_srcRead = 0;
+	_readBufferLen = 0;
+	_readBufferPos = 0;
+}
+
+byte Decompressor::fetchByte() {
+	if (_readBufferPos == _readBufferLen) {
+		const uint32 remaining = (_szPacked > _srcRead) ? _szPacked - _srcRead : 0;
+		if (remaining == 0) {
+			// The bit reservoir may want a few bytes past the end of the
+			// packed data; their bits are never consumed, so feed zeros
+			// instead of reading into whatever follows the packed block.
+			return 0;
+		}
+		_readBufferLen = _src->read(_readBuffer, MIN<uint32>(kReadBufferSize, remaining));
+		_readBufferPos = 0;
+		_srcRead += _readBufferLen;
+		if (_readBufferLen == 0)
+			return 0;
+	}
+	return _readBuffer[_readBufferPos++];
 }
 
 void Decompressor::fetchBitsMSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)fetchByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -79,7 +100,7 @@ byte Decompressor::getByteMSB() {
 
 void Decompressor::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)fetchByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -59,7 +59,10 @@ public:
 		_dwRead(0),
 		_dwWrote(0),
 		_src(nullptr),
-		_dest(nullptr)
+		_dest(nullptr),
+		_srcRead(0),
+		_readBufferLen(0),
+		_readBufferPos(0)
 	{}
 
 	virtual ~Decompressor() {}
@@ -104,6 +107,13 @@ protected:
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get the next byte of packed data. Reads from _src in blocks, so
+	 * that the bit readers above don't pay a virtual stream call per
+	 * input byte.
+	 */
+	byte fetchByte();
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
@@ -127,6 +137,16 @@ protected:
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	Common::ReadStream *_src;
 	byte *_dest;
+
+private:
+	enum {
+		kReadBufferSize = 1024
+	};
+
+	uint32 _srcRead;		///< number of bytes pulled from _src into the read buffer
+	uint32 _readBufferLen;
+	uint32 _readBufferPos;
+	byte _readBuffer[kReadBufferSize];
 };
 
 /**
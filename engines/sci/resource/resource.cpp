@@ -26,6 +26,7 @@
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/memtrack.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -1005,12 +1006,15 @@ void ResourceManager::freeResourceSources() {
 }
 
 ResourceManager::ResourceManager(const bool detectionMode) :
-	_detectionMode(detectionMode) {}
+	_detectionMode(detectionMode),
+	_memTag(-1) {}
 
 void ResourceManager::init() {
 	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_memTag = MemTrackMan.registerTag("sci.resources");
+	MemTrackMan.setBudgetCallback(_memTag, memBudgetExceeded, this);
 	_LRU.clear();
 	_resMap.clear();
 	_audioMapSCI1 = nullptr;
@@ -1085,6 +1089,16 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// The built-in caps above are a compromise; low-memory targets may
+	// want less, and machines with plenty of RAM avoid a lot of resource
+	// reloading with more. Allow overriding the cap (in KiB) from the
+	// configuration file.
+	if (ConfMan.hasKey("resource_cache_size")) {
+		int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0)
+			_maxMemoryLRU = cacheSize * 1024;
+	}
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1111,6 +1125,11 @@ void ResourceManager::init() {
 }
 
 ResourceManager::~ResourceManager() {
+	if (_memTag >= 0) {
+		MemTrackMan.subUsage(_memTag, _memoryLRU);
+		MemTrackMan.setBudgetCallback(_memTag, nullptr, nullptr);
+	}
+
 	// freeing resources
 	ResourceMap::iterator itr = _resMap.begin();
 	while (itr != _resMap.end()) {
@@ -1133,6 +1152,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 	}
 	_LRU.remove(res);
 	_memoryLRU -= res->size();
+	MemTrackMan.subUsage(_memTag, res->size());
 	res->_status = kResStatusAllocated;
 }
 
@@ -1149,6 +1169,9 @@ void ResourceManager::addToLRU(Resource *res) {
 	      _memoryLRU);
 #endif
 	res->_status = kResStatusEnqueued;
+	// Report after the status change, so a budget callback firing here
+	// can already evict this resource
+	MemTrackMan.addUsage(_memTag, res->size());
 }
 
 void ResourceManager::printLRU() {
@@ -1168,6 +1191,16 @@ void ResourceManager::printLRU() {
 	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
 }
 
+void ResourceManager::memBudgetExceeded(void *refCon, uint64 usage, uint64 budget) {
+	ResourceManager *resMan = (ResourceManager *)refCon;
+
+	// Clamp the LRU limit to the external budget and let the regular
+	// eviction logic free the difference
+	if (resMan->_maxMemoryLRU > (int)budget)
+		resMan->_maxMemoryLRU = (int)budget;
+	resMan->freeOldResources();
+}
+
 void ResourceManager::freeOldResources() {
 	while (_maxMemoryLRU < _memoryLRU) {
 		assert(!_LRU.empty());
@@ -2416,7 +2449,26 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 	byte *ptr = new byte[_size];
 	_data = ptr;
 	_status = kResStatusAllocated;
-	errorNum = ptr ? dec->unpack(file, ptr, szPacked, _size) : SCI_ERROR_RESOURCE_TOO_BIG;
+	if (!ptr) {
+		errorNum = SCI_ERROR_RESOURCE_TOO_BIG;
+	} else if (compression != kCompNone && szPacked > 0) {
+		// Pull the packed data into memory with one read and decompress
+		// from there. The bit-oriented decompressors otherwise issue a
+		// virtual readByte() on the volume file for every input byte,
+		// which adds up during room transitions that decompress dozens
+		// of resources back-to-back.
+		byte *packed = (byte *)malloc(szPacked);
+		if (packed) {
+			const uint32 packedRead = file->read(packed, szPacked);
+			Common::MemoryReadStream packedStream(packed, packedRead);
+			errorNum = dec->unpack(&packedStream, ptr, szPacked, _size);
+			free(packed);
+		} else {
+			errorNum = dec->unpack(file, ptr, szPacked, _size);
+		}
+	} else {
+		errorNum = dec->unpack(file, ptr, szPacked, _size);
+	}
 	if (errorNum) {
 		unalloc();
 	} else {
@@ -396,6 +396,18 @@ public:
 	 */
 	bool hasResourceType(ResourceType type);
 
+	/**
+	 * Opens a stream over the raw data of an audio resource directly from
+	 * its uncompressed audio volume, using a private file handle so the
+	 * stream stays valid on the mixer thread while the main thread keeps
+	 * using the resource manager. Only the resource header is parsed up
+	 * front; the sample data itself is never copied into memory. Returns
+	 * NULL when the resource cannot be streamed this way (patch resources,
+	 * compressed volumes, ...), in which case the caller should fall back
+	 * to findResource().
+	 */
+	Common::SeekableReadStream *makeAudioVolumeStream(const ResourceId &resId);
+
 	void setAudioLanguage(int language);
 	int getAudioLanguage() const;
 	void changeAudioDirectory(Common::String path);
@@ -484,6 +496,9 @@ protected:
 	// issued whenever this limit is exceeded.
 	int _maxMemoryLRU;
 
+	// Memory tracker tag for the LRU cache
+	int _memTag;
+
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	typedef Common::List<ResourceSource *> SourcesList;
 	SourcesList _sources;
@@ -551,6 +566,12 @@ protected:
 	void disposeVolumeFileStream(Common::SeekableReadStream *fileStream, ResourceSource *source);
 	void loadResource(Resource *res);
 	void freeOldResources();
+
+	/**
+	 * Invoked by the memory tracker when an externally assigned budget
+	 * is exceeded; clamps the LRU limit to the budget and evicts.
+	 */
+	static void memBudgetExceeded(void *refCon, uint64 usage, uint64 budget);
 	bool validateResource(const ResourceId &resourceId, const Common::String &sourceMapLocation, const Common::String &sourceName, const uint32 offset, const uint32 size, const uint32 sourceSize) const;
 	Resource *addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0, const Common::String &sourceMapLocation = Common::String("(no map location)"));
 	Resource *updateResource(ResourceId resId, ResourceSource *src, uint32 size, const Common::String &sourceMapLocation = Common::String("(no map location)"));
@@ -662,19 +683,13 @@ public:
 		byte poly;
 		uint16 prio;
 		SciSpan<const byte> data;
-		uint16 curPos;
-		long time;
-		byte prev;
 
 		Channel() :
 			number(0),
 			flags(0),
 			poly(0),
 			prio(0),
-			data(),
-			curPos(0) {
-			time = 0;
-			prev = 0;
+			data() {
 		}
 	};
 
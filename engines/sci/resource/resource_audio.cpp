@@ -26,6 +26,7 @@
 #include "common/file.h"
 #include "common/textconsole.h"
 #include "common/memstream.h"
+#include "common/substream.h"
 #include "sci/resource/resource.h"
 #include "sci/resource/resource_intern.h"
 #include "sci/util.h"
@@ -161,6 +162,66 @@ bool Resource::loadFromAudioVolumeSCI1(Common::SeekableReadStream *file) {
 	return true;
 }
 
+Common::SeekableReadStream *ResourceManager::makeAudioVolumeStream(const ResourceId &resId) {
+	if (resId.getType() != kResourceTypeAudio && resId.getType() != kResourceTypeAudio36)
+		return nullptr;
+
+	Resource *res = testResource(resId);
+	if (res == nullptr || res->_source == nullptr ||
+		res->_source->getSourceType() != kSourceAudioVolume)
+		return nullptr;
+
+	// Compressed volumes relocate the resource offsets and wrap the payload
+	// in MP3/Vorbis/FLAC frames, so they have to go through the normal
+	// loading path
+	if (res->getAudioCompressionType() != 0)
+		return nullptr;
+
+	// A private file handle is required here: the stream is consumed on the
+	// mixer thread, while the shared handles from getVolumeFile() keep
+	// getting seeked around by resource loads on the main thread
+	Common::SeekableReadStream *fileStream;
+	if (res->_source->_resourceFile) {
+		fileStream = res->_source->_resourceFile->createReadStream();
+	} else {
+		Common::File *file = new Common::File();
+		if (!file->open(res->_source->getLocationName())) {
+			delete file;
+			return nullptr;
+		}
+		fileStream = file;
+	}
+
+	if (fileStream == nullptr)
+		return nullptr;
+
+	uint32 size = res->_size;
+	if (size == 0) {
+		// Audio36 map entries usually carry no size, so probe the resource
+		// header the same way loadFromAudioVolumeSCI11 does
+		fileStream->seek(res->_fileOffset);
+		if (fileStream->readUint32BE() == MKTAG('R','I','F','F')) {
+			size = fileStream->readUint32LE() + 8;
+		} else {
+			fileStream->seek(res->_fileOffset);
+			const ResourceType type = convertResType(fileStream->readByte());
+			const uint8 headerSize = fileStream->readByte();
+			if (type != kResourceTypeAudio || (headerSize != 11 && headerSize != 12)) {
+				delete fileStream;
+				return nullptr;
+			}
+			fileStream->skip(7);
+			size = fileStream->readUint32LE() + headerSize + kResourceHeaderSize;
+		}
+		if (fileStream->err() || fileStream->eos()) {
+			delete fileStream;
+			return nullptr;
+		}
+	}
+
+	return new Common::SeekableSubReadStream(fileStream, res->_fileOffset, res->_fileOffset + size, DisposeAfterUse::YES);
+}
+
 void ResourceManager::addNewGMPatch(SciGameId gameId) {
 	Common::String gmPatchFile;
 
@@ -902,12 +963,10 @@ SoundResource::SoundResource(uint32 resourceNr, ResourceManager *resMan, SciVers
 
 					channel->data = _resource->subspan(dataOffset, size);
 
-					channel->curPos = 0;
 					channel->number = channel->data[0];
 
 					channel->poly = channel->data[1] & 0x0F;
 					channel->prio = channel->data[1] >> 4;
-					channel->time = channel->prev = 0;
 					channel->data += 2; // skip over header
 					if (channel->number == 0xFE) { // Digital channel
 						_tracks[trackNr].digitalChannelNr = channelNr;
@@ -118,6 +118,7 @@ SciEngine::SciEngine(OSystem *syst, const ADGameDescription *desc, SciGameId gam
 	_features(nullptr),
 	_guestAdditions(nullptr),
 	_opcode_formats(nullptr),
+	_opcode_plans(nullptr),
 	_debugState(),
 	_gameDescription(desc),
 	_gameId(gameId),
@@ -245,6 +246,7 @@ SciEngine::~SciEngine() {
 	delete _gamestate;
 
 	delete[] _opcode_formats;
+	delete[] _opcode_plans;
 
 	delete _scriptPatcher;
 	delete _resMan;	// should be deleted last
@@ -279,6 +279,13 @@ public:
 
 	opcode_format (*_opcode_formats)[4];
 
+	/**
+	 * Operand fetch plans per extended opcode, pre-resolved from
+	 * _opcode_formats by script_adjust_opcode_formats(). Each plan is a
+	 * kOperandEnd-terminated list of OperandFetch values.
+	 */
+	byte (*_opcode_plans)[4];
+
 	DebugState _debugState;
 
 	Common::MacResManager *getMacExecutable() { return &_macExecutable; }
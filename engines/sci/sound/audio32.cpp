@@ -589,11 +589,14 @@ void Audio32::freeChannel(const int16 channelIndex) {
 		// We cannot unlock resources from the audio thread because
 		// ResourceManager is not thread-safe; instead, we just record that the
 		// resource needs unlocking and unlock it whenever we are on the main
-		// thread again
-		if (_inAudioThread) {
-			_resourcesToUnlock.push_back(channel.resource);
-		} else {
-			_resMan->unlockResource(channel.resource);
+		// thread again. Streamed channels never locked a resource in the
+		// first place.
+		if (channel.resource != nullptr) {
+			if (_inAudioThread) {
+				_resourcesToUnlock.push_back(channel.resource);
+			} else {
+				_resMan->unlockResource(channel.resource);
+			}
 		}
 
 		channel.resource = nullptr;
@@ -809,13 +812,19 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 	// Here in ScummVM we just ask the resource manager to give us the resource
 	// and we get a seekable stream.
 
-	// TODO: This should be fixed to use streaming, which means fixing the
-	// resource manager to allow streaming, which means probably rewriting a
-	// bunch of the resource manager.
-	Resource *resource = _resMan->findResource(resourceId, true);
-	if (resource == nullptr) {
-		warning("[Audio32::play]: %s could not be found", resourceId.toString().c_str());
-		return 0;
+	// Resources living in uncompressed audio volumes are streamed straight
+	// from disc, with only the header parsed up front, so playback of large
+	// speech samples starts without first copying them into memory. Patch
+	// resources and compressed volumes still go through the resource
+	// manager as before.
+	Common::SeekableReadStream *dataStream = _resMan->makeAudioVolumeStream(resourceId);
+	Resource *resource = nullptr;
+	if (dataStream == nullptr) {
+		resource = _resMan->findResource(resourceId, true);
+		if (resource == nullptr) {
+			warning("[Audio32::play]: %s could not be found", resourceId.toString().c_str());
+			return 0;
+		}
 	}
 
 	channelIndex = _numActiveChannels++;
@@ -833,7 +842,9 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 		_monitoredChannelIndex = channelIndex;
 	}
 
-	Common::SeekableReadStream *dataStream = resource->makeStream();
+	if (dataStream == nullptr) {
+		dataStream = resource->makeStream();
+	}
 
 	Audio::RewindableAudioStream *audioStream;
 
@@ -1399,7 +1410,7 @@ void Audio32::printAudioList(Console *con) const {
 		con->debugPrintf("  %d[%04x:%04x]: %s, started at %d, pos %d/%d, vol %d, pan %d%s%s\n",
 						 i,
 						 PRINT_REG(channel.soundNode),
-						 channel.robot ? "robot" : channel.resource->name().c_str(),
+						 channel.robot ? "robot" : channel.id.toString().c_str(),
 						 channel.startedAtTick,
 						 (g_sci->getTickCount() - channel.startedAtTick) % channel.duration,
 						 channel.duration,
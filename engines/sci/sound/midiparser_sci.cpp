@@ -125,15 +125,15 @@ byte MidiParser_SCI::midiGetNextChannel(long ticker) {
 	long closest = ticker + 1000000, next = 0;
 
 	for (int i = 0; i < _track->channelCount; i++) {
-		if (_track->channels[i].time == -1) // channel ended
+		if (_mixState[i].time == -1) // channel ended
 			continue;
-		SoundResource::Channel *curChannel = &_track->channels[i];
-		if (curChannel->curPos >= curChannel->data.size())
+		const SoundResource::Channel *curChannel = &_track->channels[i];
+		if (_mixState[i].curPos >= curChannel->data.size())
 			continue;
-		next = curChannel->data[curChannel->curPos]; // when the next event should occur
+		next = curChannel->data[_mixState[i].curPos]; // when the next event should occur
 		if (next == 0xF8) // 0xF8 means 240 ticks delay
 			next = 240;
-		next += _track->channels[i].time;
+		next += _mixState[i].time;
 		if (next < closest) {
 			curr = i;
 			closest = next;
@@ -143,8 +143,8 @@ byte MidiParser_SCI::midiGetNextChannel(long ticker) {
 	return curr;
 }
 
-static inline bool validateNextRead(const SoundResource::Channel *channel) {
-	if (channel->data.size() <= channel->curPos) {
+static inline bool validateNextRead(const SoundResource::Channel *channel, uint16 curPos) {
+	if (channel->data.size() <= curPos) {
 		warning("Unexpected end of %s. Music may sound wrong due to game resource corruption", channel->data.name().c_str());
 		return false;
 	}
@@ -154,10 +154,12 @@ static inline bool validateNextRead(const SoundResource::Channel *channel) {
 void MidiParser_SCI::midiMixChannels() {
 	int totalSize = 0;
 
+	// The per-channel read state lives in the parser, not in the shared
+	// sound resource, so the resource data stays read-only here
+	_mixState.clear();
+	_mixState.resize(_track->channelCount);
+
 	for (int i = 0; i < _track->channelCount; i++) {
-		_track->channels[i].time = 0;
-		_track->channels[i].prev = 0;
-		_track->channels[i].curPos = 0;
 		// Ignore the digital channel data, if it exists - it's not MIDI data
 		if (i == _track->digitalChannelNr)
 			continue;
@@ -170,25 +172,26 @@ void MidiParser_SCI::midiMixChannels() {
 	byte channelNr, curDelta;
 	byte midiCommand = 0, midiParam, globalPrev = 0;
 	long newDelta;
-	SoundResource::Channel *channel;
+	const SoundResource::Channel *channel;
 	bool breakOut = false;
 
 	while ((channelNr = midiGetNextChannel(ticker)) != 0xFF) { // there is still an active channel
 		channel = &_track->channels[channelNr];
-		if (!validateNextRead(channel))
+		ChannelMixState &mixState = _mixState[channelNr];
+		if (!validateNextRead(channel, mixState.curPos))
 			break;
-		curDelta = channel->data[channel->curPos++];
-		channel->time += (curDelta == 0xF8 ? 240 : curDelta); // when the command is supposed to occur
+		curDelta = channel->data[mixState.curPos++];
+		mixState.time += (curDelta == 0xF8 ? 240 : curDelta); // when the command is supposed to occur
 		if (curDelta == 0xF8)
 			continue;
-		newDelta = channel->time - ticker;
+		newDelta = mixState.time - ticker;
 		ticker += newDelta;
 
 		if (channelNr == _track->digitalChannelNr)
 			continue;
-		if (!validateNextRead(channel))
+		if (!validateNextRead(channel, mixState.curPos))
 			break;
-		midiCommand = channel->data[channel->curPos++];
+		midiCommand = channel->data[mixState.curPos++];
 		if (midiCommand != kEndOfTrack) {
 			// Write delta
 			while (newDelta > 240) {
@@ -203,27 +206,27 @@ void MidiParser_SCI::midiMixChannels() {
 		case 0xF0: // sysEx
 			*outData++ = midiCommand;
 			do {
-				if (!validateNextRead(channel)) {
+				if (!validateNextRead(channel, mixState.curPos)) {
 					breakOut = true;
 					break;
 				}
-				midiParam = channel->data[channel->curPos++];
+				midiParam = channel->data[mixState.curPos++];
 				*outData++ = midiParam;
 			} while (midiParam != 0xF7);
 			break;
 		case kEndOfTrack: // end of channel
-			channel->time = -1;
+			mixState.time = -1;
 			break;
 		default: // MIDI command
 			if (midiCommand & 0x80) {
-				if (!validateNextRead(channel)) {
+				if (!validateNextRead(channel, mixState.curPos)) {
 					breakOut = true;
 					break;
 				}
-				midiParam = channel->data[channel->curPos++];
+				midiParam = channel->data[mixState.curPos++];
 			} else {// running status
 				midiParam = midiCommand;
-				midiCommand = channel->prev;
+				midiCommand = mixState.prev;
 			}
 
 			// remember which channel got used for channel remapping
@@ -234,13 +237,13 @@ void MidiParser_SCI::midiMixChannels() {
 				*outData++ = midiCommand;
 			*outData++ = midiParam;
 			if (nMidiParams[(midiCommand >> 4) - 8] == 2) {
-				if (!validateNextRead(channel)) {
+				if (!validateNextRead(channel, mixState.curPos)) {
 					breakOut = true;
 					break;
 				}
-				*outData++ = channel->data[channel->curPos++];
+				*outData++ = channel->data[mixState.curPos++];
 			}
-			channel->prev = midiCommand;
+			mixState.prev = midiCommand;
 			globalPrev = midiCommand;
 		}
 
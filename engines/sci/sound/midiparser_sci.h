@@ -130,6 +130,23 @@ protected:
 
 	ChannelState _channelState[16];
 
+	/**
+	 * Per-channel read state used while mixing the channels of a track
+	 * into _mixedData. This used to live in SoundResource::Channel, but
+	 * keeping it here leaves the parsed sound resource immutable after
+	 * construction.
+	 */
+	struct ChannelMixState {
+		uint16 curPos;
+		long time;
+		byte prev;
+
+		ChannelMixState() : curPos(0), prev(0) {
+			time = 0;
+		}
+	};
+
+	Common::Array<ChannelMixState> _mixState;
 };
 
 } // End of namespace Sci
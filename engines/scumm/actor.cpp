@@ -1885,10 +1885,14 @@ AdjustBoxResult Actor::adjustXYToBeInBox(int dstX, int dstY) {
 			if ((flags & kBoxInvisible) && !((flags & kBoxPlayerOnly) && !isPlayer()))
 				continue;
 
+			// Decode the box coordinates once; getBoxCoordinates()
+			// re-parses the box resource on every call.
+			const BoxCoords coords = _vm->getBoxCoordinates(box);
+
 			// For increased performance, we perform a quick test if
 			// the coordinates can even be within a distance of 'threshold'
 			// pixels of the box.
-			if (threshold > 0 && inBoxQuickReject(_vm->getBoxCoordinates(box), dstX, dstY, threshold))
+			if (threshold > 0 && inBoxQuickReject(coords, dstX, dstY, threshold))
 				continue;
 
 			// Check if the point is contained in the box. If it is,
@@ -1901,7 +1905,7 @@ AdjustBoxResult Actor::adjustXYToBeInBox(int dstX, int dstY) {
 			}
 
 			// Find the point in the box which is closest to our point.
-			tmpDist = getClosestPtOnBox(_vm->getBoxCoordinates(box), dstX, dstY, tmpX, tmpY);
+			tmpDist = getClosestPtOnBox(coords, dstX, dstY, tmpX, tmpY);
 
 			// Check if the box is closer than the previous boxes.
 			if (tmpDist < bestDist) {
@@ -2742,10 +2746,32 @@ void ScummEngine::setActorRedrawFlags() {
 
 		for (i = 0; i < _gdi->_numStrips; i++) {
 			int strip = _screenStartStrip + i;
-			if (testGfxAnyUsageBits(strip)) {
-				for (j = 1; j < _numActors; j++) {
-					if (testGfxUsageBit(strip, j) && testGfxOtherUsageBits(strip, j)) {
+			if (!testGfxAnyUsageBits(strip))
+				continue;
+			for (j = 1; j < _numActors; j++) {
+				if (_actors[j]->_needRedraw || !testGfxUsageBit(strip, j) || !testGfxOtherUsageBits(strip, j))
+					continue;
+
+				// The background itself changed in this strip, so the
+				// actor has to be repainted on top of it.
+				if (testGfxUsageBit(strip, USAGE_BIT_DIRTY) || testGfxUsageBit(strip, USAGE_BIT_RESTORED)) {
+					_actors[j]->_needRedraw = true;
+					continue;
+				}
+
+				// Only other actors share this strip. The strips give us
+				// horizontal granularity and _top/_bottom record each
+				// actor's vertical extent from its last draw, which is
+				// also the region resetActorBgs() restores. Leave this
+				// actor alone unless one of the others actually overlaps
+				// its bounding box.
+				for (int k = 1; k < _numActors; k++) {
+					if (k == j || !testGfxUsageBit(strip, k))
+						continue;
+					if (_actors[j]->_top == 0x7fffffff || _actors[k]->_top == 0x7fffffff ||
+							(_actors[j]->_top <= _actors[k]->_bottom && _actors[k]->_top <= _actors[j]->_bottom)) {
 						_actors[j]->_needRedraw = true;
+						break;
 					}
 				}
 			}
@@ -338,6 +338,8 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeId = costume;
+
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1165,6 +1167,58 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+/**
+ * Return the given cel fully decoded (a _width * _height block of color
+ * indices), decoding and caching it on first use. Returns nullptr when the
+ * cel does not fit into the cache; the caller then has to fall back to
+ * streamed decoding.
+ */
+const byte *AkosRenderer::akos16DecodeCel(const byte *src) {
+	const uint32 size = (uint32)_width * _height;
+	if (size == 0 || size > kCelCacheMaxCelSize || _costumeId < 0)
+		return nullptr;
+
+	const uint32 offset = (uint32)(src - akcd);
+
+	for (int i = 0; i < kCelCacheSize; i++) {
+		CachedCel &c = _celCache[i];
+		if (c.data && c.costume == _costumeId && c.offset == offset &&
+				c.width == _width && c.height == _height) {
+			c.lastUsed = ++_celCacheCounter;
+			return c.data;
+		}
+	}
+
+	// Not cached yet: evict the least recently used entry
+	CachedCel *victim = nullptr;
+	for (int i = 0; i < kCelCacheSize; i++) {
+		CachedCel &c = _celCache[i];
+		if (!c.data) {
+			victim = &c;
+			break;
+		}
+		if (!victim || c.lastUsed < victim->lastUsed)
+			victim = &c;
+	}
+
+	delete[] victim->data;
+	victim->data = new byte[size];
+	victim->costume = _costumeId;
+	victim->offset = offset;
+	victim->width = _width;
+	victim->height = _height;
+	victim->lastUsed = ++_celCacheCounter;
+
+	akos16SetupBitReader(src);
+	byte *dst = victim->data;
+	for (int h = 0; h < _height; h++) {
+		akos16DecodeLine(dst, _width, 1);
+		dst += _width;
+	}
+
+	return victim->data;
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
@@ -1177,25 +1231,48 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
+	// Masking, shadowing and clipping below depend on the actor's position
+	// and the z-planes, but the decoded pixels themselves do not, so rows
+	// can be copied out of the decoded-cel cache instead of bit stream
+	// decoding on every draw.
+	const byte *cel = akos16DecodeCel(src);
+
+	if (!cel) {
+		akos16SetupBitReader(src);
 
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
+		if (numskip_before != 0) {
+			akos16SkipData(numskip_before);
+		}
 	}
 
 	maskpitch = _numStrips;
 
 	maskptr = _vm->getMaskBuffer(maskLeft, maskTop, zBuf);
 
+	// The skips position the visible rectangle inside the full cel: a full
+	// row of the cel always consists of t_width drawn plus numskip_after
+	// skipped pixels, so the cached cel's row pitch is _width.
+	const byte *celRow = cel ? cel + numskip_before : nullptr;
+
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (cel) {
+			if (dir > 0) {
+				memcpy(_akos16.buffer, celRow, t_width);
+			} else {
+				for (int i = 0; i < t_width; i++)
+					_akos16.buffer[i] = celRow[t_width - 1 - i];
+			}
+			celRow += _width;
+		} else {
+			akos16DecodeLine(tmp_buf, t_width, dir);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
+		if (!cel && numskip_after != 0)	{
 			akos16SkipData(numskip_after);
 		}
 		dest += pitch;
@@ -85,6 +85,27 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	// Cache of fully decoded codec 16 cels. Masking, shadowing and the
+	// actor palette are applied after decoding, so the raw cel only
+	// depends on the costume data itself and can be reused while an
+	// animation cel stays unchanged across frames.
+	enum {
+		kCelCacheSize = 16,
+		kCelCacheMaxCelSize = 128 * 1024
+	};
+
+	struct CachedCel {
+		int costume;
+		uint32 offset;		// cel data offset inside the AKCD block
+		uint16 width, height;
+		uint32 lastUsed;
+		byte *data;
+	};
+
+	CachedCel _celCache[kCelCacheSize];
+	uint32 _celCacheCounter;
+	int _costumeId;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -98,6 +119,15 @@ public:
 		rgbs = 0;
 		xmap = 0;
 		_actorHitMode = false;
+
+		memset(_celCache, 0, sizeof(_celCache));
+		_celCacheCounter = 0;
+		_costumeId = -1;
+	}
+
+	~AkosRenderer() {
+		for (int i = 0; i < kCelCacheSize; i++)
+			delete[] _celCache[i].data;
 	}
 
 	bool _actorHitMode;
@@ -119,6 +149,7 @@ protected:
 	void akos16SetupBitReader(const byte *src);
 	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
+	const byte *akos16DecodeCel(const byte *src);
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
 
 	void markRectAsDirty(Common::Rect rect);
@@ -100,7 +100,8 @@ void bompDecodeLineReverse(byte *dst, const byte *src, int len) {
 }
 
 void bompApplyMask(byte *line_buffer, byte *mask, byte maskbit, int32 size, byte transparency) {
-	while (1) {
+	// Handle the partial leading mask byte pixel by pixel.
+	if (maskbit != 0x80) {
 		do {
 			if (size-- == 0)
 				return;
@@ -111,7 +112,32 @@ void bompApplyMask(byte *line_buffer, byte *mask, byte maskbit, int32 size, byte
 			maskbit >>= 1;
 		} while	(maskbit);
 		mask++;
-		maskbit = 128;
+	}
+
+	// Now one mask byte covers eight aligned pixels. Untouched (0x00) and
+	// fully masked (0xFF) bytes are by far the most common cases, and
+	// neither needs any per-pixel work.
+	while (size >= 8) {
+		const byte bits = *mask++;
+		if (bits == 0xFF) {
+			memset(line_buffer, transparency, 8);
+		} else if (bits) {
+			for (int i = 0; i < 8; i++) {
+				if (bits & (0x80 >> i))
+					line_buffer[i] = transparency;
+			}
+		}
+		line_buffer += 8;
+		size -= 8;
+	}
+
+	// Trailing partial byte.
+	if (size > 0) {
+		const byte bits = *mask;
+		for (int i = 0; i < size; i++) {
+			if (bits & (0x80 >> i))
+				line_buffer[i] = transparency;
+		}
 	}
 }
 
@@ -132,13 +158,30 @@ void bompApplyShadow(int shadowMode, const byte *shadowPalette, const byte *line
 	}
 }
 void bompApplyShadow0(const byte *shadowPalette, const byte *line_buffer, byte *dst, int32 size, byte transparency, bool HE7Check) {
+	if (!HE7Check) {
+		// No palette remapping, so the opaque stretches between transparent
+		// pixels can be copied wholesale instead of pixel by pixel. Overlay
+		// frames are mostly long opaque runs, which turn into one memcpy
+		// each.
+		int32 i = 0;
+		while (i < size) {
+			if (line_buffer[i] == transparency) {
+				i++;
+				continue;
+			}
+			int32 runStart = i;
+			do {
+				i++;
+			} while (i < size && line_buffer[i] != transparency);
+			memcpy(dst + runStart, line_buffer + runStart, i - runStart);
+		}
+		return;
+	}
+
 	while (size-- > 0) {
 		byte tmp = *line_buffer++;
 		if (tmp != transparency) {
-			if (HE7Check)
-				*dst = shadowPalette[tmp];
-			else
-				*dst = tmp;
+			*dst = shadowPalette[tmp];
 		}
 		dst++;
 	}
@@ -773,6 +773,13 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
 		return 0;
 
+	// Memoized lookup: the scan below is linear in the matrix resource
+	// size and runs every frame for every walking actor, so remember the
+	// answers until the matrix is replaced (see invalidateNextBoxCache).
+	if (_nextBoxCache && from < _nextBoxCacheNum && to < _nextBoxCacheNum &&
+			_nextBoxCache[from * _nextBoxCacheNum + to] != -2)
+		return _nextBoxCache[from * _nextBoxCacheNum + to];
+
 	// Skip up to the matrix data for box 'from'
 	for (i = 0; i < from && boxm < end; i++) {
 		while (boxm < end && *boxm != 0xFF)
@@ -790,9 +797,24 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	if (boxm >= end)
 		debug(0, "The box matrix apparently is truncated (room %d)", _roomResource);
 
+	if (!_nextBoxCache && numOfBoxes > 0) {
+		_nextBoxCacheNum = numOfBoxes;
+		_nextBoxCache = (int16 *)malloc(numOfBoxes * numOfBoxes * sizeof(int16));
+		for (int n = 0; n < numOfBoxes * numOfBoxes; n++)
+			_nextBoxCache[n] = -2;
+	}
+	if (_nextBoxCache && from < _nextBoxCacheNum && to < _nextBoxCacheNum)
+		_nextBoxCache[from * _nextBoxCacheNum + to] = dest;
+
 	return dest;
 }
 
+void ScummEngine::invalidateNextBoxCache() {
+	free(_nextBoxCache);
+	_nextBoxCache = nullptr;
+	_nextBoxCacheNum = 0;
+}
+
 /*
  * Computes the next point actor a has to walk towards in a straight
  * line in order to get from box1 to box3 via box2.
@@ -1022,6 +1044,8 @@ void ScummEngine::calcItineraryMatrix(byte *itineraryMatrix, int num) {
 void ScummEngine::createBoxMatrix() {
 	int num, i, j;
 
+	invalidateNextBoxCache();
+
 	// The total number of boxes
 	num = getNumBoxes();
 
@@ -578,27 +578,44 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	if (vs->h == 0)
 		return;
 
-	int i;
-	int w = 8;
-	int start = 0;
+	int start = -1;
+	int spanTop = 0, spanBottom = 0;
 
-	for (i = 0; i < _gdi->_numStrips; i++) {
+	// Coalesce neighboring dirty strips into wide spans, so the blitting
+	// (and, for older games, the text surface compositing) below operates
+	// on a few large rectangles instead of one call per 8 pixel strip.
+	for (int i = 0; i < _gdi->_numStrips; i++) {
 		if (vs->bdirty[i]) {
 			const int top = vs->tdirty[i];
 			const int bottom = vs->bdirty[i];
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
-				w += 8;
-				continue;
+
+			if (start >= 0) {
+				// Merge with the current span unless the union would copy
+				// more rows than drawing both parts separately would.
+				// Redrawing clean rows is harmless, since the virtual
+				// screen always holds the full up-to-date image.
+				const int newTop = MIN(spanTop, top);
+				const int newBottom = MAX(spanBottom, bottom);
+				if (newBottom - newTop <= (spanBottom - spanTop) + (bottom - top)) {
+					spanTop = newTop;
+					spanBottom = newBottom;
+					continue;
+				}
+				drawStripToScreen(vs, start * 8, (i - start) * 8, spanTop, spanBottom);
 			}
-			drawStripToScreen(vs, start * 8, w, top, bottom);
-			w = 8;
+			start = i;
+			spanTop = top;
+			spanBottom = bottom;
+		} else if (start >= 0) {
+			drawStripToScreen(vs, start * 8, (i - start) * 8, spanTop, spanBottom);
+			start = -1;
 		}
-		start = i + 1;
 	}
+
+	if (start >= 0)
+		drawStripToScreen(vs, start * 8, (_gdi->_numStrips - start) * 8, spanTop, spanBottom);
 }
 
 /**
@@ -1260,6 +1260,20 @@ void Sprite::processImages(bool arg) {
 	int32 w, h;
 	WizParameters wiz;
 
+	// With hundreds of active sprites, most of them share a handful of
+	// Wiz images, and the spot/dimension lookups below walk the MULT/WRAP
+	// block structure of the image resource every time. Memoize the
+	// answers for the duration of this pass; scripts can modify image
+	// resources between frames, so the cache does not outlive it.
+	struct WizHeaderInfo {
+		int image;
+		int state;
+		int32 spotX, spotY;
+		int32 w, h;
+	};
+	WizHeaderInfo headerCache[16];
+	int numCached = 0;
+
 	for (int i = 0; i < _numSpritesToProcess; i++) {
 		SpriteInfo *spi = _activeSpritesTable[i];
 
@@ -1279,7 +1293,29 @@ void Sprite::processImages(bool arg) {
 		spi->flags &= ~kSFNeedRedraw;
 		image = spi->image;
 		imageState = spi->imageState;
-		_vm->_wiz->getWizImageSpot(spi->image, spi->imageState, spr_wiz_x, spr_wiz_y);
+
+		WizHeaderInfo *hdr = nullptr;
+		if (image) {
+			for (int j = 0; j < numCached; j++) {
+				if (headerCache[j].image == image && headerCache[j].state == imageState) {
+					hdr = &headerCache[j];
+					break;
+				}
+			}
+			if (!hdr && numCached < ARRAYSIZE(headerCache)) {
+				hdr = &headerCache[numCached++];
+				hdr->image = image;
+				hdr->state = imageState;
+				_vm->_wiz->getWizImageSpot(image, imageState, hdr->spotX, hdr->spotY);
+				_vm->_wiz->getWizImageDim(image, imageState, hdr->w, hdr->h);
+			}
+		}
+		if (hdr) {
+			spr_wiz_x = hdr->spotX;
+			spr_wiz_y = hdr->spotY;
+		} else {
+			_vm->_wiz->getWizImageSpot(spi->image, spi->imageState, spr_wiz_x, spr_wiz_y);
+		}
 
 		if (spi->group) {
 			SpriteGroup *spg = &_spriteGroups[spi->group];
@@ -1310,7 +1346,12 @@ void Sprite::processImages(bool arg) {
 		if (image) {
 			angle = spi->angle;
 			scale = spi->scale;
-			_vm->_wiz->getWizImageDim(image, imageState, w, h);
+			if (hdr) {
+				w = hdr->w;
+				h = hdr->h;
+			} else {
+				_vm->_wiz->getWizImageDim(image, imageState, w, h);
+			}
 			if (spi->flags & (kSFScaled | kSFRotated)) {
 				Common::Point pts[4];
 				_vm->_wiz->polygonTransform(image, imageState, wiz.img.x1, wiz.img.y1, angle, scale, pts);
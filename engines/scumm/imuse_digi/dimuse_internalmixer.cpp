@@ -267,6 +267,12 @@ int IMuseDigiInternalMixer::loop(uint8 **destBuffer, int len) {
 	int16 *mixBuffer = (int16 *)_mixBuf;
 	uint8 *destBuffer_tmp = *destBuffer;
 
+	// Keep the table base in locals: writes through destBuffer_tmp could
+	// alias the object, which otherwise forces a reload of _softLMID on
+	// every sample.
+	const uint8 *softL8 = (const uint8 *)_softLMID;
+	const uint16 *softL16 = (const uint16 *)_softLMID;
+
 	if (!_mixBuf || !destBuffer || !len)
 		return -1;
 
@@ -277,14 +283,14 @@ int IMuseDigiInternalMixer::loop(uint8 **destBuffer, int len) {
 		if (_outWordSize != 16) {
 			if (len) {
 				for (int i = 0; i < len; i++) {
-					destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i]];
+					destBuffer_tmp[i] = softL8[mixBuffer[i]];
 				}
 			}
 		}
 
 		if (len) {
 			for (int i = 0; i < len; i++) {
-				((uint16 *)destBuffer_tmp)[i] = ((uint16 *)_softLMID)[mixBuffer[i]];
+				((uint16 *)destBuffer_tmp)[i] = softL16[mixBuffer[i]];
 			}
 		}
 	} else {
@@ -292,16 +298,16 @@ int IMuseDigiInternalMixer::loop(uint8 **destBuffer, int len) {
 		if (_outWordSize == 16) {
 			if (len) {
 				for (int i = 0; i < len; i += 2) {
-					((uint16 *)destBuffer_tmp)[i] = ((uint16 *)_softLMID)[mixBuffer[i + 1]];
-					((uint16 *)destBuffer_tmp)[i + 1] = ((uint16 *)_softLMID)[mixBuffer[i]];
+					((uint16 *)destBuffer_tmp)[i] = softL16[mixBuffer[i + 1]];
+					((uint16 *)destBuffer_tmp)[i + 1] = softL16[mixBuffer[i]];
 				}
 			}
 		}
 
 		if (len) {
 			for (int i = 0; i < len; i += 2) {
-				destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i + 1]];
-				destBuffer_tmp[i + 1] = ((uint8 *)_softLMID)[mixBuffer[i]];
+				destBuffer_tmp[i] = softL8[mixBuffer[i + 1]];
+				destBuffer_tmp[i + 1] = softL8[mixBuffer[i]];
 			}
 		}
 	}
@@ -337,12 +343,14 @@ void IMuseDigiInternalMixer::mixBits8Mono(uint8 *srcBuf, int32 inFrameCount, int
 	} else if (2 * inFrameCount == feedSize) {
 		if (inFrameCount - 1 != 0) {
 			for (int i = 0, j = 0; i < inFrameCount - 1; i++, j += 2) {
-				mixBufCurCell[j]	 += *((uint16 *)ampTable + srcBuf_ptr[i]);
-				mixBufCurCell[j + 1] += (*((int16 *)ampTable + srcBuf_ptr[i]) + *((int16 *)ampTable + srcBuf_ptr[i + 1])) >> 1;
+				value = *((int16 *)ampTable + srcBuf_ptr[i]);
+				mixBufCurCell[j]	 += value;
+				mixBufCurCell[j + 1] += (value + *((int16 *)ampTable + srcBuf_ptr[i + 1])) >> 1;
 			}
 		}
-		mixBufCurCell[inFrameCount]		+= *((uint16 *)ampTable + srcBuf_ptr[inFrameCount]);
-		mixBufCurCell[inFrameCount + 1] += *((uint16 *)ampTable + srcBuf_ptr[inFrameCount]);
+		value = *((uint16 *)ampTable + srcBuf_ptr[inFrameCount]);
+		mixBufCurCell[inFrameCount]		+= value;
+		mixBufCurCell[inFrameCount + 1] += value;
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			for (int i = 0, j = 0; i < feedSize; i++, j += 2) {
@@ -401,11 +409,12 @@ void IMuseDigiInternalMixer::mixBits12Mono(uint8 *srcBuf, int32 inFrameCount, in
 				mixBufCurCell += 4;
 			}
 		}
-		mixBufCurCell[0] +=  *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-		mixBufCurCell[1] += (*((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-			               + *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))) >> 1;
-		mixBufCurCell[2] +=  *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-		mixBufCurCell[3] +=  *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+		term_1 = *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
+		term_2 = *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+		mixBufCurCell[0] += term_1;
+		mixBufCurCell[1] += (term_1 + term_2) >> 1;
+		mixBufCurCell[2] += term_2;
+		mixBufCurCell[3] += term_2;
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = srcBuf;
@@ -445,6 +454,9 @@ void IMuseDigiInternalMixer::mixBits16Mono(uint8 *srcBuf, int32 inFrameCount, in
 	uint16 *mixBufCurCell;
 	uint16 *srcBuf_ptr;
 	int residualLength;
+	int offCur;
+	int offNext;
+	int value;
 
 	mixBufCurCell = (uint16 *)(&_mixBuf[2 * mixBufStartIndex]);
 	if (feedSize == inFrameCount) {
@@ -459,14 +471,17 @@ void IMuseDigiInternalMixer::mixBits16Mono(uint8 *srcBuf, int32 inFrameCount, in
 		int i = 0;
 		if (inFrameCount - 1 != 0) {
 			for (i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += (*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096)
-							       + *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i + 1] & (int16) 0xFFF7) >> 3) + 4096)) >> 1;
+				offCur	= (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096;
+				offNext = (((int16)srcBuf_ptr[i + 1] & (int16)0xFFF7) >> 3) + 4096;
+				value = *(int16 *)((uint8 *)ampTable + offCur);
+				mixBufCurCell[0] += value;
+				mixBufCurCell[1] += (value + *(int16 *)((uint8 *)ampTable + offNext)) >> 1;
 				mixBufCurCell += 2;
 			}
 		}
-		mixBufCurCell[0] += *(uint16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[1] += *(uint16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096);
+		value = *(uint16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096);
+		mixBufCurCell[0] += value;
+		mixBufCurCell[1] += value;
 	} else {
 		if (2 * feedSize == inFrameCount) {
 			if (feedSize) {
@@ -508,17 +523,20 @@ void IMuseDigiInternalMixer::mixBits8ConvertToMono(uint8 *srcBuf, int32 inFrameC
 	} else if (2 * inFrameCount == feedSize) {
 		if (inFrameCount != 1) {
 			for (int i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[0])) >> 1;
-				int term_1 = (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[3])) >> 1;
-				int term_2 =  *((int16 *)ampTable + srcBuf_ptr[0]) + *((int16 *)ampTable + srcBuf_ptr[2]);
+				int value0 = *((int16 *)ampTable + srcBuf_ptr[0]);
+				int value1 = *((int16 *)ampTable + srcBuf_ptr[1]);
+				mixBufCurCell[0] += (value1 + value0) >> 1;
+				int term_1 = (value1 + *((int16 *)ampTable + srcBuf_ptr[3])) >> 1;
+				int term_2 =  value0 + *((int16 *)ampTable + srcBuf_ptr[2]);
 				mixBufCurCell[1] += ((term_2 >> 1) + term_1) >> 1;
 
 				srcBuf_ptr += 2;
 				mixBufCurCell += 2;
 			}
 		}
-		mixBufCurCell[0] += (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[0])) >> 1;
-		mixBufCurCell[1] += (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[0])) >> 1;
+		int value = (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[0])) >> 1;
+		mixBufCurCell[0] += value;
+		mixBufCurCell[1] += value;
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			for (int i = 0, j = 0; i < feedSize; i++, j += 4) {
@@ -572,11 +590,10 @@ void IMuseDigiInternalMixer::mixBits12ConvertToMono(uint8 *srcBuf, int32 inFrame
 			}
 		}
 
-		mixBufCurCell[0] += (*((int16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-						   + *((int16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))) >> 1;
-		mixBufCurCell[1] += (*((int16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-						   + *((int16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))) >> 1;
-
+		term_1 = *((int16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
+		term_2 = *((int16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+		mixBufCurCell[0] += (term_1 + term_2) >> 1;
+		mixBufCurCell[1] += (term_1 + term_2) >> 1;
 
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
@@ -624,22 +641,22 @@ void IMuseDigiInternalMixer::mixBits16ConvertToMono(uint8 *srcBuf, int32 inFrame
 		srcBuf_ptr = (uint16 *)srcBuf;
 		if (inFrameCount - 1 != 0) {
 			for (int i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += (*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096)
-								   + *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
+				int value0 = *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
+				int value1 = *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
+				int value2 = *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[2] & (int16)0xFFF7) >> 3) + 4096);
+				int value3 = *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[3] & (int16)0xFFF7) >> 3) + 4096);
 
-				mixBufCurCell[1] +=  (((*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)
-									+   *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[2] & (int16)0xFFF7) >> 3) + 4096)) >> 1)
-									+ ((*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096)
-									+   *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[3] & (int16)0xFFF7) >> 3) + 4096)) >> 1)) >> 1;
+				mixBufCurCell[0] += (value1 + value0) >> 1;
+				mixBufCurCell[1] += (((value0 + value2) >> 1) + ((value1 + value3) >> 1)) >> 1;
 				mixBufCurCell += 2;
 				srcBuf_ptr += 2;
 			}
 		}
 
-		mixBufCurCell[0] += (*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096)
-						   + *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
-		mixBufCurCell[1] += (*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096)
-						   + *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
+		int value = (*(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096)
+				   + *(int16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
+		mixBufCurCell[0] += value;
+		mixBufCurCell[1] += value;
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = (uint16 *)srcBuf;
@@ -701,17 +718,21 @@ void IMuseDigiInternalMixer::mixBits8ConvertToStereo(uint8 *srcBuf, int32 inFram
 		int i = 0;
 		if (inFrameCount - 1 != 0) {
 			for (i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + srcBuf_ptr[i]);
-				mixBufCurCell[1] += *((uint16 *)rightAmpTable + srcBuf_ptr[i]);
-				mixBufCurCell[2] += (*((int16 *)leftAmpTable  + srcBuf_ptr[i]) + *((int16 *)leftAmpTable  + srcBuf_ptr[i + 1])) >> 1;
-				mixBufCurCell[3] += (*((int16 *)rightAmpTable + srcBuf_ptr[i]) + *((int16 *)rightAmpTable + srcBuf_ptr[i + 1])) >> 1;
+				int leftCur  = *((int16 *)leftAmpTable  + srcBuf_ptr[i]);
+				int rightCur = *((int16 *)rightAmpTable + srcBuf_ptr[i]);
+				mixBufCurCell[0] += leftCur;
+				mixBufCurCell[1] += rightCur;
+				mixBufCurCell[2] += (leftCur  + *((int16 *)leftAmpTable  + srcBuf_ptr[i + 1])) >> 1;
+				mixBufCurCell[3] += (rightCur + *((int16 *)rightAmpTable + srcBuf_ptr[i + 1])) >> 1;
 				mixBufCurCell += 4;
 			}
 		}
-		mixBufCurCell[0] += *((uint16 *)leftAmpTable  + srcBuf_ptr[i]);
-		mixBufCurCell[1] += *((uint16 *)rightAmpTable + srcBuf_ptr[i]);
-		mixBufCurCell[2] += *((uint16 *)leftAmpTable  + srcBuf_ptr[i]);
-		mixBufCurCell[3] += *((uint16 *)rightAmpTable + srcBuf_ptr[i]);
+		value = *((uint16 *)leftAmpTable + srcBuf_ptr[i]);
+		mixBufCurCell[0] += value;
+		mixBufCurCell[2] += value;
+		value = *((uint16 *)rightAmpTable + srcBuf_ptr[i]);
+		mixBufCurCell[1] += value;
+		mixBufCurCell[3] += value;
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = srcBuf;
@@ -748,17 +769,18 @@ void IMuseDigiInternalMixer::mixBits12ConvertToStereo(uint8 *srcBuf, int32 inFra
 	int term_1;
 	int term_2;
 	int term_3;
-	int term_4;
 
 	mixBufCurCell = (uint16 *)(&_mixBuf[4 * mixBufStartIndex]);
 	if (feedSize == inFrameCount) {
 		if (inFrameCount / 2) {
 			srcBuf_ptr = srcBuf;
 			for (int i = 0; i < (inFrameCount / 2); i++) {
-				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-				mixBufCurCell[1] += *((uint16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-				mixBufCurCell[2] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-				mixBufCurCell[3] += *((uint16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+				term_1 = srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8);
+				term_2 = srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4);
+				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + term_1);
+				mixBufCurCell[1] += *((uint16 *)rightAmpTable + term_1);
+				mixBufCurCell[2] += *((uint16 *)leftAmpTable  + term_2);
+				mixBufCurCell[3] += *((uint16 *)rightAmpTable + term_2);
 				srcBuf_ptr += 3;
 				mixBufCurCell += 4;
 			}
@@ -767,47 +789,53 @@ void IMuseDigiInternalMixer::mixBits12ConvertToStereo(uint8 *srcBuf, int32 inFra
 		srcBuf_ptr = srcBuf;
 		if ((inFrameCount / 2) - 1 != 0) {
 			for (int i = 0; i < (inFrameCount / 2) - 1; i++) {
-				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
-				mixBufCurCell[1] += *((uint16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
-
-				mixBufCurCell[2] += (*((int16 *)leftAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))
-								   + *((int16 *)leftAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))) >> 1;
-
-				mixBufCurCell[3] += (*((int16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))
-								   + *((int16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))) >> 1;
-
-				mixBufCurCell[4] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-				mixBufCurCell[5] += *((uint16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-
-				mixBufCurCell[6] += (*((int16 *)leftAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4))) +
-									 *((int16 *)leftAmpTable + (srcBuf_ptr[3] | ((srcBuf_ptr[4] & 0xF)  << 8)))) >> 1;
-
-				mixBufCurCell[7] += (*((int16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4))) +
-									 *((int16 *)rightAmpTable + (srcBuf_ptr[3] | ((srcBuf_ptr[4] & 0xF)  << 8)))) >> 1;
+				term_1 = srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8);
+				term_2 = srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4);
+				term_3 = srcBuf_ptr[3] | ((srcBuf_ptr[4] & 0xF)  << 8);
+
+				int leftCur   = *((int16 *)leftAmpTable  + term_1);
+				int rightCur  = *((int16 *)rightAmpTable + term_1);
+				int leftNext  = *((int16 *)leftAmpTable  + term_2);
+				int rightNext = *((int16 *)rightAmpTable + term_2);
+
+				mixBufCurCell[0] += leftCur;
+				mixBufCurCell[1] += rightCur;
+				mixBufCurCell[2] += (leftNext  + leftCur)  >> 1;
+				mixBufCurCell[3] += (rightNext + rightCur) >> 1;
+				mixBufCurCell[4] += leftNext;
+				mixBufCurCell[5] += rightNext;
+				mixBufCurCell[6] += (leftNext  + *((int16 *)leftAmpTable  + term_3)) >> 1;
+				mixBufCurCell[7] += (rightNext + *((int16 *)rightAmpTable + term_3)) >> 1;
 
 				srcBuf_ptr += 3;
 				mixBufCurCell += 8;
 			}
 		}
-		mixBufCurCell[0] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
-		mixBufCurCell[1] += *((uint16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
-
-		mixBufCurCell[2] += (*((int16 *)leftAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-						   + *((int16 *)leftAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))) >> 1;
-
-		mixBufCurCell[3] += (*((int16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-						   + *((int16  *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))) >> 1;
-
-		mixBufCurCell[4] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-		mixBufCurCell[5] += *((uint16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-		mixBufCurCell[6] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-		mixBufCurCell[7] += *((uint16 *)rightAmpTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+		term_1 = srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8);
+		term_2 = srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4);
+
+		{
+			int leftCur   = *((int16 *)leftAmpTable  + term_1);
+			int rightCur  = *((int16 *)rightAmpTable + term_1);
+			int leftNext  = *((int16 *)leftAmpTable  + term_2);
+			int rightNext = *((int16 *)rightAmpTable + term_2);
+
+			mixBufCurCell[0] += leftCur;
+			mixBufCurCell[1] += rightCur;
+			mixBufCurCell[2] += (leftCur  + leftNext)  >> 1;
+			mixBufCurCell[3] += (rightCur + rightNext) >> 1;
+			mixBufCurCell[4] += leftNext;
+			mixBufCurCell[5] += rightNext;
+			mixBufCurCell[6] += leftNext;
+			mixBufCurCell[7] += rightNext;
+		}
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
-				mixBufCurCell[1] += *((uint16 *)rightAmpTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8)));
+				term_1 = srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF) << 8);
+				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + term_1);
+				mixBufCurCell[1] += *((uint16 *)rightAmpTable + term_1);
 				srcBuf_ptr += 3;
 				mixBufCurCell += 2;
 			}
@@ -825,16 +853,8 @@ void IMuseDigiInternalMixer::mixBits12ConvertToStereo(uint8 *srcBuf, int32 inFra
 					term_2 = (srcBuf_ptr[1] & 0xF) << 8;
 					term_1 = srcBuf_ptr[0];
 				}
-				mixBufCurCell[0] += *((uint16 *)leftAmpTable + (term_1 | term_2));
-
-				if (xorFlag) {
-					term_4 = (srcBuf_ptr[1] & 0xF0) << 4;
-					term_3 = srcBuf_ptr[2];
-				} else {
-					term_4 = (srcBuf_ptr[1] & 0xF) << 8;
-					term_3 = srcBuf_ptr[0];
-				}
-				mixBufCurCell[1] += *((uint16 *)rightAmpTable + (term_3 | term_4));
+				mixBufCurCell[0] += *((uint16 *)leftAmpTable  + (term_1 | term_2));
+				mixBufCurCell[1] += *((uint16 *)rightAmpTable + (term_1 | term_2));
 
 				residualLength += inFrameCount;
 				while (residualLength > 0) {
@@ -854,6 +874,7 @@ void IMuseDigiInternalMixer::mixBits16ConvertToStereo(uint8 *srcBuf, int32 inFra
 	uint16* mixBufCurCell;
 	uint16 *srcBuf_tmp;
 	int residualLength;
+	int offset;
 
 	mixBufCurCell = (uint16*)(&_mixBuf[2 * mixBufStartIndex]);
 
@@ -861,8 +882,9 @@ void IMuseDigiInternalMixer::mixBits16ConvertToStereo(uint8 *srcBuf, int32 inFra
 		if (feedSize) {
 			srcBuf_tmp = (uint16 *)srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
+				offset = (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096;
+				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + offset);
+				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + offset);
 				mixBufCurCell += 2;
 			}
 		}
@@ -871,27 +893,31 @@ void IMuseDigiInternalMixer::mixBits16ConvertToStereo(uint8 *srcBuf, int32 inFra
 		int i = 0;
 		if (inFrameCount - 1 != 0) {
 			for (i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
+				offset = (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096;
+				int offNext = (((int16)srcBuf_tmp[i + 1] & (int16)0xFFF7) >> 3) + 4096;
 
-				mixBufCurCell[2] += (*(int16 *)((uint8 *)leftAmpTable + (((int16)srcBuf_tmp[i]     & (int16)0xFFF7) >> 3) + 4096)
-								   + *(int16 *)((uint8 *)leftAmpTable + (((int16)srcBuf_tmp[i + 1] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
+				int leftCur  = *(int16 *)((uint8 *)leftAmpTable  + offset);
+				int rightCur = *(int16 *)((uint8 *)rightAmpTable + offset);
 
-				mixBufCurCell[3] += (*(int16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i]     & (int16)0xFFF7) >> 3) + 4096)
-								   + *(int16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i + 1] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
+				mixBufCurCell[0] += leftCur;
+				mixBufCurCell[1] += rightCur;
+				mixBufCurCell[2] += (leftCur  + *(int16 *)((uint8 *)leftAmpTable  + offNext)) >> 1;
+				mixBufCurCell[3] += (rightCur + *(int16 *)((uint8 *)rightAmpTable + offNext)) >> 1;
 				mixBufCurCell += 4;
 			}
 		}
-		mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[2] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[3] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
+		offset = (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096;
+		mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + offset);
+		mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + offset);
+		mixBufCurCell[2] += *(uint16 *)((uint8 *)leftAmpTable  + offset);
+		mixBufCurCell[3] += *(uint16 *)((uint8 *)rightAmpTable + offset);
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_tmp = (uint16 *)srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096);
+				offset = (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096;
+				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + offset);
+				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + offset);
 				srcBuf_tmp += 2;
 				mixBufCurCell += 2;
 			}
@@ -901,8 +927,9 @@ void IMuseDigiInternalMixer::mixBits16ConvertToStereo(uint8 *srcBuf, int32 inFra
 		if (feedSize) {
 			srcBuf_tmp = (uint16 *)srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096);
+				offset = (((int16)srcBuf_tmp[0] & (int16)0xFFF7) >> 3) + 4096;
+				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + offset);
+				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + offset);
 
 				for (residualLength += inFrameCount; residualLength > 0; ++srcBuf_tmp)
 					residualLength -= feedSize;
@@ -933,18 +960,24 @@ void IMuseDigiInternalMixer::mixBits8Stereo(uint8 *srcBuf, int32 inFrameCount, i
 		srcBuf_ptr = srcBuf;
 		if (inFrameCount - 1 != 0) {
 			for (int i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += *((uint16 *)ampTable + srcBuf_ptr[0]);
-				mixBufCurCell[1] += *((uint16 *)ampTable + srcBuf_ptr[1]);
-				mixBufCurCell[2] += (*((int16 *)ampTable + srcBuf_ptr[0]) + *((int16 *)ampTable + srcBuf_ptr[2])) >> 1;
-				mixBufCurCell[3] += (*((int16 *)ampTable + srcBuf_ptr[1]) + *((int16 *)ampTable + srcBuf_ptr[3])) >> 1;
+				int leftCur  = *((int16 *)ampTable + srcBuf_ptr[0]);
+				int rightCur = *((int16 *)ampTable + srcBuf_ptr[1]);
+				mixBufCurCell[0] += leftCur;
+				mixBufCurCell[1] += rightCur;
+				mixBufCurCell[2] += (leftCur  + *((int16 *)ampTable + srcBuf_ptr[2])) >> 1;
+				mixBufCurCell[3] += (rightCur + *((int16 *)ampTable + srcBuf_ptr[3])) >> 1;
 				mixBufCurCell += 4;
 				srcBuf_ptr += 2;
 			}
 		}
-		mixBufCurCell[0] += *((uint16 *)ampTable + srcBuf_ptr[0]);
-		mixBufCurCell[1] += *((uint16 *)ampTable + srcBuf_ptr[1]);
-		mixBufCurCell[2] += *((uint16 *)ampTable + srcBuf_ptr[0]);
-		mixBufCurCell[3] += *((uint16 *)ampTable + srcBuf_ptr[1]);
+		{
+			int leftCur  = *((uint16 *)ampTable + srcBuf_ptr[0]);
+			int rightCur = *((uint16 *)ampTable + srcBuf_ptr[1]);
+			mixBufCurCell[0] += leftCur;
+			mixBufCurCell[1] += rightCur;
+			mixBufCurCell[2] += leftCur;
+			mixBufCurCell[3] += rightCur;
+		}
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = srcBuf;
@@ -992,21 +1025,25 @@ void IMuseDigiInternalMixer::mixBits12Stereo(uint8 *srcBuf, int32 inFrameCount,
 		srcBuf_ptr = srcBuf;
 		if (inFrameCount - 1 != 0) {
 			for (int i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] +=  *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-				mixBufCurCell[1] +=  *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-				mixBufCurCell[2] += (*((int16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)))
-								   + *((int16  *)ampTable + (srcBuf_ptr[3] | ((srcBuf_ptr[4] & 0xF)  << 8)))) >> 1;
-				mixBufCurCell[3] += (*((int16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)))
-								   + *((int16  *)ampTable + (srcBuf_ptr[5] | ((srcBuf_ptr[4] & 0xF0) << 4)))) >> 1;
+				int leftCur  = *((int16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
+				int rightCur = *((int16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+				mixBufCurCell[0] += leftCur;
+				mixBufCurCell[1] += rightCur;
+				mixBufCurCell[2] += (leftCur  + *((int16 *)ampTable + (srcBuf_ptr[3] | ((srcBuf_ptr[4] & 0xF)  << 8)))) >> 1;
+				mixBufCurCell[3] += (rightCur + *((int16 *)ampTable + (srcBuf_ptr[5] | ((srcBuf_ptr[4] & 0xF0) << 4)))) >> 1;
 
 				srcBuf_ptr += 3;
 				mixBufCurCell += 4;
 			}
 		}
-		mixBufCurCell[0] += *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-		mixBufCurCell[1] += *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
-		mixBufCurCell[2] += *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
-		mixBufCurCell[3] += *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+		{
+			int leftCur  = *((uint16 *)ampTable + (srcBuf_ptr[0] | ((srcBuf_ptr[1] & 0xF)  << 8)));
+			int rightCur = *((uint16 *)ampTable + (srcBuf_ptr[2] | ((srcBuf_ptr[1] & 0xF0) << 4)));
+			mixBufCurCell[0] += leftCur;
+			mixBufCurCell[1] += rightCur;
+			mixBufCurCell[2] += leftCur;
+			mixBufCurCell[3] += rightCur;
+		}
 	} else if (2 * feedSize == inFrameCount) {
 		if (feedSize) {
 			srcBuf_ptr = srcBuf;
@@ -1058,10 +1095,11 @@ void IMuseDigiInternalMixer::mixBits16Stereo(uint8 *srcBuf, int32 inFrameCount,
 
 		if (inFrameCount - 1 != 0) {
 			for (int i = 0; i < inFrameCount - 1; i++) {
-				mixBufCurCell[0] += *(uint16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
+				int leftCur = *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
+				mixBufCurCell[0] += leftCur;
 				mixBufCurCell[1] += *(uint16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
 
-				mixBufCurCell[2] += (*(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096)
+				mixBufCurCell[2] += (leftCur
 								   + *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[2] & (int16)0xFFF7) >> 3) + 4096)) >> 1;
 
 				mixBufCurCell[4] += (*(int16 *)((int8 *)ampTable + (((int16)(((uint8 *)srcBuf_ptr)[2] | (((uint8 *)srcBuf_ptr)[3] << 8)) & (int16)0xFFF7) >> 3) + 4096)
@@ -1070,10 +1108,14 @@ void IMuseDigiInternalMixer::mixBits16Stereo(uint8 *srcBuf, int32 inFrameCount,
 				srcBuf_ptr += 2;
 			}
 		}
-		mixBufCurCell[0] += *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[1] += *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[2] += *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
-		mixBufCurCell[3] += *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
+		{
+			int leftCur  = *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
+			int rightCur = *(int16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
+			mixBufCurCell[0] += leftCur;
+			mixBufCurCell[1] += rightCur;
+			mixBufCurCell[2] += leftCur;
+			mixBufCurCell[3] += rightCur;
+		}
 	} else {
 		if (2 * feedSize == inFrameCount) {
 			if (feedSize) {
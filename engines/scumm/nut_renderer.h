@@ -40,11 +40,13 @@ protected:
 
 	ScummEngine *_vm;
 	int _numChars;
-	int _maxCharSize;
 	int _fontHeight;
-	byte *_charBuffer;
 	byte *_decodedData;
 	byte *_paletteMap;
+	// Lazily filled cache of unpacked glyphs, so that text which is
+	// redrawn every frame (e.g. v7/v8 subtitles and verbs) does not pay
+	// the bit-unpacking cost over and over. See unpackChar().
+	byte *_unpackedChars[256];
 	byte _bpp;
 	byte _palette[16];
 	struct {
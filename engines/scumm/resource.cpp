@@ -21,6 +21,7 @@
  */
 
 #include "common/md5.h"
+#include "common/memtrack.h"
 #include "common/str.h"
 #include "common/memstream.h"
 #include "common/macresman.h"
@@ -846,6 +847,7 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	}
 
 	_allocatedSize += size;
+	MemTrackMan.addUsage(_memTag, size);
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
@@ -888,10 +890,13 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_memTag = MemTrackMan.registerTag("scumm.resources");
+	MemTrackMan.setBudgetCallback(_memTag, memBudgetExceeded, this);
 }
 
 ResourceManager::~ResourceManager() {
 	freeResources();
+	MemTrackMan.setBudgetCallback(_memTag, nullptr, nullptr);
 }
 
 void ResourceManager::setHeapThreshold(int min, int max) {
@@ -914,6 +919,7 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 	if (ptr != nullptr) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
+		MemTrackMan.subUsage(_memTag, _types[type][idx]._size);
 		_types[type][idx].nuke();
 	}
 }
@@ -1095,6 +1101,16 @@ void ResourceManager::expireResources(uint32 size) {
 	debugC(DEBUG_RESOURCE, "Expired resources, mem %d -> %d", oldAllocatedSize, _allocatedSize);
 }
 
+void ResourceManager::memBudgetExceeded(void *refCon, uint64 usage, uint64 budget) {
+	ResourceManager *res = (ResourceManager *)refCon;
+
+	// Pull the expiry thresholds down to the external budget, then let
+	// the regular expiry logic do the eviction
+	if (res->_maxHeapThreshold > budget)
+		res->setHeapThreshold(MIN<uint32>(res->_minHeapThreshold, budget), budget);
+	res->expireResources(0);
+}
+
 void ResourceManager::freeResources() {
 	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 		ResId idx = _types[type].size();
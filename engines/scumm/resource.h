@@ -175,6 +175,7 @@ protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
+	int _memTag;
 
 public:
 	ResourceManager(ScummEngine *vm);
@@ -229,6 +230,12 @@ public:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+
+	/**
+	 * Invoked by the memory tracker when an externally assigned budget
+	 * is exceeded; pulls the expiry thresholds down to the budget.
+	 */
+	static void memBudgetExceeded(void *refCon, uint64 usage, uint64 budget);
 };
 
 } // End of namespace Scumm
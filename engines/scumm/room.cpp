@@ -39,6 +39,34 @@ namespace Scumm {
  * Start a 'scene' by loading the specified room with the given main actor.
  * The actor is placed next to the object indicated by objectNr.
  */
+void ScummEngine::queueRoomPrefetch(int room) {
+	if (room <= 0 || room >= _numRooms)
+		return;
+	if (_roomPrefetchCount >= ARRAYSIZE(_roomPrefetchQueue))
+		return;
+
+	_roomPrefetchQueue[_roomPrefetchCount++] = room;
+}
+
+void ScummEngine::prefetchQueuedRooms() {
+	if (_roomPrefetchCount == 0)
+		return;
+
+	int room = _roomPrefetchQueue[--_roomPrefetchCount];
+
+	if (room == _currentRoom)
+		return;
+
+	// Already resident? Then there is nothing to read ahead.
+	ResId idx = room;
+	if (idx > 0x7F && _game.version < 7 && _game.heversion <= 71)
+		idx = _resourceMapper[idx & 0x7F];
+	if (idx < _res->_types[rtRoom].size() && _res->_types[rtRoom][idx]._address)
+		return;
+
+	ensureResourceLoaded(rtRoom, room);
+}
+
 void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 	int i, where;
 
@@ -131,6 +159,12 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 	if (room != 0)
 		ensureResourceLoaded(rtRoom, room);
 
+	// Queue the neighboring rooms for read-ahead; they are pulled into the
+	// resource cache one per frame from scummLoop() while this room runs.
+	_roomPrefetchCount = 0;
+	queueRoomPrefetch(room + 1);
+	queueRoomPrefetch(room - 1);
+
 	clearRoomObjects();
 
 	if (_currentRoom == 0) {
@@ -479,6 +513,7 @@ void ScummEngine::resetRoomSubBlocks() {
 	//
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
 
+	invalidateNextBoxCache();
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
 	if (_game.features & GF_SMALL_HEADER) {
@@ -737,6 +772,7 @@ void ScummEngine_v3old::resetRoomSubBlocks() {
 	//
 	// Load box data
 	//
+	invalidateNextBoxCache();
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
 
@@ -1312,7 +1312,7 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	// Save/load palette data
 	// Don't save 16 bit palette in FM-Towns and PCE games, since it gets regenerated afterwards anyway.
 	if (_16BitPalette && !(_game.platform == Common::kPlatformFMTowns && s.getVersion() < VER(82)) && !((_game.platform == Common::kPlatformFMTowns || _game.platform == Common::kPlatformPCEngine) && s.getVersion() > VER(87))) {
-		s.syncArray(_16BitPalette, 512, Common::Serializer::Uint16LE);
+		s.syncArrayAsUint16LE(_16BitPalette, 512);
 	}
 
 
@@ -1411,7 +1411,7 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	//
 	// Save/load more global object state
 	//
-	s.syncArray(_classData, _numGlobalObjects, Common::Serializer::Uint32LE);
+	s.syncArrayAsUint32LE(_classData, _numGlobalObjects);
 
 
 	//
@@ -1420,13 +1420,13 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	var120Backup = _scummVars[120];
 	var98Backup = _scummVars[98];
 
-	s.syncArray(_roomVars, _numRoomVariables, Common::Serializer::Sint32LE, VER(38));
+	s.syncArrayAsSint32LE(_roomVars, _numRoomVariables, VER(38));
 
 	// The variables grew from 16 to 32 bit.
 	if (s.getVersion() < VER(15))
-		s.syncArray(_scummVars, _numVariables, Common::Serializer::Sint16LE);
+		s.syncArrayAsSint16LE(_scummVars, _numVariables);
 	else
-		s.syncArray(_scummVars, _numVariables, Common::Serializer::Sint32LE);
+		s.syncArrayAsSint32LE(_scummVars, _numVariables);
 
 	if (_game.id == GID_TENTACLE)	// Maybe misplaced, but that's the main idea
 		_scummVars[120] = var120Backup;
@@ -3088,6 +3088,7 @@ void ScummEngine_v6::o6_setBoxSet() {
 		error("ScummEngine_v6::o6_setBoxSet: Can't find mboxes for set %d", arg);
 
 	mboxSize = READ_BE_UINT32(boxm + 4) - 8;
+	invalidateNextBoxCache();
 	matrix = _res->createResource(rtMatrix, 1, mboxSize);
 
 	assert(matrix);
@@ -25,6 +25,7 @@
 #include "common/macresman.h"
 #include "common/md5.h"
 #include "common/events.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/translation.h"
 
@@ -192,6 +193,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_numUnk = 0;
 	_curPalIndex = 0;
 	_currentRoom = 0;
+	memset(_roomPrefetchQueue, 0, sizeof(_roomPrefetchQueue));
+	_roomPrefetchCount = 0;
 	_egoPositioned = false;
 	_mouseAndKeyboardStat = 0;
 	_leftBtnPressed = 0;
@@ -309,6 +312,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
+	_nextBoxCache = nullptr;
+	_nextBoxCacheNum = 0;
 	_charset = nullptr;
 	_charsetColor = 0;
 	memset(_charsetColorMap, 0, sizeof(_charsetColorMap));
@@ -686,6 +691,7 @@ ScummEngine::~ScummEngine() {
 	free(_newNames);
 	free(_classData);
 	free(_arraySlot);
+	free(_nextBoxCache);
 
 	free(_compositeBuf);
 	free(_herculesBuf);
@@ -2488,6 +2494,8 @@ void ScummEngine_v0::scummLoop(int delta) {
 }
 
 void ScummEngine::scummLoop(int delta) {
+	PROFILER_SCOPE("scumm.scummLoop");
+
 	if (_game.version >= 3) {
 		VAR(VAR_TMR_1) += delta;
 		VAR(VAR_TMR_2) += delta;
@@ -2639,6 +2647,9 @@ load_game:
 
 	_res->increaseExpireCounter();
 
+	// Pull one queued neighbor room into the resource cache per frame
+	prefetchQueuedRooms();
+
 	animateCursor();
 
 	/* show or hide mouse */
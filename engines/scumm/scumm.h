@@ -573,6 +573,16 @@ protected:
 	void startScene(int room, Actor *a, int b);
 	bool startManiac();
 
+	// Room prefetching: when a scene starts, the numerically adjacent
+	// rooms are queued and loaded into the resource cache one per frame
+	// from scummLoop(), so a later room transition finds its data already
+	// in memory instead of hitting the disk during the fade.
+	void queueRoomPrefetch(int room);
+	void prefetchQueuedRooms();
+
+	int _roomPrefetchQueue[2];
+	int _roomPrefetchCount;
+
 public:
 	void runScript(int script, bool freezeResistant, bool recursive, int *lvarptr, int cycle = 0);
 	void stopScript(int script);
@@ -1075,6 +1085,7 @@ public:
 	byte *getBoxConnectionBase(int box);
 
 	int getNextBox(byte from, byte to);
+	void invalidateNextBoxCache();
 
 	void setBoxFlags(int box, int val);
 	void setBoxScale(int box, int b);
@@ -1092,6 +1103,11 @@ public:
 	int getScaleFromSlot(int slot, int x, int y);
 
 protected:
+	// Memoized next-hop answers for getNextBox(). Filled lazily from the
+	// box matrix and thrown away whenever the matrix resource is replaced.
+	int16 *_nextBoxCache;
+	int _nextBoxCacheNum;
+
 	// Scaling slots/items
 	struct ScaleSlot {
 		int x1, y1, scale1;
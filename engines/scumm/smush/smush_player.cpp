@@ -22,6 +22,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 #include "common/rect.h"
@@ -233,6 +234,13 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital) {
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
 
+	_prefetchBuffer = NULL;
+	_prefetchCapacity = 0;
+	_prefetchType = 0;
+	_prefetchSize = 0;
+	_havePrefetch = false;
+	_prefetchEof = false;
+
 	_seekPos = -1;
 
 	_skipNext = false;
@@ -270,6 +278,8 @@ void SmushPlayer::init(int32 speed) {
 	_frame = 0;
 	_speed = speed;
 	_endOfFile = false;
+	_havePrefetch = false;
+	_prefetchEof = false;
 
 	_vm->_smushVideoShouldFinish = false;
 	_vm->_smushActive = true;
@@ -314,6 +324,12 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = NULL;
 
+	free(_prefetchBuffer);
+	_prefetchBuffer = NULL;
+	_prefetchCapacity = 0;
+	_havePrefetch = false;
+	_prefetchEof = false;
+
 	_IACTstream = NULL;
 
 	_vm->_smushActive = false;
@@ -1063,9 +1079,42 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+void SmushPlayer::prefetchNextChunk() {
+	// Demux stage of the playback pipeline: pull the next top-level chunk
+	// into memory while play() is waiting for the frame deadline, so that
+	// parseNextFrame() can decode without blocking on disk I/O.
+	if (_havePrefetch || _endOfFile || _seekPos >= 0 || !_base)
+		return;
+
+	_prefetchType = _base->readUint32BE();
+	_prefetchSize = _base->readUint32BE();
+
+	if (_base->pos() >= (int32)_baseSize) {
+		// Don't raise _endOfFile here: the last frame still has to stay
+		// on screen for its full duration. parseNextFrame() raises it
+		// once this chunk is consumed.
+		_prefetchEof = true;
+		_havePrefetch = true;
+		return;
+	}
+
+	if ((uint32)_prefetchSize > _prefetchCapacity) {
+		free(_prefetchBuffer);
+		_prefetchBuffer = (byte *)malloc(_prefetchSize);
+		assert(_prefetchBuffer);
+		_prefetchCapacity = _prefetchSize;
+	}
+	_base->read(_prefetchBuffer, _prefetchSize);
+	_havePrefetch = true;
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		// Seeking invalidates any chunk read ahead of the old position.
+		_havePrefetch = false;
+		_prefetchEof = false;
+
 		if (_smixer)
 			_smixer->stop();
 
@@ -1111,30 +1160,59 @@ void SmushPlayer::parseNextFrame() {
 
 	assert(_base);
 
-	const uint32 subType = _base->readUint32BE();
-	const int32 subSize = _base->readUint32BE();
-	const int32 subOffset = _base->pos();
+	if (_havePrefetch) {
+		// Consume the chunk already read ahead by prefetchNextChunk().
+		_havePrefetch = false;
 
-	if (_base->pos() >= (int32)_baseSize) {
-		_vm->_smushVideoShouldFinish = true;
-		_endOfFile = true;
-		return;
-	}
+		if (_prefetchEof) {
+			_vm->_smushVideoShouldFinish = true;
+			_endOfFile = true;
+			return;
+		}
 
-	debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+		const uint32 subType = _prefetchType;
+		const int32 subSize = _prefetchSize;
+		const int32 subOffset = _base->pos() - subSize;
 
-	switch (subType) {
-	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
-		handleAnimHeader(subSize, *_base);
-		break;
-	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
-		break;
-	default:
-		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
-	}
+		debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+
+		Common::MemoryReadStream chunk(_prefetchBuffer, subSize);
+		switch (subType) {
+		case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
+			handleAnimHeader(subSize, chunk);
+			break;
+		case MKTAG('F','R','M','E'):
+			handleFrame(subSize, chunk);
+			break;
+		default:
+			error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
+		}
+	} else {
+		const uint32 subType = _base->readUint32BE();
+		const int32 subSize = _base->readUint32BE();
+		const int32 subOffset = _base->pos();
+
+		if (_base->pos() >= (int32)_baseSize) {
+			_vm->_smushVideoShouldFinish = true;
+			_endOfFile = true;
+			return;
+		}
+
+		debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+
+		switch (subType) {
+		case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
+			handleAnimHeader(subSize, *_base);
+			break;
+		case MKTAG('F','R','M','E'):
+			handleFrame(subSize, *_base);
+			break;
+		default:
+			error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
+		}
 
-	_base->seek(subOffset + subSize, SEEK_SET);
+		_base->seek(subOffset + subSize, SEEK_SET);
+	}
 
 	if (_insanity)
 		_vm->_sound->processSound();
@@ -1346,6 +1424,9 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_IACTpos = 0;
 			break;
 		}
+		// Idle part of the frame: run the demux stage now so the next
+		// chunk is already in memory when its deadline comes.
+		prefetchNextChunk();
 		_vm->_system->delayMillis(10);
 	}
 
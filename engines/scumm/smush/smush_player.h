@@ -58,6 +58,16 @@ private:
 	byte *_frameBuffer;
 	byte *_specialBuffer;
 
+	// Read-ahead state for the next top-level ANIM chunk. The chunk is
+	// pulled from disk during the idle part of play(), so that decoding
+	// at the frame deadline starts from memory. See prefetchNextChunk().
+	byte *_prefetchBuffer;
+	uint32 _prefetchCapacity;
+	uint32 _prefetchType;
+	int32 _prefetchSize;
+	bool _havePrefetch;
+	bool _prefetchEof;
+
 	Common::String _seekFile;
 	uint32 _startFrame;
 	uint32 _startTime;
@@ -117,6 +127,7 @@ protected:
 private:
 	SmushFont *getFont(int font);
 	void parseNextFrame();
+	void prefetchNextChunk();
 	void init(int32 spped);
 	void setupAnim(const char *file);
 	void updateScreen();
@@ -148,21 +148,41 @@ void Screen::randomTransition() {
 void Screen::verticalTransition() {
 	Events &events = *_vm->_events;
 
+	// The 3DO screen doubles pixels in its blit overrides, so it keeps going
+	// through SHblitFrom; for the 8-bit games the column spans are copied
+	// directly, with a single dirty rect per pass instead of one per column
+	bool directCopy = !IS_3DO;
+
 	byte table[640];
 	Common::fill(&table[0], &table[640], 0);
 
 	for (int yp = 0; yp < this->height(); ++yp) {
+		int firstRow = this->height(), lastRow = 0;
+
 		for (int xp = 0; xp < this->width(); ++xp) {
 			int temp = (table[xp] >= (this->height() - 3)) ? this->height() - table[xp] :
 				_vm->getRandomNumber(3) + 1;
 
 			if (temp) {
-				SHblitFrom(_backBuffer1, Common::Point(xp, table[xp]),
-					Common::Rect(xp, table[xp], xp + 1, table[xp] + temp));
+				if (directCopy) {
+					const byte *srcP = (const byte *)_backBuffer1.getBasePtr(xp, table[xp]);
+					byte *destP = (byte *)getBasePtr(xp, table[xp]);
+					for (int idx = 0; idx < temp; ++idx, srcP += _backBuffer1.pitch, destP += this->pitch)
+						*destP = *srcP;
+
+					firstRow = MIN(firstRow, (int)table[xp]);
+					lastRow = MAX(lastRow, (int)table[xp] + temp);
+				} else {
+					SHblitFrom(_backBuffer1, Common::Point(xp, table[xp]),
+						Common::Rect(xp, table[xp], xp + 1, table[xp] + temp));
+				}
 				table[xp] += temp;
 			}
 		}
 
+		if (directCopy && lastRow > firstRow)
+			addDirtyRect(Common::Rect(0, firstRow, this->width(), lastRow));
+
 		events.delay(10);
 	}
 }
@@ -63,6 +63,14 @@ void BaseSurface::SHtransBlitFrom(const ImageFrame &src, const Common::Point &pt
 
 void BaseSurface::SHtransBlitFrom(const Graphics::Surface &src, const Common::Point &pt,
 		bool flipped, int overrideColor, int scaleVal) {
+	// The bulk of the shape drawing is unscaled and unflipped 8-bit frames,
+	// which don't need the generic per-pixel transparency walk
+	if (scaleVal == SCALE_THRESHOLD && !flipped && !overrideColor &&
+			src.format.bytesPerPixel == 1 && this->format.bytesPerPixel == 1) {
+		transBlitRuns(src, pt);
+		return;
+	}
+
 	Common::Rect srcRect(0, 0, src.w, src.h);
 	Common::Rect destRect(pt.x, pt.y, pt.x + src.w * SCALE_THRESHOLD / scaleVal,
 		pt.y + src.h * SCALE_THRESHOLD / scaleVal);
@@ -71,5 +79,51 @@ void BaseSurface::SHtransBlitFrom(const Graphics::Surface &src, const Common::Po
 		flipped, overrideColor);
 }
 
+void BaseSurface::transBlitRuns(const Graphics::Surface &src, const Common::Point &pt) {
+	Common::Rect srcRect(0, 0, src.w, src.h);
+	Common::Rect destRect(pt.x, pt.y, pt.x + src.w, pt.y + src.h);
+
+	// Clip the blit to the surface area
+	if (destRect.left < 0) {
+		srcRect.left -= destRect.left;
+		destRect.left = 0;
+	}
+	if (destRect.top < 0) {
+		srcRect.top -= destRect.top;
+		destRect.top = 0;
+	}
+	if (destRect.right > this->w) {
+		srcRect.right -= destRect.right - this->w;
+		destRect.right = this->w;
+	}
+	if (destRect.bottom > this->h) {
+		srcRect.bottom -= destRect.bottom - this->h;
+		destRect.bottom = this->h;
+	}
+	if (!srcRect.isValidRect() || destRect.isEmpty())
+		return;
+
+	for (int y = 0; y < destRect.height(); ++y) {
+		const byte *srcRow = (const byte *)src.getBasePtr(srcRect.left, srcRect.top + y);
+		byte *destRow = (byte *)getBasePtr(destRect.left, destRect.top + y);
+		int width = destRect.width();
+
+		for (int x = 0; x < width; ) {
+			// Skip over the transparent run
+			while (x < width && srcRow[x] == TRANSPARENCY)
+				++x;
+
+			// Find the extent of the opaque run and copy it in one go
+			int runStart = x;
+			while (x < width && srcRow[x] != TRANSPARENCY)
+				++x;
+			if (x > runStart)
+				memcpy(destRow + runStart, srcRow + runStart, x - runStart);
+		}
+	}
+
+	addDirtyRect(destRect);
+}
+
 
 } // End of namespace Sherlock
@@ -85,6 +85,12 @@ public:
 	virtual void SHtransBlitFrom(const Graphics::Surface &src, const Common::Point &pt,
 		bool flipped = false, int overrideColor = 0, int scaleVal = SCALE_THRESHOLD);
 
+	/**
+	 * Draws an unscaled, unflipped 8-bit frame by copying the opaque runs of
+	 * each row, so transparent gaps are skipped instead of tested pixel by pixel
+	 */
+	void transBlitRuns(const Graphics::Surface &src, const Common::Point &pt);
+
 	/**
 	 * Fill a given area of the surface with a given color
 	 */
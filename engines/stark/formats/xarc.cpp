@@ -26,6 +26,7 @@
 #include "engines/stark/formats/xarc.h"
 #include "engines/stark/debug.h"
 
+#include "common/bufferedstream.h"
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/substream.h"
@@ -209,14 +210,14 @@ Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMem
 		return NULL;
 	}
 
-	// Return the substream that contains the archive member
+	// Return the substream that contains the archive member.
+	// The XRC importer and the asset loaders consume these streams with many
+	// small reads, so buffer them to avoid hitting the file (possibly on a
+	// network share) for each read.
 	uint32 offset = member->getOffset();
 	uint32 length = member->getLength();
-	return new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
-
-	// Different approach: keep the archive open and read full resources to memory
-	//f.seek(member->getOffset());
-	//return f.readStream(member->getLength());
+	Common::SeekableReadStream *stream = new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
+	return Common::wrapBufferedSeekableReadStream(stream, 4096, DisposeAfterUse::YES);
 }
 
 } // End of namespace Formats
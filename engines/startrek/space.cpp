@@ -87,13 +87,17 @@ void StarTrekEngine::drawStarfield() {
 	int16 yvar = var2a / 2;
 	int16 var8 = _starfieldPointDivisor << 3;
 
-	Common::MemoryReadStreamEndian *file = _resource->loadFile("stars.shp");
+	// The star shapes are decoded once and kept; this used to reload
+	// stars.shp and re-decode one bitmap per star on every frame
+	if (_starShapeBitmaps[0] == nullptr) {
+		Common::MemoryReadStreamEndian *file = _resource->loadFile("stars.shp");
+		for (int i = 0; i < NUM_STARS; i++)
+			_starShapeBitmaps[i] = new Bitmap(file, false);
+		delete file;
+	}
 
 	for (int i = 0; i < NUM_STARS; i++) {
 		Star *star = &_starList[i];
-		if ((i & 0xf) == 0) {
-			file->seek(0, SEEK_SET);
-		}
 
 		if (!star->active) {
 			int16 var4 = getRandomWord() / var28 - xvar;
@@ -112,30 +116,17 @@ void StarTrekEngine::drawStarfield() {
 			int16 x = _starfieldXVar1 + scaleSpacePosition(point2.x, point2.z);
 			int16 y = _starfieldYVar1 - scaleSpacePosition(point2.y, point2.z);
 
-			int fileOffset = file->pos();
-			file->readUint32();
-			int16 width = file->readUint16();
-			int16 height = file->readUint16();
+			Bitmap *bitmap = _starShapeBitmaps[i & 0xf];
 
-			Common::Rect starRect(x, y, x + width, y + height);
+			Common::Rect starRect(x, y, x + bitmap->width, y + bitmap->height);
 			Common::Rect drawRect = _starfieldRect.findIntersectingRect(starRect);
 
-			file->seek(fileOffset, SEEK_SET);
-
-			Bitmap *bitmap = new Bitmap(file, false);
 			if (!drawRect.isEmpty())
 				_gfx->drawBitmapToBackground(starRect, drawRect, bitmap);
-			delete bitmap;
 		} else {
 			star->active = false;
-
-			file->readUint32();
-			int16 offset2 = file->readUint16() * file->readUint16();
-			file->seek(file->pos() + offset2, SEEK_SET);
 		}
 	}
-
-	delete file;
 }
 
 /**
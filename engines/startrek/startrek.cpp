@@ -69,6 +69,7 @@ StarTrekEngine::StarTrekEngine(OSystem *syst, const StarTrekGameDescription *gam
 	_resource = nullptr;
 
 	memset(_actionOnWalkCompletionInUse, 0, sizeof(_actionOnWalkCompletionInUse));
+	memset(_starShapeBitmaps, 0, sizeof(_starShapeBitmaps));
 
 	_clockTicks = 0;
 
@@ -133,6 +134,9 @@ StarTrekEngine::~StarTrekEngine() {
 	delete _activeMenu->nextMenu;
 	delete _activeMenu;
 
+	for (int i = 0; i < NUM_STARS; i++)
+		delete _starShapeBitmaps[i];
+
 	delete _gfx;
 	delete _sound;
 	delete _resource;
@@ -776,6 +776,7 @@ public:
 	// Pseudo-3D / starfield stuff
 	Sprite _starfieldSprite;
 	Star _starList[NUM_STARS];
+	Bitmap *_starShapeBitmaps[NUM_STARS]; // Star shapes from stars.shp, decoded on first use
 	Point3 _starfieldPosition;
 	int32 _starfieldPointDivisor;
 	int16 _starfieldXVar1, _starfieldYVar1;
@@ -452,7 +452,8 @@ void Screen::renderImage(int section) {
 
 bool Screen::setCurrentImage(int filenumber) {
 	_currentImage = _resMan->getImage(filenumber);
-	_vm->_system->getPaletteManager()->setPalette(_currentImage->getPalette(), 16, 239);
+	// paletteBrightness() rebuilds colors 16 - 254 from the image palette, so
+	// there is no need to push the unscaled palette first
 	paletteBrightness();
 
 	return true;
@@ -636,17 +637,20 @@ void Screen::initPalette() {
 void Screen::paletteBrightness() {
 	byte palette[768];
 
-	_vm->_system->getPaletteManager()->grabPalette(palette, 0, 255);
+	// Scale the viewport colors from the current image palette. Without one,
+	// the already set palette has to be grabbed back and scaled in place;
+	// with one, every entry gets rewritten anyway, so the grab is skipped.
+	const byte *imagePalette;
+	if (_currentImage && _currentImage->getPalette()) {
+		imagePalette = _currentImage->getPalette();
+	} else {
+		_vm->_system->getPaletteManager()->grabPalette(palette, 0, 255);
+		imagePalette = palette + 48;
+	}
 	for (uint i = 0; i < 48; ++i) {
 		palette[i] = (initVGAPalette[i] * _guiBrightness) >> 8;
 	}
 	for (uint i = 0; i < 717; ++i) {
-		const byte *imagePalette;
-		if (_currentImage && _currentImage->getPalette()) {
-			imagePalette = _currentImage->getPalette();
-		} else {
-			imagePalette = palette + 48;
-		}
 		palette[i + 48] = (imagePalette[i] * _viewportBrightness) >> 8;
 	}
 	_vm->_system->getPaletteManager()->setPalette(palette, 0, 255);
@@ -311,6 +311,9 @@ VectorImage::~VectorImage() {
 				free(_elements[j].getPathInfo(i).getVec());
 
 	free(_pixelData);
+
+	for (Common::List<CachedRender>::iterator it = _renderCache.begin(); it != _renderCache.end(); ++it)
+		free(it->pixelData);
 }
 
 
@@ -608,32 +611,56 @@ bool VectorImage::setContent(const byte *pixeldata, uint size, uint offset, uint
 	return 0;
 }
 
+const byte *VectorImage::getRenderedData(int width, int height) {
+	// Check the per-image cache first; a hit is moved to the front so the
+	// least recently used size is evicted when the cache is full.
+	for (Common::List<CachedRender>::iterator it = _renderCache.begin(); it != _renderCache.end(); ++it) {
+		if (it->width == width && it->height == height) {
+			if (it != _renderCache.begin()) {
+				CachedRender entry = *it;
+				_renderCache.erase(it);
+				_renderCache.push_front(entry);
+			}
+			return _renderCache.front().pixelData;
+		}
+	}
+
+	render(width, height);
+
+	// Hand the rasterization over to the cache
+	CachedRender entry;
+	entry.width = width;
+	entry.height = height;
+	entry.pixelData = _pixelData;
+	_pixelData = nullptr;
+	_renderCache.push_front(entry);
+
+	if (_renderCache.size() > kMaxCachedRenders) {
+		free(_renderCache.back().pixelData);
+		_renderCache.pop_back();
+	}
+
+	return _renderCache.front().pixelData;
+}
+
 bool VectorImage::blit(int posX, int posY,
 					   int flipping,
 					   Common::Rect *pPartRect,
 					   uint color,
 					   int width, int height,
 					   RectangleList *updateRects) {
-	static VectorImage *oldThis = 0;
-	static int              oldWidth = -2;
-	static int              oldHeight = -2;
-
 	// If width or height to 0, nothing needs to be shown.
 	if (width == 0 || height == 0)
 		return true;
 
-	// Determine if the old image in the cache can not be reused and must be recalculated
-	if (!(oldThis == this && oldWidth == width && oldHeight == height)) {
-		render(width, height);
-
-		oldThis = this;
-		oldHeight = height;
-		oldWidth = width;
-	}
+	// Rasterizations are cached per image and size, so alternating between
+	// several vector images (e.g. the main menu buttons) no longer
+	// re-tessellates each of them every frame.
+	const byte *pixelData = getRenderedData(width, height);
 
 	RenderedImage *rend = new RenderedImage();
 
-	rend->replaceContent(_pixelData, width, height);
+	rend->replaceContent(const_cast<byte *>(pixelData), width, height);
 	rend->blit(posX, posY, flipping, pPartRect, color, width, height, updateRects);
 
 	delete rend;
@@ -38,6 +38,7 @@
 
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/image/image.h"
+#include "common/list.h"
 #include "common/rect.h"
 
 #include "art.h"
@@ -218,6 +219,24 @@ private:
 	bool parseDefineShape(uint shapeType, SWFBitStream &bs);
 	bool parseStyles(uint shapeType, SWFBitStream &bs, uint &numFillBits, uint &numLineBits);
 
+	/**
+	 * Return the rasterized image at the given size, rendering it only if
+	 * no cached rasterization of that size exists yet. The returned buffer
+	 * is owned by the cache and stays valid until the entry is evicted.
+	 */
+	const byte *getRenderedData(int width, int height);
+
+	// A rasterization of the image at one output size. The vector data
+	// never changes after loading, so entries stay valid indefinitely.
+	struct CachedRender {
+		int width, height;
+		byte *pixelData;
+	};
+
+	enum { kMaxCachedRenders = 4 };
+
+	Common::List<CachedRender> _renderCache;
+
 	ArtBpath *storeBez(ArtBpath *bez, int lineStyle, int fillStyle0, int fillStyle1, int *bezNodes, int *bezAllocated);
 	Common::Array<VectorImageElement>    _elements;
 	Common::Rect                         _boundingBox;
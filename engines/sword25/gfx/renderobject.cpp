@@ -136,12 +136,23 @@ bool RenderObject::render(RectangleList *updateRects, const Common::Array<int> &
 
 	// Objekt zeichnen.
 	bool needRender = false;
+	bool touchesSubtree = false;
 	int index = 0;
 
 	// Only draw if the bounding box intersects any update rectangle and
 	// the object is in front of the minimum Z value.
-	for (RectangleList::iterator rectIt = updateRects->begin(); !needRender && rectIt != updateRects->end(); ++rectIt, ++index)
-		needRender = (_bbox.contains(*rectIt) || _bbox.intersects(*rectIt)) && getAbsoluteZ() >= updateRectsMinZ[index];
+	for (RectangleList::iterator rectIt = updateRects->begin(); !needRender && rectIt != updateRects->end(); ++rectIt, ++index) {
+		if (_bbox.contains(*rectIt) || _bbox.intersects(*rectIt)) {
+			touchesSubtree = true;
+			needRender = getAbsoluteZ() >= updateRectsMinZ[index];
+		}
+	}
+
+	// The bounding boxes of all children are clipped to this object's
+	// bounding box, so if no update rectangle touches it, nothing in this
+	// subtree changed and the whole branch can be skipped.
+	if (!touchesSubtree)
+		return true;
 
 	if (needRender)
 		doRender(updateRects);
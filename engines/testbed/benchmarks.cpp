@@ -0,0 +1,353 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/mixer.h"
+#include "audio/softsynth/pcspk.h"
+
+#include "common/config-manager.h"
+#include "common/fs.h"
+#include "common/profiler.h"
+#include "common/savefile.h"
+#include "common/stream.h"
+#include "common/system.h"
+
+#include "graphics/pixelformat.h"
+
+#include "testbed/benchmarks.h"
+
+namespace Testbed {
+
+namespace Benchmarks {
+
+// One result per executed benchmark; each holds the inner fields of a
+// JSON object. ExportResults assembles and writes the complete report.
+struct BenchResult {
+	Common::String name;
+	Common::String fields;
+};
+
+static Common::Array<BenchResult> benchResults;
+
+static void addResult(const Common::String &name, const Common::String &fields) {
+	// Replace an earlier result if the benchmark is run again.
+	for (uint i = 0; i < benchResults.size(); i++) {
+		if (benchResults[i].name == name) {
+			benchResults[i].fields = fields;
+			return;
+		}
+	}
+
+	BenchResult result;
+	result.name = name;
+	result.fields = fields;
+	benchResults.push_back(result);
+}
+
+TestExitStatus benchCopyRectToScreen() {
+	const int16 w = g_system->getWidth();
+	const int16 h = g_system->getHeight();
+	const uint32 bpp = g_system->getScreenFormat().bytesPerPixel;
+	const uint32 frameBytes = w * h * bpp;
+	const int iterations = 200;
+
+	// Use two frames with different content, so backend dirty region
+	// tracking can't skip the updates.
+	byte *frameA = new byte[frameBytes];
+	byte *frameB = new byte[frameBytes];
+	memset(frameA, 0x11, frameBytes);
+	memset(frameB, 0x22, frameBytes);
+
+	const uint32 start = g_system->getMillis();
+	for (int i = 0; i < iterations; i++) {
+		g_system->copyRectToScreen((i & 1) ? frameB : frameA, w * bpp, 0, 0, w, h);
+		g_system->updateScreen();
+	}
+	const uint32 millis = g_system->getMillis() - start;
+
+	delete[] frameA;
+	delete[] frameB;
+
+	double mbPerSec = millis ? ((double)frameBytes * iterations * 1000.0) / ((double)millis * 1024.0 * 1024.0) : 0.0;
+	double fps = millis ? (iterations * 1000.0) / millis : 0.0;
+
+	addResult("copy_rect_to_screen", Common::String::format(
+		"\"frames\": %d, \"millis\": %u, \"mb_per_sec\": %.2f, \"frames_per_sec\": %.2f",
+		iterations, millis, mbPerSec, fps));
+	Testsuite::logDetailedPrintf("copyRectToScreen: %d full frames in %u ms (%.2f MB/s)\n", iterations, millis, mbPerSec);
+
+	return kTestPassed;
+}
+
+TestExitStatus benchOverlayBlend() {
+	const int16 w = g_system->getOverlayWidth();
+	const int16 h = g_system->getOverlayHeight();
+	const uint32 bpp = g_system->getOverlayFormat().bytesPerPixel;
+	const uint32 frameBytes = w * h * bpp;
+	const int iterations = 100;
+
+	byte *frameA = new byte[frameBytes];
+	byte *frameB = new byte[frameBytes];
+	memset(frameA, 0x3C, frameBytes);
+	memset(frameB, 0xC3, frameBytes);
+
+	g_system->showOverlay();
+
+	const uint32 start = g_system->getMillis();
+	for (int i = 0; i < iterations; i++) {
+		g_system->copyRectToOverlay((i & 1) ? frameB : frameA, w * bpp, 0, 0, w, h);
+		g_system->updateScreen();
+	}
+	const uint32 millis = g_system->getMillis() - start;
+
+	g_system->hideOverlay();
+
+	delete[] frameA;
+	delete[] frameB;
+
+	double mbPerSec = millis ? ((double)frameBytes * iterations * 1000.0) / ((double)millis * 1024.0 * 1024.0) : 0.0;
+	double fps = millis ? (iterations * 1000.0) / millis : 0.0;
+
+	addResult("overlay_blend", Common::String::format(
+		"\"frames\": %d, \"millis\": %u, \"mb_per_sec\": %.2f, \"frames_per_sec\": %.2f",
+		iterations, millis, mbPerSec, fps));
+	Testsuite::logDetailedPrintf("Overlay blend: %d full frames in %u ms (%.2f MB/s)\n", iterations, millis, mbPerSec);
+
+	return kTestPassed;
+}
+
+TestExitStatus benchMixerHeadroom() {
+#ifdef DISABLE_PROFILER
+	Testsuite::logDetailedPrintf("Mixer benchmark needs the profiler, which is compiled out\n");
+	return kTestSkipped;
+#else
+	Audio::Mixer *mixer = g_system->getMixer();
+	const int numStreams = 8;
+	const uint32 measureMillis = 1000;
+
+	// Load the mixer with several active streams, then measure the mixer
+	// callback with the profiler probe in Audio::MixerImpl::mixCallback.
+	Audio::SoundHandle handles[numStreams];
+	for (int i = 0; i < numStreams; i++) {
+		Audio::PCSpeaker *speaker = new Audio::PCSpeaker();
+		speaker->play(Audio::PCSpeaker::kWaveFormSine, 800 + i * 100, -1);
+		mixer->playStream(Audio::Mixer::kPlainSoundType, &handles[i], speaker);
+	}
+
+	Common::Profiler &profiler = Common::Profiler::instance();
+	const bool wasEnabled = profiler.isEnabled();
+	profiler.reset();
+	profiler.setEnabled(true);
+
+	g_system->delayMillis(measureMillis);
+
+	profiler.setEnabled(wasEnabled);
+
+	for (int i = 0; i < numStreams; i++)
+		mixer->stopHandle(handles[i]);
+
+	// Find the mixer callback probe.
+	const Common::Profiler::Probe *probe = nullptr;
+	for (uint i = 0; i < profiler.getProbeCount(); i++) {
+		if (!strcmp(profiler.getProbe(i).name, "mixer.mixCallback")) {
+			probe = &profiler.getProbe(i);
+			break;
+		}
+	}
+
+	if (!probe || probe->count == 0) {
+		// No callbacks ran (e.g. the null audio backend).
+		Testsuite::logDetailedPrintf("No mixer callbacks were observed\n");
+		return kTestSkipped;
+	}
+
+	// Headroom: how much of the real-time budget per callback is left.
+	double avgMicros = (double)probe->totalMicros / probe->count;
+	double periodMicros = (double)measureMillis * 1000.0 / probe->count;
+	double headroomPercent = 100.0 * (1.0 - avgMicros / periodMicros);
+
+	addResult("mixer_callback", Common::String::format(
+		"\"streams\": %d, \"callbacks\": %u, \"avg_micros\": %.1f, \"max_micros\": %u, \"headroom_percent\": %.1f",
+		numStreams, (uint32)probe->count, avgMicros, (uint32)probe->maxMicros, headroomPercent));
+	Testsuite::logDetailedPrintf("Mixer: %u callbacks, avg %.1f us, headroom %.1f%%\n",
+		(uint32)probe->count, avgMicros, headroomPercent);
+
+	return kTestPassed;
+#endif
+}
+
+// Walks the directory tree and counts the nodes. The depth cap guards
+// against file system loops through symlinks.
+static void traverseNode(const Common::FSNode &node, int depth, uint32 &count) {
+	if (depth <= 0)
+		return;
+
+	Common::FSList children;
+	if (!node.getChildren(children, Common::FSNode::kListAll))
+		return;
+
+	for (uint i = 0; i < children.size(); i++) {
+		count++;
+		if (children[i].isDirectory())
+			traverseNode(children[i], depth - 1, count);
+	}
+}
+
+TestExitStatus benchFSTraversal() {
+	const Common::String &path = ConfMan.get("path");
+	Common::FSNode gameRoot(path);
+
+	if (!gameRoot.exists() || !gameRoot.isDirectory()) {
+		Testsuite::logDetailedPrintf("Game path should be an existing directory\n");
+		return kTestSkipped;
+	}
+
+	uint32 nodes = 0;
+	const uint32 start = g_system->getMillis();
+	traverseNode(gameRoot, 8, nodes);
+	const uint32 millis = g_system->getMillis() - start;
+
+	double nodesPerSec = millis ? (nodes * 1000.0) / millis : 0.0;
+
+	addResult("fs_traversal", Common::String::format(
+		"\"nodes\": %u, \"millis\": %u, \"nodes_per_sec\": %.0f",
+		nodes, millis, nodesPerSec));
+	Testsuite::logDetailedPrintf("FS traversal: %u nodes in %u ms\n", nodes, millis);
+
+	return kTestPassed;
+}
+
+TestExitStatus benchSaveIO() {
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	const uint32 chunkSize = 64 * 1024;
+	const uint32 numChunks = 64; // 4 MB in total
+	const char *fileName = "testbed.benchmark";
+
+	byte *chunk = new byte[chunkSize];
+	for (uint32 i = 0; i < chunkSize; i++)
+		chunk[i] = (byte)i;
+
+	// Write uncompressed, so the raw save I/O is measured rather than the
+	// compression code.
+	Common::OutSaveFile *saveFile = saveFileMan->openForSaving(fileName, false);
+	if (!saveFile) {
+		delete[] chunk;
+		Testsuite::logDetailedPrintf("Can't open save file for writing\n");
+		return kTestFailed;
+	}
+
+	const uint32 writeStart = g_system->getMillis();
+	for (uint32 i = 0; i < numChunks; i++)
+		saveFile->write(chunk, chunkSize);
+	saveFile->finalize();
+	const uint32 writeMillis = g_system->getMillis() - writeStart;
+	const bool writeError = saveFile->err();
+	delete saveFile;
+
+	uint32 readMillis = 0;
+	bool readError = true;
+
+	if (!writeError) {
+		Common::InSaveFile *loadFile = saveFileMan->openForLoading(fileName);
+		if (loadFile) {
+			const uint32 readStart = g_system->getMillis();
+			uint32 bytesRead = 0;
+			uint32 len;
+			while ((len = loadFile->read(chunk, chunkSize)) > 0)
+				bytesRead += len;
+			readMillis = g_system->getMillis() - readStart;
+			readError = (bytesRead != chunkSize * numChunks);
+			delete loadFile;
+		}
+	}
+
+	delete[] chunk;
+	saveFileMan->removeSavefile(fileName);
+
+	if (writeError || readError) {
+		Testsuite::logDetailedPrintf("Save I/O benchmark failed to write/read back its data\n");
+		return kTestFailed;
+	}
+
+	const double totalMb = (double)(chunkSize * numChunks) / (1024.0 * 1024.0);
+	double writeMbPerSec = writeMillis ? (totalMb * 1000.0) / writeMillis : 0.0;
+	double readMbPerSec = readMillis ? (totalMb * 1000.0) / readMillis : 0.0;
+
+	addResult("save_io", Common::String::format(
+		"\"megabytes\": %.0f, \"write_millis\": %u, \"write_mb_per_sec\": %.2f, \"read_millis\": %u, \"read_mb_per_sec\": %.2f",
+		totalMb, writeMillis, writeMbPerSec, readMillis, readMbPerSec));
+	Testsuite::logDetailedPrintf("Save I/O: write %.2f MB/s, read %.2f MB/s\n", writeMbPerSec, readMbPerSec);
+
+	return kTestPassed;
+}
+
+TestExitStatus exportResults() {
+	if (benchResults.empty()) {
+		Testsuite::logDetailedPrintf("No benchmark results to export\n");
+		return kTestSkipped;
+	}
+
+	Common::WriteStream *ws = Common::FSNode(ConfParams.getLogDirectory()).getChild("testbed_benchmarks.json").createWriteStream();
+	if (!ws) {
+		Testsuite::logDetailedPrintf("Can't create benchmark report file\n");
+		return kTestFailed;
+	}
+
+	Common::String report = "{\n";
+	report += Common::String::format(
+		"\t\"device\": {\"screen_width\": %d, \"screen_height\": %d, \"screen_bpp\": %d, \"overlay_width\": %d, \"overlay_height\": %d, \"mixer_rate\": %u},\n",
+		g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat().bytesPerPixel,
+		g_system->getOverlayWidth(), g_system->getOverlayHeight(),
+		g_system->getMixer() ? g_system->getMixer()->getOutputRate() : 0);
+	report += "\t\"benchmarks\": {\n";
+	for (uint i = 0; i < benchResults.size(); i++) {
+		report += Common::String::format("\t\t\"%s\": {%s}%s\n",
+			benchResults[i].name.c_str(), benchResults[i].fields.c_str(),
+			(i + 1 < benchResults.size()) ? "," : "");
+	}
+	report += "\t}\n}\n";
+
+	ws->writeString(report);
+	ws->flush();
+	bool err = ws->err();
+	delete ws;
+
+	if (err) {
+		Testsuite::logDetailedPrintf("Error writing benchmark report\n");
+		return kTestFailed;
+	}
+
+	Testsuite::logPrintf("Info! Benchmark results written to testbed_benchmarks.json\n");
+	return kTestPassed;
+}
+
+} // End of namespace Benchmarks
+
+BenchmarkTestSuite::BenchmarkTestSuite() {
+	addTest("CopyRectToScreen", &Benchmarks::benchCopyRectToScreen, false);
+	addTest("OverlayBlend", &Benchmarks::benchOverlayBlend, false);
+	addTest("MixerHeadroom", &Benchmarks::benchMixerHeadroom, false);
+	addTest("FSTraversal", &Benchmarks::benchFSTraversal, false);
+	addTest("SaveIO", &Benchmarks::benchSaveIO, false);
+	addTest("ExportResults", &Benchmarks::exportResults, false);
+}
+
+} // End of namespace Testbed
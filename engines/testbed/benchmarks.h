@@ -0,0 +1,68 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TESTBED_BENCHMARKS_H
+#define TESTBED_BENCHMARKS_H
+
+#include "testbed/testsuite.h"
+
+namespace Testbed {
+
+namespace Benchmarks {
+
+// Timed micro-benchmarks for OSystem APIs. Unlike the other testsuites
+// these don't verify behavior; they measure throughput and latency, and
+// the collected numbers are written as JSON to the testbed log directory
+// by the final ExportResults step. All benchmarks are non-interactive.
+
+TestExitStatus benchCopyRectToScreen();
+TestExitStatus benchOverlayBlend();
+TestExitStatus benchMixerHeadroom();
+TestExitStatus benchFSTraversal();
+TestExitStatus benchSaveIO();
+TestExitStatus exportResults();
+
+} // End of namespace Benchmarks
+
+class BenchmarkTestSuite : public Testsuite {
+public:
+	/**
+	 * The constructor for the BenchmarkTestSuite
+	 * For every test to be executed one must:
+	 * 1) Create a function that would invoke the test
+	 * 2) Add that test to list by executing addTest()
+	 *
+	 * @see addTest()
+	 */
+	BenchmarkTestSuite();
+	~BenchmarkTestSuite() override {}
+	const char *getName() const override {
+		return "Benchmarks";
+	}
+	const char *getDescription() const override {
+		return "Performance benchmarks (Graphics, Mixer, FS, Save I/O)";
+	}
+};
+
+} // End of namespace Testbed
+
+#endif // TESTBED_BENCHMARKS_H
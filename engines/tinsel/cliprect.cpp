@@ -197,6 +197,31 @@ void MergeClipRect() {
 	}
 }
 
+/**
+ * Check whether an object's draw mode writes every pixel of its
+ * bounding rectangle, i.e. whether it completely hides whatever
+ * was drawn below it.
+ * @param pObj			object to check
+ */
+static bool ObjectIsOpaque(const OBJECT *pObj) {
+	const uint32 typeId = pObj->flags & 0xff;
+
+	// Color packed objects have transparent runs
+	if (TinselV2 && (pObj->flags >> 14) != 0)
+		return false;
+
+	// Constant fills write every pixel
+	if (typeId == DMA_CONST || typeId == (DMA_CONST | DMA_CLIP))
+		return true;
+
+	// Backgrounds write every pixel from Tinsel 2 onwards; the Tinsel 1
+	// renderers draw them through transparency aware paths
+	if (typeId == DMA_WA || typeId == (DMA_WA | DMA_CLIP))
+		return TinselV2;
+
+	return false;
+}
+
 /**
  * Redraws all objects within this clipping rectangle.
  * @param pObjList		Object list to draw
@@ -212,7 +237,31 @@ void UpdateClipRect(OBJECT **pObjList, Common::Point *pWin, Common::Rect *pClip)
 	// Initialize the fields of the drawing object to empty
 	memset(&currentObj, 0, sizeof(DRAWOBJECT));
 
+	// Find the last object that covers the whole clip rectangle with
+	// opaque pixels. Everything below it would only be overdrawn, so
+	// drawing can start there
+	OBJECT *pFirst = *pObjList;
 	for (pObj = *pObjList; pObj != NULL; pObj = pObj->pNext) {
+		if (!ObjectIsOpaque(pObj))
+			continue;
+
+		if (pObj->flags & DMA_ABS) {
+			// object position is absolute
+			x = fracToInt(pObj->xPos);
+			y = fracToInt(pObj->yPos);
+		} else {
+			// object position is relative to window
+			x = fracToInt(pObj->xPos) - pWin->x;
+			y = fracToInt(pObj->yPos) - pWin->y;
+		}
+
+		if (x <= pClip->left && y <= pClip->top
+				&& x + pObj->width >= pClip->right
+				&& y + pObj->height >= pClip->bottom)
+			pFirst = pObj;
+	}
+
+	for (pObj = pFirst; pObj != NULL; pObj = pObj->pNext) {
 		if (pObj->flags & DMA_ABS) {
 			// object position is absolute
 			x = fracToInt(pObj->xPos);
@@ -588,15 +588,26 @@ static void t2WrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP, bool apply
 				int runLength = numBytes - clipAmount;
 				x += numBytes - runLength;
 
-				for (int xp = 0; xp < runLength; ++xp) {
-					if ((yClip > 0) || (x >= (pObj->width - rightClip)))
-						++srcP;
-					else if (horizFlipped)
+				// Since x only increases, the visible pixels form a prefix
+				// of the run, which can be written out in one go
+				int visLength = MIN(runLength, MAX(pObj->width - rightClip - x, 0));
+				if (yClip > 0)
+					visLength = 0;
+
+				if (horizFlipped) {
+					for (int xp = 0; xp < visLength; ++xp)
 						*tempP-- = pObj->constant + *srcP++;
-					else
+				} else if (pObj->constant == 0) {
+					Common::copy(srcP, srcP + visLength, tempP);
+					tempP += visLength;
+					srcP += visLength;
+				} else {
+					for (int xp = 0; xp < visLength; ++xp)
 						*tempP++ = pObj->constant + *srcP++;
-					++x;
 				}
+
+				srcP += runLength - visLength;
+				x += runLength;
 			}
 		}
 		assert(x == pObj->width);
@@ -977,13 +988,19 @@ static void PackedWrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP,
 			numBytes -= v;
 			x += v;
 
-			while (numBytes-- > 0) {
-				if ((topClip == 0) && (x < (pObj->width - rightClip))) {
-					*tempP = color;
-					if (horizFlipped) --tempP; else ++tempP;
+			// The sequence is a single color and the visible pixels form
+			// a prefix of it, so it can be filled in one go
+			int visBytes = (topClip == 0) ? MIN(numBytes, MAX(pObj->width - rightClip - x, 0)) : 0;
+			if (visBytes > 0) {
+				if (horizFlipped) {
+					Common::fill(tempP - visBytes + 1, tempP + 1, color);
+					tempP -= visBytes;
+				} else {
+					Common::fill(tempP, tempP + visBytes, color);
+					tempP += visBytes;
 				}
-				++x;
 			}
+			x += numBytes;
 		}
 		assert(x <= pObj->width);
 
@@ -60,11 +60,14 @@ bool CBaseStarEntry::operator==(const CBaseStarEntry &s) const {
 /*------------------------------------------------------------------------*/
 
 CBaseStars::CBaseStars() : _minVal(0.0), _maxVal(1.0), _range(0.0),
-		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0) {
+		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0),
+		_starIndexCount(0) {
 }
 
 void CBaseStars::clear() {
 	_data.clear();
+	_starIndex.clear();
+	_starIndexCount = 0;
 }
 
 void CBaseStars::initialize() {
@@ -126,6 +129,116 @@ void CBaseStars::resetEntry(CBaseStarEntry &entry) {
 		entry._data[idx] = 0;
 }
 
+void CBaseStars::buildStarIndex() {
+	const int GRID_SIZE = 8;
+
+	_starIndex.clear();
+	_starIndexCount = _data.size();
+	if (_data.empty())
+		return;
+
+	// Get the bounding box of the catalogue
+	FVector minP = _data[0]._position, maxP = _data[0]._position;
+	for (uint idx = 1; idx < _data.size(); ++idx) {
+		const FVector &pos = _data[idx]._position;
+		if (pos._x < minP._x) minP._x = pos._x;
+		if (pos._y < minP._y) minP._y = pos._y;
+		if (pos._z < minP._z) minP._z = pos._z;
+		if (pos._x > maxP._x) maxP._x = pos._x;
+		if (pos._y > maxP._y) maxP._y = pos._y;
+		if (pos._z > maxP._z) maxP._z = pos._z;
+	}
+
+	FVector span(maxP._x - minP._x, maxP._y - minP._y, maxP._z - minP._z);
+
+	// Distribute the stars over a uniform grid covering the bounding box
+	Common::Array<StarIndexGroup> cells;
+	cells.resize(GRID_SIZE * GRID_SIZE * GRID_SIZE);
+
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		const FVector &pos = _data[idx]._position;
+		int cx = (span._x > 0.0) ? MIN((int)((pos._x - minP._x) * GRID_SIZE / span._x), GRID_SIZE - 1) : 0;
+		int cy = (span._y > 0.0) ? MIN((int)((pos._y - minP._y) * GRID_SIZE / span._y), GRID_SIZE - 1) : 0;
+		int cz = (span._z > 0.0) ? MIN((int)((pos._z - minP._z) * GRID_SIZE / span._z), GRID_SIZE - 1) : 0;
+		cells[(cz * GRID_SIZE + cy) * GRID_SIZE + cx]._stars.push_back(idx);
+	}
+
+	// Compute the bounding sphere of each occupied cell's members, and
+	// keep only the occupied cells
+	for (uint cellIdx = 0; cellIdx < cells.size(); ++cellIdx) {
+		StarIndexGroup &group = cells[cellIdx];
+		if (group._stars.empty())
+			continue;
+
+		double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+		for (uint idx = 0; idx < group._stars.size(); ++idx) {
+			const FVector &pos = _data[group._stars[idx]]._position;
+			sumX += pos._x;
+			sumY += pos._y;
+			sumZ += pos._z;
+		}
+		group._center = FVector((float)(sumX / group._stars.size()),
+			(float)(sumY / group._stars.size()), (float)(sumZ / group._stars.size()));
+
+		double radius2 = 0.0;
+		for (uint idx = 0; idx < group._stars.size(); ++idx) {
+			const FVector &pos = _data[group._stars[idx]]._position;
+			FVector diff(pos._x - group._center._x, pos._y - group._center._y,
+				pos._z - group._center._z);
+			double dist2 = diff._x * diff._x + diff._y * diff._y + diff._z * diff._z;
+			if (dist2 > radius2)
+				radius2 = dist2;
+		}
+		// Slightly inflated to absorb the single precision rounding of
+		// the member positions
+		group._radius = sqrt(radius2) * 1.001;
+
+		_starIndex.push_back(group);
+	}
+}
+
+bool CBaseStars::isGroupVisible(const StarIndexGroup &group, const FPose &pose,
+		double minVal, double threshold, double boundX, double boundY,
+		double xSlack) const {
+	// Transform the group's bounding sphere centre into view space
+	const FVector &c = group._center;
+	double bx = c._x * pose._row1._x + c._y * pose._row2._x + c._z * pose._row3._x + pose._vector._x;
+	double by = c._x * pose._row1._y + c._y * pose._row2._y + c._z * pose._row3._y + pose._vector._y;
+	double bz = c._x * pose._row1._z + c._y * pose._row2._z + c._z * pose._row3._z + pose._vector._z;
+	double r = group._radius;
+
+	// Entirely behind the rejection plane used by the per-star loops
+	if (bz + r <= minVal)
+		return false;
+
+	// A group close enough that a member may get a closeup drawn can
+	// never be culled against the view planes
+	double closeDist = 1.0e6 + r;
+	if (bx * bx + by * by + bz * bz < closeDist * closeDist)
+		return true;
+
+	// Entirely closer than the camera's front clip distance
+	if (bz + r <= threshold)
+		return false;
+
+	// Entirely outside the left/right or top/bottom view planes. The
+	// plane normals aren't unit length, so the sphere radius is scaled
+	// by their norm; xSlack covers the x offsets draw3/draw4 apply
+	double normX = sqrt(_value1 * _value1 + boundX * boundX);
+	if (_value1 * bx - boundX * bz - xSlack > r * normX)
+		return false;
+	if (-_value1 * bx - boundX * bz - xSlack > r * normX)
+		return false;
+
+	double normY = sqrt(_value2 * _value2 + boundY * boundY);
+	if (_value2 * by - boundY * bz > r * normY)
+		return false;
+	if (-_value2 * by - boundY * bz > r * normY)
+		return false;
+
+	return true;
+}
+
 void CBaseStars::draw(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
 	if (!_data.empty()) {
 		switch (camera->getStarColor()) {
@@ -174,74 +287,86 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	double boundX = MAX((double)centroid._x, (double)width1 - (double)centroid._x);
+	double boundY = MAX((double)centroid._y, (double)height1 - (double)centroid._y);
+	double xSlack = 0.0;
+	if (_starIndexCount != _data.size())
+		buildStarIndex();
 
-		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
-				surfaceArea, camera);
+	for (uint grpIdx = 0; grpIdx < _starIndex.size(); ++grpIdx) {
+		const StarIndexGroup &group = _starIndex[grpIdx];
+		if (!isGroupVisible(group, pose, minVal, threshold, boundX, boundY, xSlack))
 			continue;
-		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
-			continue;
+		for (uint entryIdx = 0; entryIdx < group._stars.size(); ++entryIdx) {
+			CBaseStarEntry &entry = _data[group._stars[entryIdx]];
+			const FVector &vector = entry._position;
+			tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
+				+ vector._z * pose._row3._z + pose._vector._z;
+			if (tempZ <= minVal)
+				continue;
+
+			tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
+			tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+			total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+
+			if (total2 < 1.0e12) {
+				closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+					surfaceArea, camera);
+				continue;
+			}
 
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
+			if (tempZ <= threshold || total2 >= MAX_VAL)
+				continue;
 
-		double sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		double red = MIN((double)entry._red * sVal, (double)255.0);
-		double green = MIN((double)entry._green * sVal, (double)255.0);
-		double blue = MIN((double)entry._green * sVal, (double)255.0);
+			int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
+			int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
 
-		int skipCtr = 0;
-		if (red < 0.0) {
-			red = 0.0;
-			++skipCtr;
-		}
-		if (green < 0.0) {
-			green = 0.0;
-			++skipCtr;
-		}
-		if (blue < 0.0) {
-			blue = 0.0;
-			++skipCtr;
-		}
-		if (skipCtr == 3)
-			continue;
+			double sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			double red = MIN((double)entry._red * sVal, (double)255.0);
+			double green = MIN((double)entry._green * sVal, (double)255.0);
+			double blue = MIN((double)entry._green * sVal, (double)255.0);
 
-		int r = (int)(red - 0.5) & 0xfff8;
-		int g = (int)(green - 0.5) & 0xfff8;
-		int b = (int)(blue - 0.5) & 0xfff8;
-		int rgb = ((g | (r << 5)) << 2) | ((b >> 3) & 0xfff8);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int skipCtr = 0;
+			if (red < 0.0) {
+				red = 0.0;
+				++skipCtr;
+			}
+			if (green < 0.0) {
+				green = 0.0;
+				++skipCtr;
+			}
+			if (blue < 0.0) {
+				blue = 0.0;
+				++skipCtr;
+			}
+			if (skipCtr == 3)
+				continue;
 
-		switch (entry._thickness) {
-		case 0:
-			*pixelP = rgb;
-			break;
+			int r = (int)(red - 0.5) & 0xfff8;
+			int g = (int)(green - 0.5) & 0xfff8;
+			int b = (int)(blue - 0.5) & 0xfff8;
+			int rgb = ((g | (r << 5)) << 2) | ((b >> 3) & 0xfff8);
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 
-		case 1:
-			*pixelP = rgb;
-			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-			break;
+			switch (entry._thickness) {
+			case 0:
+				*pixelP = rgb;
+				break;
 
-		default:
-			break;
+			case 1:
+				*pixelP = rgb;
+				*(pixelP + 1) = rgb;
+				*(pixelP + surfaceArea->_pitch / 2) = rgb;
+				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				break;
+
+			default:
+				break;
+			}
 		}
 	}
 }
@@ -259,75 +384,87 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	double boundX = MAX((double)centroid._x, (double)width1 - (double)centroid._x);
+	double boundY = MAX((double)centroid._y, (double)height1 - (double)centroid._y);
+	double xSlack = 0.0;
+	if (_starIndexCount != _data.size())
+		buildStarIndex();
 
-		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
-				surfaceArea, camera);
+	for (uint grpIdx = 0; grpIdx < _starIndex.size(); ++grpIdx) {
+		const StarIndexGroup &group = _starIndex[grpIdx];
+		if (!isGroupVisible(group, pose, minVal, threshold, boundX, boundY, xSlack))
 			continue;
-		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
-			continue;
+		for (uint entryIdx = 0; entryIdx < group._stars.size(); ++entryIdx) {
+			CBaseStarEntry &entry = _data[group._stars[entryIdx]];
+			const FVector &vector = entry._position;
+			tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
+				+ vector._z * pose._row3._z + pose._vector._z;
+			if (tempZ <= minVal)
+				continue;
+
+			tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
+			tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+			total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+
+			if (total2 < 1.0e12) {
+				closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+					surfaceArea, camera);
+				continue;
+			}
 
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
+			if (tempZ <= threshold || total2 >= MAX_VAL)
+				continue;
 
-		double sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		double red = MIN((double)entry._red * sVal, (double)255.0);
-		double green = MIN((double)entry._green * sVal, (double)255.0);
-		double blue = MIN((double)entry._green * sVal, (double)255.0);
+			int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
+			int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
 
-		int skipCtr = 0;
-		if (red < 0.0) {
-			red = 0.0;
-			++skipCtr;
-		}
-		if (green < 0.0) {
-			green = 0.0;
-			++skipCtr;
-		}
-		if (blue < 0.0) {
-			blue = 0.0;
-			++skipCtr;
-		}
-		if (skipCtr == 3)
-			continue;
+			double sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			double red = MIN((double)entry._red * sVal, (double)255.0);
+			double green = MIN((double)entry._green * sVal, (double)255.0);
+			double blue = MIN((double)entry._green * sVal, (double)255.0);
 
-		int r = (int)(red - 0.5) & 0xf8;
-		int g = (int)(green - 0.5) & 0xfc;
-		int b = (int)(blue - 0.5) & 0xfff8;
+			int skipCtr = 0;
+			if (red < 0.0) {
+				red = 0.0;
+				++skipCtr;
+			}
+			if (green < 0.0) {
+				green = 0.0;
+				++skipCtr;
+			}
+			if (blue < 0.0) {
+				blue = 0.0;
+				++skipCtr;
+			}
+			if (skipCtr == 3)
+				continue;
 
-		int rgb = ((g | (r << 5)) << 3) | (b >> 3);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int r = (int)(red - 0.5) & 0xf8;
+			int g = (int)(green - 0.5) & 0xfc;
+			int b = (int)(blue - 0.5) & 0xfff8;
 
-		switch (entry._thickness) {
-		case 0:
-			*pixelP = rgb;
-			break;
+			int rgb = ((g | (r << 5)) << 3) | (b >> 3);
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 
-		case 1:
-			*pixelP = rgb;
-			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-			break;
+			switch (entry._thickness) {
+			case 0:
+				*pixelP = rgb;
+				break;
 
-		default:
-			break;
+			case 1:
+				*pixelP = rgb;
+				*(pixelP + 1) = rgb;
+				*(pixelP + surfaceArea->_pitch / 2) = rgb;
+				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				break;
+
+			default:
+				break;
+			}
 		}
 	}
 }
@@ -348,92 +485,104 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
-
-		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
-				surfaceArea, camera);
-			continue;
-		}
+	double boundX = MAX((double)centroid._x, (double)width1 - (double)centroid._x);
+	double boundY = MAX((double)centroid._y, (double)height1 - (double)centroid._y);
+	double xSlack = fabs(*v1Ptr) * MAX(fabs(*v3Ptr), fabs(*v4Ptr));
+	if (_starIndexCount != _data.size())
+		buildStarIndex();
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
+	for (uint grpIdx = 0; grpIdx < _starIndex.size(); ++grpIdx) {
+		const StarIndexGroup &group = _starIndex[grpIdx];
+		if (!isGroupVisible(group, pose, minVal, threshold, boundX, boundY, xSlack))
 			continue;
 
-		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
-
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
-		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP = rgb;
-				break;
-
-			case 1:
-				*pixelP = rgb;
-				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-				break;
-
-			default:
-				break;
+		for (uint entryIdx = 0; entryIdx < group._stars.size(); ++entryIdx) {
+			CBaseStarEntry &entry = _data[group._stars[entryIdx]];
+			const FVector &vector = entry._position;
+			tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
+				+ vector._z * pose._row3._z + pose._vector._z;
+			if (tempZ <= minVal)
+				continue;
+
+			tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
+			tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+			total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+
+			if (total2 < 1.0e12) {
+				closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+					surfaceArea, camera);
+				continue;
 			}
-		}
-
-		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
-
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
 
-		if (sVal > 255.0)
-			sVal = 255.0;
-
-		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP |= rgb;
-				break;
-
-			case 1:
-				*pixelP |= rgb;
-				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
-				break;
+			if (tempZ <= threshold || total2 >= MAX_VAL)
+				continue;
+
+			// First pixel
+			xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
+			yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
+
+			sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			sVal *= 255.0;
+
+			if (sVal > 255.0)
+				sVal = 255.0;
+
+			if (sVal > 2.0) {
+				pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+				rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
+
+				switch (entry._thickness) {
+				case 0:
+					*pixelP = rgb;
+					break;
+
+				case 1:
+					*pixelP = rgb;
+					*(pixelP + 1) = rgb;
+					*(pixelP + surfaceArea->_pitch / 2) = rgb;
+					*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+					break;
+
+				default:
+					break;
+				}
+			}
 
-			default:
-				break;
+			// Second pixel
+			xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
+			yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
+
+			sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			sVal *= 255.0;
+
+			if (sVal > 255.0)
+				sVal = 255.0;
+
+			if (sVal > 2.0) {
+				pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+				rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
+
+				switch (entry._thickness) {
+				case 0:
+					*pixelP |= rgb;
+					break;
+
+				case 1:
+					*pixelP |= rgb;
+					*(pixelP + 1) |= rgb;
+					*(pixelP + surfaceArea->_pitch / 2) |= rgb;
+					*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+					break;
+
+				default:
+					break;
+				}
 			}
 		}
 	}
@@ -454,94 +603,106 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		const CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
-
-		if (total2 < 1.0e12) {
-			// We're in close proximity to the given star, so draw a closeup of it
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
-				surfaceArea, camera);
-			continue;
-		}
-
-		if (tempZ <= threshold || total2 >= MAX_VAL)
-			continue;
+	double boundX = MAX((double)centroid._x, (double)width1 - (double)centroid._x);
+	double boundY = MAX((double)centroid._y, (double)height1 - (double)centroid._y);
+	double xSlack = fabs(*v1Ptr) * MAX(fabs(*v3Ptr), fabs(*v4Ptr));
+	if (_starIndexCount != _data.size())
+		buildStarIndex();
 
-		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+	for (uint grpIdx = 0; grpIdx < _starIndex.size(); ++grpIdx) {
+		const StarIndexGroup &group = _starIndex[grpIdx];
+		if (!isGroupVisible(group, pose, minVal, threshold, boundX, boundY, xSlack))
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
+		for (uint entryIdx = 0; entryIdx < group._stars.size(); ++entryIdx) {
+			const CBaseStarEntry &entry = _data[group._stars[entryIdx]];
+			const FVector &vector = entry._position;
 
-		if (sVal > 255.0)
-			sVal = 255.0;
+			tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
+				+ vector._z * pose._row3._z + pose._vector._z;
+			if (tempZ <= minVal)
+				continue;
 
-		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
+			tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
+			tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+			total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
-			switch (entry._thickness) {
-			case 0:
-				*pixelP = rgb;
-				break;
-
-			case 1:
-				*pixelP = rgb;
-				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-				break;
-
-			default:
-				break;
+			if (total2 < 1.0e12) {
+				// We're in close proximity to the given star, so draw a closeup of it
+				closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+					surfaceArea, camera);
+				continue;
 			}
-		}
-
-		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)((tempY * *v2Ptr) / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
-
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
-		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
 
-			switch (entry._thickness) {
-			case 0:
-				*pixelP |= rgb;
-				break;
-
-			case 1:
-				*pixelP |= rgb;
-				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
-				break;
+			if (tempZ <= threshold || total2 >= MAX_VAL)
+				continue;
+
+			// First pixel
+			xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
+			yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
+
+			sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			sVal *= 255.0;
+
+			if (sVal > 255.0)
+				sVal = 255.0;
+
+			if (sVal > 2.0) {
+				pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+				rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
+
+				switch (entry._thickness) {
+				case 0:
+					*pixelP = rgb;
+					break;
+
+				case 1:
+					*pixelP = rgb;
+					*(pixelP + 1) = rgb;
+					*(pixelP + surfaceArea->_pitch / 2) = rgb;
+					*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+					break;
+
+				default:
+					break;
+				}
+			}
 
-			default:
-				break;
+			// Second pixel
+			xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
+			yStart = (int)((tempY * *v2Ptr) / tempZ + centroid._y);
+			if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+				continue;
+
+			sVal = sqrt(total2);
+			sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+			sVal *= 255.0;
+
+			if (sVal > 255.0)
+				sVal = 255.0;
+
+			if (sVal > 2.0) {
+				pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+				rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
+
+				switch (entry._thickness) {
+				case 0:
+					*pixelP |= rgb;
+					break;
+
+				case 1:
+					*pixelP |= rgb;
+					*(pixelP + 1) |= rgb;
+					*(pixelP + surfaceArea->_pitch / 2) |= rgb;
+					*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+					break;
+
+				default:
+					break;
+				}
 			}
 		}
 	}
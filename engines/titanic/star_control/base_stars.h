@@ -36,6 +36,7 @@ enum StarMode { MODE_STARFIELD = 0, MODE_PHOTO = 1 };
 
 class CCamera;
 class CStarCloseup;
+class FPose;
 class CString;
 class CSurfaceArea;
 class SimpleFile;
@@ -73,7 +74,35 @@ struct CStarPosition : public Common::Point {
  * Base class for views that draw a set of stars in simulated 3D space
  */
 class CBaseStars {
+	/**
+	 * A cell of the spatial star index - a group of neighbouring stars
+	 * together with their bounding sphere, so that entire groups can be
+	 * culled against the view before any per-star transform is done
+	 */
+	struct StarIndexGroup {
+		FVector _center;
+		double _radius;
+		Common::Array<uint> _stars;
+		StarIndexGroup() : _radius(0.0) {}
+	};
 private:
+	Common::Array<StarIndexGroup> _starIndex;
+	uint _starIndexCount;
+
+	/**
+	 * Partitions the star catalogue into the groups of the spatial index
+	 */
+	void buildStarIndex();
+
+	/**
+	 * Conservatively tests a group's bounding sphere against the view.
+	 * Returns false only if no member star can pass the per-star clip
+	 * checks, so culled groups are safe to skip entirely
+	 */
+	bool isGroupVisible(const StarIndexGroup &group, const FPose &pose,
+		double minVal, double threshold, double boundX, double boundY,
+		double xSlack) const;
+
 	void draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
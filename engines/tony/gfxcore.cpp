@@ -251,6 +251,7 @@ RMGfxWoodyBuffer::RMGfxWoodyBuffer(int dimx, int dimy)
 
 RMGfxTargetBuffer::RMGfxTargetBuffer() {
 	_otlist = NULL;
+	_otTail = NULL;
 	_otSize = 0;
 	_trackDirtyRects = false;
 }
@@ -273,6 +274,7 @@ void RMGfxTargetBuffer::clearOT() {
 	}
 
 	_otlist = NULL;
+	_otTail = NULL;
 }
 
 void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
@@ -304,6 +306,10 @@ void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
 			// Delete task, freeing the memory
 			delete _ctx->cur->_prim;
 			_ctx->next = _ctx->cur->_next;
+
+			// If it was the last item, update the list tail
+			if (_ctx->cur == _otTail)
+				_otTail = _ctx->prev;
 			delete _ctx->cur;
 
 			// If it was the first item, update the list head
@@ -332,25 +338,35 @@ void RMGfxTargetBuffer::addPrim(RMGfxPrimitive *prim) {
 	prim->_task->Register();
 
 	// Check the priority
-	nPrior = prim->_task->priority();
 	n = new OTList(prim);
+	nPrior = n->_prior;
 
 	// Empty list
 	if (_otlist == NULL) {
 		_otlist = n;
 		_otlist->_next = NULL;
+		_otTail = n;
 	}
 	// Inclusion in the head
-	else if (nPrior < _otlist->_prim->_task->priority()) {
+	else if (nPrior < _otlist->_prior) {
 		n->_next = _otlist;
 		_otlist = n;
+	}
+	// Inclusion at the tail. The comparison must be strict, because a
+	// primitive with the same priority as an existing one is inserted
+	// before it, not after
+	else if (nPrior > _otTail->_prior) {
+		_otTail->_next = n;
+		_otTail = n;
 	} else {
 		cur = _otlist;
-		while (cur->_next != NULL && nPrior > cur->_next->_prim->_task->priority())
+		while (cur->_next != NULL && nPrior > cur->_next->_prior)
 			cur = cur->_next;
 
 		n->_next = cur->_next;
 		cur->_next = n;
+		if (n->_next == NULL)
+			_otTail = n;
 	}
 }
 
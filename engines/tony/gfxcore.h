@@ -437,11 +437,15 @@ class RMGfxTargetBuffer : public virtual RMGfxBuffer {
 private:
 	struct OTList {
 		RMGfxPrimitive *_prim;
+		// Priority of the task, cached here so that sorting the list
+		// doesn't have to make a virtual call per comparison
+		int _prior;
 		OTList *_next;
 
 		OTList();
 		OTList(RMGfxPrimitive *pr) {
 			_prim = pr;
+			_prior = pr->_task->priority();
 			_next = NULL;
 		}
 	};
@@ -456,6 +460,9 @@ private:
 
 protected:
 	OTList *_otlist;
+	// Tail of the OT list, so that the common case of adding a primitive
+	// at or above the highest priority doesn't walk the whole list
+	OTList *_otTail;
 	int _otSize;
 
 public:
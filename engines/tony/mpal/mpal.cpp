@@ -130,6 +130,36 @@ static void unlockScripts() {
 	globalUnlock(GLOBALS._hScripts);
 }
 
+/**
+ * Finds a global variable by name
+ *
+ * @param lpszVarName		Name of the variable
+ * @returns		Pointer to the variable, or NULL if it is not present
+ * @remarks		Scripts tend to access the same variable several times in
+ * a row (a check followed by an assignment, or the counter of a loop), so
+ * the index of the last hit is remembered to avoid rescanning the whole
+ * table on every access.
+ */
+static LpMpalVar varFindByName(const char *lpszVarName) {
+	static uint lastVar = 0;
+
+	if (lastVar < GLOBALS._nVars) {
+		LpMpalVar v = GLOBALS._lpmvVars + lastVar;
+		if (strcmp(lpszVarName, v->_lpszVarName) == 0)
+			return v;
+	}
+
+	LpMpalVar v = GLOBALS._lpmvVars;
+	for (uint i = 0; i < GLOBALS._nVars; v++, i++) {
+		if (strcmp(lpszVarName, v->_lpszVarName) == 0) {
+			lastVar = i;
+			return v;
+		}
+	}
+
+	return NULL;
+}
+
 /**
  * Returns the current value of a global variable
  *
@@ -140,11 +170,9 @@ static void unlockScripts() {
  * need to remember to call UnlockVar()
  */
 int32 varGetValue(const char *lpszVarName) {
-	LpMpalVar v = GLOBALS._lpmvVars;
-
-	for (int i = 0; i < GLOBALS._nVars; v++, i++)
-		if (strcmp(lpszVarName, v->_lpszVarName) == 0)
-			return v->_dwVal;
+	LpMpalVar v = varFindByName(lpszVarName);
+	if (v != NULL)
+		return v->_dwVal;
 
 	GLOBALS._mpalError = 1;
 	return 0;
@@ -156,22 +184,20 @@ int32 varGetValue(const char *lpszVarName) {
  * @param val				Value to set
  */
 void varSetValue(const char *lpszVarName, int32 val) {
-	LpMpalVar v = GLOBALS._lpmvVars;
-
-	for (uint i = 0; i < GLOBALS._nVars; v++, i++)
-		if (strcmp(lpszVarName, v->_lpszVarName) == 0) {
-			v->_dwVal = val;
-			if (GLOBALS._lpiifCustom != NULL && strncmp(v->_lpszVarName, "Pattern.", 8) == 0) {
-				i = 0;
-				sscanf(v->_lpszVarName, "Pattern.%u", &i);
-				GLOBALS._lpiifCustom(i, val, -1);
-			} else if (GLOBALS._lpiifCustom != NULL && strncmp(v->_lpszVarName, "Status.", 7) == 0) {
-				i = 0;
-				sscanf(v->_lpszVarName,"Status.%u", &i);
-				GLOBALS._lpiifCustom(i, -1, val);
-			}
-			return;
+	LpMpalVar v = varFindByName(lpszVarName);
+	if (v != NULL) {
+		v->_dwVal = val;
+		if (GLOBALS._lpiifCustom != NULL && strncmp(v->_lpszVarName, "Pattern.", 8) == 0) {
+			uint i = 0;
+			sscanf(v->_lpszVarName, "Pattern.%u", &i);
+			GLOBALS._lpiifCustom(i, val, -1);
+		} else if (GLOBALS._lpiifCustom != NULL && strncmp(v->_lpszVarName, "Status.", 7) == 0) {
+			uint i = 0;
+			sscanf(v->_lpszVarName,"Status.%u", &i);
+			GLOBALS._lpiifCustom(i, -1, val);
 		}
+		return;
+	}
 
 	GLOBALS._mpalError = 1;
 	return;
@@ -139,6 +139,27 @@ Common::Rect Animation::getRect() {
 	return Common::Rect(_x1, _y1, _x2, _y2);
 }
 
+/**
+ * Composite a row of sprite pixels, treating zero as transparent.
+ * Opaque runs are copied in blocks rather than per pixel.
+ */
+static void copyMaskedRow(uint8 *dst, const uint8 *src, int16 len) {
+	const uint8 *end = src + len;
+	while (src < end) {
+		if (*src) {
+			const uint8 *runStart = src;
+			do {
+				src++;
+			} while (src < end && *src);
+			memcpy(dst, runStart, src - runStart);
+			dst += src - runStart;
+		} else {
+			src++;
+			dst++;
+		}
+	}
+}
+
 void Animation::drawFrame(Graphics::Surface &surface, int32 frame, int16 xx, int16 yy) {
 	debugC(3, kDebugAnim, "drawFrame(surface, %d, %d, %d)", frame, xx, yy);
 	if (frame < 0)
@@ -199,14 +220,7 @@ void Animation::drawFrame(Graphics::Surface &surface, int32 frame, int16 xx, int
 	uint8 *srcRow = _frames[dataFrame]._data + offsX + (_frames[frame]._x2 - _frames[frame]._x1) * offsY;
 	uint8 *curRow = (uint8 *)surface.getBasePtr(xx + _x1 + _frames[frame]._x1 + offsX, yy + _frames[frame]._y1 + _y1 + offsY);
 	for (int16 y = 0; y < rectY; y++) {
-		uint8 *cur = curRow;
-		uint8 *c = srcRow + y * (_frames[frame]._x2 - _frames[frame]._x1);
-		for (int16 x = 0; x < rectX; x++) {
-			if (*c)
-				*cur = *c;
-			c++;
-			cur++;
-		}
+		copyMaskedRow(curRow, srcRow + y * (_frames[frame]._x2 - _frames[frame]._x1), rectX);
 		curRow += destPitch;
 	}
 }
@@ -247,26 +261,39 @@ void Animation::drawFrameWithMaskAndScale(Graphics::Surface &surface, int32 fram
 
 	bool shadowFlag = Common::String(_name).contains("SHADOW");
 
-	for (int16 y = yy1; y < yy2; y++) {
-		for (int16 x = xx1; x < xx2; x++) {
-			if (x < 0 || x >= 1280 || y < 0 || y >= 400)
-				continue;
-
-			uint8 *cur = curRow + x + y * destPitch;
-			uint8 *curMask = curRowMask + x + y * destPitchMask;
+	// Clamp the target area up front so the bounds don't have to be
+	// checked per pixel
+	int16 clipX1 = MAX<int16>(xx1, 0);
+	int16 clipY1 = MAX<int16>(yy1, 0);
+	int16 clipX2 = MIN<int16>(xx2, 1280);
+	int16 clipY2 = MIN<int16>(yy2, 400);
+	if (clipX1 >= clipX2 || clipY1 >= clipY2 || scale <= 0)
+		return;
 
-			// find the good c
-			int16 xs = (x - xx1) * 1024 / scale;
-			int16 ys = (y - yy1) * 1024 / scale;
-			uint8 *cc = &c[ys * w + xs];
-			if (*cc && ((*curMask) >= zz)) {
+	// Precompute the source column of each target column once, instead
+	// of dividing per pixel
+	int16 *srcCols = new int16[clipX2 - clipX1];
+	for (int16 x = clipX1; x < clipX2; x++)
+		srcCols[x - clipX1] = (x - xx1) * 1024 / scale;
+
+	for (int16 y = clipY1; y < clipY2; y++) {
+		int16 ys = (y - yy1) * 1024 / scale;
+		const uint8 *srcRow = &c[ys * w];
+		uint8 *cur = curRow + clipX1 + y * destPitch;
+		uint8 *curMask = curRowMask + clipX1 + y * destPitchMask;
+
+		for (int16 x = clipX1; x < clipX2; x++, cur++, curMask++) {
+			uint8 cc = srcRow[srcCols[x - clipX1]];
+			if (cc && ((*curMask) >= zz)) {
 				if (shadowFlag)
 					*cur = _vm->getShadowLUT()[*cur];
 				else
-					*cur = *cc;
+					*cur = cc;
 			}
 		}
 	}
+
+	delete[] srcCols;
 }
 
 void Animation::applyPalette(int32 offset, int32 srcOffset, int32 numEntries) {
@@ -397,13 +424,8 @@ void Animation::drawFrameOnPicture(int32 frame, int16 xx, int16 yy) {
 	uint8 *c = _frames[frame]._data;
 	uint8 *curRow = (uint8 *)pic->getDataPtr() + (yy + _frames[frame]._y1 + _y1) * destPitch + (xx + _x1 + _frames[frame]._x1);
 	for (int16 y = 0; y < rectY; y++) {
-		unsigned char *cur = curRow;
-		for (int16 x = 0; x < rectX; x++) {
-			if (*c)
-				*cur = *c;
-			c++;
-			cur++;
-		}
+		copyMaskedRow(curRow, c, rectX);
+		c += rectX;
 		curRow += destPitch;
 	}
 }
@@ -172,14 +172,22 @@ void Graphics::copyRect(uint8 *dst, int dstPitch, int dstX, int dstY, const uint
 	}
 	dst += dstY * dstPitch + dstX;
 	src += srcY * srcPitch + srcX;
-	while (h--) {
-		for (int i = 0; i < w; ++i) {
-			if ((flags & kTransparent) == 0 || src[i] != 0) {
-				dst[i] = src[i];
+	if ((flags & kTransparent) == 0) {
+		while (h--) {
+			memcpy(dst, src, w);
+			dst += dstPitch;
+			src += srcPitch;
+		}
+	} else {
+		while (h--) {
+			for (int i = 0; i < w; ++i) {
+				if (src[i] != 0) {
+					dst[i] = src[i];
+				}
 			}
+			dst += dstPitch;
+			src += srcPitch;
 		}
-		dst += dstPitch;
-		src += srcPitch;
 	}
 }
 
@@ -201,10 +209,20 @@ void Graphics::copyMask(uint8 *dst, int dstPitch, int dstX, int dstY, const uint
 	dst += dstY * dstPitch + dstX;
 	src += srcY * srcPitch + srcX;
 	while (h--) {
-		for (int i = 0; i < w; ++i) {
-			if (src[i] != 0) {
-				dst[i] = fillColor;
+		// Fill the masked pixels one run at a time instead of testing
+		// every pixel individually
+		int i = 0;
+		while (i < w) {
+			if (src[i] == 0) {
+				++i;
+				continue;
+			}
+			int runEnd = i + 1;
+			while (runEnd < w && src[runEnd] != 0) {
+				++runEnd;
 			}
+			memset(dst + i, fillColor, runEnd - i);
+			i = runEnd;
 		}
 		dst += dstPitch;
 		src += srcPitch;
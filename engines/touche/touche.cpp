@@ -1151,15 +1151,28 @@ void ToucheEngine::moveKeyChar(uint8 *dst, int dstPitch, KeyChar *key) {
 			uint8 *dstCur = dst + copyRegion.r.top * dstPitch + copyRegion.r.left;
 			const uint8 *srcSpr = spr->ptr + (srcOffsY + copyRegion.srcY) * spr->bitmapWidth;
 			srcSpr += vflipped ? srcOffsX + spr->w - 1 - copyRegion.srcX : srcOffsX + copyRegion.srcX;
-			for (int h = 0; h < copyRegion.r.height(); ++h) {
-				for (int w = 0; w < copyRegion.r.width(); ++w) {
-					uint8 color = vflipped ? srcSpr[-w] : srcSpr[w];
-					if (color != 0) {
-						dstCur[w] = color;
+			if (vflipped) {
+				for (int h = 0; h < copyRegion.r.height(); ++h) {
+					for (int w = 0; w < copyRegion.r.width(); ++w) {
+						uint8 color = srcSpr[-w];
+						if (color != 0) {
+							dstCur[w] = color;
+						}
 					}
+					srcSpr += spr->bitmapWidth;
+					dstCur += dstPitch;
+				}
+			} else {
+				for (int h = 0; h < copyRegion.r.height(); ++h) {
+					for (int w = 0; w < copyRegion.r.width(); ++w) {
+						uint8 color = srcSpr[w];
+						if (color != 0) {
+							dstCur[w] = color;
+						}
+					}
+					srcSpr += spr->bitmapWidth;
+					dstCur += dstPitch;
 				}
-				srcSpr += spr->bitmapWidth;
-				dstCur += dstPitch;
 			}
 		}
 	} else { // draw sprite frames with rescaling
@@ -180,13 +180,28 @@ void GraphicsManager::clearScreen() {
 	g_system->fillScreen(0);
 }
 
+void GraphicsManager::buildPaletteMap(uint16 *palMap, const byte *palette) const {
+	for (int i = 0; i < 256; ++i)
+		palMap[i] = (uint16)_screenFormat.RGBToColor(palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2]);
+}
+
 void GraphicsManager::copyToScreenBuffer(const Graphics::Surface *surface, int x, int y, const byte *palette) {
-	Graphics::Surface *surface16 = surface->convertTo(_screenFormat, palette);
+	if (x + surface->w > MAXX || y + surface->h > MAXY) {
+		warning("copyToScreenBuffer: Invalid surface, skipping");
+		return;
+	}
 
-	copyToScreenBufferInner(surface16, x, y);
+	// Convert the paletted frame straight into the screen buffer, without
+	// allocating an intermediate 16-bit surface for every frame
+	uint16 palMap[256];
+	buildPaletteMap(palMap, palette);
 
-	surface16->free();
-	delete surface16;
+	for (int curY = 0; curY < surface->h; ++curY) {
+		const byte *src = (const byte *)surface->getBasePtr(0, curY);
+		uint16 *dst = (uint16 *)_screenBuffer.getBasePtr(x, y + curY);
+		for (int curX = 0; curX < surface->w; ++curX)
+			dst[curX] = palMap[src[curX]];
+	}
 }
 
 void GraphicsManager::copyToScreenBufferInner(const Graphics::Surface *surface, int x, int y) {
@@ -208,28 +223,30 @@ void GraphicsManager::blitToScreenBuffer(const Graphics::Surface *surface, int x
 		return;
 	}
 
-	const uint16 mask = (uint16)_screenFormat.RGBToColor(palette[0], palette[1], palette[2]);
-	Graphics::Surface *surface16 = surface->convertTo(_screenFormat, palette);
+	// As above, convert during the blit via a palette map instead of
+	// through a temporary surface
+	uint16 palMap[256];
+	buildPaletteMap(palMap, palette);
+	const uint16 mask = palMap[0];
 
-	for (int curY = 0; curY < surface16->h; ++curY) {
-		for (int curX = 0; curX < surface16->w; ++curX) {
-			const int destX = x + curX;
-			const int destY = y + curY;
-			const uint16 pixel = (uint16)surface16->getPixel(curX, curY);
+	for (int curY = 0; curY < surface->h; ++curY) {
+		const byte *src = (const byte *)surface->getBasePtr(0, curY);
+		uint16 *dst = (uint16 *)_screenBuffer.getBasePtr(x, y + curY);
+		uint16 *smkBg = useSmkBg ? (uint16 *)_smkBackground.getBasePtr(x, y + curY - TOP) : nullptr;
+		const uint16 *bg = useSmkBg ? (const uint16 *)_background.getBasePtr(x, y + curY - TOP) : nullptr;
+
+		for (int curX = 0; curX < surface->w; ++curX) {
+			const uint16 pixel = palMap[src[curX]];
 			if (pixel != mask) {
-				_screenBuffer.setPixel(destX, destY, pixel);
+				dst[curX] = pixel;
 				if (useSmkBg)
-					_smkBackground.setPixel(destX, destY - TOP, pixel);
+					smkBg[curX] = pixel;
 			} else if (useSmkBg) {
-				const uint16 bgPixel = _background.getPixel(destX, destY - TOP);
-				_screenBuffer.setPixel(destX, destY, bgPixel);
-				_smkBackground.setPixel(destX, destY - TOP, bgPixel);
+				dst[curX] = bg[curX];
+				smkBg[curX] = bg[curX];
 			}
 		}
 	}
-
-	surface16->free();
-	delete surface16;
 }
 
 void GraphicsManager::copyToScreen(int x, int y, int w, int h) {
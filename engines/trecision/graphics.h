@@ -61,6 +61,7 @@ class GraphicsManager {
 	const Graphics::PixelFormat _rgb555Format;
 
 	uint16 aliasing(uint32 val1, uint32 val2, uint8 num);
+	void buildPaletteMap(uint16 *palMap, const byte *palette) const;
 	void drawCharPixel(uint16 y, uint16 charLeft, uint16 charRight, Common::Rect rect, Common::Rect subtitleRect, uint16 color, Graphics::Surface *externalSurface = nullptr);
 	void initCursor();
 	void copyToScreenBufferInner(const Graphics::Surface *surface, int x, int y);
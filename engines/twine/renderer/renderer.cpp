@@ -513,8 +513,8 @@ void Renderer::renderPolygonsCopper(int vtop, int32 vsize, uint16 color) const {
 		ptr1++;
 		uint8 *pDest = out + xMin;
 
-		for (; xMin <= xMax; xMin++) {
-			*pDest++ = (uint8)color;
+		if (xMin <= xMax) {
+			memset(pDest, (uint8)color, xMax - xMin + 1);
 		}
 
 		color += sens;
@@ -548,10 +548,8 @@ void Renderer::renderPolygonsBopper(int vtop, int32 vsize, uint16 color) const {
 		int16 xMax = ptr1[screenHeight];
 		ptr1++;
 
-		uint8 *pDest = out + xMin;
-
-		for (; xMin <= xMax; xMin++) {
-			*pDest++ = (uint8)color;
+		if (xMin <= xMax) {
+			memset(out + xMin, (uint8)color, xMax - xMin + 1);
 		}
 
 		line--;
@@ -583,15 +581,12 @@ void Renderer::renderPolygonsFlat(int vtop, int32 vsize, uint16 color) const {
 		renderLoop = screenHeight;
 	}
 	for (int32 currentLine = 0; currentLine < renderLoop; ++currentLine) {
-		const int16 start = ptr1[0];
-		const int16 stop = ptr1[screenHeight];
+		const int16 start = MAX<int16>(0, ptr1[0]);
+		const int16 stop = MIN<int16>((int16)(screenWidth - 1), ptr1[screenHeight]);
 		ptr1++;
-		const int32 hsize = stop - start;
 
-		for (int32 j = start; j <= hsize + start; j++) {
-			if (j >= 0 && j < screenWidth) {
-				out[j] = color;
-			}
+		if (start <= stop) {
+			memset(out + start, color, stop - start + 1);
 		}
 		out += screenWidth;
 	}
@@ -753,18 +748,16 @@ void Renderer::renderPolygonsGouraud(int vtop, int32 vsize) const {
 			colorDiff /= hsize;
 			hsize++;
 
-			if (hsize % 2) {
-				if (currentXPos >= 0 && currentXPos < screenWidth) {
-					*out2 = startColor / 256;
+			if (start >= 0 && start + hsize <= screenWidth) {
+				// The whole span lies on screen, so the per-pixel clipping
+				// checks can be dropped and the compiler is free to
+				// vectorize this plain interpolation loop.
+				for (int32 i = 0; i < hsize; ++i) {
+					out2[i] = startColor / 256;
+					startColor += colorDiff;
 				}
-				++out2;
-				++currentXPos;
-				startColor += colorDiff;
-			}
-			hsize /= 2;
-
-			do {
-				for (int i = 0; i < 2; ++i) {
+			} else {
+				if (hsize % 2) {
 					if (currentXPos >= 0 && currentXPos < screenWidth) {
 						*out2 = startColor / 256;
 					}
@@ -772,7 +765,19 @@ void Renderer::renderPolygonsGouraud(int vtop, int32 vsize) const {
 					++currentXPos;
 					startColor += colorDiff;
 				}
-			} while (--hsize);
+				hsize /= 2;
+
+				do {
+					for (int i = 0; i < 2; ++i) {
+						if (currentXPos >= 0 && currentXPos < screenWidth) {
+							*out2 = startColor / 256;
+						}
+						++out2;
+						++currentXPos;
+						startColor += colorDiff;
+					}
+				} while (--hsize);
+			}
 		}
 		out += screenWidth;
 	}
@@ -888,24 +893,41 @@ void Renderer::renderPolygonsDither(int vtop, int32 vsize) const {
 					hsize /= 2;
 				}
 
-				do {
-					currentColor &= 0xFF;
-					currentColor += startColor;
-					if (currentXPos >= 0 && currentXPos < screenWidth) {
+				if (start >= 0 && stop < screenWidth) {
+					// Fully visible span: the same color walk as below,
+					// minus the per-pixel clipping checks.
+					do {
+						currentColor &= 0xFF;
+						currentColor += startColor;
 						*out2 = currentColor / 256;
-					}
-					currentXPos++;
-					currentColor &= 0xFF;
-					startColor += colorSize;
-					currentColor = ((currentColor & (0xFF00)) | ((((currentColor & 0xFF) << (hsize & 0xFF))) & 0xFF));
-					currentColor += startColor;
-					if (currentXPos >= 0 && currentXPos < screenWidth) {
+						currentColor &= 0xFF;
+						startColor += colorSize;
+						currentColor = ((currentColor & (0xFF00)) | ((((currentColor & 0xFF) << (hsize & 0xFF))) & 0xFF));
+						currentColor += startColor;
 						*(out2 + 1) = currentColor / 256;
-					}
-					currentXPos++;
-					out2 += 2;
-					startColor += colorSize;
-				} while (--hsize);
+						out2 += 2;
+						startColor += colorSize;
+					} while (--hsize);
+				} else {
+					do {
+						currentColor &= 0xFF;
+						currentColor += startColor;
+						if (currentXPos >= 0 && currentXPos < screenWidth) {
+							*out2 = currentColor / 256;
+						}
+						currentXPos++;
+						currentColor &= 0xFF;
+						startColor += colorSize;
+						currentColor = ((currentColor & (0xFF00)) | ((((currentColor & 0xFF) << (hsize & 0xFF))) & 0xFF));
+						currentColor += startColor;
+						if (currentXPos >= 0 && currentXPos < screenWidth) {
+							*(out2 + 1) = currentColor / 256;
+						}
+						currentXPos++;
+						out2 += 2;
+						startColor += colorSize;
+					} while (--hsize);
+				}
 			}
 		}
 		out += screenWidth;
@@ -970,13 +992,12 @@ void Renderer::renderPolygonsSimplified(int vtop, int32 vsize, uint16 color) con
 		renderLoop = screenHeight;
 	}
 	for (int32 currentLine = 0; currentLine < renderLoop; ++currentLine) {
-		int16 xMin = MAX<int16>(0, ptr1[0]);
+		const int16 xMin = MAX<int16>(0, ptr1[0]);
 		const int16 xMax = MIN<int16>((int16)(screenWidth - 1), ptr1[screenHeight]);
-		uint8 *pDest = out + xMin;
 
 		color = (*ptr2++) >> 8;
-		for (; xMin <= xMax; xMin++) {
-			*pDest++ = color;
+		if (xMin <= xMax) {
+			memset(out + xMin, color, xMax - xMin + 1);
 		}
 		++ptr1;
 
@@ -287,7 +287,6 @@ void Grid::loadGridBricks() {
 	uint32 lastBrick = 0;
 	uint32 currentBllEntryIdx = 1;
 
-	memset(_brickSizeTable, 0, sizeof(_brickSizeTable));
 	memset(_brickUsageTable, 0, sizeof(_brickUsageTable));
 
 	// get block libraries usage bits
@@ -324,6 +323,12 @@ void Grid::loadGridBricks() {
 		if (!_brickUsageTable[i]) {
 			free(_brickTable[i]);
 			_brickTable[i] = nullptr;
+			_brickSizeTable[i] = 0;
+			continue;
+		}
+		if (_brickTable[i]) {
+			// still resident from the previous grid - the brick data is
+			// immutable, so don't hit the HQR file again
 			continue;
 		}
 		_brickSizeTable[i] = HQR::getAllocEntry(&_brickTable[i], Resources::HQR_LBA_BRK_FILE, i);
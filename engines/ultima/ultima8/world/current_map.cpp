@@ -79,6 +79,7 @@ void CurrentMap::clear() {
 			for (iter = _items[i][j].begin(); iter != _items[i][j].end(); ++iter)
 				delete *iter;
 			_items[i][j].clear();
+			_colItems[i][j].clear();
 		}
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
@@ -147,6 +148,7 @@ void CurrentMap::writeback() {
 				}
 			}
 			_items[i][j].clear();
+			_colItems[i][j].clear();
 		}
 	}
 
@@ -252,6 +254,8 @@ void CurrentMap::addItem(Item *item) {
 #endif
 
 	_items[cx][cy].push_front(item);
+	if (isCollisionItem(item))
+		_colItems[cx][cy].push_front(item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -292,6 +296,8 @@ void CurrentMap::addItemToEnd(Item *item) {
 #endif
 
 	_items[cx][cy].push_back(item);
+	if (isCollisionItem(item))
+		_colItems[cx][cy].push_back(item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -407,9 +413,30 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cy = oldy / _mapChunkSize;
 
 	_items[cx][cy].remove(item);
+	// Remove unconditionally: the item's shape flags may have changed
+	// since it was classified.
+	_colItems[cx][cy].remove(item);
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
+void CurrentMap::updateCollisionIndex(Item *item) {
+	int32 ix, iy, iz;
+
+	item->getLocation(ix, iy, iz);
+
+	if (ix < 0 || ix >= _mapChunkSize * MAP_NUM_CHUNKS ||
+	        iy < 0 || iy >= _mapChunkSize * MAP_NUM_CHUNKS) {
+		return;
+	}
+
+	int32 cx = ix / _mapChunkSize;
+	int32 cy = iy / _mapChunkSize;
+
+	_colItems[cx][cy].remove(item);
+	if (isCollisionItem(item))
+		_colItems[cx][cy].push_back(item);
+}
+
 // Check to see if the chunk is on the screen
 static inline bool ChunkOnScreen(int32 cx, int32 cy, int32 sleft, int32 stop, int32 sright, int32 sbot, int mapChunkSize) {
 	int32 scx = (cx * mapChunkSize - cy * mapChunkSize) / 4;
@@ -545,6 +572,12 @@ void CurrentMap::unsetChunkFast(int32 cx, int32 cy) {
 	}
 }
 
+bool CurrentMap::isCollisionItem(const Item *item) {
+	static const uint32 colflagmask = (ShapeInfo::SI_SOLID | ShapeInfo::SI_DAMAGING |
+	                                   ShapeInfo::SI_ROOF | ShapeInfo::SI_LAND);
+	return (item->getShapeInfo()->_flags & colflagmask) != 0;
+}
+
 inline void CurrentMap::clipMapChunks(int &minx, int &maxx, int &miny, int &maxy) {
 	minx = CLIP(minx, 0, MAP_NUM_CHUNKS - 1);
 	maxx = CLIP(maxx, 0, MAP_NUM_CHUNKS - 1);
@@ -777,8 +810,8 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
 			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-				 iter != _items[cx][cy].end(); ++iter) {
+			for (iter = _colItems[cx][cy].begin();
+				 iter != _colItems[cx][cy].end(); ++iter) {
 				const Item *item = *iter;
 				if (item->getObjId() == item_)
 					continue;
@@ -900,8 +933,8 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			for (item_list::const_iterator iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
+			for (item_list::const_iterator iter = _colItems[cx][cy].begin();
+			        iter != _colItems[cx][cy].end(); ++iter) {
 				const Item *citem = *iter;
 				if (citem->getObjId() == item->getObjId())
 					continue;
@@ -1078,9 +1111,13 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
+			// When only blocking items are of interest they are all in the
+			// collision index, which is much shorter in decorated areas.
+			const item_list &chunkitems = blocking_only ?
+			                              _colItems[cx][cy] : _items[cx][cy];
 			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
+			for (iter = chunkitems.begin();
+			        iter != chunkitems.end(); ++iter) {
 				const Item *other_item = *iter;
 				if (other_item->getObjId() == item)
 					continue;
@@ -1266,11 +1303,19 @@ const Item *CurrentMap::traceTopItem(int32 x, int32 y, int32 ztop, int32 zbot, O
 	int maxy = (y / _mapChunkSize) + 1;
 	clipMapChunks(minx, maxx, miny, maxy);
 
+	// The collision index holds every solid/damaging/roof/land item, so
+	// it can be used whenever the caller only asks for those flags.
+	static const uint32 colflagmask = (ShapeInfo::SI_SOLID | ShapeInfo::SI_DAMAGING |
+	                                   ShapeInfo::SI_ROOF | ShapeInfo::SI_LAND);
+	const bool indexed = (shflags & ~colflagmask) == 0;
+
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
+			const item_list &chunkitems = indexed ?
+			                              _colItems[cx][cy] : _items[cx][cy];
 			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
+			for (iter = chunkitems.begin();
+			        iter != chunkitems.end(); ++iter) {
 				const Item *item = *iter;
 				if (item->getObjId() == ignore)
 					continue;
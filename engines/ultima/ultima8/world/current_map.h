@@ -71,6 +71,10 @@ public:
 	void removeItemFromList(Item *item, int32 oldx, int32 oldy);
 	void removeItem(Item *item);
 
+	//! Re-evaluate whether the item belongs in the collision index.
+	//! Must be called when the shape of a mapped item changes.
+	void updateCollisionIndex(Item *item);
+
 	//! Add an item to the list of possible targets (in Crusader)
 	void addTargetItem(const Item *item);
 	//! Remove an item from the list of possible targets (in Crusader)
@@ -223,12 +227,22 @@ private:
 	//! clip the given map chunk numbers to iterate over them safely
 	static void clipMapChunks(int &minx, int &maxx, int &miny, int &maxy);
 
+	//! whether the item's shape flags make it relevant for the collision
+	//! queries (isValidPosition, sweepTest, ...)
+	static bool isCollisionItem(const Item *item);
+
 	Map *_currentMap;
 
 	// item lists. Lots of them :-)
 	// items[x][y]
 	Std::list<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
 
+	// Secondary index over _items holding only the items whose shapes are
+	// solid, damaging, roof or land. The collision queries only care about
+	// those, and this keeps them from walking past piles of purely
+	// decorative items. Kept in the same relative order as _items.
+	Std::list<Item *> _colItems[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+
 	ProcId _eggHatcher;
 
 	// Fast area bit masks -> fast[ry][rx/32]&(1<<(rx&31));
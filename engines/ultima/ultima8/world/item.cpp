@@ -491,6 +491,11 @@ void Item::setShape(uint32 shape) {
 		_shape = shape;
 		_cachedShapeInfo = nullptr;
 	}
+
+	// The new shape's flags may change whether the item belongs in the
+	// map's collision index.
+	if (hasExtFlags(EXT_INCURMAP))
+		World::get_instance()->getCurrentMap()->updateCollisionIndex(this);
 }
 
 bool Item::overlaps(const Item &item2) const {
@@ -81,8 +81,26 @@ void Screen::addRectOptSaveRect(ViewPortResource *viewPort, int idx, const Commo
 	if (viewPort->_rectListCount[idx] == -1)
 		return;
 
-	// TODO: Lots of code in original, which I suspect may be overlapping rect merging
-	viewPort->_rectListPtr[idx]->push_back(bounds);
+	// Merge overlapping areas into a single rect, so restoreBack doesn't
+	// copy the same background region more than once per frame
+	Common::Array<Common::Rect> &rectList = *viewPort->_rectListPtr[idx];
+	Common::Rect r = bounds;
+	bool merged;
+	do {
+		merged = false;
+		for (int i = 0; i < viewPort->_rectListCount[idx]; ++i) {
+			if (r.intersects(rectList[i])) {
+				// Absorb the existing entry into the new rect and drop it
+				r.extend(rectList[i]);
+				rectList.remove_at(i);
+				--viewPort->_rectListCount[idx];
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+
+	rectList.push_back(r);
 	++viewPort->_rectListCount[idx];
 }
 
@@ -460,7 +460,6 @@ bool AdActor3DX::displayShadowVolume() {
 	lightVector.normalize();
 
 	getShadowVolume()->setColor(_shadowColor);
-	getShadowVolume()->reset();
 
 	ModelX *shadowModel;
 	if (_shadowModel) {
@@ -469,7 +468,18 @@ bool AdActor3DX::displayShadowVolume() {
 		shadowModel = _modelX;
 	}
 
-	shadowModel->updateShadowVol(getShadowVolume(), _worldMatrix, lightVector, extrusionDepth);
+	// Only regenerate the silhouette geometry when the pose, placement or
+	// light moved since the last frame.
+	uint32 signature = 2166136261u;
+	signature = hashFloats(signature, _worldMatrix.getData(), 16);
+	signature = hashFloats(signature, lightVector.getData(), 3);
+	signature = hashFloats(signature, &extrusionDepth, 1);
+	signature = (signature ^ shadowModel->getPoseSignature()) * 16777619;
+
+	if (needsShadowVolumeRebuild(signature)) {
+		getShadowVolume()->reset();
+		shadowModel->updateShadowVol(getShadowVolume(), _worldMatrix, lightVector, extrusionDepth);
+	}
 
 	// handle the attachments
 	for (uint32 i = 0; i < _attachments.size(); i++) {
@@ -110,8 +110,18 @@ bool AdAttach3DX::displayShadowVol(const Math::Matrix4 &modelMat, const Math::Ve
 
 	if (_modelX) {
 		if (update) {
-			getShadowVolume()->reset();
-			_modelX->updateShadowVol(getShadowVolume(), finalMat, light, extrusionDepth);
+			// Only regenerate the silhouette geometry when the pose,
+			// placement or light moved since the last frame.
+			uint32 signature = 2166136261u;
+			signature = hashFloats(signature, finalMat.getData(), 16);
+			signature = hashFloats(signature, light.getData(), 3);
+			signature = hashFloats(signature, &extrusionDepth, 1);
+			signature = (signature ^ _modelX->getPoseSignature()) * 16777619;
+
+			if (needsShadowVolumeRebuild(signature)) {
+				getShadowVolume()->reset();
+				_modelX->updateShadowVol(getShadowVolume(), finalMat, light, extrusionDepth);
+			}
 		}
 
 		_gameRef->_renderer3D->setWorldTransform(finalMat);
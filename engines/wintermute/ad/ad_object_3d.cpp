@@ -52,7 +52,9 @@ AdObject3D::AdObject3D(BaseGame *inGame) : AdObject(inGame),
 										   _angVelocity(1.0f),
 										   _ambientLightColor(0x00000000),
 										   _hasAmbientLightColor(false),
-										   _shadowVolume(nullptr) {
+										   _shadowVolume(nullptr),
+										   _shadowVolSignature(0),
+										   _shadowVolSignatureValid(false) {
 	_is3D = true;
 	_state = _nextState = STATE_READY;
 	_shadowType = SHADOW_STENCIL;
@@ -541,6 +543,7 @@ bool AdObject3D::persist(BasePersistenceManager *persistMgr) {
 
 	if (!persistMgr->getIsSaving()) {
 		_shadowVolume = nullptr;
+		_shadowVolSignatureValid = false;
 	}
 
 	_ignoredLights.persist(persistMgr);
@@ -577,11 +580,24 @@ bool AdObject3D::skipTo(int x, int y, bool tolerant) {
 ShadowVolume *AdObject3D::getShadowVolume() {
 	if (_shadowVolume == nullptr) {
 		_shadowVolume = _gameRef->_renderer3D->createShadowVolume();
+		// a freshly created volume holds no geometry yet
+		_shadowVolSignatureValid = false;
 	}
 
 	return _shadowVolume;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool AdObject3D::needsShadowVolumeRebuild(uint32 signature) {
+	if (_shadowVolSignatureValid && signature == _shadowVolSignature) {
+		return false;
+	}
+
+	_shadowVolSignature = signature;
+	_shadowVolSignatureValid = true;
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool AdObject3D::getBonePosition2D(const char *boneName, int32 *x, int32 *y) {
 	if (!_modelX) {
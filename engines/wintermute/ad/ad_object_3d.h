@@ -66,9 +66,18 @@ public:
 	const char *scToString() override;
 
 	ShadowVolume *getShadowVolume();
+	/**
+	 * Check whether the shadow volume has to be regenerated for the given
+	 * hash of its inputs (model pose, world matrix, light, extrusion depth).
+	 * Remembers the signature, so an unchanged setup returns false until
+	 * any input moves and the volume geometry can be reused as-is.
+	 */
+	bool needsShadowVolumeRebuild(uint32 signature);
 
 private:
 	ShadowVolume *_shadowVolume;
+	uint32 _shadowVolSignature;
+	bool _shadowVolSignatureValid;
 	BaseArray<char *> _ignoredLights;
 	void clearIgnoredLights();
 	bool addIgnoredLight(char *lightName);
@@ -40,6 +40,9 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+// Maximum number of disjoint dirty regions kept before collapsing them
+// into their bounding rect, so the composite loop stays cheap.
+#define DIRTY_REGION_LIMIT 8
 
 namespace Wintermute {
 
@@ -57,7 +60,6 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -75,8 +77,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -160,8 +160,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -183,6 +182,7 @@ bool BaseRenderOSystem::flip() {
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
+				unregisterTicketSignature(ticket);
 				it = _renderQueue.erase(it);
 				delete ticket;
 			} else {
@@ -200,9 +200,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -293,6 +291,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
+		registerTicketSignature(ticket);
 		drawFromSurface(ticket);
 		return;
 	}
@@ -303,33 +302,30 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	}
 
 	if (owner) { // Fade-tickets are owner-less
-		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
+		uint32 signature = RenderTicket::computeSignature(owner, *srcRect, *dstRect, transform);
+		// Only walk the queue if a live ticket with this exact draw-state
+		// exists at all; draw-states never seen before go straight to
+		// ticket creation instead of comparing against every ticket.
+		if (_signatureCount.contains(signature)) {
+			RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
+			RenderQueueIterator it = _lastFrameIter;
+			++it;
+			// Avoid calling end() and operator* every time, when potentially going through
+			// LOTS of tickets.
+			RenderQueueIterator endIterator = _renderQueue.end();
+			RenderTicket *compareTicket = nullptr;
+			for (; it != endIterator; ++it) {
+				compareTicket = *it;
+				// Cheap signature reject before the full field comparison
+				if (compareTicket->_signature == signature && *(compareTicket) == compare && compareTicket->_isValid) {
 					drawFromQueuedTicket(it);
+					return;
 				}
-				return;
 			}
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
-	if (!_disableDirtyRects) {
-		drawFromTicket(ticket);
-	} else {
-		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
-		drawFromSurface(ticket);
-	}
+	drawFromTicket(ticket);
 }
 
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
@@ -349,6 +345,7 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	renderTicket->_wantsDraw = true;
+	registerTicketSignature(renderTicket);
 
 	++_lastFrameIter;
 	// In-order
@@ -377,19 +374,57 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
+		unregisterTicketSignature(renderTicket);
 		_renderQueue.erase(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
 	}
 }
 
+void BaseRenderOSystem::registerTicketSignature(RenderTicket *ticket) {
+	_signatureCount[ticket->_signature]++;
+}
+
+void BaseRenderOSystem::unregisterTicketSignature(RenderTicket *ticket) {
+	SignatureCountMap::iterator it = _signatureCount.find(ticket->_signature);
+	if (it != _signatureCount.end()) {
+		if (--(it->_value) == 0) {
+			_signatureCount.erase(it);
+		}
+	}
+}
+
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect clipped(rect);
+	clipped.clip(_renderRect);
+	if (clipped.width() == 0 || clipped.height() == 0) {
+		return;
+	}
+
+	// Merge with every region we overlap; a merge can create new overlaps,
+	// so retry until the rect is disjoint from all remaining regions.
+	bool merged = true;
+	while (merged) {
+		merged = false;
+		for (DirtyRectList::iterator it = _dirtyRects.begin(); it != _dirtyRects.end(); ++it) {
+			if (clipped.intersects(*it)) {
+				clipped.extend(*it);
+				_dirtyRects.erase(it);
+				merged = true;
+				break;
+			}
+		}
+	}
+	_dirtyRects.push_back(clipped);
+
+	if (_dirtyRects.size() > DIRTY_REGION_LIMIT) {
+		Common::Rect bounds = _dirtyRects.front();
+		for (DirtyRectList::iterator it = _dirtyRects.begin(); it != _dirtyRects.end(); ++it) {
+			bounds.extend(*it);
+		}
+		_dirtyRects.clear();
+		_dirtyRects.push_back(bounds);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -402,13 +437,14 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_wantsDraw == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
+			unregisterTicketSignature(ticket);
 			it = _renderQueue.erase(it);
 			delete ticket;
 		} else {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -418,43 +454,48 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
-			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
-		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+	RenderTicket *soleOpaqueTicket = nullptr;
+	if (!_renderQueue.empty() && _renderQueue.front() == _renderQueue.back() && _renderQueue.front()->_transform._alphaDisable == true) {
+		soleOpaqueTicket = _renderQueue.front();
 	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+
+	// Composite each dirty region separately, so two small changes in
+	// opposite corners don't force a redraw of their whole bounding rect.
+	for (DirtyRectList::iterator dirty = _dirtyRects.begin(); dirty != _dirtyRects.end(); ++dirty) {
+		// If our single opaque rect covers the region, we can skip filling.
+		if (!soleOpaqueTicket || !soleOpaqueTicket->_dstRect.contains(*dirty)) {
+			// Apply the clear-color to the dirty region.
+			_renderSurface->fillRect(*dirty, _clearColor);
+		}
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(*dirty)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty region
+				dstClip.clip(*dirty);
+				// we need to keep track of the position to redraw the dirty region
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirty->left, dirty->top), _renderSurface->pitch, dirty->left, dirty->top, dirty->width(), dirty->height());
+	}
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -462,6 +503,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_isValid == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
+			unregisterTicketSignature(ticket);
 			it = _renderQueue.erase(it);
 			delete ticket;
 		} else {
@@ -590,6 +632,7 @@ void BaseRenderOSystem::endSaveLoad() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_signatureCount.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
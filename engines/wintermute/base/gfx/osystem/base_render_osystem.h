@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "graphics/transform_struct.h"
 
@@ -44,7 +45,11 @@ class RenderTicket;
  * are stored as tickets until flip() is called, and compared against the tickets
  * from last frame, to determine which calls were the same as last round
  * (i.e. in the exact same order, with the exact same arguments), and thus
- * figure out which parts of the screen need to be redrawn.
+ * figure out which parts of the screen need to be redrawn. Every ticket
+ * carries a hash of its draw-state, and the renderer keeps a count of live
+ * tickets per hash, so draw-calls whose state was never seen before skip
+ * the comparison walk entirely, and matches are confirmed with a single
+ * integer compare before the full equality check.
  *
  * Important concepts to handle here, is the ordered number of any ticket
  * which is called the "drawNum", every frame this starts from scratch, and
@@ -129,9 +134,18 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+
+	typedef Common::List<Common::Rect> DirtyRectList;
+	/// Disjoint dirty regions, composited one by one at flip() time
+	DirtyRectList _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
 
+	typedef Common::HashMap<uint32, uint32> SignatureCountMap;
+	/// Number of live tickets in _renderQueue per draw-state signature
+	SignatureCountMap _signatureCount;
+	void registerTicketSignature(RenderTicket *ticket);
+	void unregisterTicketSignature(RenderTicket *ticket);
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
@@ -36,13 +36,37 @@
 
 namespace Wintermute {
 
+// One FNV-1a step, mixing a 32-bit word into the hash
+static inline uint32 hashMix(uint32 hash, uint32 value) {
+	return (hash ^ value) * 16777619;
+}
+
+uint32 RenderTicket::computeSignature(BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform) {
+	// Only the fields operator== compares may go into the hash, so that
+	// equal tickets are guaranteed to get equal signatures.
+	uint32 hash = 2166136261u;
+	hash = hashMix(hash, (uint32)(uintptr)owner);
+	hash = hashMix(hash, ((uint16)srcRect.left << 16) | (uint16)srcRect.top);
+	hash = hashMix(hash, ((uint16)srcRect.right << 16) | (uint16)srcRect.bottom);
+	hash = hashMix(hash, ((uint16)dstRect.left << 16) | (uint16)dstRect.top);
+	hash = hashMix(hash, ((uint16)dstRect.right << 16) | (uint16)dstRect.bottom);
+	hash = hashMix(hash, ((uint16)transform._zoom.x << 16) | (uint16)transform._zoom.y);
+	hash = hashMix(hash, (uint32)transform._angle);
+	hash = hashMix(hash, ((uint32)transform._flip << 16) | ((uint32)transform._alphaDisable << 8) | (uint32)transform._blendMode);
+	hash = hashMix(hash, transform._rgbaMod);
+	hash = hashMix(hash, ((uint16)transform._offset.x << 16) | (uint16)transform._offset.y);
+	hash = hashMix(hash, ((uint16)transform._numTimesX << 16) | (uint16)transform._numTimesY);
+	return hash;
+}
+
 RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) :
 	_owner(owner),
 	_srcRect(*srcRect),
 	_dstRect(*dstRect),
 	_isValid(true),
 	_wantsDraw(true),
-	_transform(transform) {
+	_transform(transform),
+	_signature(computeSignature(owner, *srcRect, *dstRect, transform)) {
 	if (surf) {
 		_surface = new Graphics::Surface();
 		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
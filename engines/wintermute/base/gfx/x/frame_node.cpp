@@ -305,6 +305,17 @@ bool FrameNode::updateMatrices(Math::Matrix4 &parentMat) {
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Mix the combined matrices of the whole frame subtree into the given
+// hash, to detect poses that did not move between two updates.
+void FrameNode::hashPose(uint32 *hash) const {
+	*hash = hashFloats(*hash, _combinedMatrix.getData(), 16);
+
+	for (uint32 i = 0; i < _frames.size(); i++) {
+		_frames[i]->hashPose(hash);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool FrameNode::updateMeshes() {
 	bool res = true;
@@ -50,6 +50,7 @@ public:
 
 	bool updateMatrices(Math::Matrix4 &parentMat);
 	bool updateMeshes();
+	void hashPose(uint32 *hash) const;
 	bool resetMatrices();
 	bool render(ModelX *model);
 	bool renderFlatShadowModel();
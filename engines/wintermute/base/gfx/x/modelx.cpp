@@ -164,6 +164,8 @@ ModelX::ModelX(BaseGame *inGame, BaseObject *owner) : BaseObject(inGame),
 	}
 
 	_ticksPerSecond = kDefaultTicksPerSecond;
+	_poseSignature = 0;
+	_poseSignatureValid = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -214,6 +216,9 @@ void ModelX::cleanup(bool complete) {
 	_parentModel = nullptr;
 
 	_ticksPerSecond = kDefaultTicksPerSecond;
+
+	// the cached pose no longer matches any mesh data
+	_poseSignatureValid = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -254,6 +259,9 @@ bool ModelX::mergeFromFile(const Common::String &filename) {
 
 	findBones(false, nullptr);
 
+	// the merged-in meshes have not been skinned yet
+	_poseSignatureValid = false;
+
 	bool found = false;
 
 	for (uint i = 0; i < _mergedModels.size(); ++i) {
@@ -367,6 +375,20 @@ bool ModelX::update() {
 		tempMat.setToIdentity();
 		_rootFrame->updateMatrices(tempMat);
 
+		// The mesh data is fully determined by the combined frame matrices
+		// (skinning combines them with constant offset matrices), so if none
+		// of them moved since the last update, the skinned vertex data is
+		// still current and the per-vertex work can be skipped.
+		uint32 poseSignature = 2166136261u;
+		_rootFrame->hashPose(&poseSignature);
+
+		if (_poseSignatureValid && poseSignature == _poseSignature) {
+			return true;
+		}
+
+		_poseSignature = poseSignature;
+		_poseSignatureValid = true;
+
 		return _rootFrame->updateMeshes();
 	} else {
 		return false;
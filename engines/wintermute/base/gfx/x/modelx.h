@@ -52,6 +52,20 @@ struct MaterialReference {
 	Material *_material;
 };
 
+/**
+ * Mix the raw bits of a float array into an FNV-1a hash. Used to detect
+ * unchanged bone poses and shadow volume inputs, so per-frame CPU skinning
+ * and silhouette extraction can be skipped for resting models.
+ */
+inline uint32 hashFloats(uint32 hash, const float *data, uint32 count) {
+	for (uint32 i = 0; i < count; ++i) {
+		uint32 bits;
+		memcpy(&bits, &data[i], sizeof(bits));
+		hash = (hash ^ bits) * 16777619;
+	}
+	return hash;
+}
+
 #define X_NUM_ANIMATION_CHANNELS 10
 
 class ModelX : public BaseObject {
@@ -174,6 +188,9 @@ public:
 	Math::Matrix4 *getBoneMatrix(const char *boneName);
 	FrameNode *getRootFrame();
 
+	/// Hash of the combined frame matrices as of the last update() call
+	uint32 getPoseSignature() const { return _poseSignature; }
+
 	bool setMaterialSprite(const char *materialName, const char *spriteFilename);
 	bool setMaterialTheora(const char *materialName, const char *theoraFilename);
 	bool initializeSimple();
@@ -198,6 +215,9 @@ private:
 	Rect32 _drawingViewport;
 	Math::Matrix4 _lastViewMat;
 	Math::Matrix4 _lastProjMat;
+
+	uint32 _poseSignature;
+	bool _poseSignatureValid;
 	int32 _lastOffsetX;
 	int32 _lastOffsetY;
 
@@ -32,7 +32,8 @@ static const int INDOOR_POW_INDEXES[3] = { 157, 151, 154 };
 static const int OUTDOOR_POW_INDEXES[3] = { 119, 113, 116 };
 static const int COMBAT_OFFSET_X[4] = { 8, 6, 4, 2 };
 
-OutdoorDrawList::OutdoorDrawList() : _sky1(_data[0]), _sky2(_data[1]),
+OutdoorDrawList::OutdoorDrawList() : _composedHash(0), _composedValid(false),
+	_sky1(_data[0]), _sky2(_data[1]),
 	_groundSprite(_data[2]), _attackImgs1(&_data[124]), _attackImgs2(&_data[95]),
 	_attackImgs3(&_data[76]), _attackImgs4(&_data[53]), _groundTiles(&_data[3]) {
 	_data[0] = DrawStruct(0, 8, 8);
@@ -172,18 +173,69 @@ OutdoorDrawList::OutdoorDrawList() : _sky1(_data[0]), _sky2(_data[1]),
 		_data[idx]._flags |= SPRFLAG_SCENE_CLIPPED;
 }
 
+/**
+ * FNV-1a over everything Window::drawList consumes from a draw list, plus
+ * the party's map state. Two lists with the same hash compose the same
+ * scene pixels, since sprite resources are immutable once loaded
+ */
+static uint32 hashDrawList(const DrawStruct *items, int count) {
+	Party &party = *g_vm->_party;
+	uint32 hash = 2166136261U;
+
+	hash = (hash ^ (uint32)party._mazeId) * 16777619;
+	hash = (hash ^ (uint32)party._mazePosition.x) * 16777619;
+	hash = (hash ^ (uint32)party._mazePosition.y) * 16777619;
+	hash = (hash ^ (uint32)party._mazeDirection) * 16777619;
+
+	for (int idx = 0; idx < count; ++idx, ++items) {
+		if (items->_frame == -1 || items->_scale == -1 || items->_sprites == nullptr)
+			continue;
+		hash = (hash ^ (uint32)idx) * 16777619;
+		hash = (hash ^ (uint32)(uintptr)items->_sprites) * 16777619;
+		hash = (hash ^ (uint32)items->_frame) * 16777619;
+		hash = (hash ^ (uint32)items->_x) * 16777619;
+		hash = (hash ^ (uint32)items->_y) * 16777619;
+		hash = (hash ^ (uint32)items->_scale) * 16777619;
+		hash = (hash ^ (uint32)items->_flags) * 16777619;
+	}
+
+	return hash;
+}
+
 void OutdoorDrawList::draw() {
 	// Mark all items to be drawn as being clipped to the scene area
 	for (int idx = 0; idx < size(); ++idx)
 		_data[idx]._flags |= SPRFLAG_SCENE_CLIPPED;
 
+	// Area that SPRFLAG_SCENE_CLIPPED confines all the sprite draws to
+	Window &win = (*g_vm->_windows)[3];
+	const Common::Rect sceneArea(8, 8, 223, 141);
+	uint32 hash = hashDrawList(_data, size());
+
+	if (_composedValid && hash == _composedHash) {
+		// Identical composition to the last drawn one - restore the
+		// snapshot instead of re-decoding every sprite layer
+		win.copyRectToSurface(_composedScene, sceneArea.left, sceneArea.top,
+			Common::Rect(0, 0, sceneArea.width(), sceneArea.height()));
+		win.addDirtyRect(sceneArea);
+		return;
+	}
+
 	// Draw the list
-	(*g_vm->_windows)[3].drawList(_data, size());
+	win.drawList(_data, size());
+
+	// Snapshot the composed view for reuse
+	if (_composedScene.w != sceneArea.width() || _composedScene.h != sceneArea.height())
+		_composedScene.create(sceneArea.width(), sceneArea.height());
+	_composedScene.copyRectToSurface(win, 0, 0, sceneArea);
+	_composedHash = hash;
+	_composedValid = true;
 }
 
 /*------------------------------------------------------------------------*/
 
 IndoorDrawList::IndoorDrawList() :
+	_composedHash(0), _composedValid(false),
 	_sky1(_data[0]), _sky2(_data[1]), _ground(_data[2]), _horizon(_data[28]),
 	_swl_0F1R(_data[146]), _swl_0F1L(_data[144]), _swl_1F1R(_data[134]),
 	_swl_1F1L(_data[133]), _swl_2F2R(_data[110]), _swl_2F1R(_data[109]),
@@ -385,8 +437,28 @@ void IndoorDrawList::draw() {
 	for (int idx = 0; idx < size(); ++idx)
 		_data[idx]._flags |= SPRFLAG_SCENE_CLIPPED;
 
+	Window &win = (*g_vm->_windows)[3];
+	const Common::Rect sceneArea(8, 8, 223, 141);
+	uint32 hash = hashDrawList(_data, size());
+
+	if (_composedValid && hash == _composedHash) {
+		// Identical composition to the last drawn one - restore the
+		// snapshot instead of re-decoding every sprite layer
+		win.copyRectToSurface(_composedScene, sceneArea.left, sceneArea.top,
+			Common::Rect(0, 0, sceneArea.width(), sceneArea.height()));
+		win.addDirtyRect(sceneArea);
+		return;
+	}
+
 	// Draw the list
-	(*g_vm->_windows)[3].drawList(_data, size());
+	win.drawList(_data, size());
+
+	// Snapshot the composed view for reuse
+	if (_composedScene.w != sceneArea.width() || _composedScene.h != sceneArea.height())
+		_composedScene.create(sceneArea.width(), sceneArea.height());
+	_composedScene.copyRectToSurface(win, 0, 0, sceneArea);
+	_composedHash = hash;
+	_composedValid = true;
 }
 
 /*------------------------------------------------------------------------*/
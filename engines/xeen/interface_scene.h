@@ -32,6 +32,14 @@ namespace Xeen {
 class XeenEngine;
 
 class OutdoorDrawList {
+private:
+	// Snapshot of the last composed scene view, so that drawing the same
+	// list again (standing still, or turning back to a prior facing within
+	// the same animation cycle) restores pixels instead of re-decoding
+	// every sprite layer
+	XSurface _composedScene;
+	uint32 _composedHash;
+	bool _composedValid;
 public:
 	DrawStruct _data[132];
 	DrawStruct &_sky1, &_sky2;
@@ -67,6 +75,11 @@ public:
 };
 
 class IndoorDrawList {
+private:
+	// Snapshot of the last composed scene view, keyed like the outdoor one
+	XSurface _composedScene;
+	uint32 _composedHash;
+	bool _composedValid;
 public:
 	DrawStruct _data[170];
 	DrawStruct &_sky1, &_sky2;
@@ -35,6 +35,8 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_sourceOffsets = new uint32[numRows * numColumns];
+	generateSourceOffsets();
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -42,6 +44,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _sourceOffsets;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -86,44 +89,29 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
 	uint32 destOffset = 0;
+	int16 width = subRect.right - subRect.left;
 
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *sourceOffsets = _sourceOffsets + y * _numColumns + subRect.left;
+		uint16 *dest = destBuffer + destOffset;
 
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
+		for (int16 x = 0; x < width; ++x)
+			dest[x] = sourceBuffer[sourceOffsets[x]];
 
 		destOffset += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
 	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+		const uint32 *sourceOffsets = _sourceOffsets + y * _numColumns;
+		uint16 *dest = destBuffer + y * srcBuf->w;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
-		}
+		for (int16 x = 0; x < srcBuf->w; ++x)
+			dest[x] = sourceBuffer[sourceOffsets[x]];
 	}
 }
 
@@ -141,6 +129,19 @@ void RenderTable::generateRenderTable() {
 	default:
 		break;
 	}
+
+	generateSourceOffsets();
+}
+
+void RenderTable::generateSourceOffsets() {
+	// Flatten the (x, y) offsets into absolute source pixel offsets, so
+	// the per-frame warp doesn't have to resolve them per pixel
+	for (uint y = 0; y < _numRows; ++y) {
+		for (uint x = 0; x < _numColumns; ++x) {
+			uint32 index = y * _numColumns + x;
+			_sourceOffsets[index] = (y + _internalBuffer[index].y) * _numColumns + (x + _internalBuffer[index].x);
+		}
+	}
 }
 
 void RenderTable::generatePanoramaLookupTable() {
@@ -43,6 +43,9 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	// Absolute source pixel offset of every destination pixel, flattened
+	// from _internalBuffer so mutateImage() is a plain gather
+	uint32 *_sourceOffsets;
 	RenderState _renderState;
 
 	struct {
@@ -90,6 +93,7 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void generateSourceOffsets();
 };
 
 } // End of namespace ZVision
@@ -289,7 +289,7 @@ Audio::RewindableAudioStream *makeRawZorkStream(const Common::String &filePath,
 		return NULL;
 
 	if (soundParams->packed) {
-		return makeRawZorkStream(wrapBufferedSeekableReadStream(file, 2048, DisposeAfterUse::YES), soundParams->rate, soundParams->stereo, DisposeAfterUse::YES);
+		return makeRawZorkStream(wrapAdaptiveBufferedSeekableReadStream(file, 2048, 32768, DisposeAfterUse::YES), soundParams->rate, soundParams->stereo, DisposeAfterUse::YES);
 	} else {
 		byte flags = 0;
 		if (soundParams->bits16)
@@ -69,7 +69,8 @@ RLFDecoder::RLFVideoTrack::RLFVideoTrack(Common::SeekableReadStream *stream)
 
 	_frames = new Frame[_frameCount];
 
-	// Read in each frame
+	// Read in each frame's header; the encoded data stays in the stream
+	// until the frame is first needed
 	for (uint i = 0; i < _frameCount; ++i) {
 		_frames[i] = readNextFrame();
 	}
@@ -141,8 +142,9 @@ RLFDecoder::RLFVideoTrack::Frame RLFDecoder::RLFVideoTrack::readNextFrame() {
 	_readStream->readUint32LE();                        // Unknown3
 
 	frame.encodedSize = size - headerSize;
-	frame.encodedData = new int8[frame.encodedSize];
-	_readStream->read(frame.encodedData, frame.encodedSize);
+	frame.encodedData = nullptr;
+	frame.dataOffset = _readStream->pos();
+	_readStream->skip(frame.encodedSize);
 
 	if (type == MKTAG('E', 'L', 'H', 'D')) {
 		frame.type = Masked;
@@ -204,7 +206,19 @@ const Graphics::Surface *RLFDecoder::RLFVideoTrack::decodeNextFrame() {
 	return &_currentFrameBuffer;
 }
 
+void RLFDecoder::RLFVideoTrack::loadFrameData(uint frameNumber) {
+	Frame &frame = _frames[frameNumber];
+	if (frame.encodedData)
+		return;
+
+	frame.encodedData = new int8[frame.encodedSize];
+	_readStream->seek(frame.dataOffset, SEEK_SET);
+	_readStream->read(frame.encodedData, frame.encodedSize);
+}
+
 void RLFDecoder::RLFVideoTrack::applyFrameToCurrent(uint frameNumber) {
+	loadFrameData(frameNumber);
+
 	if (_frames[frameNumber].type == Masked) {
 		decodeMaskedRunLengthEncoding(_frames[frameNumber].encodedData, (int8 *)_currentFrameBuffer.getPixels(), _frames[frameNumber].encodedSize, _frameBufferByteSize);
 	} else if (_frames[frameNumber].type == Simple) {
@@ -65,6 +65,7 @@ private:
 			EncodingType type;
 			int8 *encodedData;
 			uint32 encodedSize;
+			uint32 dataOffset;
 		};
 
 		/**
@@ -75,13 +76,22 @@ private:
 		bool readHeader();
 
 		/**
-		 * Reads the next frame from the RLF file, stores the data in
-		 * a Frame object, then returns the object
+		 * Reads the header of the next frame from the RLF file and
+		 * records where its encoded data lives in the stream. The data
+		 * itself is read in on demand by loadFrameData()
 		 *
-		 * @return    A Frame object representing the frame data
+		 * @return    A Frame object representing the frame
 		 */
 		Frame readNextFrame();
 
+		/**
+		 * Reads the encoded data of the frame from the stream, if it
+		 * hasn't been read already
+		 *
+		 * @param frameNumber    The frame number to load the data for
+		 */
+		void loadFrameData(uint frameNumber);
+
 		/**
 		 * Applies the frame corresponding to frameNumber on top of _currentFrameBuffer.
 		 * This function requires _stream = false so it can look up the Frame object
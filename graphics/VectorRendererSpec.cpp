@@ -23,6 +23,15 @@
 #include "common/util.h"
 #include "common/system.h"
 #include "common/frac.h"
+#include "common/cpuinfo.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define USE_FILL_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define USE_FILL_SIMD
+#endif
 
 #include "graphics/managed_surface.h"
 #include "graphics/nine_patch.h"
@@ -423,6 +432,40 @@ inline frac_t fp_sqroot(uint32 x) {
 
 namespace Graphics {
 
+#ifdef USE_FILL_SIMD
+/**
+ * Fills a run of pixels with 16-byte vector stores. Returns the number of
+ * pixels written; the caller finishes the remaining tail with scalar stores.
+ */
+template<typename PixelType>
+inline int colorFillSIMD(PixelType *first, int count, PixelType color) {
+	const int step = 16 / sizeof(PixelType);
+	int done = 0;
+#if defined(__SSE2__)
+	if (!Common::hasCpuFeatureSSE2())
+		return 0;
+	__m128i value;
+	if (sizeof(PixelType) == 2)
+		value = _mm_set1_epi16((int16)color);
+	else
+		value = _mm_set1_epi32((int32)color);
+	for (; done + step <= count; done += step)
+		_mm_storeu_si128((__m128i *)(first + done), value);
+#else
+	if (sizeof(PixelType) == 2) {
+		uint16x8_t value = vdupq_n_u16((uint16)color);
+		for (; done + step <= count; done += step)
+			vst1q_u16((uint16 *)(first + done), value);
+	} else {
+		uint32x4_t value = vdupq_n_u32((uint32)color);
+		for (; done + step <= count; done += step)
+			vst1q_u32((uint32 *)(first + done), value);
+	}
+#endif
+	return done;
+}
+#endif
+
 /**
  * Fills several pixels in a row with a given color.
  *
@@ -444,6 +487,15 @@ void colorFill(PixelType *first, PixelType *last, PixelType color) {
 	int count = (last - first);
 	if (!count)
 		return;
+#ifdef USE_FILL_SIMD
+	if (count >= (int)(16 / sizeof(PixelType))) {
+		int done = colorFillSIMD(first, count, color);
+		first += done;
+		count -= done;
+		if (!count)
+			return;
+	}
+#endif
 	int n = (count + 7) >> 3;
 	switch (count % 8) {
 	default:
@@ -485,6 +537,15 @@ void colorFillClip(PixelType *first, PixelType *last, PixelType color, int realX
 	if (!count)
 		return;
 
+#ifdef USE_FILL_SIMD
+	if (count >= (int)(16 / sizeof(PixelType))) {
+		int done = colorFillSIMD(first, count, color);
+		first += done;
+		count -= done;
+		if (!count)
+			return;
+	}
+#endif
 	int n = (count + 7) >> 3;
 	switch (count % 8) {
 	default:
@@ -501,6 +562,56 @@ void colorFillClip(PixelType *first, PixelType *last, PixelType color, int realX
 	}
 }
 
+/**
+ * Fills a row of pixels with two alternating colors, starting with c0.
+ * This is the write pattern of the dithered bands of gradient fills.
+ *
+ * @param first Pointer to the first pixel to fill.
+ * @param count Number of pixels to fill.
+ * @param c0 Color of the even pixels (relative to the start of the run).
+ * @param c1 Color of the odd pixels.
+ */
+template<typename PixelType>
+void colorFillAlternate(PixelType *first, int count, PixelType c0, PixelType c1) {
+#ifdef USE_FILL_SIMD
+	const int step = 16 / sizeof(PixelType);
+	if (count >= step
+#if defined(__SSE2__)
+			&& Common::hasCpuFeatureSSE2()
+#endif
+			) {
+		PixelType pat[16 / sizeof(PixelType)];
+		for (int i = 0; i < step; i += 2) {
+			pat[i] = c0;
+			pat[i + 1] = c1;
+		}
+#if defined(__SSE2__)
+		__m128i value = _mm_loadu_si128((const __m128i *)pat);
+		for (; count >= step; count -= step, first += step)
+			_mm_storeu_si128((__m128i *)first, value);
+#else
+		if (sizeof(PixelType) == 2) {
+			uint16x8_t value = vld1q_u16((const uint16 *)pat);
+			for (; count >= step; count -= step, first += step)
+				vst1q_u16((uint16 *)first, value);
+		} else {
+			uint32x4_t value = vld1q_u32((const uint32 *)pat);
+			for (; count >= step; count -= step, first += step)
+				vst1q_u32((uint32 *)first, value);
+		}
+#endif
+	}
+#endif
+	while (count >= 2) {
+		first[0] = c0;
+		first[1] = c1;
+		first += 2;
+		count -= 2;
+	}
+	if (count)
+		*first = c0;
+}
+
 /**
  * Fills several pixels in a column with a given color.
  *
@@ -592,6 +703,15 @@ VectorRendererSpec(PixelFormat format) :
 
 	_fgColor = _bgColor = _bevelColor = 0;
 	_gradientStart = _gradientEnd = 0;
+	_gradCache = nullptr;
+	_gradIndexes = nullptr;
+}
+
+template<typename PixelType>
+VectorRendererSpec<PixelType>::
+~VectorRendererSpec() {
+	for (uint i = 0; i < _gradientCache.size(); i++)
+		delete _gradientCache[i];
 }
 
 /****************************
@@ -638,19 +758,48 @@ calcGradient(uint32 pos, uint32 max) {
 template<typename PixelType>
 void VectorRendererSpec<PixelType>::
 precalcGradient(int h) {
-	PixelType prevcolor = 0, color;
+	// A gradient table only depends on the colors, the gradient factor and
+	// the shape height, all of which the theme reuses frame after frame, so
+	// look for a previously computed table before recomputing anything.
+	for (uint i = 0; i < _gradientCache.size(); i++) {
+		GradientCacheEntry *entry = _gradientCache[i];
+		if (entry->height == h && entry->start == _gradientStart &&
+				entry->end == _gradientEnd && entry->factor == Base::_gradientFactor) {
+			if (i > 0) {
+				_gradientCache.remove_at(i);
+				_gradientCache.insert_at(0, entry);
+			}
+			_gradCache = entry->colors.begin();
+			_gradIndexes = entry->indexes.begin();
+			return;
+		}
+	}
+
+	GradientCacheEntry *entry = new GradientCacheEntry();
+	entry->start = _gradientStart;
+	entry->end = _gradientEnd;
+	entry->factor = Base::_gradientFactor;
+	entry->height = h;
 
-	_gradCache.resize(0);
-	_gradIndexes.resize(0);
+	PixelType prevcolor = 0, color;
 
 	for (int i = 0; i < h + 2; i++) {
 		color = calcGradient(i, h);
 		if (color != prevcolor || i == 0 || i > h - 1) {
 			prevcolor = color;
-			_gradCache.push_back(color);
-			_gradIndexes.push_back(i);
+			entry->colors.push_back(color);
+			entry->indexes.push_back(i);
 		}
 	}
+
+	if (_gradientCache.size() >= kGradientCacheSize) {
+		delete _gradientCache.back();
+		_gradientCache.pop_back();
+	}
+	_gradientCache.insert_at(0, entry);
+
+	_gradCache = entry->colors.begin();
+	_gradIndexes = entry->indexes.begin();
 }
 
 template<typename PixelType>
@@ -681,16 +830,21 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+		// For a fixed row parity the dither pattern reduces to two colors
+		// alternating along the row.
+		PixelType even, odd;
+		if (ox) {
+			even = (grad == 2 || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+			odd = _gradCache[curGrad + 1];
+		} else {
+			even = _gradCache[curGrad];
+			odd = (grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
 		}
+
+		if (x & 1)
+			colorFillAlternate<PixelType>(ptr, width, odd, even);
+		else
+			colorFillAlternate<PixelType>(ptr, width, even, odd);
 	}
 }
 
@@ -723,17 +877,28 @@ gradientFillClip(PixelType *ptr, int width, int x, int y, int realX, int realY)
 	} else if (grad == 3 && ox) {
 		colorFillClip<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1], realX, realY, _clippingArea);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			if (realX + j - x < _clippingArea.left || realX + j - x >= _clippingArea.right) continue;
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+		// Restrict the run to the clipping area; within it the dither
+		// pattern reduces to two colors alternating along the row, just
+		// as in gradientFill().
+		int j0 = MAX<int>(x, x + _clippingArea.left - realX);
+		int j1 = MIN<int>(x + width, x + _clippingArea.right - realX);
+		if (j0 >= j1)
+			return;
+
+		PixelType even, odd;
+		if (ox) {
+			even = (grad == 2 || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+			odd = _gradCache[curGrad + 1];
+		} else {
+			even = _gradCache[curGrad];
+			odd = (grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
 		}
+
+		ptr += j0 - x;
+		if (j0 & 1)
+			colorFillAlternate<PixelType>(ptr, j1 - j0, odd, even);
+		else
+			colorFillAlternate<PixelType>(ptr, j1 - j0, even, odd);
 	}
 }
 
@@ -58,6 +58,7 @@ class VectorRendererSpec : public VectorRenderer {
 
 public:
 	VectorRendererSpec(PixelFormat format);
+	~VectorRendererSpec() override;
 
 	void drawLine(int x1, int y1, int x2, int y2) override;
 	void drawCircle(int x, int y, int r) override;
@@ -318,8 +319,27 @@ protected:
 
 	int _gradientBytes[3]; /**< Color bytes of the active gradient, used to speed up calculation */
 
-	Common::Array<PixelType> _gradCache;
-	Common::Array<int> _gradIndexes;
+	/**
+	 * Precomputed gradient table for one shape height. The theme redraws the
+	 * same widgets with the same gradients frame after frame, so the tables
+	 * are kept across draw calls keyed by colors, factor and height.
+	 */
+	struct GradientCacheEntry {
+		PixelType start, end;
+		int factor;
+		int height;
+		Common::Array<PixelType> colors;
+		Common::Array<int> indexes;
+	};
+
+	enum {
+		kGradientCacheSize = 32 /**< Number of gradient tables kept around */
+	};
+
+	Common::Array<GradientCacheEntry *> _gradientCache; /**< Cached gradient tables, most recently used first */
+
+	const PixelType *_gradCache; /**< Color table of the active gradient */
+	const int *_gradIndexes; /**< Row index table of the active gradient */
 
 	PixelType _bevelColor;
 	PixelType _bitmapAlphaColor;
@@ -29,10 +29,18 @@
 #include "graphics/pixelformat.h"
 #include "graphics/transform_struct.h"
 
+#include "common/cpuinfo.h"
 #include "common/endian.h"
 #include "common/math.h"
 #include "common/rect.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace Graphics {
 
 // TODO: YUV to RGB conversion function
@@ -170,6 +178,160 @@ inline void crossBlitLogic3BppSource(byte *dst, const byte *src, const uint w, c
 	}
 }
 
+// Vectorized fast paths for the crossBlit cases that dominate in practice:
+// expanding a 16 bit surface (565/555 style, no alpha) to a 32 bit format
+// with 8 bit channels, and packing such a 32 bit surface back down to 16
+// bits. Channel placement is taken from the PixelFormats at runtime, so any
+// layout within these constraints is handled. The row converters fall back
+// to the exact scalar per-pixel conversion for leftover pixels and on
+// targets without SIMD support.
+
+inline bool canVectorizeCrossBlit16To32(const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+	// Source channels of 4 to 8 bits expand to 8 bits with two shifts and
+	// an or (see ColorComponent in pixelformat.h); narrower channels and
+	// source alpha would need more work and are not worth a kernel.
+	return srcFmt.aLoss == 8 &&
+	       srcFmt.rLoss <= 4 && srcFmt.gLoss <= 4 && srcFmt.bLoss <= 4 &&
+	       dstFmt.rLoss == 0 && dstFmt.gLoss == 0 && dstFmt.bLoss == 0 &&
+	       (dstFmt.aLoss == 0 || dstFmt.aLoss == 8);
+}
+
+inline bool canVectorizeCrossBlit32To16(const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+	return srcFmt.rLoss == 0 && srcFmt.gLoss == 0 && srcFmt.bLoss == 0 &&
+	       dstFmt.aLoss == 8;
+}
+
+#if defined(__SSE2__)
+// Expands an n bit channel (n = 8 - loss, n >= 4) to 8 bits in each 32 bit
+// lane, matching ColorComponent<n>::expand.
+inline __m128i sse2ExpandChannel(const __m128i c, const int srcShift, const int loss) {
+	const __m128i mask = _mm_set1_epi32(0xFF >> loss);
+	const __m128i v = _mm_and_si128(_mm_srl_epi32(c, _mm_cvtsi32_si128(srcShift)), mask);
+	return _mm_or_si128(_mm_sll_epi32(v, _mm_cvtsi32_si128(loss)),
+	                    _mm_srl_epi32(v, _mm_cvtsi32_si128(8 - 2 * loss)));
+}
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+inline uint32x4_t neonExpandChannel(const uint32x4_t c, const int srcShift, const int loss) {
+	const uint32x4_t v = vandq_u32(vshlq_u32(c, vdupq_n_s32(-srcShift)), vdupq_n_u32(0xFF >> loss));
+	return vorrq_u32(vshlq_u32(v, vdupq_n_s32(loss)), vshlq_u32(v, vdupq_n_s32(-(8 - 2 * loss))));
+}
+#endif
+
+// Converts one row right to left, so the backward in-place case in crossBlit
+// stays correct: every store lands at or beyond the matching load, exactly
+// like the per-pixel backward loop.
+void crossBlitRow16To32(byte *dstRow, const byte *srcRow, const uint w,
+						const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+	const uint32 alphaTerm = (dstFmt.aLoss == 0) ? (0xFFu << dstFmt.aShift) : 0;
+	uint x = w;
+
+#if defined(__SSE2__)
+	if (Common::hasCpuFeatureSSE2()) {
+		const __m128i alpha = _mm_set1_epi32(alphaTerm);
+		const __m128i zero = _mm_setzero_si128();
+		while (x >= 8) {
+			x -= 8;
+			const __m128i pix = _mm_loadu_si128((const __m128i *)(srcRow + x * 2));
+			__m128i half[2];
+			half[0] = _mm_unpacklo_epi16(pix, zero);
+			half[1] = _mm_unpackhi_epi16(pix, zero);
+			for (int i = 0; i < 2; ++i) {
+				__m128i out = alpha;
+				out = _mm_or_si128(out, _mm_sll_epi32(sse2ExpandChannel(half[i], srcFmt.rShift, srcFmt.rLoss), _mm_cvtsi32_si128(dstFmt.rShift)));
+				out = _mm_or_si128(out, _mm_sll_epi32(sse2ExpandChannel(half[i], srcFmt.gShift, srcFmt.gLoss), _mm_cvtsi32_si128(dstFmt.gShift)));
+				out = _mm_or_si128(out, _mm_sll_epi32(sse2ExpandChannel(half[i], srcFmt.bShift, srcFmt.bLoss), _mm_cvtsi32_si128(dstFmt.bShift)));
+				_mm_storeu_si128((__m128i *)(dstRow + x * 4 + i * 16), out);
+			}
+		}
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	{
+		const uint32x4_t alpha = vdupq_n_u32(alphaTerm);
+		while (x >= 8) {
+			x -= 8;
+			const uint16x8_t pix = vld1q_u16((const uint16 *)(srcRow + x * 2));
+			uint32x4_t half[2];
+			half[0] = vmovl_u16(vget_low_u16(pix));
+			half[1] = vmovl_u16(vget_high_u16(pix));
+			for (int i = 0; i < 2; ++i) {
+				uint32x4_t out = alpha;
+				out = vorrq_u32(out, vshlq_u32(neonExpandChannel(half[i], srcFmt.rShift, srcFmt.rLoss), vdupq_n_s32(dstFmt.rShift)));
+				out = vorrq_u32(out, vshlq_u32(neonExpandChannel(half[i], srcFmt.gShift, srcFmt.gLoss), vdupq_n_s32(dstFmt.gShift)));
+				out = vorrq_u32(out, vshlq_u32(neonExpandChannel(half[i], srcFmt.bShift, srcFmt.bLoss), vdupq_n_s32(dstFmt.bShift)));
+				vst1q_u32((uint32 *)(dstRow + x * 4 + i * 16), out);
+			}
+		}
+	}
+#endif
+
+	while (x > 0) {
+		--x;
+		byte a, r, g, b;
+		srcFmt.colorToARGB(*(const uint16 *)(srcRow + x * 2), a, r, g, b);
+		*(uint32 *)(dstRow + x * 4) = dstFmt.ARGBToColor(a, r, g, b);
+	}
+}
+
+// Converts one row left to right; packing never overtakes its loads, so the
+// forward in-place case stays correct as well.
+void crossBlitRow32To16(byte *dstRow, const byte *srcRow, const uint w,
+						const PixelFormat &srcFmt, const PixelFormat &dstFmt) {
+	uint x = 0;
+
+#if defined(__SSE2__)
+	if (Common::hasCpuFeatureSSE2()) {
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+		const __m128i bias = _mm_set1_epi32(0x8000);
+		const __m128i sign = _mm_set1_epi16((int16)0x8000);
+		for (; x + 8 <= w; x += 8) {
+			__m128i out[2];
+			for (int i = 0; i < 2; ++i) {
+				const __m128i pix = _mm_loadu_si128((const __m128i *)(srcRow + x * 4 + i * 16));
+				__m128i acc = _mm_setzero_si128();
+				__m128i t = _mm_and_si128(_mm_srl_epi32(pix, _mm_cvtsi32_si128(srcFmt.rShift)), byteMask);
+				acc = _mm_or_si128(acc, _mm_sll_epi32(_mm_srl_epi32(t, _mm_cvtsi32_si128(dstFmt.rLoss)), _mm_cvtsi32_si128(dstFmt.rShift)));
+				t = _mm_and_si128(_mm_srl_epi32(pix, _mm_cvtsi32_si128(srcFmt.gShift)), byteMask);
+				acc = _mm_or_si128(acc, _mm_sll_epi32(_mm_srl_epi32(t, _mm_cvtsi32_si128(dstFmt.gLoss)), _mm_cvtsi32_si128(dstFmt.gShift)));
+				t = _mm_and_si128(_mm_srl_epi32(pix, _mm_cvtsi32_si128(srcFmt.bShift)), byteMask);
+				acc = _mm_or_si128(acc, _mm_sll_epi32(_mm_srl_epi32(t, _mm_cvtsi32_si128(dstFmt.bLoss)), _mm_cvtsi32_si128(dstFmt.bShift)));
+				out[i] = acc;
+			}
+			// Pack the 32 bit lanes (all values fit in 16 bits) with the
+			// usual SSE2 bias trick around the signed pack.
+			const __m128i packed = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(out[0], bias), _mm_sub_epi32(out[1], bias)), sign);
+			_mm_storeu_si128((__m128i *)(dstRow + x * 2), packed);
+		}
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	{
+		const uint32x4_t byteMask = vdupq_n_u32(0xFF);
+		for (; x + 8 <= w; x += 8) {
+			uint32x4_t out[2];
+			for (int i = 0; i < 2; ++i) {
+				const uint32x4_t pix = vld1q_u32((const uint32 *)(srcRow + x * 4 + i * 16));
+				uint32x4_t acc = vdupq_n_u32(0);
+				uint32x4_t t = vandq_u32(vshlq_u32(pix, vdupq_n_s32(-srcFmt.rShift)), byteMask);
+				acc = vorrq_u32(acc, vshlq_u32(vshlq_u32(t, vdupq_n_s32(-dstFmt.rLoss)), vdupq_n_s32(dstFmt.rShift)));
+				t = vandq_u32(vshlq_u32(pix, vdupq_n_s32(-srcFmt.gShift)), byteMask);
+				acc = vorrq_u32(acc, vshlq_u32(vshlq_u32(t, vdupq_n_s32(-dstFmt.gLoss)), vdupq_n_s32(dstFmt.gShift)));
+				t = vandq_u32(vshlq_u32(pix, vdupq_n_s32(-srcFmt.bShift)), byteMask);
+				acc = vorrq_u32(acc, vshlq_u32(vshlq_u32(t, vdupq_n_s32(-dstFmt.bLoss)), vdupq_n_s32(dstFmt.bShift)));
+				out[i] = acc;
+			}
+			vst1q_u16((uint16 *)(dstRow + x * 2), vcombine_u16(vmovn_u32(out[0]), vmovn_u32(out[1])));
+		}
+	}
+#endif
+
+	for (; x < w; ++x) {
+		byte a, r, g, b;
+		srcFmt.colorToARGB(*(const uint32 *)(srcRow + x * 4), a, r, g, b);
+		*(uint16 *)(dstRow + x * 2) = dstFmt.ARGBToColor(a, r, g, b);
+	}
+}
+
 } // End of anonymous namespace
 
 // Function to blit a rect from one color format to another
@@ -200,7 +362,12 @@ bool crossBlit(byte *dst, const byte *src,
 		} else if (srcFmt.bytesPerPixel == 3) {
 			crossBlitLogic3BppSource<uint16, false>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
 		} else {
-			crossBlitLogic<uint32, uint16, false>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
+			if (canVectorizeCrossBlit32To16(srcFmt, dstFmt)) {
+				for (uint y = 0; y < h; ++y)
+					crossBlitRow32To16(dst + y * dstPitch, src + y * srcPitch, w, srcFmt, dstFmt);
+			} else {
+				crossBlitLogic<uint32, uint16, false>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
+			}
 		}
 	} else if (dstFmt.bytesPerPixel == 4) {
 		if (srcFmt.bytesPerPixel == 2) {
@@ -209,9 +376,14 @@ bool crossBlit(byte *dst, const byte *src,
 			// buffer copying the surface from top left to bottom right would
 			// overwrite the source, since we have more bits per destination
 			// color than per source color.
-			dst += h * dstPitch - dstDelta - dstFmt.bytesPerPixel;
-			src += h * srcPitch - srcDelta - srcFmt.bytesPerPixel;
-			crossBlitLogic<uint16, uint32, true>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
+			if (canVectorizeCrossBlit16To32(srcFmt, dstFmt)) {
+				for (uint y = h; y > 0; --y)
+					crossBlitRow16To32(dst + (y - 1) * dstPitch, src + (y - 1) * srcPitch, w, srcFmt, dstFmt);
+			} else {
+				dst += h * dstPitch - dstDelta - dstFmt.bytesPerPixel;
+				src += h * srcPitch - srcDelta - srcFmt.bytesPerPixel;
+				crossBlitLogic<uint16, uint32, true>(dst, src, w, h, srcFmt, dstFmt, srcDelta, dstDelta);
+			}
 		} else if (srcFmt.bytesPerPixel == 3) {
 			// We need to blit the surface from bottom right to top left here.
 			// This is neeeded, because when we convert to the same memory
@@ -182,6 +182,16 @@ private:
 	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
 	typedef Common::HashMap<uint32, Glyph> GlyphCache;
 	mutable GlyphCache _glyphs;
+
+	/**
+	 * FT_Get_Kerning is queried once per character pair per drawString call,
+	 * so the offsets are cached keyed by the character pair.
+	 */
+	struct KerningPairHash {
+		uint operator()(uint64 key) const { return (uint)(key ^ (key >> 32)); }
+	};
+	typedef Common::HashMap<uint64, int, KerningPairHash> KerningCache;
+	mutable KerningCache _kerningCache;
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
@@ -203,7 +213,7 @@ private:
 
 TTFFont::TTFFont()
 	: _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
-	  _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
+	  _descent(0), _glyphs(), _kerningCache(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
 	  _hasKerning(false), _allowLateCaching(false), _fakeBold(false), _fakeItalic(false) {
 }
 
@@ -562,32 +572,34 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
+	const uint64 pair = ((uint64)left << 32) | right;
+	KerningCache::const_iterator cached = _kerningCache.find(pair);
+	if (cached != _kerningCache.end())
+		return cached->_value;
+
 	assureCached(left);
 	assureCached(right);
 
-	FT_UInt leftGlyph, rightGlyph;
+	FT_UInt leftGlyph = 0, rightGlyph = 0;
 	GlyphCache::const_iterator glyphEntry;
 
 	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
+	if (glyphEntry != _glyphs.end())
 		leftGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
 
 	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
+	if (glyphEntry != _glyphs.end())
 		rightGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
 
-	if (!leftGlyph || !rightGlyph)
-		return 0;
+	int offset = 0;
+	if (leftGlyph && rightGlyph) {
+		FT_Vector kerningVector;
+		FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+		offset = (kerningVector.x / 64);
+	}
 
-	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	_kerningCache[pair] = offset;
+	return offset;
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
@@ -629,14 +641,24 @@ static void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos,
 					dstFormat.colorToARGB(*rDst, dA, dR, dG, dB);
 				}
 
-				double sAn = (double)sA / 255.0;
-				double dAn = (double)dA / 255.0;
-				double oAn = sAn + dAn * (1.0 - sAn);
-
-				dR = static_cast<uint8>(sR * sAn + dR * dAn * (1.0 - sAn) / oAn);
-				dG = static_cast<uint8>(sG * sAn + dG * dAn * (1.0 - sAn) / oAn);
-				dB = static_cast<uint8>(sB * sAn + dB * dAn * (1.0 - sAn) / oAn);
-				dA = static_cast<uint8>(oAn * 255.0);
+				// Porter-Duff "over" with the usual normalized formulas
+				//   oA = sA + dA * (1 - sA)
+				//   oC = sC * sA + dC * dA * (1 - sA) / oA
+				// evaluated in exact integer arithmetic: with
+				// D = sA * 255 + dA * (255 - sA) (i.e. oA * 255^2) the
+				// color channels become
+				//   oC = (sC * sA * D + dC * dA * (255 - sA) * 255) / (255 * D)
+				// which fits comfortably into 64 bit intermediates.
+				const uint32 dstTerm = dA * (255 - sA);
+				const uint32 outDiv = sA * 255 + dstTerm;
+				const uint64 srcScale = (uint64)sA * outDiv;
+				const uint64 dstScale = (uint64)dstTerm * 255;
+				const uint64 div = (uint64)outDiv * 255;
+
+				dR = static_cast<uint8>((sR * srcScale + dR * dstScale) / div);
+				dG = static_cast<uint8>((sG * srcScale + dG * dstScale) / div);
+				dB = static_cast<uint8>((sB * srcScale + dB * dstScale) / div);
+				dA = static_cast<uint8>(outDiv / 255);
 
 				*rDst = dstFormat.ARGBToColor(dA, dR, dG, dB);
 			}
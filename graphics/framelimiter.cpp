@@ -30,12 +30,17 @@ FrameLimiter::FrameLimiter(OSystem *system, const uint framerate) :
 		_system(system),
 		_speedLimitMs(0),
 		_startFrameTime(0),
-		_lastFrameDurationMs(_speedLimitMs) {
+		_lastFrameDurationMs(_speedLimitMs),
+		_frameDurationMicros(0),
+		_deadlineMicros(0),
+		_oversleepMicros(1000),
+		_jitterMicros(0) {
 	// The frame limiter is disabled when vsync is enabled.
 	_enabled = !_system->getFeatureState(OSystem::kFeatureVSync) && framerate != 0;
 
 	if (_enabled) {
 		_speedLimitMs = 1000 / CLIP<uint>(framerate, 0, 100);
+		_frameDurationMicros = 1000000 / CLIP<uint>(framerate, 1, 100);
 	}
 }
 
@@ -50,18 +55,50 @@ void FrameLimiter::startFrame() {
 }
 
 void FrameLimiter::delayBeforeSwap() {
-	uint endFrameTime = _system->getMillis();
-	uint frameDuration = endFrameTime - _startFrameTime;
+	if (!_enabled)
+		return;
 
-	if (_enabled && frameDuration < _speedLimitMs) {
-		_system->delayMillis(_speedLimitMs - frameDuration);
+	uint64 nowMicros = (uint64)_system->getMillis() * 1000;
+
+	// (Re)anchor the deadline after startup, a pause, or a frame so slow
+	// that the timeslot was missed entirely - carrying the old deadline
+	// forward would make the next frames run short to catch up.
+	if (_deadlineMicros == 0 || nowMicros >= _deadlineMicros + _frameDurationMicros)
+		_deadlineMicros = nowMicros + _frameDurationMicros;
+
+	// Coarse sleep, stopping short of the deadline by the measured
+	// oversleep of delayMillis() plus one clock tick.
+	while (nowMicros + _oversleepMicros + 1000 < _deadlineMicros) {
+		const uint sleepMs = (uint)((_deadlineMicros - nowMicros - _oversleepMicros) / 1000);
+		_system->delayMillis(sleepMs);
+
+		const uint64 wokenMicros = (uint64)_system->getMillis() * 1000;
+		const int64 overslept = (int64)(wokenMicros - nowMicros) - (int64)sleepMs * 1000;
+		if (overslept >= 0) {
+			// Keep a slow-moving average so a single scheduler hiccup
+			// does not turn every following sleep into a long spin.
+			_oversleepMicros = (3 * _oversleepMicros + (uint)MIN<int64>(overslept, 4000)) / 4;
+		}
+		nowMicros = wokenMicros;
 	}
+
+	// Spin away the remainder. This burns at most about the oversleep
+	// estimate, and getMillis() is cheap enough to poll for that long.
+	while (nowMicros < _deadlineMicros)
+		nowMicros = (uint64)_system->getMillis() * 1000;
+
+	// Track how far the swap ends up from the paced deadline.
+	const uint missMicros = (uint)(nowMicros - _deadlineMicros);
+	_jitterMicros = (7 * _jitterMicros + missMicros) / 8;
+
+	_deadlineMicros += _frameDurationMicros;
 }
 
 void FrameLimiter::pause(bool pause) {
 	if (!pause) {
 		// Make sure the frame duration value is consistent when resuming
 		_startFrameTime = 0;
+		_deadlineMicros = 0;
 	}
 }
 
@@ -69,4 +106,8 @@ uint FrameLimiter::getLastFrameDuration() const {
 	return _lastFrameDurationMs;
 }
 
+float FrameLimiter::getAverageJitterMs() const {
+	return _jitterMicros / 1000.0f;
+}
+
 } // End of namespace Graphics
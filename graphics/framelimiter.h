@@ -34,6 +34,12 @@ namespace Graphics {
  * by delaying until all of the timeslot allocated to the frame
  * is consumed.
  * Allows to curb CPU usage and have a stable framerate.
+ *
+ * Frames are paced against an absolute deadline kept in microseconds,
+ * so fractional frame periods (16.667 ms at 60 fps) do not drift, and
+ * the delay is hybrid: a coarse delayMillis() sleep that stops short by
+ * the measured oversleep of the backend, followed by a short spin on
+ * getMillis() up to the deadline.
  */
 class FrameLimiter {
 public:
@@ -45,6 +51,14 @@ public:
 	void pause(bool pause);
 
 	uint getLastFrameDuration() const;
+
+	/**
+	 * Average absolute deviation between the end of delayBeforeSwap() and
+	 * the paced frame deadline, in milliseconds. Engines can use this to
+	 * adapt (e.g. skip effects when pacing is poor). The resolution is
+	 * bounded by the 1 ms system clock; 0.0 while the limiter is disabled.
+	 */
+	float getAverageJitterMs() const;
 private:
 	OSystem *_system;
 
@@ -52,6 +66,11 @@ private:
 	uint _speedLimitMs;
 	uint _startFrameTime;
 	uint _lastFrameDurationMs;
+
+	uint64 _frameDurationMicros; ///< Exact frame period, so pacing does not drift
+	uint64 _deadlineMicros;      ///< End of the current frame's timeslot (0 = resync)
+	uint _oversleepMicros;       ///< Measured delayMillis() overshoot, left to the spin
+	uint _jitterMicros;          ///< Average absolute deadline miss
 };
 
 } // End of namespace Graphics
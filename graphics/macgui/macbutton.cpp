@@ -111,11 +111,11 @@ void MacButton::invertInner() {
 			break;
 		case kCBInsetBlack:
 			checkbox = Common::Rect(r.left + 2, r.top + 4, r.left + 2 + 6, r.top + 4 + 6);
-			Graphics::drawFilledRect(checkbox, 0, _wm->getDrawPixel(), &_pd);
+			Graphics::drawFilledRect(checkbox, 0, _wm->getDrawSpan(), &_pd);
 			break;
 		case kCBFilledBlack:
 			checkbox = Common::Rect(r.left + 1, r.top + 3, r.left + 1 + 8, r.top + 3 + 8);
-			Graphics::drawFilledRect(checkbox, 0, _wm->getDrawPixel(), &_pd);
+			Graphics::drawFilledRect(checkbox, 0, _wm->getDrawSpan(), &_pd);
 			break;
 		}
 		break;
@@ -50,6 +50,7 @@ bool BaseMacWindow::isVisible() { return _visible; }
 MacWindow::MacWindow(int id, bool scrollable, bool resizable, bool editable, MacWindowManager *wm) :
 		BaseMacWindow(id, editable, wm), _scrollable(scrollable), _resizable(resizable) {
 	_borderIsDirty = true;
+	_renderedBorderFlags = (uint32)-1;
 
 	_pattern = 0;
 	_hasPattern = false;
@@ -150,7 +151,11 @@ bool MacWindow::draw(bool forceRedraw) {
 	if (!_borderIsDirty && !_contentIsDirty && !forceRedraw)
 		return false;
 
-	if (_borderIsDirty || forceRedraw)
+	// The chrome in _borderSurface only depends on the border flags, the
+	// window size and the scroll state, and everything that changes those
+	// marks the border dirty. A full-refresh redraw can therefore reuse
+	// the cached render and only re-blit it.
+	if (_borderIsDirty || getBorderFlags() != _renderedBorderFlags)
 		drawBorder();
 
 	_contentIsDirty = false;
@@ -247,6 +252,7 @@ void MacWindow::drawBorder() {
 	ManagedSurface *g = &_borderSurface;
 
 	uint32 flags = getBorderFlags();
+	_renderedBorderFlags = flags;
 
 	if (_macBorder.hasBorder(flags)) {
 		drawBorderFromSurface(g, flags);
@@ -276,23 +282,27 @@ void MacWindow::setTitle(const Common::String &title) {
 
 void MacWindow::drawPattern() {
 	byte *pat = _wm->getPatterns()[_pattern - 1];
-	for (int y = 0; y < _composeSurface->h; y++) {
-		for (int x = 0; x < _composeSurface->w; x++) {
-			if (_wm->_pixelformat.bytesPerPixel == 1) {
-				byte *dst = (byte *)_composeSurface->getBasePtr(x, y);
-				if (pat[y % 8] & (1 << (7 - (x % 8))))
-					*dst = _wm->_colorBlack;
-				else
-					*dst = _wm->_colorWhite;
-			} else {
-				uint32 *dst = (uint32 *)_composeSurface->getBasePtr(x, y);
-				if (pat[y % 8] & (1 << (7 - (x % 8))))
-					*dst = _wm->_colorBlack;
-				else
-					*dst = _wm->_colorWhite;
-			}
+	const int w = _composeSurface->w;
+
+	// Expand each of the (up to) 8 distinct pattern rows once, then tile
+	// the rest of the surface with row-wide copies.
+	const int templateRows = MIN<int>(_composeSurface->h, 8);
+	for (int y = 0; y < templateRows; y++) {
+		byte patRow = pat[y % 8];
+		if (_wm->_pixelformat.bytesPerPixel == 1) {
+			byte *dst = (byte *)_composeSurface->getBasePtr(0, y);
+			for (int x = 0; x < w; x++)
+				dst[x] = (patRow & (1 << (7 - (x % 8)))) ? _wm->_colorBlack : _wm->_colorWhite;
+		} else {
+			uint32 *dst = (uint32 *)_composeSurface->getBasePtr(0, y);
+			for (int x = 0; x < w; x++)
+				dst[x] = (patRow & (1 << (7 - (x % 8)))) ? _wm->_colorBlack : _wm->_colorWhite;
 		}
 	}
+
+	for (int y = 8; y < _composeSurface->h; y++)
+		memcpy(_composeSurface->getBasePtr(0, y), _composeSurface->getBasePtr(0, y % 8),
+			w * _wm->_pixelformat.bytesPerPixel);
 }
 
 void MacWindow::setHighlight(WindowClick highlightedPart) {
@@ -373,6 +373,7 @@ protected:
 	ManagedSurface _borderSurface;
 
 	bool _borderIsDirty;
+	uint32 _renderedBorderFlags; ///< Flags the cached chrome in _borderSurface was rendered with
 	Common::Rect _innerDims;
 
 	Common::List<Common::Rect> _dirtyRects;
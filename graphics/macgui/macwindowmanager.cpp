@@ -797,6 +797,70 @@ MacDrawPixPtr MacWindowManager::getDrawPixel() {
 		return &macDrawPixel<uint32 *>;
 }
 
+// Span flavor of macDrawPixel(): same pattern semantics, but clips and
+// resolves the pattern row once per run and then walks the row with plain
+// pointer increments instead of a bounds check and getBasePtr() per pixel.
+template<typename T>
+void macDrawSpan(int x1, int x2, int y, int color, void *data) {
+	MacPlotData *p = (MacPlotData *)data;
+
+	if (p->fillType > p->patterns->size() || !p->fillType)
+		return;
+
+	if (p->thickness != 1) {
+		for (int x = x1; x <= x2; x++)
+			macDrawPixel<T>(x, y, color, data);
+		return;
+	}
+
+	if (y < 0 || y >= p->surface->h)
+		return;
+
+	x1 = MAX(x1, 0);
+	x2 = MIN(x2, p->surface->w - 1);
+	if (x1 > x2)
+		return;
+
+	const byte *pat = p->patterns->operator[](p->fillType - 1);
+	uint yu = (uint)y;
+	byte patRow = pat[(yu - p->fillOriginY) % 8];
+
+	T ptr = (T)p->surface->getBasePtr(x1, yu);
+
+	if (p->invert) {
+		for (int x = x1; x <= x2; x++, ptr++)
+			*ptr = ~(*ptr);
+	} else if (patRow == 0xff) {
+		for (int x = x1; x <= x2; x++, ptr++)
+			*ptr = color;
+	} else if (patRow == 0x00) {
+		for (int x = x1; x <= x2; x++, ptr++)
+			*ptr = p->bgColor;
+	} else {
+		// Expand the pattern row to one color per phase, so the inner
+		// loop is a table lookup instead of a shift and mask per pixel.
+		uint32 rowColors[8];
+		for (int i = 0; i < 8; i++)
+			rowColors[i] = (patRow & (1 << (7 - i))) ? color : p->bgColor;
+
+		for (int x = x1; x <= x2; x++, ptr++)
+			*ptr = rowColors[((uint)x - p->fillOriginX) & 7];
+	}
+
+	if (p->mask) {
+		T mptr = (T)p->mask->getBasePtr(x1, yu);
+		for (int x = x1; x <= x2; x++, mptr++)
+			*mptr = 0xff;
+	}
+}
+
+MacDrawSpanPtr MacWindowManager::getDrawSpan() {
+	if (_pixelformat.bytesPerPixel == 1)
+		return &macDrawSpan<byte *>;
+	else
+		return &macDrawSpan<uint32 *>;
+}
+
 // get the function of drawing invert pixel for default palette
 MacDrawPixPtr MacWindowManager::getDrawInvertPixel() {
 	if (_pixelformat.bytesPerPixel == 1)
@@ -845,7 +909,7 @@ void MacWindowManager::drawDesktop() {
 
 		MacPlotData pd(_desktop, nullptr, &_patterns, kPatternCheckers, 0, 0, 1, _colorWhite);
 
-		Graphics::drawRoundRect(r, kDesktopArc, _colorBlack, true, getDrawPixel(), &pd);
+		Graphics::drawRoundRect(r, kDesktopArc, _colorBlack, true, getDrawSpan(), &pd);
 	}
 }
 
@@ -135,6 +135,7 @@ struct ZoomBox {
 };
 
 typedef void (* MacDrawPixPtr)(int, int, int, void *);
+typedef void (* MacDrawSpanPtr)(int, int, int, int, void *);
 
 /**
  * A manager class to handle window creation, destruction,
@@ -147,6 +148,7 @@ public:
 
 	MacDrawPixPtr getDrawPixel();
 	MacDrawPixPtr getDrawInvertPixel();
+	MacDrawSpanPtr getDrawSpan();
 
 	/**
 	 * Mutator to indicate the surface onto which the desktop will be drawn.
@@ -21,6 +21,7 @@
  */
 
 #include "graphics/managed_surface.h"
+#include "graphics/palette.h"
 #include "common/algorithm.h"
 #include "common/textconsole.h"
 #include "common/endian.h"
@@ -495,37 +496,27 @@ void ManagedSurface::transBlitFrom(const ManagedSurface &src, const Common::Rect
 		srcAlpha, srcPalette, dstPalette, mask, maskOnly);
 }
 
-static uint findBestColor(const uint32 *palette, byte cr, byte cg, byte cb) {
-	uint bestColor = 0;
-	double min = 0xFFFFFFFF;
-
-	for (uint i = 0; i < 256; ++i) {
-		uint col = palette[i];
-
-		int rmean = ((col & 0xff) + cr) / 2;
-		int r = (col & 0xff) - cr;
-		int g = ((col >> 8) & 0xff) - cg;
-		int b = ((col >> 16) & 0xff) - cb;
-
-		double dist = sqrt((((512 + rmean) * r * r) >> 8) + 4 * g * g + (((767 - rmean) * b * b) >> 8));
-		if (min > dist) {
-			bestColor = i;
-			min = dist;
-		}
-	}
-
-	return bestColor;
-}
+// Shared between blit calls, so repeated blits against the same destination
+// palette reuse the previously resolved matches.
+static PaletteLookup g_paletteLookup;
 
 static byte *createPaletteLookup(const uint32 *srcPalette, const uint32 *dstPalette) {
 	byte *lookup = new byte[256];
+	byte pal[256 * 3];
+
+	for (int i = 0; i < 256; i++) {
+		pal[i * 3 + 0] = dstPalette[i] & 0xff;
+		pal[i * 3 + 1] = (dstPalette[i] >> 8) & 0xff;
+		pal[i * 3 + 2] = (dstPalette[i] >> 16) & 0xff;
+	}
+	g_paletteLookup.setPalette(pal, 256);
 
 	for (int i = 0; i < 256; i++) {
 		uint col = srcPalette[i];
 		if (col == dstPalette[i]) {
 			lookup[i] = i;
 		} else {
-			lookup[i] = findBestColor(dstPalette, col & 0xff, (col >> 8) & 0xff, (col >> 16) & 0xff);
+			lookup[i] = g_paletteLookup.findBestColor(col & 0xff, (col >> 8) & 0xff, (col >> 16) & 0xff);
 		}
 	}
 
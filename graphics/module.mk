@@ -29,6 +29,7 @@ MODULE_OBJS := \
 	macgui/macwindowmanager.o \
 	managed_surface.o \
 	nine_patch.o \
+	palette.o \
 	pixelformat.o \
 	primitives.o \
 	renderer.o \
@@ -0,0 +1,90 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/textconsole.h"
+#include "common/util.h"
+#include "graphics/palette.h"
+
+namespace Graphics {
+
+PaletteLookup::PaletteLookup() {
+	_paletteSize = 0;
+	memset(_palette, 0, sizeof(_palette));
+	memset(_valid, 0, sizeof(_valid));
+}
+
+bool PaletteLookup::setPalette(const byte *palette, uint len) {
+	assert(len <= 256);
+
+	if (len == _paletteSize && memcmp(_palette, palette, len * 3) == 0)
+		return false;
+
+	memcpy(_palette, palette, len * 3);
+	_paletteSize = len;
+	memset(_valid, 0, sizeof(_valid));
+
+	return true;
+}
+
+byte PaletteLookup::findBestColor(byte cr, byte cg, byte cb) {
+	if (_paletteSize == 0) {
+		warning("PaletteLookup::findBestColor(): no palette was set");
+		return 0;
+	}
+
+	uint cell = ((cr >> 3) << 10) | ((cg >> 3) << 5) | (cb >> 3);
+
+	if (!(_valid[cell >> 5] & (1 << (cell & 31)))) {
+		// Search with the quantized color so that every color falling into
+		// this cell resolves to the same entry. The weighted distance is the
+		// "redmean" metric the ad-hoc scans used; comparing the squared
+		// distances yields the same winner without the sqrt.
+		const int qr = cr & ~7, qg = cg & ~7, qb = cb & ~7;
+
+		uint bestColor = 0;
+		uint32 min = 0xFFFFFFFF;
+
+		for (uint i = 0; i < _paletteSize; ++i) {
+			int rmean = (_palette[3 * i + 0] + qr) / 2;
+			int r = _palette[3 * i + 0] - qr;
+			int g = _palette[3 * i + 1] - qg;
+			int b = _palette[3 * i + 2] - qb;
+
+			uint32 dist = (((512 + rmean) * r * r) >> 8) + 4 * g * g + (((767 - rmean) * b * b) >> 8);
+			if (min > dist) {
+				bestColor = i;
+				min = dist;
+			}
+		}
+
+		_lookup[cell] = bestColor;
+		_valid[cell >> 5] |= 1 << (cell & 31);
+	}
+
+	return _lookup[cell];
+}
+
+byte PaletteLookup::findBestColor(uint32 rgb) {
+	return findBestColor((rgb >> 16) & 0xff, (rgb >> 8) & 0xff, rgb & 0xff);
+}
+
+} // End of namespace Graphics
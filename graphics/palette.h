@@ -107,5 +107,55 @@ public:
 	 */
 	virtual void grabPalette(byte *colors, uint start, uint num) const = 0;
 };
+
+namespace Graphics {
+
+/**
+ * A shared inverse-palette lookup object.
+ *
+ * Several places need nearest-color matching against an 8-bit palette and
+ * used to scan all entries once per pixel. This object quantizes colors to
+ * 5 bits per channel and resolves each of the 32K cube cells at most once
+ * per palette, so repeated queries degenerate into a table lookup. The
+ * cube is flushed whenever a different palette is passed in.
+ *
+ * Matching uses the same perceptually weighted ("redmean") distance as the
+ * ad-hoc scans this replaces.
+ */
+class PaletteLookup {
+public:
+	PaletteLookup();
+
+	/**
+	 * Pass the palette to match against. Flushes the lookup cube only if
+	 * the palette actually differs from the current one.
+	 *
+	 * @param palette  the palette data, in interleaved RGB format
+	 * @param len      number of colors in the palette
+	 * @return true if the palette changed and the cube was flushed
+	 */
+	bool setPalette(const byte *palette, uint len);
+
+	/**
+	 * Find the palette entry closest to the given color.
+	 *
+	 * @note The color is quantized to 5 bits per channel, thus colors
+	 *       falling into the same cube cell map to the same entry.
+	 */
+	byte findBestColor(byte r, byte g, byte b);
+
+	/** Convenience overload taking a color packed as 0x00RRGGBB. */
+	byte findBestColor(uint32 rgb);
+
+private:
+	byte _palette[256 * 3];
+	uint _paletteSize;
+
+	byte _lookup[32768];       /**< One entry per 555-quantized color */
+	uint32 _valid[32768 / 32]; /**< Bitmap of resolved cube cells */
+};
+
+} // End of namespace Graphics
+
  /** @} */
 #endif
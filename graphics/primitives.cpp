@@ -80,6 +80,53 @@ void drawVLine(int x, int y1, int y2, int color, void (*plotProc)(int, int, int,
 		(*plotProc)(x, y, color, data);
 }
 
+namespace {
+
+// Adapters letting the scan conversion code of the filled primitives emit
+// either single pixels or whole horizontal spans, depending on which
+// callback flavor the caller provided.
+
+struct PixelPlotter {
+	void (*plotProc)(int, int, int, void *);
+	void *data;
+
+	PixelPlotter(void (*proc)(int, int, int, void *), void *d) : plotProc(proc), data(d) {}
+
+	void plot(int x, int y, int color) const {
+		(*plotProc)(x, y, color, data);
+	}
+	void span(int x1, int x2, int y, int color) const {
+		drawHLine(x1, x2, y, color, plotProc, data);
+	}
+	void vspan(int x, int y1, int y2, int color) const {
+		drawVLine(x, y1, y2, color, plotProc, data);
+	}
+};
+
+struct SpanPlotter {
+	SpanProc spanProc;
+	void *data;
+
+	SpanPlotter(SpanProc proc, void *d) : spanProc(proc), data(d) {}
+
+	void plot(int x, int y, int color) const {
+		(*spanProc)(x, x, y, color, data);
+	}
+	void span(int x1, int x2, int y, int color) const {
+		if (x1 > x2)
+			SWAP(x1, x2);
+		(*spanProc)(x1, x2, y, color, data);
+	}
+	void vspan(int x, int y1, int y2, int color) const {
+		if (y1 > y2)
+			SWAP(y1, y2);
+		for (int y = y1; y <= y2; y++)
+			(*spanProc)(x, x, y, color, data);
+	}
+};
+
+} // End of anonymous namespace
+
 void drawThickLine(int x0, int y0, int x1, int y1, int penX, int penY, int color, void (*plotProc)(int, int, int, void *), void *data) {
 	assert(penX > 0 && penY > 0);
 
@@ -239,9 +286,18 @@ void drawThickLine2(int x1, int y1, int x2, int y2, int thick, int color, void (
 	}
 }
 
-void drawFilledRect(Common::Rect &rect, int color, void (*plotProc)(int, int, int, void *), void *data) {
+template<typename Plotter>
+static void drawFilledRectImpl(Common::Rect &rect, int color, const Plotter &p) {
 	for (int y = rect.top; y <= rect.bottom; y++)
-		drawHLine(rect.left, rect.right, y, color, plotProc, data);
+		p.span(rect.left, rect.right, y, color);
+}
+
+void drawFilledRect(Common::Rect &rect, int color, void (*plotProc)(int, int, int, void *), void *data) {
+	drawFilledRectImpl(rect, color, PixelPlotter(plotProc, data));
+}
+
+void drawFilledRect(Common::Rect &rect, int color, SpanProc spanProc, void *data) {
+	drawFilledRectImpl(rect, color, SpanPlotter(spanProc, data));
 }
 
 void drawRect(Common::Rect &rect, int color, void (*plotProc)(int, int, int, void *), void *data) {
@@ -252,7 +308,8 @@ void drawRect(Common::Rect &rect, int color, void (*plotProc)(int, int, int, voi
 }
 
 // http://members.chello.at/easyfilter/bresenham.html
-void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
+template<typename Plotter>
+static void drawRoundRectImpl(Common::Rect &rect, int arc, int color, bool filled, const Plotter &p) {
 	if (rect.height() < rect.width()) {
 		int x = -arc, y = 0, err = 2-2*arc; /* II. Quadrant */
 		int dy = rect.height() - arc * 2;
@@ -264,13 +321,13 @@ void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*p
 
 		do {
 			if (filled) {
-				drawHLine(rect.left + x + r, rect.right - x - r, rect.top    - y + r - stop, color, plotProc, data);
-				drawHLine(rect.left + x + r, rect.right - x - r, rect.bottom + y - r + stop, color, plotProc, data);
+				p.span(rect.left + x + r, rect.right - x - r, rect.top    - y + r - stop, color);
+				p.span(rect.left + x + r, rect.right - x - r, rect.bottom + y - r + stop, color);
 			} else {
-				(*plotProc)(rect.left  + x + r, rect.top    - y + r - stop, color, data);
-				(*plotProc)(rect.right - x - r, rect.top    - y + r - stop, color, data);
-				(*plotProc)(rect.left  + x + r, rect.bottom + y - r + stop, color, data);
-				(*plotProc)(rect.right - x - r, rect.bottom + y - r + stop, color, data);
+				p.plot(rect.left  + x + r, rect.top    - y + r - stop, color);
+				p.plot(rect.right - x - r, rect.top    - y + r - stop, color);
+				p.plot(rect.left  + x + r, rect.bottom + y - r + stop, color);
+				p.plot(rect.right - x - r, rect.bottom + y - r + stop, color);
 
 				lastx = x;
 				lasty = y;
@@ -286,16 +343,16 @@ void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*p
 			x = lastx;
 			y = lasty;
 
-			drawHLine(rect.left + x + r, rect.right - x - r, rect.top    - y + r - stop, color, plotProc, data);
-			drawHLine(rect.left + x + r, rect.right - x - r, rect.bottom + y - r + stop, color, plotProc, data);
+			p.span(rect.left + x + r, rect.right - x - r, rect.top    - y + r - stop, color);
+			p.span(rect.left + x + r, rect.right - x - r, rect.bottom + y - r + stop, color);
 		}
 
 		for (int i = 1; i < dy; i++) {
 			if (filled) {
-				drawHLine(rect.left, rect.right, rect.top + r + i, color, plotProc, data);
+				p.span(rect.left, rect.right, rect.top + r + i, color);
 			} else {
-				(*plotProc)(rect.left,  rect.top + r + i, color, data);
-				(*plotProc)(rect.right, rect.top + r + i, color, data);
+				p.plot(rect.left,  rect.top + r + i, color);
+				p.plot(rect.right, rect.top + r + i, color);
 			}
 		}
 	} else {
@@ -309,13 +366,13 @@ void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*p
 
 		do {
 			if (filled) {
-				drawVLine(rect.left  - x + r - stop, rect.top + y + r, rect.bottom - y - r, color, plotProc, data);
-				drawVLine(rect.right + x - r + stop, rect.top + y + r, rect.bottom - y - r, color, plotProc, data);
+				p.vspan(rect.left  - x + r - stop, rect.top + y + r, rect.bottom - y - r, color);
+				p.vspan(rect.right + x - r + stop, rect.top + y + r, rect.bottom - y - r, color);
 			} else {
-				(*plotProc)(rect.left  - x + r - stop, rect.top    + y + r, color, data);
-				(*plotProc)(rect.left  - x + r - stop, rect.bottom - y - r, color, data);
-				(*plotProc)(rect.right + x - r + stop, rect.top    + y + r, color, data);
-				(*plotProc)(rect.right + x - r + stop, rect.bottom - y - r, color, data);
+				p.plot(rect.left  - x + r - stop, rect.top    + y + r, color);
+				p.plot(rect.left  - x + r - stop, rect.bottom - y - r, color);
+				p.plot(rect.right + x - r + stop, rect.top    + y + r, color);
+				p.plot(rect.right + x - r + stop, rect.bottom - y - r, color);
 
 				lastx = x;
 				lasty = y;
@@ -331,24 +388,38 @@ void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*p
 		if (!filled) {
 			x = lastx;
 			y = lasty;
-			drawVLine(rect.left  - x + r - stop, rect.top + y + r, rect.bottom - y - r, color, plotProc, data);
-			drawVLine(rect.right + x - r + stop, rect.top + y + r, rect.bottom - y - r, color, plotProc, data);
+			p.vspan(rect.left  - x + r - stop, rect.top + y + r, rect.bottom - y - r, color);
+			p.vspan(rect.right + x - r + stop, rect.top + y + r, rect.bottom - y - r, color);
 		}
 
-		for (int i = 1; i < dx; i++) {
-			if (filled) {
-				drawVLine(rect.left + r + i, rect.top, rect.bottom, color, plotProc, data);
-			} else {
-				(*plotProc)(rect.left + r + i, rect.top,    color, data);
-				(*plotProc)(rect.left + r + i, rect.bottom, color, data);
+		if (filled) {
+			// The middle part is rectangular, so emit it row-wise: the same
+			// pixels as one column per iteration, but in span-sized runs.
+			if (dx > 1) {
+				for (int yy = rect.top; yy <= rect.bottom; yy++)
+					p.span(rect.left + r + 1, rect.left + r + dx - 1, yy, color);
+			}
+		} else {
+			for (int i = 1; i < dx; i++) {
+				p.plot(rect.left + r + i, rect.top,    color);
+				p.plot(rect.left + r + i, rect.bottom, color);
 			}
 		}
 	}
 }
 
+void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
+	drawRoundRectImpl(rect, arc, color, filled, PixelPlotter(plotProc, data));
+}
+
+void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, SpanProc spanProc, void *data) {
+	drawRoundRectImpl(rect, arc, color, filled, SpanPlotter(spanProc, data));
+}
+
 // Based on public-domain code by Darel Rex Finley, 2007
 // http://alienryderflex.com/polygon_fill/
-void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, void (*plotProc)(int, int, int, void *), void *data) {
+template<typename Plotter>
+static void drawPolygonScanImpl(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, const Plotter &p) {
 	int *nodeX = (int *)calloc(npoints, sizeof(int));
 	int i, j;
 
@@ -377,7 +448,7 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 				nodeX[i] = MAX<int16>(nodeX[i], bbox.left);
 				nodeX[i + 1] = MIN<int16>(nodeX[i + 1], bbox.right);
 
-				drawHLine(nodeX[i], nodeX[i + 1], pixelY, color, plotProc, data);
+				p.span(nodeX[i], nodeX[i + 1], pixelY, color);
 			}
 		}
 	}
@@ -385,8 +456,17 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 	free(nodeX);
 }
 
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, void (*plotProc)(int, int, int, void *), void *data) {
+	drawPolygonScanImpl(polyX, polyY, npoints, bbox, color, PixelPlotter(plotProc, data));
+}
+
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, SpanProc spanProc, void *data) {
+	drawPolygonScanImpl(polyX, polyY, npoints, bbox, color, SpanPlotter(spanProc, data));
+}
+
 // http://members.chello.at/easyfilter/bresenham.html
-void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
+template<typename Plotter>
+static void drawEllipseImpl(int x0, int y0, int x1, int y1, int color, bool filled, const Plotter &p) {
 	int a = abs(x1 - x0), b = abs(y1 - y0), b1 = b & 1; /* values of diameter */
 	long dx = 4 * (1 - a) * b * b, dy = 4 * (b1 + 1) * a * a; /* error increment */
 	long err = dx + dy + b1 * a * a, e2; /* error of 1.step */
@@ -398,13 +478,13 @@ void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*
 
 	do {
 		if (filled) {
-			drawHLine(x0, x1, y0, color, plotProc, data);
-			drawHLine(x0, x1, y1, color, plotProc, data);
+			p.span(x0, x1, y0, color);
+			p.span(x0, x1, y1, color);
 		} else {
-			(*plotProc)(x1, y0, color, data); /*   I. Quadrant */
-			(*plotProc)(x0, y0, color, data); /*  II. Quadrant */
-			(*plotProc)(x0, y1, color, data); /* III. Quadrant */
-			(*plotProc)(x1, y1, color, data); /*  IV. Quadrant */
+			p.plot(x1, y0, color); /*   I. Quadrant */
+			p.plot(x0, y0, color); /*  II. Quadrant */
+			p.plot(x0, y1, color); /* III. Quadrant */
+			p.plot(x1, y1, color); /*  IV. Quadrant */
 		}
 		e2 = 2*err;
 		if (e2 <= dy) { y0++; y1--; err += dy += a; }  /* y step */
@@ -413,19 +493,27 @@ void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*
 
 	while (y0-y1 < b) {  /* too early stop of flat ellipses a=1 */
 		if (filled) {
-			drawHLine(x0 - 1, x0 - 1, y0, color, plotProc, data); /* -> finish tip of ellipse */
-			drawHLine(x1 + 1, x1 + 1, y0, color, plotProc, data);
-			drawHLine(x0 - 1, x0 - 1, y1, color, plotProc, data);
-			drawHLine(x1 + 1, x1 + 1, y1, color, plotProc, data);
+			p.span(x0 - 1, x0 - 1, y0, color); /* -> finish tip of ellipse */
+			p.span(x1 + 1, x1 + 1, y0, color);
+			p.span(x0 - 1, x0 - 1, y1, color);
+			p.span(x1 + 1, x1 + 1, y1, color);
 		} else {
-			(*plotProc)(x0 - 1, y0, color, data); /* -> finish tip of ellipse */
-			(*plotProc)(x1 + 1, y0, color, data);
-			(*plotProc)(x0 - 1, y1, color, data);
-			(*plotProc)(x1 + 1, y1, color, data);
+			p.plot(x0 - 1, y0, color); /* -> finish tip of ellipse */
+			p.plot(x1 + 1, y0, color);
+			p.plot(x0 - 1, y1, color);
+			p.plot(x1 + 1, y1, color);
 		}
 		y0++;
 		y1--;
 	}
 }
 
+void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
+	drawEllipseImpl(x0, y0, x1, y1, color, filled, PixelPlotter(plotProc, data));
+}
+
+void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, SpanProc spanProc, void *data) {
+	drawEllipseImpl(x0, y0, x1, y1, color, filled, SpanPlotter(spanProc, data));
+}
+
 } // End of namespace Graphics
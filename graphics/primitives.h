@@ -40,6 +40,20 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 								void (*plotProc)(int, int, int, void *), void *data);
 void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data);
 
+/**
+ * Callback drawing one horizontal span: all pixels from x1 to x2 inclusive
+ * on row y. The span-batched variants of the filled primitives below emit
+ * whole scanline runs through it instead of calling a plot callback once
+ * per pixel, so the callback can fill the run with a width-optimized inner
+ * loop.
+ */
+typedef void (*SpanProc)(int x1, int x2, int y, int color, void *data);
+
+void drawFilledRect(Common::Rect &rect, int color, SpanProc spanProc, void *data);
+void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, SpanProc spanProc, void *data);
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, SpanProc spanProc, void *data);
+void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, SpanProc spanProc, void *data);
+
 } // End of namespace Graphics
 
 #endif
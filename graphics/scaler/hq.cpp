@@ -4995,7 +4995,7 @@ HQPlugin::HQPlugin() {
 }
 
 void HQPlugin::initialize(const Graphics::PixelFormat &format) {
-	ScalerPluginObject::initialize(format);
+	SourceScaler::initialize(format);
 
 	if (format.bytesPerPixel == 2) {
 		InitLUT(format);
@@ -5011,10 +5011,63 @@ void HQPlugin::initialize(const Graphics::PixelFormat &format) {
 void HQPlugin::deinitialize() {
 	free(RGBtoYUV);
 	RGBtoYUV = 0;
+
+	SourceScaler::deinitialize();
+}
+
+void HQPlugin::internScale(const uint8 *srcPtr, uint32 srcPitch,
+						   uint8 *dstPtr, uint32 dstPitch,
+						   const uint8 *oldSrcPtr, uint32 oldSrcPitch,
+						   int width, int height, const uint8 *buffer, uint32 bufferPitch) {
+	if (!oldSrcPtr) {
+		scaleBand(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		return;
+	}
+
+	// Row-granular change detection. A row's scaled output depends on the
+	// 3x3 source neighborhood, so a row has to be rescaled when it or one
+	// of its direct neighbors changed; everything else is copied from the
+	// buffered output of the previous frame. Contiguous dirty rows are
+	// rescaled as one band, which also gives the scaler the unchanged
+	// overlap rows it reads across the band seams.
+	const uint rowBytes = width * _format.bytesPerPixel;
+	const uint dstRowBytes = width * _factor * _format.bytesPerPixel;
+
+	bool prevChanged = false;
+	bool curChanged = memcmp(srcPtr, oldSrcPtr, rowBytes) != 0;
+	int bandStart = -1;
+
+	for (int y = 0; y < height; y++) {
+		const bool nextChanged = (y + 1 < height) &&
+				memcmp(srcPtr + (y + 1) * srcPitch, oldSrcPtr + (y + 1) * oldSrcPitch, rowBytes) != 0;
+
+		if (prevChanged || curChanged || nextChanged) {
+			if (bandStart < 0)
+				bandStart = y;
+		} else {
+			if (bandStart >= 0) {
+				scaleBand(srcPtr + bandStart * srcPitch, srcPitch,
+				          dstPtr + bandStart * _factor * dstPitch, dstPitch,
+				          width, y - bandStart);
+				bandStart = -1;
+			}
+			for (uint i = 0; i < _factor; i++)
+				memcpy(dstPtr + (y * _factor + i) * dstPitch,
+				       buffer + (y * _factor + i) * bufferPitch, dstRowBytes);
+		}
+
+		prevChanged = curChanged;
+		curChanged = nextChanged;
+	}
+
+	if (bandStart >= 0)
+		scaleBand(srcPtr + bandStart * srcPitch, srcPitch,
+		          dstPtr + bandStart * _factor * dstPitch, dstPitch,
+		          width, height - bandStart);
 }
 
-void HQPlugin::scaleIntern(const uint8 *srcPtr, uint32 srcPitch,
-							uint8 *dstPtr, uint32 dstPitch, int width, int height, int x, int y) {
+void HQPlugin::scaleBand(const uint8 *srcPtr, uint32 srcPitch,
+							uint8 *dstPtr, uint32 dstPitch, int width, int height) {
 	if (_format.bytesPerPixel == 2) {
 		switch (_factor) {
 #ifdef USE_NASM
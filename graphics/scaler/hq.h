@@ -24,7 +24,7 @@
 
 #include "graphics/scalerplugin.h"
 
-class HQPlugin : public ScalerPluginObject {
+class HQPlugin : public SourceScaler {
 public:
 	HQPlugin();
 	void initialize(const Graphics::PixelFormat &format) override;
@@ -33,11 +33,22 @@ public:
 	uint decreaseFactor() override;
 	bool canDrawCursor() const override { return false; }
 	uint extraPixels() const override { return 1; }
+	bool useOldSource() const override { return true; }
 	const char *getName() const override;
 	const char *getPrettyName() const override;
 protected:
-	virtual void scaleIntern(const uint8 *srcPtr, uint32 srcPitch,
-							uint8 *dstPtr, uint32 dstPitch, int width, int height, int x, int y) override;
+	virtual void internScale(const uint8 *srcPtr, uint32 srcPitch,
+							uint8 *dstPtr, uint32 dstPitch,
+							const uint8 *oldSrcPtr, uint32 oldSrcPitch,
+							int width, int height, const uint8 *buffer, uint32 bufferPitch) override;
+
+private:
+	/**
+	 * Unconditionally scales a band of rows; dispatches to the right
+	 * HQ2x/HQ3x implementation for the current factor and format.
+	 */
+	void scaleBand(const uint8 *srcPtr, uint32 srcPitch,
+				   uint8 *dstPtr, uint32 dstPitch, int width, int height);
 };
 
 
@@ -20,15 +20,79 @@
  *
  */
 
+#include "common/cpuinfo.h"
 #include "common/endian.h"
 #include "common/scummsys.h"
 #include "common/system.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "graphics/colormasks.h"
 #include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/palette.h"
 
+#if defined(__SSE2__)
+/**
+ * One 2x box-filter pass over a 16 bit surface, four output pixels per
+ * iteration. Produces bit-identical results to quadBlockInterpolate: the
+ * pixels are widened to 32 bit lanes, so the sum-minus-lowbits truncation
+ * matches the scalar formula exactly.
+ *
+ * The callers run this in place on the surface being downscaled, so each
+ * destination row must not be below its source row pair (which holds for
+ * dst == src with the same pitch).
+ */
+static void createThumbnailHalveSSE2(const uint8 *src, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, uint16 low2Bits) {
+	const __m128i lowMask = _mm_set1_epi32(low2Bits);
+	const __m128i evenMask = _mm_set1_epi32(0xFFFF);
+
+	for (int y = 0; y < height; y += 2) {
+		const uint8 *row0 = src;
+		const uint8 *row1 = src + srcPitch;
+		uint8 *dst = dstPtr;
+		int x = 0;
+
+		for (; x + 8 <= width; x += 8, dst += 8) {
+			const __m128i a = _mm_loadu_si128((const __m128i *)(row0 + 2 * x));
+			const __m128i b = _mm_loadu_si128((const __m128i *)(row1 + 2 * x));
+			const __m128i p1 = _mm_and_si128(a, evenMask);
+			const __m128i p2 = _mm_srli_epi32(a, 16);
+			const __m128i p3 = _mm_and_si128(b, evenMask);
+			const __m128i p4 = _mm_srli_epi32(b, 16);
+
+			const __m128i sum = _mm_add_epi32(_mm_add_epi32(p1, p2), _mm_add_epi32(p3, p4));
+			__m128i low = _mm_add_epi32(
+				_mm_add_epi32(_mm_and_si128(p1, lowMask), _mm_and_si128(p2, lowMask)),
+				_mm_add_epi32(_mm_and_si128(p3, lowMask), _mm_and_si128(p4, lowMask)));
+			low = _mm_and_si128(low, lowMask);
+
+			__m128i res = _mm_srli_epi32(_mm_sub_epi32(sum, low), 2);
+
+			// Pack the 32 bit lanes back to 16 bits; the sign-extension
+			// dance keeps packs from saturating values above 0x7FFF
+			res = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+			res = _mm_packs_epi32(res, res);
+			_mm_storel_epi64((__m128i *)dst, res);
+		}
+
+		for (; x < width; x += 2, dst += 2) {
+			const uint32 p1 = *(const uint16 *)(row0 + 2 * x);
+			const uint32 p2 = *(const uint16 *)(row0 + 2 * x + 2);
+			const uint32 p3 = *(const uint16 *)(row1 + 2 * x);
+			const uint32 p4 = *(const uint16 *)(row1 + 2 * x + 2);
+			const uint32 lowbits = ((p1 & low2Bits) + (p2 & low2Bits) + (p3 & low2Bits) + (p4 & low2Bits)) & low2Bits;
+			*(uint16 *)dst = (uint16)((p1 + p2 + p3 + p4 - lowbits) >> 2);
+		}
+
+		src += 2 * srcPitch;
+		dstPtr += dstPitch;
+	}
+}
+#endif
+
 template<typename ColorMask>
 uint16 quadBlockInterpolate(const uint8 *src, uint32 srcPitch) {
 	uint16 colorx1y1 = *(((const uint16 *)src));
@@ -46,6 +110,13 @@ void createThumbnail_2(const uint8 *src, uint32 srcPitch, uint8 *dstPtr, uint32
 	width &= ~1;
 	height &= ~1;
 
+#if defined(__SSE2__)
+	if (Common::hasCpuFeatureSSE2()) {
+		createThumbnailHalveSSE2(src, srcPitch, dstPtr, dstPitch, width, height, (uint16)ColorMask::kLow2Bits);
+		return;
+	}
+#endif
+
 	for (int y = 0; y < height; y += 2) {
 		for (int x = 0; x < width; x += 2, dstPtr += 2) {
 			*((uint16 *)dstPtr) = quadBlockInterpolate<ColorMask>(src + 2 * x, srcPitch);
@@ -61,6 +132,17 @@ void createThumbnail_4(const uint8 *src, uint32 srcPitch, uint8 *dstPtr, uint32
 	width &= ~3;
 	height &= ~3;
 
+#if defined(__SSE2__)
+	if (Common::hasCpuFeatureSSE2()) {
+		// Two 2x passes compute exactly the intermediate averages the
+		// nested quadBlockInterpolate calls below would, so the result
+		// is bit-identical to the single 4x pass
+		createThumbnailHalveSSE2(src, srcPitch, dstPtr, dstPitch, width, height, (uint16)ColorMask::kLow2Bits);
+		createThumbnailHalveSSE2(dstPtr, dstPitch, dstPtr, dstPitch, width / 2, height / 2, (uint16)ColorMask::kLow2Bits);
+		return;
+	}
+#endif
+
 	for (int y = 0; y < height; y += 4) {
 		for (int x = 0; x < width; x += 4, dstPtr += 2) {
 			uint16 upleft = quadBlockInterpolate<ColorMask>(src + 2 * x, srcPitch);
@@ -70,10 +70,31 @@ void FontSJIS::drawChar(Graphics::Surface &dst, uint16 ch, int x, int y, uint32
 	drawChar(dst.getBasePtr(x, y), ch, dst.pitch, dst.format.bytesPerPixel, c1, c2, dst.w - x, dst.h - y);
 }
 
+void FontSJIS::drawString(Graphics::Surface &dst, const Common::String &str, int x, int y, uint32 c1, uint32 c2) const {
+	for (uint i = 0; i < str.size(); ) {
+		uint16 ch = (uint8)str[i++];
+		if (ch > 0x80 && ch < 0xF0 && !(ch >= 0xA0 && ch <= 0xDF) && i < str.size())
+			ch |= (uint8)str[i++] << 8;
+
+		drawChar(dst, ch, x, y, c1, c2);
+		x += getCharWidth(ch);
+	}
+}
+
 FontSJISBase::FontSJISBase()
 : _drawMode(kDefaultMode), _flippedMode(false), _fatPrint(false), _fontWidth(16), _fontHeight(16), _bitPosNewLineMask(0) {
 }
 
+FontSJISBase::~FontSJISBase() {
+	clearGlyphCache();
+}
+
+void FontSJISBase::clearGlyphCache() const {
+	for (GlyphCacheMap::iterator i = _glyphCache.begin(); i != _glyphCache.end(); ++i)
+		delete i->_value;
+	_glyphCache.clear();
+}
+
 void FontSJISBase::setDrawingMode(DrawingMode mode) {
 	if (hasFeature(1 << mode))
 		_drawMode = mode;
@@ -233,6 +254,87 @@ const uint8 *FontSJISBase::makeFatCharacter(const uint8 *glyph, const int w) con
 	return _tempGlyph2;
 }
 
+template<typename Color>
+void FontSJISBase::renderGlyph(uint8 *dst, int pitch, const uint8 *glyphSource, const uint8 *outline,
+		int width, int height, int outlineXOffset, int outlineYOffset,
+		int outlineExtraWidth, int outlineExtraHeight, Color c1, Color c2) const {
+	int shadowOffset = sizeof(Color);
+	if (_drawMode == kShadowLeftMode)
+		shadowOffset = -shadowOffset;
+
+	if (_drawMode == kOutlineMode) {
+		blitCharacter<Color>(outline, width + outlineExtraWidth, height + outlineExtraHeight, dst, pitch, c2);
+		blitCharacter<Color>(glyphSource, width - outlineXOffset, height - outlineYOffset, dst + pitch + sizeof(Color), pitch, c1);
+	} else {
+		if (_drawMode != kDefaultMode) {
+			blitCharacter<Color>(glyphSource, width - outlineXOffset, height, dst + shadowOffset, pitch, c2);
+			blitCharacter<Color>(glyphSource, width, height - outlineYOffset, dst + pitch, pitch, c2);
+			if (_drawMode != kFMTownsShadowMode)
+				blitCharacter<Color>(glyphSource, width - outlineXOffset, height - outlineYOffset, dst + pitch + shadowOffset, pitch, c2);
+		}
+
+		blitCharacter<Color>(glyphSource, width, height, dst, pitch, c1);
+	}
+}
+
+const FontSJISBase::CachedGlyph *FontSJISBase::getCachedGlyph(uint16 ch, int bpp, uint32 c1, uint32 c2,
+		const uint8 *glyphSource, int width, int height) const {
+	// Colors that do not fit into 16 bits cannot be packed into the key.
+	// drawChar() rejects bpp > 2, so this only guards exotic color values.
+	if ((c1 >> 16) || (c2 >> 16))
+		return nullptr;
+
+	const uint64 key = (uint64)ch
+		| ((uint64)_drawMode << 16)
+		| ((uint64)(_flippedMode ? 1 : 0) << 19)
+		| ((uint64)(_fatPrint ? 1 : 0) << 20)
+		| ((uint64)bpp << 21)
+		| ((uint64)c1 << 24)
+		| ((uint64)c2 << 40);
+
+	GlyphCacheMap::iterator i = _glyphCache.find(key);
+	if (i != _glyphCache.end())
+		return i->_value;
+
+	// The cache covers the glyphs of a dialogue page many times over;
+	// simply start over when it fills up.
+	if (_glyphCache.size() >= kGlyphCacheLimit)
+		clearGlyphCache();
+
+	CachedGlyph *glyph = new CachedGlyph();
+	glyph->xOffset = (_drawMode == kShadowLeftMode) ? -1 : 0;
+	const int extra = (_drawMode == kOutlineMode) ? 2 : (_drawMode == kDefaultMode ? 0 : 1);
+	glyph->w = width + extra;
+	glyph->h = height + extra;
+	memset(glyph->mask, 0, sizeof(glyph->mask));
+	memset(glyph->pixels, 0, sizeof(glyph->pixels));
+
+	uint8 outline[18 * 18];
+	if (_drawMode == kOutlineMode) {
+		memset(outline, 0, sizeof(outline));
+		createOutline(outline, glyphSource, width, height);
+	}
+
+	// Keep the shadow-left column inside the buffer; the blit compensates
+	// through xOffset.
+	const int marginLeft = -glyph->xOffset;
+
+	if (bpp == 1)
+		renderGlyph<uint8>((uint8 *)glyph->pixels + marginLeft, kMaxGlyphWidth,
+			glyphSource, outline, width, height, 0, 0, 2, 2, (uint8)c1, (uint8)c2);
+	else
+		renderGlyph<uint16>((uint8 *)glyph->pixels + marginLeft * 2, kMaxGlyphWidth * 2,
+			glyphSource, outline, width, height, 0, 0, 2, 2, (uint16)c1, (uint16)c2);
+
+	// Rendering the same composition with an all-ones color into the mask
+	// marks exactly the pixels the draw would have touched.
+	renderGlyph<uint8>(glyph->mask + marginLeft, kMaxGlyphWidth,
+		glyphSource, outline, width, height, 0, 0, 2, 2, (uint8)1, (uint8)1);
+
+	_glyphCache[key] = glyph;
+	return glyph;
+}
+
 void FontSJISBase::drawChar(void *dst, uint16 ch, int pitch, int bpp, uint32 c1, uint32 c2, int maxW, int maxH) const {
 	const uint8 *glyphSource = 0;
 	int width = 0, height = 0;
@@ -277,46 +379,50 @@ void FontSJISBase::drawChar(void *dst, uint16 ch, int pitch, int bpp, uint32 c1,
 		glyphSource = flipCharacter(glyphSource, width);
 #endif
 
-	int shadowOffset = bpp;
+	if (bpp != 1 && bpp != 2)
+		error("FontSJISBase::drawChar: unsupported bpp: %d", bpp);
+
+	// Unclipped draws go through the glyph cache: the composited result is
+	// copied in a single masked pass instead of re-running the outline and
+	// shadow blits on every call.
+	if (outlineXOffset == 0 && outlineYOffset == 0) {
+		const CachedGlyph *glyph = getCachedGlyph(ch, bpp, c1, c2, glyphSource, width, height);
+		if (glyph) {
+			const uint8 *mask = glyph->mask;
+			if (bpp == 1) {
+				uint8 *d = (uint8 *)dst + glyph->xOffset;
+				const uint8 *src = (const uint8 *)glyph->pixels;
+				for (int y = 0; y < glyph->h; ++y, d += pitch, src += kMaxGlyphWidth, mask += kMaxGlyphWidth) {
+					for (int x = 0; x < glyph->w; ++x)
+						if (mask[x])
+							d[x] = src[x];
+				}
+			} else {
+				uint8 *d = (uint8 *)dst + glyph->xOffset * 2;
+				const uint16 *src = glyph->pixels;
+				for (int y = 0; y < glyph->h; ++y, d += pitch, src += kMaxGlyphWidth, mask += kMaxGlyphWidth) {
+					uint16 *d16 = (uint16 *)d;
+					for (int x = 0; x < glyph->w; ++x)
+						if (mask[x])
+							d16[x] = src[x];
+				}
+			}
+			return;
+		}
+	}
+
 	uint8 outline[18 * 18];
 	if (_drawMode == kOutlineMode) {
 		memset(outline, 0, sizeof(outline));
 		createOutline(outline, glyphSource, width, height);
-	} else if (_drawMode == kShadowLeftMode) {
-		shadowOffset = -shadowOffset;
 	}
 
-	if (bpp == 1) {
-		if (_drawMode == kOutlineMode) {
-			blitCharacter<uint8>(outline, width + outlineExtraWidth, height + outlineExtraHeight, (uint8 *)dst, pitch, c2);
-			blitCharacter<uint8>(glyphSource, width - outlineXOffset, height - outlineYOffset, (uint8 *)dst + pitch + 1, pitch, c1);
-		} else {
-			if (_drawMode != kDefaultMode) {
-				blitCharacter<uint8>(glyphSource, width - outlineXOffset, height, ((uint8 *)dst) + shadowOffset, pitch, c2);
-				blitCharacter<uint8>(glyphSource, width, height - outlineYOffset, ((uint8 *)dst) + pitch, pitch, c2);
-				if (_drawMode != kFMTownsShadowMode)
-					blitCharacter<uint8>(glyphSource, width - outlineXOffset, height - outlineYOffset, ((uint8 *)dst) + pitch + shadowOffset, pitch, c2);
-			}
-
-			blitCharacter<uint8>(glyphSource, width, height, (uint8 *)dst, pitch, c1);
-		}
-	} else if (bpp == 2) {
-		if (_drawMode == kOutlineMode) {
-			blitCharacter<uint16>(outline, width + outlineExtraWidth, height + outlineExtraHeight, (uint8 *)dst, pitch, c2);
-			blitCharacter<uint16>(glyphSource, width - outlineXOffset, height - outlineYOffset, (uint8 *)dst + pitch + 2, pitch, c1);
-		} else {
-			if (_drawMode != kDefaultMode) {
-				blitCharacter<uint16>(glyphSource, width - outlineXOffset, height, ((uint8 *)dst) + shadowOffset, pitch, c2);
-				blitCharacter<uint16>(glyphSource, width, height - outlineYOffset, ((uint8 *)dst) + pitch, pitch, c2);
-				if (_drawMode != kFMTownsShadowMode)
-					blitCharacter<uint16>(glyphSource, width - outlineXOffset, height - outlineYOffset, ((uint8 *)dst) + pitch + shadowOffset, pitch, c2);
-			}
-
-			blitCharacter<uint16>(glyphSource, width, height, (uint8 *)dst, pitch, c1);
-		}
-	} else {
-		error("FontSJISBase::drawChar: unsupported bpp: %d", bpp);
-	}
+	if (bpp == 1)
+		renderGlyph<uint8>((uint8 *)dst, pitch, glyphSource, outline, width, height,
+			outlineXOffset, outlineYOffset, outlineExtraWidth, outlineExtraHeight, (uint8)c1, (uint8)c2);
+	else
+		renderGlyph<uint16>((uint8 *)dst, pitch, glyphSource, outline, width, height,
+			outlineXOffset, outlineYOffset, outlineExtraWidth, outlineExtraHeight, (uint16)c1, (uint16)c2);
 }
 
 bool FontSJISBase::isASCII(uint16 ch) const {
@@ -45,6 +45,8 @@
 
 #include "common/scummsys.h"
 #include "common/platform.h"
+#include "common/hashmap.h"
+#include "common/str.h"
 
 namespace Graphics {
 
@@ -136,6 +138,13 @@ public:
 	 */
 	void drawChar(Graphics::Surface &dst, uint16 ch, int x, int y, uint32 c1, uint32 c2) const;
 
+	/**
+	 * Draws a run of SJIS encoded characters on the given surface,
+	 * advancing by getCharWidth() after each one. Two-byte characters
+	 * are assembled from their SJIS lead bytes (0x81-0x9F, 0xE0-0xEF).
+	 */
+	void drawString(Graphics::Surface &dst, const Common::String &str, int x, int y, uint32 c1, uint32 c2) const;
+
 	/**
 	 * Draws a SJIS char on the given raw buffer.
 	 *
@@ -157,6 +166,7 @@ public:
 class FontSJISBase : public FontSJIS {
 public:
 	FontSJISBase();
+	virtual ~FontSJISBase();
 
 	virtual void setDrawingMode(DrawingMode mode);
 
@@ -176,6 +186,36 @@ private:
 	void blitCharacter(const uint8 *glyph, const int w, const int h, uint8 *dst, int pitch, Color c) const;
 	void createOutline(uint8 *outline, const uint8 *glyph, const int w, const int h) const;
 
+	// Performs the full outline/shadow/glyph composition of an unclipped
+	// drawChar() call. Shared between the direct draw path and the glyph
+	// cache builder so cached glyphs are pixel-identical.
+	template<typename Color>
+	void renderGlyph(uint8 *dst, int pitch, const uint8 *glyphSource, const uint8 *outline,
+		int width, int height, int outlineXOffset, int outlineYOffset,
+		int outlineExtraWidth, int outlineExtraHeight, Color c1, Color c2) const;
+
+	enum {
+		kMaxGlyphWidth = 18,
+		kMaxGlyphHeight = 18,
+		kGlyphCacheLimit = 256
+	};
+
+	// A glyph composited with its current mode and colors, ready to be
+	// copied to the destination wherever the coverage mask is set.
+	struct CachedGlyph {
+		int16 w, h;
+		int16 xOffset;	///< kShadowLeftMode draws one pixel left of the origin
+		uint8 mask[kMaxGlyphWidth * kMaxGlyphHeight];
+		uint16 pixels[kMaxGlyphWidth * kMaxGlyphHeight];	///< uint8 rows for 1 bpp targets
+	};
+
+	typedef Common::HashMap<uint64, CachedGlyph *> GlyphCacheMap;
+	mutable GlyphCacheMap _glyphCache;
+
+	const CachedGlyph *getCachedGlyph(uint16 ch, int bpp, uint32 c1, uint32 c2,
+		const uint8 *glyphSource, int width, int height) const;
+	void clearGlyphCache() const;
+
 #ifndef DISABLE_FLIPPED_MODE
 	// This is used in the FM-Towns version of Monkey Island 1
 	// when Guybrush gets shot out of the cannon in the circus tent.
@@ -367,7 +367,13 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 		// we draw all the scan line of the part
 		while (nb_lines > 0) {
 			int x = x1;
-			{
+			// The dirty rect system replays each draw call once per dirty
+			// region with the scissor rectangle set to that region, so most
+			// scanlines of a triangle are often fully clipped; skip them
+			// before doing any per-pixel work. The shadow mask pass ignores
+			// the scissor rectangle and keeps rasterizing every line.
+			if (!kEnableScissor || kDrawLogic == DRAW_SHADOW_MASK ||
+					(y >= _clipRectangle.top && y < _clipRectangle.bottom)) {
 				if (kDrawLogic == DRAW_DEPTH_ONLY ||
 						(kDrawLogic == DRAW_FLAT && !(kInterpST || kInterpSTZ))) {
 					int pp;
@@ -387,6 +393,24 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					if (kDrawLogic == DRAW_FLAT) {
 						a = a1;
 					}
+					if (kEnableScissor) {
+						// Clamp the span to the scissor rectangle up front;
+						// all interpolants step by integer deltas, so jumping
+						// ahead is exact.
+						if (x < _clipRectangle.left) {
+							int skip = _clipRectangle.left - x;
+							x += skip;
+							buf += skip;
+							pp += skip;
+							if (kInterpZ) {
+								pz += skip;
+								z += skip * dzdx;
+							}
+							n -= skip;
+						}
+						if (x + n >= _clipRectangle.right)
+							n = _clipRectangle.right - 1 - x;
+					}
 					while (n >= 3) {
 						if (kDrawLogic == DRAW_DEPTH_ONLY) {
 							putPixelDepth<kDepthWrite, kEnableScissor>(this, buf, pz, 0, x, y, z, dzdx);
@@ -398,7 +422,7 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 						if (kDrawLogic == DRAW_FLAT) {
 							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 0, x, y, z, r, g, b, a, dzdx);
 							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 1, x, y, z, r, g, b, a, dzdx);
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 2, x, y, z, r, g, g, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 2, x, y, z, r, g, b, a, dzdx);
 							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 3, x, y, z, r, g, b, a, dzdx);
 						}
 						if (kInterpZ) {
@@ -460,6 +484,19 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					pm = pm1 + x1;
 					pz = pz1 + x1;
 					z = z1;
+					if (kEnableScissor) {
+						if (x < _clipRectangle.left) {
+							int skip = _clipRectangle.left - x;
+							x += skip;
+							buf += skip;
+							pm += skip;
+							pz += skip;
+							z += skip * dzdx;
+							n -= skip;
+						}
+						if (x + n >= _clipRectangle.right)
+							n = _clipRectangle.right - 1 - x;
+					}
 					while (n >= 3) {
 						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
 						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, dzdx, pm);
@@ -491,6 +528,22 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					g = g1;
 					b = b1;
 					a = a1;
+					if (kEnableScissor) {
+						if (x < _clipRectangle.left) {
+							int skip = _clipRectangle.left - x;
+							x += skip;
+							buf += skip;
+							pz += skip;
+							z += skip * dzdx;
+							r += skip * drdx;
+							g += skip * dgdx;
+							b += skip * dbdx;
+							a += skip * dadx;
+							n -= skip;
+						}
+						if (x + n >= _clipRectangle.right)
+							n = _clipRectangle.right - 1 - x;
+					}
 					while (n >= 3) {
 						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
 						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
@@ -530,6 +583,12 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					g = g1;
 					b = b1;
 					a = a1;
+					// The perspective correction accumulates floats along the
+					// span, so jumping into the middle of it would change
+					// rounding; only spans entirely outside the scissor
+					// rectangle can be rejected wholesale.
+					if (kEnableScissor && (x >= _clipRectangle.right || x + n < _clipRectangle.left))
+						n = -1;
 					while (n >= (NB_INTERP - 1)) {
 						{
 							float ss, tt;
@@ -23,6 +23,7 @@
 
 
 #include "common/algorithm.h"
+#include "common/cpuinfo.h"
 #include "common/endian.h"
 #include "common/util.h"
 #include "common/rect.h"
@@ -33,6 +34,16 @@
 #include "graphics/transparent_surface.h"
 #include "graphics/transform_tools.h"
 
+// The SIMD row kernels below hardcode the little endian AXXX byte layout
+// (alpha in byte 0), so they are not compiled on big endian targets.
+#if defined(SCUMM_LITTLE_ENDIAN) && defined(__SSE2__)
+#include <emmintrin.h>
+#define USE_BLEND_SIMD
+#elif defined(SCUMM_LITTLE_ENDIAN) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define USE_BLEND_SIMD
+#endif
+
 namespace Graphics {
 
 static const int kBModShift = 8;//img->format.bShift;
@@ -60,6 +71,182 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 void doBlitSubtractiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color);
 void doBlitMultiplyBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color);
 
+#ifdef USE_BLEND_SIMD
+
+/**
+ * Returns true when the SIMD blend row kernels may be used on this host.
+ */
+static inline bool useBlendSIMD() {
+#if defined(__SSE2__)
+	return Common::hasCpuFeatureSSE2();
+#else
+	return true;
+#endif
+}
+
+#if defined(__SSE2__)
+
+/**
+ * SSE2 version of the color == 0xffffffff loop of doBlitAlphaBlend.
+ * Processes width & ~3 pixels of one row and returns that count; the caller
+ * finishes the remainder with the scalar loop. The arithmetic matches the
+ * scalar code exactly: alpha acts as a convex weight, so the 16 bit lanes
+ * cannot overflow before the >> 8.
+ */
+static uint32 doBlitAlphaBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)3;
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c255 = _mm_set1_epi16(255);
+	const __m128i aMask = _mm_set1_epi32(0xFF);	// the alpha byte of each pixel
+
+	for (uint32 x = 0; x < processed; x += 4) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)(in + x * 4));
+		const __m128i dst = _mm_loadu_si128((const __m128i *)(out + x * 4));
+
+		__m128i res[2];
+		for (int half = 0; half < 2; ++half) {
+			const __m128i s16 = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			const __m128i d16 = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
+			// Replicate each pixel's alpha (lane 0 of each group of four)
+			__m128i a16 = _mm_shufflelo_epi16(s16, _MM_SHUFFLE(0, 0, 0, 0));
+			a16 = _mm_shufflehi_epi16(a16, _MM_SHUFFLE(0, 0, 0, 0));
+			res[half] = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s16, a16),
+			                                         _mm_mullo_epi16(d16, _mm_sub_epi16(c255, a16))), 8);
+		}
+		__m128i blended = _mm_or_si128(_mm_packus_epi16(res[0], res[1]), aMask);
+
+		// Pixels with zero source alpha keep the destination untouched.
+		const __m128i keep = _mm_cmpeq_epi32(_mm_and_si128(src, aMask), zero);
+		_mm_storeu_si128((__m128i *)(out + x * 4),
+		                 _mm_or_si128(_mm_and_si128(keep, dst), _mm_andnot_si128(keep, blended)));
+	}
+	return processed;
+}
+
+/** SSE2 version of the color == 0xffffffff loop of doBlitAdditiveBlend. */
+static uint32 doBlitAdditiveBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)3;
+	const __m128i zero = _mm_setzero_si128();
+	// Zeroes the alpha lane of each pixel, so alpha stays untouched
+	const __m128i chanMask = _mm_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+
+	for (uint32 x = 0; x < processed; x += 4) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)(in + x * 4));
+		const __m128i dst = _mm_loadu_si128((const __m128i *)(out + x * 4));
+
+		__m128i res[2];
+		for (int half = 0; half < 2; ++half) {
+			const __m128i s16 = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			__m128i a16 = _mm_shufflelo_epi16(s16, _MM_SHUFFLE(0, 0, 0, 0));
+			a16 = _mm_shufflehi_epi16(a16, _MM_SHUFFLE(0, 0, 0, 0));
+			res[half] = _mm_and_si128(_mm_srli_epi16(_mm_mullo_epi16(s16, a16), 8), chanMask);
+		}
+		// The saturating byte add reproduces the scalar MIN(..., 255);
+		// pixels with zero alpha contribute zero, so no mask is needed.
+		_mm_storeu_si128((__m128i *)(out + x * 4),
+		                 _mm_adds_epu8(dst, _mm_packus_epi16(res[0], res[1])));
+	}
+	return processed;
+}
+
+/** SSE2 version of the color == 0xffffffff loop of doBlitMultiplyBlend. */
+static uint32 doBlitMultiplyBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)3;
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i aMask = _mm_set1_epi32(0xFF);
+	const __m128i chanMask = _mm_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	// A multiplier of 256 in the alpha lane passes the destination alpha
+	// through the (m * dst) >> 8 step unchanged.
+	const __m128i aPass = _mm_set_epi16(0, 0, 0, 256, 0, 0, 0, 256);
+
+	for (uint32 x = 0; x < processed; x += 4) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)(in + x * 4));
+		const __m128i dst = _mm_loadu_si128((const __m128i *)(out + x * 4));
+
+		__m128i res[2];
+		for (int half = 0; half < 2; ++half) {
+			const __m128i s16 = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			const __m128i d16 = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
+			__m128i a16 = _mm_shufflelo_epi16(s16, _MM_SHUFFLE(0, 0, 0, 0));
+			a16 = _mm_shufflehi_epi16(a16, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128i m16 = _mm_and_si128(_mm_srli_epi16(_mm_mullo_epi16(s16, a16), 8), chanMask);
+			m16 = _mm_or_si128(m16, aPass);
+			res[half] = _mm_srli_epi16(_mm_mullo_epi16(m16, d16), 8);
+		}
+		const __m128i blended = _mm_packus_epi16(res[0], res[1]);
+
+		const __m128i keep = _mm_cmpeq_epi32(_mm_and_si128(src, aMask), zero);
+		_mm_storeu_si128((__m128i *)(out + x * 4),
+		                 _mm_or_si128(_mm_and_si128(keep, dst), _mm_andnot_si128(keep, blended)));
+	}
+	return processed;
+}
+
+#else
+
+/**
+ * NEON version of the color == 0xffffffff loop of doBlitAlphaBlend.
+ * Processes width & ~7 pixels of one row and returns that count; the caller
+ * finishes the remainder with the scalar loop. vld4 deinterleaves the
+ * pixels into per-channel planes, which keeps the kernels short.
+ */
+static uint32 doBlitAlphaBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)7;
+	for (uint32 x = 0; x < processed; x += 8) {
+		const uint8x8x4_t s = vld4_u8(in + x * 4);
+		uint8x8x4_t d = vld4_u8(out + x * 4);
+		const uint8x8_t a = s.val[0];
+		const uint8x8_t opaque = vtst_u8(a, a);	// all ones where alpha != 0
+		const uint8x8_t na = vmvn_u8(a);	// 255 - alpha
+		for (int c = 1; c < 4; ++c) {
+			const uint8x8_t blended = vshrn_n_u16(vaddq_u16(vmull_u8(s.val[c], a),
+			                                                vmull_u8(d.val[c], na)), 8);
+			d.val[c] = vbsl_u8(opaque, blended, d.val[c]);
+		}
+		d.val[0] = vorr_u8(d.val[0], opaque);	// out alpha = 255
+		vst4_u8(out + x * 4, d);
+	}
+	return processed;
+}
+
+/** NEON version of the color == 0xffffffff loop of doBlitAdditiveBlend. */
+static uint32 doBlitAdditiveBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)7;
+	for (uint32 x = 0; x < processed; x += 8) {
+		const uint8x8x4_t s = vld4_u8(in + x * 4);
+		uint8x8x4_t d = vld4_u8(out + x * 4);
+		const uint8x8_t a = s.val[0];
+		// The saturating byte add reproduces the scalar MIN(..., 255);
+		// pixels with zero alpha contribute zero, so no mask is needed.
+		for (int c = 1; c < 4; ++c)
+			d.val[c] = vqadd_u8(d.val[c], vshrn_n_u16(vmull_u8(s.val[c], a), 8));
+		vst4_u8(out + x * 4, d);
+	}
+	return processed;
+}
+
+/** NEON version of the color == 0xffffffff loop of doBlitMultiplyBlend. */
+static uint32 doBlitMultiplyBlendRowSIMD(const byte *in, byte *out, uint32 width) {
+	const uint32 processed = width & ~(uint32)7;
+	for (uint32 x = 0; x < processed; x += 8) {
+		const uint8x8x4_t s = vld4_u8(in + x * 4);
+		uint8x8x4_t d = vld4_u8(out + x * 4);
+		const uint8x8_t a = s.val[0];
+		const uint8x8_t opaque = vtst_u8(a, a);
+		for (int c = 1; c < 4; ++c) {
+			const uint8x8_t m = vshrn_n_u16(vmull_u8(s.val[c], a), 8);
+			const uint8x8_t blended = vshrn_n_u16(vmull_u8(m, d.val[c]), 8);
+			d.val[c] = vbsl_u8(opaque, blended, d.val[c]);
+		}
+		vst4_u8(out + x * 4, d);
+	}
+	return processed;
+}
+
+#endif
+
+#endif // USE_BLEND_SIMD
+
 TransparentSurface::TransparentSurface() : Surface(), _alphaMode(ALPHA_FULL) {}
 
 TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Surface(), _alphaMode(ALPHA_FULL) {
@@ -145,7 +332,15 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef USE_BLEND_SIMD
+			if (inStep == 4 && useBlendSIMD()) {
+				j = doBlitAlphaBlendRowSIMD(in, out, width);
+				in += j * inStep;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kAIndex] = 255;
@@ -206,7 +401,15 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef USE_BLEND_SIMD
+			if (inStep == 4 && useBlendSIMD()) {
+				j = doBlitAdditiveBlendRowSIMD(in, out, width);
+				in += j * inStep;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
@@ -337,7 +540,15 @@ void doBlitMultiplyBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef USE_BLEND_SIMD
+			if (inStep == 4 && useBlendSIMD()) {
+				j = doBlitMultiplyBlendRowSIMD(in, out, width);
+				in += j * inStep;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) * out[kRIndex] >> 8, 255);
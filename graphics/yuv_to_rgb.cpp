@@ -83,9 +83,18 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/cpuinfo.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define USE_YUV_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define USE_YUV_SIMD
+#endif
+
 namespace Common {
 DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 }
@@ -292,6 +301,208 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
+#ifdef USE_YUV_SIMD
+
+// SIMD path for convert420, processing both rows of a macroblock pair at
+// once. It reproduces the table-driven scalar math exactly: the chroma
+// contribution terms are read from the same _colorTab (minus the table base
+// offsets), the min/max saturation matches the spread-out table ranges, and
+// the video-range luminance rescale uses a magic-multiply form of
+// (x * 255) / 219 that is exact over the clamped range. Destinations with
+// 8 bit channels (32 bpp) or no alpha (16 bpp, e.g. RGB565) are supported;
+// everything else keeps the scalar converter.
+
+struct YUV420SIMDParams {
+	bool dst16;
+	bool videoScale;
+	uint32 aTerm;
+	byte rShift, gShift, bShift;
+	byte rLoss, gLoss, bLoss;
+};
+
+static bool canVectorizeYUV420(const Graphics::PixelFormat &format) {
+#if defined(__SSE2__)
+	if (!Common::hasCpuFeatureSSE2())
+		return false;
+#endif
+	if (format.bytesPerPixel == 4)
+		return format.rLoss == 0 && format.gLoss == 0 && format.bLoss == 0 &&
+		       (format.aLoss == 0 || format.aLoss == 8);
+	return format.aLoss == 8;
+}
+
+#if defined(__SSE2__)
+
+// Turns channel indices (luminance plus chroma term) into 8 bit channel
+// values, matching what the rgbToPix tables hold at those indices.
+static inline __m128i yuvChannelValueSSE2(__m128i idx, const bool videoScale) {
+	if (!videoScale)
+		return _mm_min_epi16(_mm_max_epi16(idx, _mm_setzero_si128()), _mm_set1_epi16(255));
+
+	idx = _mm_min_epi16(_mm_max_epi16(idx, _mm_set1_epi16(16)), _mm_set1_epi16(235));
+	idx = _mm_sub_epi16(idx, _mm_set1_epi16(16));
+	// (x * 255) / 219 == x + (x * 10774) >> 16, exact for x in [0, 219]
+	return _mm_add_epi16(idx, _mm_mulhi_epu16(idx, _mm_set1_epi16(10774)));
+}
+
+// Converts 8 pixels in each of the two rows of a 420 row pair. The chroma
+// term vectors hold one entry per pixel (each chroma sample duplicated).
+static void convertYUV420BlockSIMD(byte *dst0, byte *dst1, const byte *ySrc0, const byte *ySrc1,
+								   const int16 *crr, const int16 *crbg, const int16 *cbb,
+								   const YUV420SIMDParams &p) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vcrr = _mm_loadu_si128((const __m128i *)crr);
+	const __m128i vcrbg = _mm_loadu_si128((const __m128i *)crbg);
+	const __m128i vcbb = _mm_loadu_si128((const __m128i *)cbb);
+
+	for (int row = 0; row < 2; ++row) {
+		const byte *ySrc = row ? ySrc1 : ySrc0;
+		byte *dst = row ? dst1 : dst0;
+
+		const __m128i y16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)ySrc), zero);
+		const __m128i r16 = yuvChannelValueSSE2(_mm_add_epi16(y16, vcrr), p.videoScale);
+		const __m128i g16 = yuvChannelValueSSE2(_mm_add_epi16(y16, vcrbg), p.videoScale);
+		const __m128i b16 = yuvChannelValueSSE2(_mm_add_epi16(y16, vcbb), p.videoScale);
+
+		if (p.dst16) {
+			__m128i out = _mm_sll_epi16(_mm_srl_epi16(r16, _mm_cvtsi32_si128(p.rLoss)), _mm_cvtsi32_si128(p.rShift));
+			out = _mm_or_si128(out, _mm_sll_epi16(_mm_srl_epi16(g16, _mm_cvtsi32_si128(p.gLoss)), _mm_cvtsi32_si128(p.gShift)));
+			out = _mm_or_si128(out, _mm_sll_epi16(_mm_srl_epi16(b16, _mm_cvtsi32_si128(p.bLoss)), _mm_cvtsi32_si128(p.bShift)));
+			_mm_storeu_si128((__m128i *)dst, out);
+		} else {
+			const __m128i aTerm = _mm_set1_epi32(p.aTerm);
+			for (int half = 0; half < 2; ++half) {
+				const __m128i r32 = half ? _mm_unpackhi_epi16(r16, zero) : _mm_unpacklo_epi16(r16, zero);
+				const __m128i g32 = half ? _mm_unpackhi_epi16(g16, zero) : _mm_unpacklo_epi16(g16, zero);
+				const __m128i b32 = half ? _mm_unpackhi_epi16(b16, zero) : _mm_unpacklo_epi16(b16, zero);
+				__m128i out = aTerm;
+				out = _mm_or_si128(out, _mm_sll_epi32(r32, _mm_cvtsi32_si128(p.rShift)));
+				out = _mm_or_si128(out, _mm_sll_epi32(g32, _mm_cvtsi32_si128(p.gShift)));
+				out = _mm_or_si128(out, _mm_sll_epi32(b32, _mm_cvtsi32_si128(p.bShift)));
+				_mm_storeu_si128((__m128i *)(dst + half * 16), out);
+			}
+		}
+	}
+}
+
+#else
+
+static inline int16x8_t yuvChannelValueNEON(int16x8_t idx, const bool videoScale) {
+	if (!videoScale)
+		return vminq_s16(vmaxq_s16(idx, vdupq_n_s16(0)), vdupq_n_s16(255));
+
+	idx = vminq_s16(vmaxq_s16(idx, vdupq_n_s16(16)), vdupq_n_s16(235));
+	const uint16x8_t x = vreinterpretq_u16_s16(vsubq_s16(idx, vdupq_n_s16(16)));
+	// (x * 255) / 219 == x + (x * 10774) >> 16, exact for x in [0, 219]
+	const uint16x4_t hiLo = vshrn_n_u32(vmull_u16(vget_low_u16(x), vdup_n_u16(10774)), 16);
+	const uint16x4_t hiHi = vshrn_n_u32(vmull_u16(vget_high_u16(x), vdup_n_u16(10774)), 16);
+	return vreinterpretq_s16_u16(vaddq_u16(x, vcombine_u16(hiLo, hiHi)));
+}
+
+static void convertYUV420BlockSIMD(byte *dst0, byte *dst1, const byte *ySrc0, const byte *ySrc1,
+								   const int16 *crr, const int16 *crbg, const int16 *cbb,
+								   const YUV420SIMDParams &p) {
+	const int16x8_t vcrr = vld1q_s16(crr);
+	const int16x8_t vcrbg = vld1q_s16(crbg);
+	const int16x8_t vcbb = vld1q_s16(cbb);
+
+	for (int row = 0; row < 2; ++row) {
+		const byte *ySrc = row ? ySrc1 : ySrc0;
+		byte *dst = row ? dst1 : dst0;
+
+		const int16x8_t y16 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ySrc)));
+		const uint16x8_t r16 = vreinterpretq_u16_s16(yuvChannelValueNEON(vaddq_s16(y16, vcrr), p.videoScale));
+		const uint16x8_t g16 = vreinterpretq_u16_s16(yuvChannelValueNEON(vaddq_s16(y16, vcrbg), p.videoScale));
+		const uint16x8_t b16 = vreinterpretq_u16_s16(yuvChannelValueNEON(vaddq_s16(y16, vcbb), p.videoScale));
+
+		if (p.dst16) {
+			uint16x8_t out = vshlq_u16(vshlq_u16(r16, vdupq_n_s16(-(int)p.rLoss)), vdupq_n_s16(p.rShift));
+			out = vorrq_u16(out, vshlq_u16(vshlq_u16(g16, vdupq_n_s16(-(int)p.gLoss)), vdupq_n_s16(p.gShift)));
+			out = vorrq_u16(out, vshlq_u16(vshlq_u16(b16, vdupq_n_s16(-(int)p.bLoss)), vdupq_n_s16(p.bShift)));
+			vst1q_u16((uint16 *)dst, out);
+		} else {
+			const uint32x4_t aTerm = vdupq_n_u32(p.aTerm);
+			for (int half = 0; half < 2; ++half) {
+				const uint32x4_t r32 = vmovl_u16(half ? vget_high_u16(r16) : vget_low_u16(r16));
+				const uint32x4_t g32 = vmovl_u16(half ? vget_high_u16(g16) : vget_low_u16(g16));
+				const uint32x4_t b32 = vmovl_u16(half ? vget_high_u16(b16) : vget_low_u16(b16));
+				uint32x4_t out = aTerm;
+				out = vorrq_u32(out, vshlq_u32(r32, vdupq_n_s32(p.rShift)));
+				out = vorrq_u32(out, vshlq_u32(g32, vdupq_n_s32(p.gShift)));
+				out = vorrq_u32(out, vshlq_u32(b32, vdupq_n_s32(p.bShift)));
+				vst1q_u32((uint32 *)(dst + half * 16), out);
+			}
+		}
+	}
+}
+
+#endif
+
+static void convertYUV420ToRGBSIMD(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab,
+								   const byte *ySrc, const byte *uSrc, const byte *vSrc,
+								   int yWidth, int yHeight, int yPitch, int uvPitch,
+								   const Graphics::PixelFormat &format, bool videoScale) {
+	const int16 *Cr_r_tab = colorTab;
+	const int16 *Cr_g_tab = Cr_r_tab + 256;
+	const int16 *Cb_g_tab = Cr_g_tab + 256;
+	const int16 *Cb_b_tab = Cb_g_tab + 256;
+	const uint32 *rgbToPix = lookup->getRGBToPix();
+
+	YUV420SIMDParams p;
+	p.dst16 = (format.bytesPerPixel == 2);
+	p.videoScale = videoScale;
+	p.aTerm = format.ARGBToColor(255, 0, 0, 0);
+	p.rShift = format.rShift; p.gShift = format.gShift; p.bShift = format.bShift;
+	p.rLoss = format.rLoss; p.gLoss = format.gLoss; p.bLoss = format.bLoss;
+
+	const int halfHeight = yHeight >> 1;
+	const int halfWidth = yWidth >> 1;
+	const int blockWidth = halfWidth & ~3;	// 4 chroma samples -> 8 pixels per row
+	const uint bpp = format.bytesPerPixel;
+
+	for (int h = 0; h < halfHeight; h++) {
+		const byte *y0 = ySrc + (2 * h) * yPitch;
+		const byte *y1 = y0 + yPitch;
+		const byte *u = uSrc + h * uvPitch;
+		const byte *v = vSrc + h * uvPitch;
+		byte *d0 = dstPtr + (2 * h) * dstPitch;
+		byte *d1 = d0 + dstPitch;
+
+		int w = 0;
+		for (; w < blockWidth; w += 4) {
+			int16 crr[8], crbg[8], cbb[8];
+			for (int i = 0; i < 4; ++i) {
+				const byte cu = u[w + i], cv = v[w + i];
+				crr[2 * i] = crr[2 * i + 1] = Cr_r_tab[cv] - (0 * 768 + 256);
+				crbg[2 * i] = crbg[2 * i + 1] = (Cr_g_tab[cv] - (1 * 768 + 256)) + Cb_g_tab[cu];
+				cbb[2 * i] = cbb[2 * i + 1] = Cb_b_tab[cu] - (2 * 768 + 256);
+			}
+			convertYUV420BlockSIMD(d0 + w * 2 * bpp, d1 + w * 2 * bpp, y0 + w * 2, y1 + w * 2, crr, crbg, cbb, p);
+		}
+
+		// Scalar tail, same table math as convertYUV420ToRGB
+		for (; w < halfWidth; w++) {
+			const int16 cr_r = Cr_r_tab[v[w]];
+			const int16 crb_g = Cr_g_tab[v[w]] + Cb_g_tab[u[w]];
+			const int16 cb_b = Cb_b_tab[u[w]];
+			for (int dy = 0; dy < 2; ++dy) {
+				const byte *yRow = dy ? y1 : y0;
+				byte *dRow = dy ? d1 : d0;
+				for (int dx = 0; dx < 2; ++dx) {
+					const uint32 *L = &rgbToPix[yRow[w * 2 + dx]];
+					const uint32 pix = L[cr_r] | L[crb_g] | L[cb_b];
+					if (p.dst16)
+						*(uint16 *)(dRow + (w * 2 + dx) * 2) = pix;
+					else
+						*(uint32 *)(dRow + (w * 2 + dx) * 4) = pix;
+				}
+			}
+		}
+	}
+}
+
+#endif // USE_YUV_SIMD
+
 void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Sanity checks
 	assert(dst && dst->getPixels());
@@ -302,6 +513,13 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+#ifdef USE_YUV_SIMD
+	if (canVectorizeYUV420(dst->format)) {
+		convertYUV420ToRGBSIMD((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch, dst->format, scale == kScaleITU);
+		return;
+	}
+#endif
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV420ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
@@ -194,7 +194,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(nullptr), _vectorRenderer(nullptr),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(nullptr), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(nullptr), _scaleFactor(1.0f) {
+	_cursor(nullptr), _scaleFactor(1.0f),
+	_loadedBaseWidth(0), _loadedBaseHeight(0), _loadedScaleFactor(0.0f) {
 
 	_baseWidth = 640;	// Default sane values
 	_baseHeight = 480;
@@ -252,6 +253,7 @@ ThemeEngine::~ThemeEngine() {
 
 	unloadTheme();
 	unloadExtraFont();
+	clearSTXCache();
 
 	// Release all graphics surfaces
 	for (ImagesMap::iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
@@ -393,6 +395,10 @@ void ThemeEngine::refresh() {
 			}
 		}
 		_bitmaps.clear();
+
+		// The bitmaps are reloaded by the theme parser, so the re-parse
+		// must not be skipped this time.
+		_loadedThemeId.clear();
 	}
 
 	init();
@@ -761,6 +767,17 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
  * Theme XML loading
  *********************************************************/
 void ThemeEngine::loadTheme(const Common::String &themeId) {
+	// Re-parsing the theme produces identical draw data and layouts as long
+	// as the theme and the layout parameters are unchanged, so a refresh()
+	// that kept both (e.g. an overlay recreated at the same resolution) can
+	// reuse everything from the previous load.
+	if (_themeOk && themeId == _loadedThemeId &&
+	    _baseWidth == _loadedBaseWidth && _baseHeight == _loadedBaseHeight &&
+	    _scaleFactor == _loadedScaleFactor) {
+		debug(6, "Theme %s is already loaded, skipping re-parse", themeId.c_str());
+		return;
+	}
+
 	unloadTheme();
 
 	debug(6, "Loading theme %s", themeId.c_str());
@@ -773,6 +790,7 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 	}
 
 	if (!_themeOk) {
+		_loadedThemeId.clear();
 		warning("Failed to load theme '%s'", themeId.c_str());
 		return;
 	}
@@ -784,6 +802,11 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 			_widgets[i]->calcBackgroundOffset();
 		}
 	}
+
+	_loadedThemeId = themeId;
+	_loadedBaseWidth = _baseWidth;
+	_loadedBaseHeight = _baseHeight;
+	_loadedScaleFactor = _scaleFactor;
 }
 
 void ThemeEngine::unloadTheme() {
@@ -858,49 +881,83 @@ bool ThemeEngine::loadDefaultXML() {
 #endif
 }
 
+void ThemeEngine::clearSTXCache() {
+	for (uint i = 0; i < _stxCache.size(); ++i)
+		free(_stxCache[i].data);
+	_stxCache.clear();
+	_stxCacheThemeId.clear();
+	_stxCacheThemeName.clear();
+}
+
 bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 	assert(_parser);
-	assert(_themeArchive);
 
 	_themeName.clear();
 
+	if (_stxCacheThemeId != themeId) {
+		// First load of this theme: read its THEMERC and decompress all
+		// STX files from the archive into the cache. Re-parses on refresh()
+		// (e.g. resolution changes) then run from memory without touching
+		// the archive again.
+		clearSTXCache();
+		assert(_themeArchive);
+
+		//
+		// Now that we have a Common::Archive, verify that it contains a valid THEMERC File
+		//
+		Common::File themercFile;
+		themercFile.open("THEMERC", *_themeArchive);
+		if (!themercFile.isOpen()) {
+			warning("Theme '%s' contains no 'THEMERC' file.", themeId.c_str());
+			return false;
+		}
 
-	//
-	// Now that we have a Common::Archive, verify that it contains a valid THEMERC File
-	//
-	Common::File themercFile;
-	themercFile.open("THEMERC", *_themeArchive);
-	if (!themercFile.isOpen()) {
-		warning("Theme '%s' contains no 'THEMERC' file.", themeId.c_str());
-		return false;
-	}
+		Common::String stxHeader = themercFile.readLine();
+		if (!themeConfigParseHeader(stxHeader, _stxCacheThemeName) || _stxCacheThemeName.empty()) {
+			warning("Corrupted 'THEMERC' file in theme '%s'", themeId.c_str());
+			return false;
+		}
 
-	Common::String stxHeader = themercFile.readLine();
-	if (!themeConfigParseHeader(stxHeader, _themeName) || _themeName.empty()) {
-		warning("Corrupted 'THEMERC' file in theme '%s'", themeId.c_str());
-		return false;
-	}
+		Common::ArchiveMemberList members;
+		if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
+			warning("Found no STX files for theme '%s'.", themeId.c_str());
+			return false;
+		}
 
-	Common::ArchiveMemberList members;
-	if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
-		warning("Found no STX files for theme '%s'.", themeId.c_str());
-		return false;
+		for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
+			assert((*i)->getName().hasSuffix(".stx"));
+
+			Common::SeekableReadStream *stream = (*i)->createReadStream();
+			if (!stream) {
+				warning("Failed to load STX file '%s'", (*i)->getName().c_str());
+				clearSTXCache();
+				return false;
+			}
+
+			CachedSTXFile file;
+			file.name = (*i)->getName();
+			file.size = stream->size();
+			file.data = (byte *)malloc(file.size);
+			stream->read(file.data, file.size);
+			delete stream;
+			_stxCache.push_back(file);
+		}
+
+		_stxCacheThemeId = themeId;
 	}
 
 	//
 	// Loop over all STX files, load and parse them
 	//
-	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
-		assert((*i)->getName().hasSuffix(".stx"));
-
-		if (_parser->loadStream((*i)->createReadStream()) == false) {
-			warning("Failed to load STX file '%s'", (*i)->getName().c_str());
+	for (uint i = 0; i < _stxCache.size(); ++i) {
+		if (_parser->loadBuffer(_stxCache[i].data, _stxCache[i].size) == false) {
+			warning("Failed to load STX file '%s'", _stxCache[i].name.c_str());
 			_parser->close();
 			return false;
 		}
 
 		if (_parser->parse() == false) {
-			warning("Failed to parse STX file '%s'", (*i)->getName().c_str());
+			warning("Failed to parse STX file '%s'", _stxCache[i].name.c_str());
 			_parser->close();
 			return false;
 		}
@@ -908,6 +965,7 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		_parser->close();
 	}
 
+	_themeName = _stxCacheThemeName;
 	assert(!_themeName.empty());
 	return true;
 }
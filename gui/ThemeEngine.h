@@ -24,6 +24,7 @@
 #define GUI_THEME_ENGINE_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
 #include "common/hashmap.h"
@@ -663,6 +664,12 @@ protected:
 	 */
 	bool loadThemeXML(const Common::String &themeId);
 
+	/**
+	 * Frees the in-memory copies of the theme's STX files kept for
+	 * fast re-parsing, see loadThemeXML().
+	 */
+	void clearSTXCache();
+
 	/**
 	 * Loads the default theme file (the embedded XML file found
 	 * in ThemeDefaultXML.cpp).
@@ -804,6 +811,28 @@ protected:
 	Common::Archive *_themeArchive;
 	Common::SearchSet _themeFiles;
 
+	/**
+	 * Decompressed copies of the theme's STX files. loadThemeXML() fills
+	 * this on the first load and re-parses from it afterwards, so that a
+	 * refresh() (e.g. on a resolution change) does not have to re-inflate
+	 * the files from the theme archive again.
+	 */
+	struct CachedSTXFile {
+		Common::String name;
+		byte *data;
+		uint32 size;
+	};
+	Common::Array<CachedSTXFile> _stxCache;
+	Common::String _stxCacheThemeId;   ///< Theme the cache was filled from.
+	Common::String _stxCacheThemeName; ///< Theme name read from its THEMERC.
+
+	// Parameters of the last successful loadTheme() call. While they are
+	// unchanged, a refresh() can skip the XML re-parse altogether since it
+	// would produce identical draw data and layouts.
+	Common::String _loadedThemeId;
+	int _loadedBaseWidth, _loadedBaseHeight;
+	float _loadedScaleFactor;
+
 	bool _useCursor;
 	int _cursorHotspotX, _cursorHotspotY;
 	uint32 _cursorTransparent;
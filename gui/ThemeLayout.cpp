@@ -217,6 +217,60 @@ Widget *ThemeLayoutWidget::getWidget(Widget *widgetChain) const {
 	return Widget::findWidgetInChain(widgetChain, widgetName.c_str());
 }
 
+void ThemeLayoutMain::buildWidgetIndex(ThemeLayout *node) {
+	LayoutType type = node->getLayoutType();
+	if (type == kLayoutWidget || type == kLayoutTabWidget) {
+		ThemeLayoutWidget *widget = (ThemeLayoutWidget *)node;
+		// The first occurrence wins, like in the pre-order tree search
+		// this table replaces.
+		if (!_widgetIndex.contains(widget->getName()))
+			_widgetIndex[widget->getName()] = widget;
+		return;
+	}
+
+	for (uint i = 0; i < node->_children.size(); ++i)
+		buildWidgetIndex(node->_children[i]);
+}
+
+bool ThemeLayoutMain::getWidgetData(const Common::String &name, int16 &x, int16 &y, int16 &w, int16 &h, bool &useRTL) {
+	if (name.empty()) {
+		x = _x; y = _y;
+		w = _w; h = _h;
+		useRTL = _useRTL;
+
+		return true;
+	}
+
+	// The layout tree is only mutated while the theme is parsed and queries
+	// start after that, so the index can be built lazily on the first one.
+	if (!_widgetIndexBuilt) {
+		buildWidgetIndex(this);
+		_widgetIndexBuilt = true;
+	}
+
+	ThemeLayout *widget = _widgetIndex.getValOrDefault(name);
+	if (!widget)
+		return false;
+
+	return widget->getWidgetData(name, x, y, w, h, useRTL);
+}
+
+Graphics::TextAlign ThemeLayoutMain::getWidgetTextHAlign(const Common::String &name) {
+	if (name.empty())
+		return _textHAlign;
+
+	if (!_widgetIndexBuilt) {
+		buildWidgetIndex(this);
+		_widgetIndexBuilt = true;
+	}
+
+	ThemeLayout *widget = _widgetIndex.getValOrDefault(name);
+	if (!widget)
+		return Graphics::kTextAlignInvalid;
+
+	return widget->getWidgetTextHAlign(name);
+}
+
 void ThemeLayoutMain::reflowLayout(Widget *widgetChain) {
 	assert(_children.size() <= 1);
 
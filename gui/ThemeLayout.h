@@ -24,6 +24,8 @@
 #define THEME_LAYOUT_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/rect.h"
 #include "graphics/font.h"
 
@@ -145,7 +147,8 @@ public:
 			ThemeLayout(nullptr),
 			_name(name),
 			_overlays(overlays),
-			_inset(inset) {
+			_inset(inset),
+			_widgetIndexBuilt(false) {
 		_w = _defaultW = width;
 		_h = _defaultH = height;
 		_x = _defaultX = -1;
@@ -153,6 +156,12 @@ public:
 	}
 	void reflowLayout(Widget *widgetChain) override;
 
+	// Widget lookups on a dialog layout go through a name -> node table
+	// built lazily from the finished layout tree, instead of a recursive
+	// string-compare search over the whole tree on every query.
+	bool getWidgetData(const Common::String &name, int16 &x, int16 &y, int16 &w, int16 &h, bool &useRTL) override;
+	Graphics::TextAlign getWidgetTextHAlign(const Common::String &name) override;
+
 	void resetLayout() override {
 		ThemeLayout::resetLayout();
 		_x = _defaultX;
@@ -165,6 +174,11 @@ protected:
 	LayoutType getLayoutType() const override { return kLayoutMain; }
 	ThemeLayout *makeClone(ThemeLayout *newParent) override { assert(!"Do not copy Main Layouts!"); return nullptr; }
 
+	void buildWidgetIndex(ThemeLayout *node);
+
+	Common::HashMap<Common::String, ThemeLayout *> _widgetIndex;
+	bool _widgetIndexBuilt;
+
 	int16 _defaultX;
 	int16 _defaultY;
 
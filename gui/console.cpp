@@ -78,6 +78,8 @@ ConsoleDialog::ConsoleDialog(float widthPercent, float heightPercent)
 
 	_promptStartPos = _promptEndPos = -1;
 
+	_firstDirtyLine = _lastDirtyLine = -1;
+
 	// Init callback
 	_callbackProc = nullptr;
 	_callbackRefCon = nullptr;
@@ -178,6 +180,9 @@ void ConsoleDialog::drawDialog(DrawLayer layerToDraw) {
 
 	for (int line = 0; line < _linesPerPage; line++)
 		drawLine(line);
+
+	// Everything on screen is up to date now
+	_firstDirtyLine = _lastDirtyLine = -1;
 }
 
 void ConsoleDialog::drawLine(int line) {
@@ -200,6 +205,31 @@ void ConsoleDialog::drawLine(int line) {
 	}
 }
 
+void ConsoleDialog::markLineDirty(int line) {
+	if (_firstDirtyLine < 0) {
+		_firstDirtyLine = _lastDirtyLine = line;
+	} else {
+		if (line < _firstDirtyLine)
+			_firstDirtyLine = line;
+		if (line > _lastDirtyLine)
+			_lastDirtyLine = line;
+	}
+}
+
+void ConsoleDialog::flushDirtyLines() {
+	if (_firstDirtyLine < 0)
+		return;
+
+	// Redraw only the dirty lines which are actually on screen
+	int start = _scrollLine - _linesPerPage + 1;
+	int first = MAX(_firstDirtyLine - start, 0);
+	int last = MIN(_lastDirtyLine - start, _linesPerPage - 1);
+	for (int line = first; line <= last; line++)
+		drawLine(line);
+
+	_firstDirtyLine = _lastDirtyLine = -1;
+}
+
 void ConsoleDialog::reflowLayout() {
 	init();
 
@@ -219,6 +249,10 @@ void ConsoleDialog::handleTickle() {
 		drawCaret(_caretVisible);
 	}
 
+	// Flush any text appended since the last frame
+	if (_slideMode == kNoSlideMode)
+		flushDirtyLines();
+
 	// Perform the "slide animation".
 	if (_slideMode != kNoSlideMode) {
 		const float tmp = (float)(g_system->getMillis() - _slideTime) / kConsoleSlideDownDuration;
@@ -745,6 +779,7 @@ void ConsoleDialog::printCharIntern(int c) {
 		nextLine();
 	else {
 		buffer(_currentPos) = (char)c;
+		markLineDirty(_currentPos / kCharsPerLine);
 		_currentPos++;
 		if ((_scrollLine + 1) * kCharsPerLine == _currentPos) {
 			_scrollLine++;
@@ -757,10 +792,16 @@ void ConsoleDialog::print(const char *str) {
 	if (_caretVisible)
 		drawCaret(true);
 
+	int oldScrollLine = _scrollLine;
+
 	while (*str)
 		printCharIntern(*str++);
 
-	g_gui.scheduleTopDialogRedraw();
+	// If the output scrolled the page, all visible lines moved and a full
+	// redraw is due. Otherwise the appended lines were marked dirty and
+	// will be flushed individually on the next tickle.
+	if (_scrollLine != oldScrollLine)
+		g_gui.scheduleTopDialogRedraw();
 }
 
 void ConsoleDialog::drawCaret(bool erase) {
@@ -90,6 +90,14 @@ protected:
 	int _promptStartPos;
 	int _promptEndPos;
 
+	// Range of buffer lines (in absolute line numbers) whose contents
+	// changed since the last flush, or -1 when nothing is pending. Text
+	// appended by print() is flushed from handleTickle() as individual
+	// line draws, so heavy output costs one partial redraw per frame
+	// instead of a full page redraw per call.
+	int _firstDirtyLine;
+	int _lastDirtyLine;
+
 	bool   _caretVisible;
 	uint32 _caretTime;
 
@@ -172,6 +180,8 @@ protected:
 	int pos2line(int pos) { return (pos - (_scrollLine - _linesPerPage + 1) * kCharsPerLine) / kCharsPerLine; }
 
 	void drawLine(int line);
+	void markLineDirty(int line);
+	void flushDirtyLines();
 	void drawCaret(bool erase);
 	void printCharIntern(int c);
 	void insertIntoPrompt(const char *str);
@@ -26,6 +26,8 @@
 #include "common/file.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/memtrack.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
@@ -79,6 +81,10 @@ Debugger::Debugger() {
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
 	registerCmd("debugflag_disable",	WRAP_METHOD(Debugger, cmdDebugFlagDisable));
+#ifndef DISABLE_PROFILER
+	registerCmd("profiler",			WRAP_METHOD(Debugger, cmdProfiler));
+#endif
+	registerCmd("memstats",			WRAP_METHOD(Debugger, cmdMemStats));
 }
 
 Debugger::~Debugger() {
@@ -811,6 +817,111 @@ bool Debugger::cmdDebugFlagDisable(int argc, const char **argv) {
 	return true;
 }
 
+#ifndef DISABLE_PROFILER
+bool Debugger::cmdProfiler(int argc, const char **argv) {
+	Common::Profiler &profiler = Common::Profiler::instance();
+
+	if (argc < 2) {
+		debugPrintf("profiler <on | off | reset | dump | export <filename>>\n");
+		debugPrintf("Profiler is currently %s\n", profiler.isEnabled() ? "on" : "off");
+	} else if (!scumm_stricmp(argv[1], "on")) {
+		profiler.setEnabled(true);
+		debugPrintf("Profiler enabled\n");
+	} else if (!scumm_stricmp(argv[1], "off")) {
+		profiler.setEnabled(false);
+		debugPrintf("Profiler disabled\n");
+	} else if (!scumm_stricmp(argv[1], "reset")) {
+		profiler.reset();
+		debugPrintf("Profiler statistics cleared\n");
+	} else if (!scumm_stricmp(argv[1], "dump")) {
+		if (profiler.getProbeCount() == 0) {
+			debugPrintf("No probes have fired; use 'profiler on' first\n");
+			return true;
+		}
+		debugPrintf("%-32s %10s %12s %12s %12s\n", "probe", "count", "total ms", "avg us", "max us");
+		for (uint i = 0; i < profiler.getProbeCount(); ++i) {
+			const Common::Profiler::Probe &probe = profiler.getProbe(i);
+			debugPrintf("%-32s %10u %12u %12u %12u\n", probe.name, probe.count,
+				(uint32)(probe.totalMicros / 1000),
+				probe.count ? (uint32)(probe.totalMicros / probe.count) : 0,
+				(uint32)probe.maxMicros);
+		}
+	} else if (!scumm_stricmp(argv[1], "export")) {
+		if (argc < 3) {
+			debugPrintf("profiler export <filename>\n");
+			return true;
+		}
+		Common::DumpFile out;
+		if (!out.open(argv[2])) {
+			debugPrintf("Failed to open '%s' for writing\n", argv[2]);
+			return true;
+		}
+		Common::Profiler::Sample *samples = new Common::Profiler::Sample[Common::Profiler::kRingSize];
+		uint count = profiler.getSamples(samples, Common::Profiler::kRingSize);
+		out.writeString("start_us,duration_us,probe\n");
+		for (uint i = 0; i < count; ++i) {
+			out.writeString(Common::String::format("%llu,%u,%s\n",
+				(unsigned long long)samples[i].startMicros, samples[i].durationMicros,
+				profiler.getProbe(samples[i].probeId).name));
+		}
+		delete[] samples;
+		out.close();
+		debugPrintf("Exported %u samples to '%s'\n", count, argv[2]);
+	} else {
+		debugPrintf("profiler <on | off | reset | dump | export <filename>>\n");
+	}
+	return true;
+}
+#endif
+
+bool Debugger::cmdMemStats(int argc, const char **argv) {
+	if (argc >= 2 && !scumm_stricmp(argv[1], "budget")) {
+		if (argc < 4) {
+			debugPrintf("memstats budget <tag> <kilobytes>  (0 removes the budget)\n");
+			return true;
+		}
+		// Only existing tags can be budgeted; registerTag would keep a
+		// pointer to the transient command line
+		int tag = -1;
+		for (uint i = 0; i < MemTrackMan.getTagCount(); ++i) {
+			if (!scumm_stricmp(MemTrackMan.getTag(i).name, argv[2])) {
+				tag = i;
+				break;
+			}
+		}
+		if (tag < 0) {
+			debugPrintf("Unknown tag '%s'\n", argv[2]);
+			return true;
+		}
+		uint64 budget = (uint64)atoi(argv[3]) * 1024;
+		MemTrackMan.setBudget(tag, budget);
+		if (budget)
+			debugPrintf("Budget for '%s' set to %u KB\n", argv[2], (uint32)(budget / 1024));
+		else
+			debugPrintf("Budget for '%s' removed\n", argv[2]);
+		return true;
+	}
+
+	if (argc >= 2) {
+		debugPrintf("memstats [budget <tag> <kilobytes>]\n");
+		return true;
+	}
+
+	if (MemTrackMan.getTagCount() == 0) {
+		debugPrintf("No subsystem has reported memory usage\n");
+		return true;
+	}
+
+	debugPrintf("%-24s %12s %12s %12s\n", "tag", "usage KB", "peak KB", "budget KB");
+	for (uint i = 0; i < MemTrackMan.getTagCount(); ++i) {
+		const Common::MemoryTracker::Tag &tag = MemTrackMan.getTag(i);
+		debugPrintf("%-24s %12u %12u %12u\n", tag.name,
+			(uint32)(tag.usage / 1024), (uint32)(tag.peakUsage / 1024),
+			(uint32)(tag.budget / 1024));
+	}
+	return true;
+}
+
 // Console handler
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 bool Debugger::debuggerInputCallback(GUI::ConsoleDialog *console, const char *input, void *refCon) {
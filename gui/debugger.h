@@ -247,6 +247,10 @@ protected:
 	bool cmdDebugFlagsList(int argc, const char **argv);
 	bool cmdDebugFlagEnable(int argc, const char **argv);
 	bool cmdDebugFlagDisable(int argc, const char **argv);
+#ifndef DISABLE_PROFILER
+	bool cmdProfiler(int argc, const char **argv);
+#endif
+	bool cmdMemStats(int argc, const char **argv);
 	bool cmdExecFile(int argc, const char **argv);
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
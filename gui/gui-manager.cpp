@@ -349,9 +349,26 @@ void GuiManager::redraw() {
 	}
 
 	switch (_redrawStatus) {
+		case kRedrawTopDialog:
+			// Only the topmost dialog changed state. The back buffer still
+			// holds everything below the top dialog's layers (the dialogs
+			// underneath, the screen shading and the top dialog's own
+			// background) exactly as the last full/open redraw left it, so
+			// restore it and re-render just the top dialog's layers. This
+			// avoids re-grabbing the overlay and re-rendering the whole
+			// dialog stack on every widget state change.
+			_theme->drawToScreen();
+			_theme->copyBackBufferToScreen();
+			// The plain back buffer copy above does not record dirty rects,
+			// so queue the whole restored area for the screen update.
+			_theme->addDirtyRect(Common::Rect(0, 0, _system->getOverlayWidth(), _system->getOverlayHeight()));
+
+			_dialogStack.top()->drawDialog(kDrawLayerBackground);
+			_dialogStack.top()->drawDialog(kDrawLayerForeground);
+			break;
+
 		case kRedrawCloseDialog:
 		case kRedrawFull:
-		case kRedrawTopDialog:
 			_theme->clearAll();
 			_theme->drawToBackbuffer();
 
@@ -397,6 +397,10 @@ void LauncherDialog::massAddGame() {
 
 		massAddDlg.runModal();
 
+		// Persist the md5s computed during the scan, so the next mass add
+		// over the same library is metadata-only.
+		MD5Man.save();
+
 		// Update the ListWidget and force a redraw
 
 		// If new target(s) were added, update the ListWidget and move
@@ -566,7 +570,11 @@ bool LauncherDialog::doGameDetection(const Common::String &path) {
 
 	// ...so let's determine a list of candidates, games that
 	// could be contained in the specified directory.
+	// Drop cached md5s that cannot be revalidated first, the files may
+	// have changed on disk since the last scan.
+	MD5Man.clear();
 	DetectionResults detectionResults = EngineMan.detectGames(files);
+	MD5Man.save();
 
 	if (detectionResults.foundUnknownGames()) {
 		Common::U32String report = detectionResults.generateUnknownGameReport(false, 80);
@@ -1515,6 +1523,9 @@ void LauncherGrid::build() {
 
 	// Add list with game titles
 	_grid = new GridWidget(this, "LauncherGrid.IconArea");
+	// The grid decodes queued thumbnails from its tickle handler, so make
+	// sure it receives tickles even while another widget has the focus.
+	setTickleWidget(_grid);
 	// Populate the list
 	updateListing();
 
@@ -34,6 +34,17 @@
 
 namespace GUI {
 
+enum {
+	// Maximum number of decoded thumbnails kept in _loadedSurfaces. Roughly
+	// a dozen screens worth of covers; beyond that the least recently used
+	// ones are evicted so a 2000-entry library does not pin them all.
+	kMaxCachedThumbnails = 512,
+	// Number of off-screen rows to decode ahead in the scroll direction.
+	kThumbnailPrefetchRows = 2,
+	// Time budget per tickle for decoding queued thumbnails.
+	kThumbnailDecodeBudgetMillis = 8
+};
+
 GridItemWidget::GridItemWidget(GridWidget *boss)
 	: ContainerWidget(boss, 0, 0, 0, 0), CommandSender(boss) {
 
@@ -286,13 +297,19 @@ void GridItemTray::handleMouseMoved(int x, int y, int button) {
 #pragma mark -
 
 // Load an image file by String name, provide additional render dimensions for SVG images.
-// TODO: Add BMP support, and add scaling of non-vector images.
+// For PNGs the dimensions are a decode hint: large covers are decoded directly
+// into the overlay format and downscaled-on-decode to the smallest size that
+// still covers the request, instead of fully decoding and converting first.
+// TODO: Add BMP support.
 Graphics::ManagedSurface *loadSurfaceFromFile(const Common::String &name, int renderWidth = 0, int renderHeight = 0) {
 	Graphics::ManagedSurface *surf = nullptr;
 	if (name.hasSuffix(".png")) {
 #ifdef USE_PNG
 		const Graphics::Surface *srcSurface = nullptr;
 		Image::PNGDecoder decoder;
+		decoder.setOutputPixelFormat(g_system->getOverlayFormat());
+		if (renderWidth > 0 && renderHeight > 0)
+			decoder.setMaxDecodeSize(renderWidth, renderHeight);
 		if (g_gui.getIconsSet().hasFile(name)) {
 			Common::SeekableReadStream *stream = g_gui.getIconsSet().createReadStreamForMember(name);
 			if (!decoder.loadStream(*stream)) {
@@ -372,6 +389,10 @@ GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 
 	_selectedEntry = nullptr;
 	_isGridInvalid = true;
+	_scrollDirection = 1;
+
+	// Queued thumbnails are decoded incrementally from handleTickle().
+	setFlags(getFlags() | WIDGET_WANT_TICKLE);
 }
 
 GridWidget::~GridWidget() {
@@ -395,7 +416,11 @@ void GridWidget::unloadSurfaces(Common::HashMap<T, const Graphics::ManagedSurfac
 const Graphics::ManagedSurface *GridWidget::filenameToSurface(const Common::String &name) {
 	for (Common::Array<GridItemInfo *>::iterator l = _visibleEntryList.begin(); l != _visibleEntryList.end(); ++l) {
 		if ((!(*l)->isHeader) && ((*l)->thumbPath == name)) {
-			return _loadedSurfaces[name];
+			// The surface may not be decoded yet; don't insert a stray
+			// nullptr entry here, or the queued decode would be skipped.
+			if (_loadedSurfaces.contains(name))
+				return _loadedSurfaces[name];
+			return nullptr;
 		}
 	}
 	return nullptr;
@@ -570,27 +595,107 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 	_groupHeaderSuffix = suffix;
 }
 
+void GridWidget::queueThumbnailLoad(const GridItemInfo *entry) {
+	if (entry->isHeader || entry->thumbPath.empty())
+		return;
+	if (_loadedSurfaces.contains(entry->thumbPath)) {
+		// Already decoded, just refresh its position in the LRU order.
+		touchThumbnail(entry->thumbPath);
+		return;
+	}
+	_thumbLoadQueue.push(entry->thumbPath);
+}
+
 void GridWidget::reloadThumbnails() {
-	Graphics::ManagedSurface *surf = nullptr;
-	Common::String gameid;
-	Common::String engineid;
+	// Rebuild the decode queue rather than decoding anything here. The
+	// actual decoding is spread over subsequent tickles so that scrolling
+	// stays at frame rate even when many new covers come into view.
+	_thumbLoadQueue.clear();
 
+	// Visible entries first, so they appear before the prefetched ones.
 	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
-		GridItemInfo *entry = *iter;
-		if (!_loadedSurfaces.contains(entry->thumbPath)) {
-			surf = loadSurfaceFromFile(entry->thumbPath);
-			if (surf) {
-				const Graphics::ManagedSurface *scSurf(scaleGfx(surf, _thumbnailWidth, 512));
-				_loadedSurfaces[entry->thumbPath] = scSurf;
-				surf->free();
-				delete surf;
-			} else {
-				_loadedSurfaces[entry->thumbPath] = nullptr;
-			}
+		queueThumbnailLoad(*iter);
+	}
+
+	// Then decode ahead: the next few rows beyond the visible area in the
+	// direction of the last scroll, so they are ready once they scroll in.
+	int prefetchLeft = _itemsPerRow * kThumbnailPrefetchRows;
+	if (_scrollDirection >= 0) {
+		for (int ind = _lastVisibleItem + 1; (ind < (int)_sortedEntryList.size()) && (prefetchLeft > 0); ++ind, --prefetchLeft) {
+			queueThumbnailLoad(&_sortedEntryList[ind]);
+		}
+	} else {
+		for (int ind = _firstVisibleItem - 1; (ind >= 0) && (prefetchLeft > 0); --ind, --prefetchLeft) {
+			queueThumbnailLoad(&_sortedEntryList[ind]);
 		}
 	}
 }
 
+void GridWidget::touchThumbnail(const Common::String &name) {
+	for (Common::List<Common::String>::iterator it = _lruThumbnails.begin(); it != _lruThumbnails.end(); ++it) {
+		if (*it == name) {
+			_lruThumbnails.erase(it);
+			break;
+		}
+	}
+	_lruThumbnails.push_back(name);
+}
+
+bool GridWidget::isThumbnailVisible(const Common::String &name) const {
+	for (Common::Array<GridItemInfo *>::const_iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
+		if ((!(*iter)->isHeader) && ((*iter)->thumbPath == name))
+			return true;
+	}
+	return false;
+}
+
+void GridWidget::trimThumbnailCache() {
+	uint guard = _lruThumbnails.size();
+	while ((_loadedSurfaces.size() > (uint)kMaxCachedThumbnails) && (guard-- > 0) && !_lruThumbnails.empty()) {
+		Common::String victim = _lruThumbnails.front();
+		_lruThumbnails.pop_front();
+		if (isThumbnailVisible(victim)) {
+			// Never evict a thumbnail that is currently on screen.
+			_lruThumbnails.push_back(victim);
+			continue;
+		}
+		delete _loadedSurfaces[victim];
+		_loadedSurfaces.erase(victim);
+	}
+}
+
+void GridWidget::handleTickle() {
+	if (_thumbLoadQueue.empty())
+		return;
+
+	// Decode queued thumbnails until the per-frame budget runs out. The
+	// surfaces are cached already scaled to the display size, so drawing
+	// them later never goes through the scaler again.
+	uint32 budgetEnd = g_system->getMillis() + kThumbnailDecodeBudgetMillis;
+	bool loadedAny = false;
+	do {
+		Common::String path = _thumbLoadQueue.pop();
+		if (_loadedSurfaces.contains(path))
+			continue;
+		Graphics::ManagedSurface *surf = loadSurfaceFromFile(path, _thumbnailWidth, _thumbnailHeight);
+		if (surf) {
+			_loadedSurfaces[path] = scaleGfx(surf, _thumbnailWidth, 512);
+			surf->free();
+			delete surf;
+		} else {
+			_loadedSurfaces[path] = nullptr;
+		}
+		touchThumbnail(path);
+		loadedAny = true;
+	} while (!_thumbLoadQueue.empty() && (g_system->getMillis() < budgetEnd));
+
+	if (loadedAny) {
+		trimThumbnailCache();
+		assignEntriesToItems();
+		markAsDirty();
+	}
+}
+
 void GridWidget::loadFlagIcons() {
 	const Common::LanguageDescription *l = Common::g_languages;
 	for (; l->code; ++l) {
@@ -712,6 +817,7 @@ void GridWidget::handleCommand(CommandSender *sender, uint32 cmd, uint32 data) {
 	switch (cmd) {
 	case kSetPositionCmd:
 		if (_scrollPos != (int)data) {
+			_scrollDirection = ((int)data > _scrollPos) ? 1 : -1;
 			_scrollPos = data;
 
 			if (calcVisibleEntries()) {
@@ -817,6 +923,7 @@ void GridWidget::reflowLayout() {
 	_thumbnailWidth = g_gui.xmlEval()->getVar("Globals.GridItemThumbnail.Width");
 	if ((oldThumbnailHeight != _thumbnailHeight) || (oldThumbnailWidth != _thumbnailWidth)) {
 		unloadSurfaces(_loadedSurfaces);
+		_lruThumbnails.clear();
 		reloadThumbnails();
 		loadFlagIcons();
 	}
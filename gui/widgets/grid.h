@@ -25,6 +25,8 @@
 
 #include "gui/dialog.h"
 #include "gui/widgets/scrollbar.h"
+#include "common/list.h"
+#include "common/queue.h"
 #include "common/str.h"
 
 #include "image/bmp.h"
@@ -101,9 +103,19 @@ protected:
 	Common::HashMap<int, const Graphics::ManagedSurface *> _platformIcons;
 	Common::HashMap<int, const Graphics::ManagedSurface *> _languageIcons;
 
-	// Images are mapped by filename -> surface.
+	// Images are mapped by filename -> surface. Thumbnails are stored already
+	// scaled to the current display size, so drawing never has to rescale.
 	Common::HashMap<Common::String, const Graphics::ManagedSurface *> _loadedSurfaces;
 
+	// Thumbnails are not decoded synchronously when they scroll into view.
+	// Instead reloadThumbnails() only queues the file names and handleTickle()
+	// decodes a few of them per frame, so scrolling a large library never
+	// stalls on image decoding. _lruThumbnails orders the cached surfaces by
+	// last use (least recently used at the front) for eviction.
+	Common::Queue<Common::String>	_thumbLoadQueue;
+	Common::List<Common::String>	_lruThumbnails;
+	int								_scrollDirection;
+
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_sortedEntryList;
 	Common::Array<GridItemInfo *>		_visibleEntryList;
@@ -185,6 +197,10 @@ public:
 	void toggleGroup(int groupID);
 
 	void reloadThumbnails();
+	void queueThumbnailLoad(const GridItemInfo *entry);
+	void touchThumbnail(const Common::String &name);
+	void trimThumbnailCache();
+	bool isThumbnailVisible(const Common::String &name) const;
 	void loadFlagIcons();
 	void loadPlatformIcons();
 
@@ -203,6 +219,7 @@ public:
 
 	void handleMouseWheel(int x, int y, int direction) override;
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
+	void handleTickle() override;
 
 	void reflowLayout() override;
 
@@ -129,138 +129,123 @@ struct CodebookConverterRaw {
 	}
 };
 
+inline byte getRGBLookupEntryVFW(const byte *colorMap, uint16 index) {
+	return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
+}
+
+/**
+ * Expand a single codebook entry into its dithered 4x4 block (VFW-style).
+ * The result only depends on the codebook entry and the palette map, so it
+ * is computed once per codebook update rather than once per decoded vector.
+ */
+void ditherCodebookDetailVFW(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntryVFW(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntryVFW(colorMap, pixelGroup2 >> 16);
+	dst[2] = getRGBLookupEntryVFW(colorMap, pixelGroup5 & 0xFFFF);
+	dst[3] = getRGBLookupEntryVFW(colorMap, pixelGroup6 >> 16);
+	dst[4] = getRGBLookupEntryVFW(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntryVFW(colorMap, pixelGroup4 >> 16);
+	dst[6] = getRGBLookupEntryVFW(colorMap, pixelGroup7 & 0xFFFF);
+	dst[7] = getRGBLookupEntryVFW(colorMap, pixelGroup8 >> 16);
+	dst[8] = getRGBLookupEntryVFW(colorMap, pixelGroup1 >> 16);
+	dst[9] = getRGBLookupEntryVFW(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntryVFW(colorMap, pixelGroup5 >> 16);
+	dst[11] = getRGBLookupEntryVFW(colorMap, pixelGroup2 & 0xFFFF);
+	dst[12] = getRGBLookupEntryVFW(colorMap, pixelGroup3 >> 16);
+	dst[13] = getRGBLookupEntryVFW(colorMap, pixelGroup8 & 0xFFFF);
+	dst[14] = getRGBLookupEntryVFW(colorMap, pixelGroup7 >> 16);
+	dst[15] = getRGBLookupEntryVFW(colorMap, pixelGroup4 & 0xFFFF);
+}
+
+void ditherCodebookSmoothVFW(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntryVFW(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntryVFW(colorMap, pixelGroup1 >> 16);
+	dst[2] = getRGBLookupEntryVFW(colorMap, pixelGroup2 & 0xFFFF);
+	dst[3] = getRGBLookupEntryVFW(colorMap, pixelGroup2 >> 16);
+	dst[4] = getRGBLookupEntryVFW(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntryVFW(colorMap, pixelGroup3 >> 16);
+	dst[6] = getRGBLookupEntryVFW(colorMap, pixelGroup4 & 0xFFFF);
+	dst[7] = getRGBLookupEntryVFW(colorMap, pixelGroup4 >> 16);
+	dst[8] = getRGBLookupEntryVFW(colorMap, pixelGroup5 >> 16);
+	dst[9] = getRGBLookupEntryVFW(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntryVFW(colorMap, pixelGroup7 >> 16);
+	dst[11] = getRGBLookupEntryVFW(colorMap, pixelGroup8 & 0xFFFF);
+	dst[12] = getRGBLookupEntryVFW(colorMap, pixelGroup6 >> 16);
+	dst[13] = getRGBLookupEntryVFW(colorMap, pixelGroup5 & 0xFFFF);
+	dst[14] = getRGBLookupEntryVFW(colorMap, pixelGroup8 >> 16);
+	dst[15] = getRGBLookupEntryVFW(colorMap, pixelGroup7 & 0xFFFF);
+}
+
 /**
  * Codebook converter that dithers in VFW-style
+ *
+ * The dithered 4x4 blocks are precomputed per codebook entry whenever a
+ * codebook is loaded (see CinepakDecoder::ditherCodebookVFW), so decoding
+ * a vector is a plain table copy, just like in the QT-style converter.
  */
 struct CodebookConverterDitherVFW {
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		byte blockBuffer[16];
-		ditherCodebookSmooth(codebook, blockBuffer, colorMap);
-		rows[0][0] = blockBuffer[0];
-		rows[0][1] = blockBuffer[1];
-		rows[0][2] = blockBuffer[2];
-		rows[0][3] = blockBuffer[3];
-		rows[1][0] = blockBuffer[4];
-		rows[1][1] = blockBuffer[5];
-		rows[1][2] = blockBuffer[6];
-		rows[1][3] = blockBuffer[7];
-		rows[2][0] = blockBuffer[8];
-		rows[2][1] = blockBuffer[9];
-		rows[2][2] = blockBuffer[10];
-		rows[2][3] = blockBuffer[11];
-		rows[3][0] = blockBuffer[12];
-		rows[3][1] = blockBuffer[13];
-		rows[3][2] = blockBuffer[14];
-		rows[3][3] = blockBuffer[15];
+		const byte *colorPtr = strip.v1_dither + (codebookIndex << 4);
+		WRITE_UINT32(rows[0], READ_UINT32(colorPtr));
+		WRITE_UINT32(rows[1], READ_UINT32(colorPtr + 4));
+		WRITE_UINT32(rows[2], READ_UINT32(colorPtr + 8));
+		WRITE_UINT32(rows[3], READ_UINT32(colorPtr + 12));
 	}
 
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		byte blockBuffer[16];
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[0]], blockBuffer, colorMap);
-		rows[0][0] = blockBuffer[0];
-		rows[0][1] = blockBuffer[1];
-		rows[1][0] = blockBuffer[4];
-		rows[1][1] = blockBuffer[5];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[1]], blockBuffer, colorMap);
-		rows[0][2] = blockBuffer[2];
-		rows[0][3] = blockBuffer[3];
-		rows[1][2] = blockBuffer[6];
-		rows[1][3] = blockBuffer[7];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[2]], blockBuffer, colorMap);
-		rows[2][0] = blockBuffer[8];
-		rows[2][1] = blockBuffer[9];
-		rows[3][0] = blockBuffer[12];
-		rows[3][1] = blockBuffer[13];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[3]], blockBuffer, colorMap);
-		rows[2][2] = blockBuffer[10];
-		rows[2][3] = blockBuffer[11];
-		rows[3][2] = blockBuffer[14];
-		rows[3][3] = blockBuffer[15];
-	}
+		const byte *colorPtr = strip.v4_dither + (codebookIndex[0] << 4);
+		WRITE_UINT16(rows[0] + 0, READ_UINT16(colorPtr + 0));
+		WRITE_UINT16(rows[1] + 0, READ_UINT16(colorPtr + 4));
 
-private:
-	static inline void ditherCodebookDetail(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-	}
+		colorPtr = strip.v4_dither + (codebookIndex[1] << 4);
+		WRITE_UINT16(rows[0] + 2, READ_UINT16(colorPtr + 2));
+		WRITE_UINT16(rows[1] + 2, READ_UINT16(colorPtr + 6));
 
-	static inline void ditherCodebookSmooth(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-	}
+		colorPtr = strip.v4_dither + (codebookIndex[2] << 4);
+		WRITE_UINT16(rows[2] + 0, READ_UINT16(colorPtr + 8));
+		WRITE_UINT16(rows[3] + 0, READ_UINT16(colorPtr + 12));
 
-	static inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
-		return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
+		colorPtr = strip.v4_dither + (codebookIndex[3] << 4);
+		WRITE_UINT16(rows[2] + 2, READ_UINT16(colorPtr + 10));
+		WRITE_UINT16(rows[3] + 2, READ_UINT16(colorPtr + 14));
 	}
 };
 
@@ -514,6 +499,8 @@ void CinepakDecoder::initializeCodebook(uint16 strip, byte codebookType) {
 
 		if (_ditherType == kDitherTypeQT)
 			ditherCodebookQT(strip, codebookType, i);
+		else if (_ditherType == kDitherTypeVFW)
+			ditherCodebookVFW(strip, codebookType, i);
 	}
 }
 
@@ -550,9 +537,11 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Update the precomputed dither tables along with the codebook
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
+			else if (_ditherType == kDitherTypeVFW)
+				ditherCodebookVFW(strip, codebookType, i);
 		}
 	}
 }
@@ -615,6 +604,13 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 	}
 }
 
+void CinepakDecoder::ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	if (codebookType == 1)
+		ditherCodebookSmoothVFW(_curFrame.strips[strip].v1_codebook[codebookIndex], _curFrame.strips[strip].v1_dither + (codebookIndex << 4), _colorMap);
+	else
+		ditherCodebookDetailVFW(_curFrame.strips[strip].v4_codebook[codebookIndex], _curFrame.strips[strip].v4_dither + (codebookIndex << 4), _colorMap);
+}
+
 void CinepakDecoder::decodeVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize) {
 	if (_curFrame.surface->format.bytesPerPixel == 1) {
 		decodeVectorsTmpl<byte, CodebookConverterRaw>(_curFrame, _clipTable, _colorMap, stream, strip, chunkID, chunkSize);
@@ -26,8 +26,17 @@
  * written, produced, and directed by Alan Smithee
  */
 
+#include "common/cpuinfo.h"
 #include "image/codecs/indeo/indeo_dsp.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define IVI_DSP_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IVI_DSP_SIMD
+#endif
+
 namespace Image {
 namespace Indeo {
 
@@ -271,6 +280,261 @@ void IndeoDSP::ffIviDcHaar2d(const int32 *in, int16 *out, uint32 pitch,
 	}
 }
 
+#ifdef IVI_DSP_SIMD
+
+/*
+ * Vectorized inverse slant transform and motion compensation, four
+ * 32 bit lanes per vector. The helpers give SSE2 and NEON the same
+ * vocabulary so the transform body is shared; all arithmetic mirrors
+ * the scalar macros exactly (adds, shifts, wrapping truncation), so
+ * the output is bit-identical to the scalar code.
+ */
+
+#if defined(__SSE2__)
+
+typedef __m128i IviVec;
+
+static inline bool iviHasSIMD() { return Common::hasCpuFeatureSSE2(); }
+static inline IviVec ivLoad(const int32 *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline IviVec ivAdd(IviVec a, IviVec b) { return _mm_add_epi32(a, b); }
+static inline IviVec ivSub(IviVec a, IviVec b) { return _mm_sub_epi32(a, b); }
+static inline IviVec ivAnd(IviVec a, IviVec b) { return _mm_and_si128(a, b); }
+static inline IviVec ivConst(int32 c) { return _mm_set1_epi32(c); }
+static inline IviVec ivAddC(IviVec v, int32 c) { return _mm_add_epi32(v, _mm_set1_epi32(c)); }
+static inline IviVec ivShl(IviVec v, int bits) { return _mm_slli_epi32(v, bits); }
+static inline IviVec ivShr(IviVec v, int bits) { return _mm_srai_epi32(v, bits); }
+
+/** Loads the left/right half of an eight entry int16 row, widened to 32 bit. */
+static inline void ivLoadS16(const int16 *p, IviVec &lo, IviVec &hi) {
+	const __m128i v = _mm_loadu_si128((const __m128i *)p);
+	lo = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), v), 16);
+	hi = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), v), 16);
+}
+
+/** Stores eight lanes as int16 with wrapping truncation, like an assignment. */
+static inline void ivStoreS16(int16 *p, IviVec lo, IviVec hi) {
+	const __m128i lo16 = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+	const __m128i hi16 = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+	_mm_storeu_si128((__m128i *)p, _mm_packs_epi32(lo16, hi16));
+}
+
+static inline void ivTranspose4(IviVec &r0, IviVec &r1, IviVec &r2, IviVec &r3) {
+	const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+	const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+	const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+	const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+	r0 = _mm_unpacklo_epi64(t0, t1);
+	r1 = _mm_unpackhi_epi64(t0, t1);
+	r2 = _mm_unpacklo_epi64(t2, t3);
+	r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+#else
+
+typedef int32x4_t IviVec;
+
+static inline bool iviHasSIMD() { return true; }
+static inline IviVec ivLoad(const int32 *p) { return vld1q_s32(p); }
+static inline IviVec ivAdd(IviVec a, IviVec b) { return vaddq_s32(a, b); }
+static inline IviVec ivSub(IviVec a, IviVec b) { return vsubq_s32(a, b); }
+static inline IviVec ivAnd(IviVec a, IviVec b) { return vandq_s32(a, b); }
+static inline IviVec ivConst(int32 c) { return vdupq_n_s32(c); }
+static inline IviVec ivAddC(IviVec v, int32 c) { return vaddq_s32(v, vdupq_n_s32(c)); }
+static inline IviVec ivShl(IviVec v, int bits) { return vshlq_s32(v, vdupq_n_s32(bits)); }
+static inline IviVec ivShr(IviVec v, int bits) { return vshlq_s32(v, vdupq_n_s32(-bits)); }
+
+static inline void ivLoadS16(const int16 *p, IviVec &lo, IviVec &hi) {
+	const int16x8_t v = vld1q_s16(p);
+	lo = vmovl_s16(vget_low_s16(v));
+	hi = vmovl_s16(vget_high_s16(v));
+}
+
+static inline void ivStoreS16(int16 *p, IviVec lo, IviVec hi) {
+	vst1q_s16(p, vcombine_s16(vmovn_s32(lo), vmovn_s32(hi)));
+}
+
+static inline void ivTranspose4(IviVec &r0, IviVec &r1, IviVec &r2, IviVec &r3) {
+	const int32x4x2_t t01 = vtrnq_s32(r0, r1);
+	const int32x4x2_t t23 = vtrnq_s32(r2, r3);
+	r0 = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+	r1 = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+	r2 = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+	r3 = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+}
+
+#endif
+
+/** IVI_SLANT_BFLY, lane-wise. */
+static inline void ivSlantBfly(IviVec &s1, IviVec &s2) {
+	const IviVec t = ivSub(s1, s2);
+	s1 = ivAdd(s1, s2);
+	s2 = t;
+}
+
+/** IVI_IREFLECT, lane-wise. */
+static inline void ivIReflect(IviVec &s1, IviVec &s2) {
+	const IviVec t = ivAdd(ivShr(ivAddC(ivAdd(s1, ivShl(s2, 1)), 2), 2), s1);
+	s2 = ivSub(ivShr(ivAddC(ivSub(ivShl(s1, 1), s2), 2), 2), s2);
+	s1 = t;
+}
+
+/** IVI_SLANT_PART4, lane-wise. */
+static inline void ivSlantPart4(IviVec &s1, IviVec &s2) {
+	const IviVec t = ivAdd(s2, ivShr(ivAddC(ivSub(ivShl(s1, 2), s2), 4), 3));
+	s2 = ivAdd(s1, ivShr(ivSub(ivConst(4), ivAdd(s1, ivShl(s2, 2))), 3));
+	s1 = t;
+}
+
+/**
+ * IVI_INV_SLANT8 over eight row vectors; r[0..7] are src[0..7] in the
+ * macro's memory order and are replaced by the t1..t8 outputs in the
+ * same order. The caller applies COMPENSATE.
+ */
+static inline void ivSlantPass8(IviVec *r) {
+	IviVec s1 = r[0], s4 = r[1], s8 = r[2], s5 = r[3];
+	IviVec s2 = r[4], s6 = r[5], s3 = r[6], s7 = r[7];
+
+	ivSlantPart4(s4, s5);	// -> t4, t5
+
+	IviVec t1 = s1, t5 = s5;
+	ivSlantBfly(t1, t5);
+	IviVec t2 = s2, t6 = s6;
+	ivSlantBfly(t2, t6);
+	IviVec t7 = s7, t3 = s3;
+	ivSlantBfly(t7, t3);
+	IviVec t4 = s4, t8 = s8;
+	ivSlantBfly(t4, t8);
+
+	ivSlantBfly(t1, t2);
+	ivIReflect(t4, t3);
+	ivSlantBfly(t5, t6);
+	ivIReflect(t8, t7);
+	ivSlantBfly(t1, t4);
+	ivSlantBfly(t2, t3);
+	ivSlantBfly(t5, t8);
+	ivSlantBfly(t6, t7);
+
+	r[0] = t1; r[1] = t2; r[2] = t3; r[3] = t4;
+	r[4] = t5; r[5] = t6; r[6] = t7; r[7] = t8;
+}
+
+/** Transposes an 8x8 block held as left (lo) and right (hi) half rows. */
+static inline void ivTranspose8(IviVec *lo, IviVec *hi) {
+	ivTranspose4(lo[0], lo[1], lo[2], lo[3]);
+	ivTranspose4(hi[0], hi[1], hi[2], hi[3]);
+	ivTranspose4(lo[4], lo[5], lo[6], lo[7]);
+	ivTranspose4(hi[4], hi[5], hi[6], hi[7]);
+	for (int i = 0; i < 4; i++)
+		SWAP(hi[i], lo[i + 4]);
+}
+
+static void iviInverseSlant8x8SIMD(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	IviVec lo[8], hi[8];
+
+	for (int i = 0; i < 8; i++) {
+		lo[i] = ivLoad(in + 8 * i);
+		hi[i] = ivLoad(in + 8 * i + 4);
+	}
+
+	// Column pass: lane-wise across the row vectors. Columns with a
+	// cleared flag are zeroed afterwards via a lane mask, matching the
+	// scalar code's dst column wipe.
+	int32 mask[8];
+	for (int i = 0; i < 8; i++)
+		mask[i] = flags[i] ? -1 : 0;
+	const IviVec maskLo = ivLoad(mask);
+	const IviVec maskHi = ivLoad(mask + 4);
+
+	ivSlantPass8(lo);
+	ivSlantPass8(hi);
+
+	for (int i = 0; i < 8; i++) {
+		lo[i] = ivAnd(lo[i], maskLo);
+		hi[i] = ivAnd(hi[i], maskHi);
+	}
+
+	// Row pass with COMPENSATE ((x + 1) >> 1) in the transposed domain.
+	ivTranspose8(lo, hi);
+	ivSlantPass8(lo);
+	ivSlantPass8(hi);
+	for (int i = 0; i < 8; i++) {
+		lo[i] = ivShr(ivAddC(lo[i], 1), 1);
+		hi[i] = ivShr(ivAddC(hi[i], 1), 1);
+	}
+	ivTranspose8(lo, hi);
+
+	for (int i = 0; i < 8; i++)
+		ivStoreS16(out + i * pitch, lo[i], hi[i]);
+}
+
+/** (a + b) >> 1 with full int precision, truncated back to int16 lanes. */
+static inline void ivAvg2(const int16 *a, const int16 *b, IviVec &lo, IviVec &hi) {
+	IviVec al, ah, bl, bh;
+	ivLoadS16(a, al, ah);
+	ivLoadS16(b, bl, bh);
+	lo = ivShr(ivAdd(al, bl), 1);
+	hi = ivShr(ivAdd(ah, bh), 1);
+}
+
+/** (a + b + c + d) >> 2 with full int precision. */
+static inline void ivAvg4(const int16 *a, const int16 *b, const int16 *c, const int16 *d, IviVec &lo, IviVec &hi) {
+	IviVec al, ah, bl, bh, cl, ch, dl, dh;
+	ivLoadS16(a, al, ah);
+	ivLoadS16(b, bl, bh);
+	ivLoadS16(c, cl, ch);
+	ivLoadS16(d, dl, dh);
+	lo = ivShr(ivAdd(ivAdd(al, bl), ivAdd(cl, dl)), 2);
+	hi = ivShr(ivAdd(ivAdd(ah, bh), ivAdd(ch, dh)), 2);
+}
+
+static inline void iviMc8x8SIMDCore(int16 *buf, uint32 dpitch, const int16 *refBuf, uint32 pitch, int mcType, bool delta) {
+	const int16 *wptr = refBuf + pitch;
+
+	for (int i = 0; i < 8; i++, buf += dpitch, wptr += pitch, refBuf += pitch) {
+		IviVec lo, hi;
+
+		switch (mcType) {
+		case 0:		// fullpel (no interpolation)
+			ivLoadS16(refBuf, lo, hi);
+			break;
+		case 1:		// horizontal halfpel interpolation
+			ivAvg2(refBuf, refBuf + 1, lo, hi);
+			break;
+		case 2:		// vertical halfpel interpolation
+			ivAvg2(refBuf, wptr, lo, hi);
+			break;
+		default:	// vertical and horizontal halfpel interpolation
+			ivAvg4(refBuf, refBuf + 1, wptr, wptr + 1, lo, hi);
+			break;
+		}
+
+		if (delta) {
+			IviVec dl, dh;
+			ivLoadS16(buf, dl, dh);
+			lo = ivAdd(dl, lo);
+			hi = ivAdd(dh, hi);
+		}
+
+		ivStoreS16(buf, lo, hi);
+	}
+}
+
+static void iviMc8x8SIMDNoDelta(int16 *buf, uint32 dpitch, const int16 *refBuf, uint32 pitch, int mcType) {
+	iviMc8x8SIMDCore(buf, dpitch, refBuf, pitch, mcType, false);
+}
+
+static void iviMc8x8SIMDDelta(int16 *buf, uint32 dpitch, const int16 *refBuf, uint32 pitch, int mcType) {
+	iviMc8x8SIMDCore(buf, dpitch, refBuf, pitch, mcType, true);
+}
+
+#else
+
+static inline bool iviHasSIMD() { return false; }
+static inline void iviMc8x8SIMDNoDelta(int16 *, uint32, const int16 *, uint32, int) {}
+static inline void iviMc8x8SIMDDelta(int16 *, uint32, const int16 *, uint32, int) {}
+
+#endif // IVI_DSP_SIMD
+
 //* butterfly operation for the inverse slant transform
 #define IVI_SLANT_BFLY(s1, s2, o1, o2, t) \
 	t  = (s1) - (s2);\
@@ -325,6 +589,13 @@ void IndeoDSP::ffIviInverseSlant8x8(const int32 *in, int16 *out, uint32 pitch, c
 	int32 tmp[64];
 	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
 
+#ifdef IVI_DSP_SIMD
+	if (iviHasSIMD()) {
+		iviInverseSlant8x8SIMD(in, out, pitch, flags);
+		return;
+	}
+#endif
+
 #define COMPENSATE(x) (x)
 	const int32 *src = in;
 	int32 *dst = tmp;
@@ -537,6 +808,11 @@ static void iviMc ## size ##x## size ## suffix(int16 *buf, \
 												 uint32 pitch, int mcType) \
 { \
 	const int16 *wptr; \
+\
+	if (size == 8 && iviHasSIMD()) { \
+		iviMc8x8SIMD ## suffix(buf, dpitch, refBuf, pitch, mcType); \
+		return; \
+	} \
 \
 	switch (mcType) { \
 	case 0: /* fullpel (no interpolation) */ \
@@ -37,6 +37,7 @@
 #include "common/debug.h"
 #include "common/array.h"
 #include "common/stream.h"
+#include "common/util.h"
 
 namespace Image {
 
@@ -46,7 +47,9 @@ PNGDecoder::PNGDecoder() :
 		_paletteColorCount(0),
 		_skipSignature(false),
 		_keepTransparencyPaletted(false),
-		_transparentColor(-1) {
+		_transparentColor(-1),
+		_maxDecodeWidth(0),
+		_maxDecodeHeight(0) {
 }
 
 PNGDecoder::~PNGDecoder() {
@@ -99,6 +102,33 @@ void pngFlushStream(png_structp pngPtr) {
 	Common::WriteStream *stream = (Common::WriteStream *)writeIOptr;
 	stream->flush();
 }
+
+// Copies a decoded full-width row into a (possibly smaller) destination row,
+// point-sampling every (1 << scaleShift)th pixel and converting between the
+// byte-order RGBA decode format and the requested output format on the fly.
+static void pngSampleRow(byte *dst, const byte *src, int outWidth, int scaleShift,
+		const Graphics::PixelFormat &srcFormat, const Graphics::PixelFormat &dstFormat) {
+	if (srcFormat.bytesPerPixel == 1) {
+		for (int x = 0; x < outWidth; x++)
+			dst[x] = src[x << scaleShift];
+	} else if (srcFormat == dstFormat) {
+		const uint32 *srcP = (const uint32 *)src;
+		uint32 *dstP = (uint32 *)dst;
+		for (int x = 0; x < outWidth; x++)
+			dstP[x] = srcP[x << scaleShift];
+	} else {
+		const uint32 *srcP = (const uint32 *)src;
+		byte a, r, g, b;
+		for (int x = 0; x < outWidth; x++) {
+			srcFormat.colorToARGB(srcP[x << scaleShift], a, r, g, b);
+			const uint32 color = dstFormat.ARGBToColor(a, r, g, b);
+			if (dstFormat.bytesPerPixel == 2)
+				((uint16 *)dst)[x] = (uint16)color;
+			else
+				((uint32 *)dst)[x] = color;
+		}
+	}
+}
 #endif
 
 /*
@@ -159,10 +189,28 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
+	// Pick the scale-on-decode factor: only power-of-two downscales, and
+	// only while the result still covers the requested size.
+	int scaleShift = 0;
+	if (_maxDecodeWidth > 0 && _maxDecodeHeight > 0) {
+		while (scaleShift < 2 && (width >> (scaleShift + 1)) >= _maxDecodeWidth
+				&& (height >> (scaleShift + 1)) >= _maxDecodeHeight)
+			scaleShift++;
+	}
+	const int outWidth = MAX(width >> scaleShift, 1);
+	const int outHeight = MAX(height >> scaleShift, 1);
+
+	// A requested output format only applies to images that decode to a
+	// truecolor surface; paletted output stays CLUT8.
+	const bool hasTargetFormat = (_targetFormat.bytesPerPixel == 2 || _targetFormat.bytesPerPixel == 4);
+
 	// Allocate memory for the final image data.
 	// To keep memory framentation low this happens before allocating memory for temporary image data.
 	_outputSurface = new Graphics::Surface();
 
+	// Pixel layout libpng decodes to, before any requested output conversion
+	Graphics::PixelFormat decodeFormat = Graphics::PixelFormat::createFormatCLUT8();
+
 	// Images of all color formats except PNG_COLOR_TYPE_PALETTE
 	// will be transformed into ARGB images
 	if (colorType == PNG_COLOR_TYPE_PALETTE && (_keepTransparencyPaletted || !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS))) {
@@ -200,8 +248,10 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			}
 		}
 
-		_outputSurface->create(width, height,
-			hasRgbaPalette ? getByteOrderRgbaPixelFormat(true) : Graphics::PixelFormat::createFormatCLUT8());
+		Graphics::PixelFormat rgbaFormat = Graphics::PixelFormat::createFormatCLUT8();
+		if (hasRgbaPalette)
+			rgbaFormat = hasTargetFormat ? _targetFormat : getByteOrderRgbaPixelFormat(true);
+		_outputSurface->create(outWidth, outHeight, rgbaFormat);
 		png_set_packing(pngPtr);
 
 		if (hasRgbaPalette) {
@@ -225,7 +275,9 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			png_set_expand(pngPtr);
 		}
 
-		_outputSurface->create(width, height, getByteOrderRgbaPixelFormat(isAlpha));
+		decodeFormat = getByteOrderRgbaPixelFormat(isAlpha);
+		_outputSurface->create(outWidth, outHeight,
+			hasTargetFormat ? _targetFormat : decodeFormat);
 		if (!_outputSurface->getPixels()) {
 			error("Could not allocate memory for output image.");
 		}
@@ -249,28 +301,70 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	height = h;
 
 	if (hasRgbaPalette) {
-		// Build up the RGBA surface from paletted rows
+		// Build up the RGBA surface from paletted rows. The palette entries
+		// are already in the output format, so scaled and converted decodes
+		// only differ in how each row is sampled and stored.
 		png_bytep rowPtr = new byte[width];
 		if (!rowPtr)
 			error("Could not allocate memory for row.");
 
 		for (int yp = 0; yp < height; ++yp) {
 			png_read_row(pngPtr, rowPtr, nullptr);
-			uint32 *destRowP = (uint32 *)_outputSurface->getBasePtr(0, yp);
-
-			for (int xp = 0; xp < width; ++xp)
-				destRowP[xp] = rgbaPalette[rowPtr[xp]];
+			if (yp & ((1 << scaleShift) - 1))
+				continue;
+			const int outY = yp >> scaleShift;
+			if (outY >= outHeight)
+				continue;
+			byte *destRowP = (byte *)_outputSurface->getBasePtr(0, outY);
+
+			if (_outputSurface->format.bytesPerPixel == 2) {
+				for (int xp = 0; xp < outWidth; ++xp)
+					((uint16 *)destRowP)[xp] = (uint16)rgbaPalette[rowPtr[xp << scaleShift]];
+			} else {
+				for (int xp = 0; xp < outWidth; ++xp)
+					((uint32 *)destRowP)[xp] = rgbaPalette[rowPtr[xp << scaleShift]];
+			}
 		}
 
 		delete[] rowPtr;
 	} else  if (interlaceType == PNG_INTERLACE_NONE) {
-		// PNGs without interlacing can simply be read row by row.
-		for (int i = 0; i < height; i++) {
-			png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
+		if (scaleShift == 0 && _outputSurface->format == decodeFormat) {
+			// PNGs without interlacing can simply be read row by row.
+			for (int i = 0; i < height; i++) {
+				png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
+			}
+		} else {
+			// Decode through a single row buffer and sample/convert the
+			// rows that survive the downscale into the output surface, so
+			// no full-size intermediate image is ever allocated.
+			png_bytep rowPtr = new byte[png_get_rowbytes(pngPtr, infoPtr)];
+			if (!rowPtr)
+				error("Could not allocate memory for row.");
+
+			for (int i = 0; i < height; i++) {
+				png_read_row(pngPtr, rowPtr, NULL);
+				if (i & ((1 << scaleShift) - 1))
+					continue;
+				const int outY = i >> scaleShift;
+				if (outY >= outHeight)
+					continue;
+				pngSampleRow((byte *)_outputSurface->getBasePtr(0, outY), rowPtr,
+					outWidth, scaleShift, decodeFormat, _outputSurface->format);
+			}
+
+			delete[] rowPtr;
 		}
 	} else {
 		// PNGs with interlacing require us to allocate an auxillary
-		// buffer with pointers to all row starts.
+		// buffer with pointers to all row starts. When scaling or
+		// converting, the full-size image goes to a temporary surface
+		// first, since libpng fills all rows incrementally here.
+		Graphics::Surface tmpSurface;
+		Graphics::Surface *readSurface = _outputSurface;
+		if (scaleShift != 0 || _outputSurface->format != decodeFormat) {
+			tmpSurface.create(width, height, decodeFormat);
+			readSurface = &tmpSurface;
+		}
 
 		// Allocate row pointer buffer
 		png_bytep *rowPtr = new png_bytep[height];
@@ -280,13 +374,21 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		// Initialize row pointers
 		for (int i = 0; i < height; i++)
-			rowPtr[i] = (png_bytep)_outputSurface->getBasePtr(0, i);
+			rowPtr[i] = (png_bytep)readSurface->getBasePtr(0, i);
 
 		// Read image data
 		png_read_image(pngPtr, rowPtr);
 
 		// Free row pointer buffer
 		delete[] rowPtr;
+
+		if (readSurface != _outputSurface) {
+			for (int i = 0; i < outHeight; i++)
+				pngSampleRow((byte *)_outputSurface->getBasePtr(0, i),
+					(const byte *)tmpSurface.getBasePtr(0, i << scaleShift),
+					outWidth, scaleShift, decodeFormat, _outputSurface->format);
+			tmpSurface.free();
+		}
 	}
 
 	// Read additional data at the end.
@@ -66,6 +66,26 @@ public:
 	int getTransparentColor() const { return _transparentColor; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
 	void setKeepTransparencyPaletted(bool keep) { _keepTransparencyPaletted = keep; }
+
+	/**
+	 * Decode directly into the given pixel format (2 or 4 bytes per pixel)
+	 * instead of producing a byte-order RGBA surface that the caller has
+	 * to convert afterwards. Images that decode to a paletted surface are
+	 * not affected and stay CLUT8.
+	 */
+	void setOutputPixelFormat(const Graphics::PixelFormat &format) { _targetFormat = format; }
+
+	/**
+	 * Downscale the image while decoding so that it still covers the given
+	 * size. Only power-of-two factors (1/2, 1/4) are applied, and only when
+	 * the result stays at least as large as the requested size, so callers
+	 * that fine-scale the result afterwards lose no quality. Pass 0/0 to
+	 * disable (the default).
+	 */
+	void setMaxDecodeSize(int width, int height) {
+		_maxDecodeWidth = width;
+		_maxDecodeHeight = height;
+	}
 private:
 	Graphics::PixelFormat getByteOrderRgbaPixelFormat(bool isAlpha) const;
 
@@ -79,6 +99,13 @@ private:
 	bool _keepTransparencyPaletted;
 	int _transparentColor;
 
+	// Requested output format (bytesPerPixel == 0 means byte-order RGBA)
+	Graphics::PixelFormat _targetFormat;
+
+	// Requested size for scale-on-decode (0 means decode at full size)
+	int _maxDecodeWidth;
+	int _maxDecodeHeight;
+
 	Graphics::Surface *_outputSurface;
 };
 
@@ -0,0 +1,169 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * Audio mixer benchmark, run via the 'bench' make target.
+ *
+ * Instantiates MixerImpl on top of the null backend, drives synthetic
+ * channel loads through the regular mixer callback, and reports
+ * samples-mixed-per-second plus the worst observed callback time. Use it
+ * to validate changes to the mixing kernels and rate converters and to
+ * compare hosts; the numbers are only meaningful relative to a baseline
+ * taken with the same parameters on the same machine.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "test/null_osystem.h"
+
+#include "common/scummsys.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "audio/audiostream.h"
+#include "audio/decoders/raw.h"
+#include "audio/mixer_intern.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#ifdef POSIX
+#include <sys/time.h>
+#endif
+
+namespace {
+
+enum {
+	kOutputRate = 44100,
+	kCallbackBytes = 4096,	// 1024 stereo 16 bit frames, a typical SDL buffer
+	kCallbacksPerRun = 4000
+};
+
+/** Microsecond clock for per-callback timing; getMillis() is too coarse. */
+uint64 getMicros() {
+#ifdef POSIX
+	timeval tv;
+	gettimeofday(&tv, 0);
+	return (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+	return (uint64)g_system->getMillis() * 1000;
+#endif
+}
+
+/** Builds a looping sine tone as a raw stream at the given rate/layout. */
+Audio::AudioStream *makeTestTone(int rate, bool stereo, int freq) {
+	const uint32 frames = rate;	// one second, then loop
+	const uint32 samples = frames * (stereo ? 2 : 1);
+	int16 *data = (int16 *)malloc(samples * sizeof(int16));
+
+	for (uint32 i = 0; i < frames; ++i) {
+		const int16 value = (int16)(12000 * sin(2.0 * M_PI * freq * i / rate));
+		if (stereo) {
+			data[2 * i] = value;
+			data[2 * i + 1] = value;
+		} else {
+			data[i] = value;
+		}
+	}
+
+	byte flags = Audio::FLAG_16BITS;
+	if (stereo)
+		flags |= Audio::FLAG_STEREO;
+#ifdef SCUMM_LITTLE_ENDIAN
+	flags |= Audio::FLAG_LITTLE_ENDIAN;
+#endif
+
+	Audio::SeekableAudioStream *stream = Audio::makeRawStream(
+		(const byte *)data, samples * sizeof(int16), rate, flags, DisposeAfterUse::YES);
+	return Audio::makeLoopingAudioStream(stream, 0);
+}
+
+/**
+ * Mixes kCallbacksPerRun callbacks against the given channel load and
+ * prints the throughput.
+ *
+ * @param label          scenario name for the report
+ * @param numDirect      looping streams at the output rate (copy converter)
+ * @param numResampled   looping 22050 Hz mono streams (polyphase converter)
+ * @param numBalanced    looping streams with off-center balance settings
+ */
+void runScenario(const char *label, int numDirect, int numResampled, int numBalanced) {
+	Audio::MixerImpl mixer(kOutputRate);
+	mixer.setReady(true);
+
+	int tone = 200;
+	for (int i = 0; i < numDirect; ++i)
+		mixer.playStream(Audio::Mixer::kPlainSoundType, nullptr,
+		                 makeTestTone(kOutputRate, true, tone += 50),
+		                 -1, Audio::Mixer::kMaxChannelVolume, 0,
+		                 DisposeAfterUse::YES, false, false);
+	for (int i = 0; i < numResampled; ++i)
+		mixer.playStream(Audio::Mixer::kSFXSoundType, nullptr,
+		                 makeTestTone(22050, false, tone += 50),
+		                 -1, Audio::Mixer::kMaxChannelVolume, 0,
+		                 DisposeAfterUse::YES, false, false);
+	for (int i = 0; i < numBalanced; ++i)
+		mixer.playStream(Audio::Mixer::kSpeechSoundType, nullptr,
+		                 makeTestTone(kOutputRate, false, tone += 50),
+		                 -1, Audio::Mixer::kMaxChannelVolume, (i & 1) ? 64 : -64,
+		                 DisposeAfterUse::YES, false, false);
+
+	byte buffer[kCallbackBytes];
+	uint64 worstCallback = 0;
+
+	const uint64 start = getMicros();
+	for (int i = 0; i < kCallbacksPerRun; ++i) {
+		const uint64 callbackStart = getMicros();
+		mixer.mixCallback(buffer, kCallbackBytes);
+		const uint64 callbackTime = getMicros() - callbackStart;
+		if (callbackTime > worstCallback)
+			worstCallback = callbackTime;
+	}
+	const uint64 total = getMicros() - start;
+
+	const uint64 framesMixed = (uint64)kCallbacksPerRun * (kCallbackBytes / 4);
+	const double perSecond = (total > 0) ? (double)framesMixed * 1000000.0 / total : 0.0;
+
+	printf("%-28s %3d channels  %8.2f Mframes/s  worst callback %5u us\n",
+	       label, numDirect + numResampled + numBalanced,
+	       perSecond / 1000000.0, (uint)worstCallback);
+
+	mixer.stopAll();
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	Common::install_null_g_system();
+
+	printf("Audio mixer benchmark: %d callbacks of %d frames at %d Hz per scenario\n\n",
+	       kCallbacksPerRun, kCallbackBytes / 4, kOutputRate);
+
+	runScenario("direct stereo", 8, 0, 0);
+	runScenario("resampled mono", 0, 8, 0);
+	runScenario("balance-panned", 0, 0, 8);
+	// NUM_CHANNELS caps the mixer at 32 concurrent channels.
+	runScenario("mixed load", 8, 8, 8);
+	runScenario("full mixer", 12, 12, 8);
+
+	return 0;
+}
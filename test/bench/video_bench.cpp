@@ -0,0 +1,275 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * Video decoder benchmark and conformance harness, run via the 'bench'
+ * make target.
+ *
+ * Unlike the audio and scaler benchmarks this one cannot synthesize its
+ * input: it decodes sample files supplied by the user. Point it at a
+ * directory of videos via the SCUMMVM_BENCH_VIDEO_DIR environment
+ * variable (or pass file names as arguments) and it decodes every frame
+ * as fast as possible on the null backend, reporting per-file ms/frame,
+ * peak RSS and a CRC32 over the decoded pixels. The CRC makes the run a
+ * conformance check as well: it must not change when only performance
+ * work (SIMD kernels, prefetching, buffering) lands. The decoder is
+ * picked by extension: .bik, .smk, .avi, .mov, and .ogv/.ogg when
+ * ScummVM is built with Theora support. Without samples the harness
+ * prints a note and exits successfully so 'make bench' stays usable.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "test/null_osystem.h"
+
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/crc.h"
+#include "common/memstream.h"
+#include "common/scummsys.h"
+#include "common/str.h"
+#include "common/system.h"
+
+#include "graphics/surface.h"
+
+#include "video/avi_decoder.h"
+#include "video/bink_decoder.h"
+#include "video/qt_decoder.h"
+#include "video/smk_decoder.h"
+#include "video/video_decoder.h"
+
+#ifdef USE_THEORADEC
+#include "video/theora_decoder.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef POSIX
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+namespace {
+
+/** Microsecond clock for timing; getMillis() is too coarse. */
+uint64 getMicros() {
+#ifdef POSIX
+	timeval tv;
+	gettimeofday(&tv, 0);
+	return (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+	return (uint64)g_system->getMillis() * 1000;
+#endif
+}
+
+/** Peak resident set size in kilobytes, or 0 where unavailable. */
+long getPeakRSSKb() {
+#ifdef POSIX
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		return usage.ru_maxrss;
+#endif
+	return 0;
+}
+
+bool hasSuffix(const Common::String &name, const char *suffix) {
+	Common::String lower(name);
+	lower.toLowercase();
+	return lower.hasSuffix(suffix);
+}
+
+/** Creates the decoder matching the file extension, or 0 for none. */
+Video::VideoDecoder *createDecoderFor(const Common::String &name, const char *&codec) {
+	if (hasSuffix(name, ".bik")) {
+		codec = "bink";
+		return new Video::BinkDecoder();
+	}
+
+	if (hasSuffix(name, ".smk")) {
+		codec = "smacker";
+		return new Video::SmackerDecoder();
+	}
+
+	if (hasSuffix(name, ".avi")) {
+		codec = "avi";
+		return new Video::AVIDecoder();
+	}
+
+	if (hasSuffix(name, ".mov") || hasSuffix(name, ".mp4")) {
+		codec = "quicktime";
+		return new Video::QuickTimeDecoder();
+	}
+
+#ifdef USE_THEORADEC
+	if (hasSuffix(name, ".ogv") || hasSuffix(name, ".ogg")) {
+		codec = "theora";
+		return new Video::TheoraDecoder();
+	}
+#endif
+
+	return 0;
+}
+
+/** Reads a whole file into memory so timing excludes disk I/O. */
+Common::SeekableReadStream *slurpFile(const Common::String &path) {
+	FILE *f = fopen(path.c_str(), "rb");
+	if (!f)
+		return 0;
+
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	if (size <= 0) {
+		fclose(f);
+		return 0;
+	}
+
+	byte *data = (byte *)malloc(size);
+	const bool ok = data && fread(data, 1, size, f) == (size_t)size;
+	fclose(f);
+
+	if (!ok) {
+		free(data);
+		return 0;
+	}
+
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
+void benchFile(const Common::String &path) {
+	// Strip the directory for reporting
+	Common::String name(path);
+	if (name.contains('/'))
+		name = Common::String(strrchr(path.c_str(), '/') + 1);
+
+	const char *codec = 0;
+	Video::VideoDecoder *decoder = createDecoderFor(name, codec);
+	if (!decoder)
+		return;
+
+	Common::SeekableReadStream *stream = slurpFile(path);
+	if (!stream || !decoder->loadStream(stream)) {
+		printf("SKIP\t%s: cannot load\n", name.c_str());
+		delete decoder;
+		delete stream;
+		return;
+	}
+
+	Common::CRC<uint32> crc(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true);
+	uint32 remainder = crc.init();
+
+	uint64 pixels = 0;
+	int frames = 0;
+	const uint64 start = getMicros();
+
+	while (!decoder->endOfVideo()) {
+		const Graphics::Surface *frame = decoder->decodeNextFrame();
+		if (!frame)
+			break;
+
+		const uint rowBytes = frame->w * frame->format.bytesPerPixel;
+		for (int y = 0; y < frame->h; y++) {
+			const byte *row = (const byte *)frame->getBasePtr(0, y);
+			for (uint x = 0; x < rowBytes; x++)
+				remainder = crc.processByte(row[x], remainder);
+		}
+
+		pixels += (uint64)frame->w * frame->h;
+		frames++;
+	}
+
+	const uint64 elapsed = getMicros() - start;
+
+	if (!frames) {
+		printf("SKIP\t%s: no frames decoded\n", name.c_str());
+		delete decoder;
+		return;
+	}
+
+	printf("RESULT\tcodec=%s\tfile=%s\tsize=%dx%d\tframes=%d\tms_per_frame=%.3f\tmpix_per_s=%.2f\tcrc32=%08x\tpeak_rss_kb=%ld\n",
+	       codec, name.c_str(), decoder->getWidth(), decoder->getHeight(), frames,
+	       (double)elapsed / 1000.0 / frames,
+	       elapsed ? (double)pixels / elapsed : 0.0,
+	       crc.finalize(remainder), getPeakRSSKb());
+
+	delete decoder;
+}
+
+/** Runs every recognized file in the given directory; returns the count. */
+int benchDirectory(const Common::String &dir) {
+	int found = 0;
+
+#ifdef POSIX
+	DIR *d = opendir(dir.c_str());
+	if (!d)
+		return 0;
+
+	// Collect and sort for a stable report order
+	Common::Array<Common::String> names;
+	while (struct dirent *entry = readdir(d))
+		names.push_back(entry->d_name);
+	closedir(d);
+
+	Common::sort(names.begin(), names.end());
+
+	for (uint i = 0; i < names.size(); i++) {
+		const char *codec = 0;
+		Video::VideoDecoder *probe = createDecoderFor(names[i], codec);
+		if (!probe)
+			continue;
+		delete probe;
+
+		benchFile(dir + "/" + names[i]);
+		found++;
+	}
+#endif
+
+	return found;
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char **argv) {
+	Common::install_null_g_system();
+
+	int found = 0;
+
+	if (argc > 1) {
+		for (int i = 1; i < argc; i++) {
+			benchFile(argv[i]);
+			found++;
+		}
+	} else {
+		const char *dir = getenv("SCUMMVM_BENCH_VIDEO_DIR");
+		found = benchDirectory(dir ? dir : "test/bench/videos");
+	}
+
+	if (!found)
+		printf("video_bench: no sample videos found; set SCUMMVM_BENCH_VIDEO_DIR "
+		       "or pass files as arguments to benchmark the video decoders\n");
+
+	return 0;
+}
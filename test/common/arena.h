@@ -0,0 +1,77 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/arena.h"
+
+class ArenaTestSuite : public CxxTest::TestSuite {
+public:
+	void test_alignment() {
+		Common::Arena arena;
+
+		void *a = arena.alloc(1);
+		void *b = arena.alloc(3);
+		void *c = arena.alloc(24);
+
+		const size_t align = 2 * sizeof(void *);
+		TS_ASSERT_EQUALS((size_t)a % align, (size_t)0);
+		TS_ASSERT_EQUALS((size_t)b % align, (size_t)0);
+		TS_ASSERT_EQUALS((size_t)c % align, (size_t)0);
+		TS_ASSERT_DIFFERS(a, b);
+		TS_ASSERT_DIFFERS(b, c);
+	}
+
+	void test_growth_and_reuse() {
+		Common::Arena arena(64);
+
+		// Force the arena past its first block.
+		for (int i = 0; i < 32; ++i)
+			arena.alloc(16);
+		size_t peak = arena.totalSize();
+		TS_ASSERT_LESS_THAN((size_t)64, peak);
+
+		// After a reset, the same workload must fit into the retained
+		// blocks without growing the arena further.
+		arena.reset();
+		for (int i = 0; i < 32; ++i)
+			arena.alloc(16);
+		TS_ASSERT_EQUALS(arena.totalSize(), peak);
+	}
+
+	void test_oversized_allocation() {
+		Common::Arena arena(32);
+
+		// A request larger than the block size must still succeed.
+		byte *p = (byte *)arena.alloc(500);
+		memset(p, 0xA5, 500);
+		TS_ASSERT_LESS_THAN((size_t)499, arena.totalSize());
+	}
+
+	void test_release_unused_blocks() {
+		Common::Arena arena(64);
+
+		for (int i = 0; i < 32; ++i)
+			arena.alloc(16);
+		TS_ASSERT_LESS_THAN((size_t)64, arena.totalSize());
+
+		arena.releaseUnusedBlocks();
+		TS_ASSERT_EQUALS(arena.totalSize(), (size_t)64);
+
+		// The remaining block is usable again.
+		arena.alloc(16);
+	}
+
+	struct Point2 {
+		int x, y;
+		Point2(int ax, int ay) : x(ax), y(ay) {}
+	};
+
+	void test_placement_new() {
+		Common::Arena arena;
+
+		Point2 *p = new (arena) Point2(3, 7);
+		Point2 *q = new (arena) Point2(-1, 2);
+		TS_ASSERT_EQUALS(p->x, 3);
+		TS_ASSERT_EQUALS(p->y, 7);
+		TS_ASSERT_EQUALS(q->x, -1);
+		TS_ASSERT_EQUALS(q->y, 2);
+	}
+};
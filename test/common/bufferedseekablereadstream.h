@@ -91,4 +91,40 @@ class BufferedSeekableReadStreamTestSuite : public CxxTest::TestSuite {
 
 		delete &ssrs;
 	}
+
+	void test_adaptive() {
+		byte contents[64];
+		for (uint i = 0; i < 64; ++i)
+			contents[i] = i;
+		Common::MemoryReadStream ms(contents, 64);
+
+		Common::SeekableReadStream &ssrs
+			= *Common::wrapAdaptiveBufferedSeekableReadStream(&ms, 4, 16, DisposeAfterUse::NO);
+
+		// Sequential reads stay correct while the readahead window grows
+		byte i, b;
+		for (i = 0; i < 40; ++i) {
+			TS_ASSERT_EQUALS(i, ssrs.pos());
+			ssrs.read(&b, 1);
+			TS_ASSERT_EQUALS(i, b);
+		}
+
+		// A far seek shrinks the window again; data must still match
+		ssrs.seek(2, SEEK_SET);
+		TS_ASSERT_EQUALS(ssrs.pos(), 2);
+		b = ssrs.readByte();
+		TS_ASSERT_EQUALS(b, 2);
+
+		byte readBuffer[30];
+		ssrs.seek(20, SEEK_SET);
+		TS_ASSERT_EQUALS(ssrs.read(readBuffer, 30), (uint32)30);
+		for (i = 0; i < 30; ++i)
+			TS_ASSERT_EQUALS(readBuffer[i], 20 + i);
+
+		TS_ASSERT(!ssrs.eos());
+		ssrs.seek(0, SEEK_END);
+		TS_ASSERT_EQUALS(ssrs.pos(), 64);
+
+		delete &ssrs;
+	}
 };
@@ -0,0 +1,53 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/crc.h"
+
+/*
+ * The standard CRC check string. The expected values below are the
+ * well-known check values of the respective CRC presets for this input.
+ */
+static const byte crc_test_message[] = "123456789";
+#define CRC_TEST_LEN 9
+
+class CRCTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_crc32() {
+		Common::CRC32 crc;
+		crc.init();
+		TS_ASSERT_EQUALS(crc.crcFast(crc_test_message, CRC_TEST_LEN), 0xCBF43926U);
+		TS_ASSERT_EQUALS(crc.crcSlow(crc_test_message, CRC_TEST_LEN), 0xCBF43926U);
+	}
+
+	void test_crc16() {
+		Common::CRC16 crc;
+		crc.init();
+		TS_ASSERT_EQUALS(crc.crcFast(crc_test_message, CRC_TEST_LEN), 0xBB3D);
+		TS_ASSERT_EQUALS(crc.crcSlow(crc_test_message, CRC_TEST_LEN), 0xBB3D);
+	}
+
+	void test_crc_ccitt() {
+		Common::CRC_CCITT crc;
+		crc.init();
+		TS_ASSERT_EQUALS(crc.crcFast(crc_test_message, CRC_TEST_LEN), 0x29B1);
+		TS_ASSERT_EQUALS(crc.crcSlow(crc_test_message, CRC_TEST_LEN), 0x29B1);
+	}
+
+	void test_crc_binhex() {
+		Common::CRC_BINHEX crc;
+		crc.init();
+		TS_ASSERT_EQUALS(crc.crcFast(crc_test_message, CRC_TEST_LEN), 0x31C3);
+		TS_ASSERT_EQUALS(crc.crcSlow(crc_test_message, CRC_TEST_LEN), 0x31C3);
+	}
+
+	void test_crc_byte_by_byte() {
+		// Processing byte by byte with init/processByte/finalize must match
+		// crcFast over the whole message.
+		Common::CRC32 crc;
+		uint32 remainder = crc.init();
+
+		for (int i = 0; i < CRC_TEST_LEN; ++i)
+			remainder = crc.processByte(crc_test_message[i], remainder);
+
+		TS_ASSERT_EQUALS(crc.finalize(remainder), 0xCBF43926U);
+	}
+};
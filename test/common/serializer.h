@@ -1,6 +1,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "common/serializer.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 
 class SerializerTestSuite : public CxxTest::TestSuite {
@@ -108,4 +109,39 @@ public:
 	void test_read_v2_as_v2() {
 		readVersioned_v2(_inStreamV2, 2);
 	}
+
+	// The block-staged array methods must produce exactly the same bytes
+	// as one syncAs call per element, and round-trip the values. Use
+	// enough elements to force multiple staging blocks.
+	void test_sync_array_block() {
+		const uint kCount = 700; // 2800 bytes, larger than the staging buffer
+
+		int32 values[kCount];
+		for (uint i = 0; i < kCount; i++)
+			values[i] = (int32)(i * 2654435761u);
+
+		Common::MemoryWriteStreamDynamic blockOut(DisposeAfterUse::YES);
+		{
+			Common::Serializer ser(0, &blockOut);
+			ser.syncArrayAsSint32LE(values, kCount);
+			TS_ASSERT_EQUALS(ser.bytesSynced(), kCount * 4);
+		}
+
+		Common::MemoryWriteStreamDynamic elementOut(DisposeAfterUse::YES);
+		{
+			Common::Serializer ser(0, &elementOut);
+			for (uint i = 0; i < kCount; i++)
+				ser.syncAsSint32LE(values[i]);
+		}
+
+		TS_ASSERT_EQUALS(blockOut.size(), elementOut.size());
+		TS_ASSERT_SAME_DATA(blockOut.getData(), elementOut.getData(), kCount * 4);
+
+		int32 readBack[kCount];
+		Common::MemoryReadStream in(blockOut.getData(), blockOut.size());
+		Common::Serializer ser(&in, 0);
+		ser.syncArrayAsSint32LE(readBack, kCount);
+
+		TS_ASSERT_SAME_DATA(readBack, values, sizeof(values));
+	}
 };
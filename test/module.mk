@@ -10,25 +10,31 @@ TEST_LIBS    :=
 
 ifdef POSIX
 TEST_LIBS += test/null_osystem.o \
+	base/benchmark.o \
 	backends/fs/posix/posix-fs-factory.o \
 	backends/fs/posix/posix-fs.o \
 	backends/fs/posix/posix-iostream.o \
 	backends/fs/abstract-fs.o \
 	backends/fs/stdiostream.o \
+	backends/mixer/null/null-mixer.o \
 	backends/modular-backend.o
 endif
 
 ifdef WIN32
 TEST_LIBS += test/null_osystem.o \
+	base/benchmark.o \
 	backends/fs/windows/windows-fs-factory.o \
 	backends/fs/windows/windows-fs.o \
 	backends/fs/abstract-fs.o \
 	backends/fs/stdiostream.o \
+	backends/mixer/null/null-mixer.o \
 	backends/modular-backend.o \
 	backends/platform/sdl/win32/win32_wrapper.o
 endif
 
-TEST_LIBS +=	audio/libaudio.a math/libmath.a common/libcommon.a image/libimage.a graphics/libgraphics.a
+# libcommon is repeated after libgraphics because the graphics kernels
+# reference the CPU feature probes in common/cpuinfo.
+TEST_LIBS +=	video/libvideo.a audio/libaudio.a math/libmath.a common/libcommon.a image/libimage.a graphics/libgraphics.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -67,6 +73,19 @@ endif
 
 test: test/runner
 	./test/runner
+
+# Performance harnesses; see test/bench/audio_bench.cpp,
+# test/bench/scaler_bench.cpp and test/bench/video_bench.cpp.
+bench: test/audio_bench test/scaler_bench test/video_bench
+	./test/audio_bench
+	./test/scaler_bench
+	./test/video_bench
+test/audio_bench: $(srcdir)/test/bench/audio_bench.cpp $(TEST_LIBS)
+	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -o $@ $< $(TEST_LIBS) $(TEST_LDFLAGS)
+test/scaler_bench: $(srcdir)/test/bench/scaler_bench.cpp $(TEST_LIBS)
+	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -o $@ $< $(TEST_LIBS) $(TEST_LDFLAGS)
+test/video_bench: $(srcdir)/test/bench/video_bench.cpp $(TEST_LIBS)
+	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -o $@ $< $(TEST_LIBS) $(TEST_LDFLAGS)
 test/runner: test/runner.cpp $(TEST_LIBS) copy-dat
 	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -o $@ test/runner.cpp $(TEST_LIBS) $(TEST_LDFLAGS)
 test/runner.cpp: $(TESTS) $(srcdir)/test/module.mk
@@ -75,7 +94,7 @@ test/runner.cpp: $(TESTS) $(srcdir)/test/module.mk
 
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner test/engine-data/encoding.dat
+	-$(RM) test/runner.cpp test/runner test/audio_bench test/scaler_bench test/video_bench test/engine-data/encoding.dat
 	-rmdir test/engine-data
 
 test/engine-data/encoding.dat: $(srcdir)/dists/engine-data/encoding.dat
@@ -84,4 +103,4 @@ test/engine-data/encoding.dat: $(srcdir)/dists/engine-data/encoding.dat
 
 copy-dat: test/engine-data/encoding.dat
 
-.PHONY: test clean-test copy-dat
+.PHONY: test bench clean-test copy-dat
@@ -2484,6 +2484,21 @@ void VMDDecoder::blit16(const Graphics::Surface &srcSurf, Common::Rect &rect) {
 
 	Graphics::PixelFormat pixelFormat = getPixelFormat();
 
+	// (Re-)build the conversion table if the output format changed
+	if (_blit16Lut.empty() || (_blit16LutFormat != pixelFormat)) {
+		_blit16Lut.resize(32768);
+
+		for (uint32 data = 0; data < 32768; data++) {
+			byte r = ((data & 0x7C00) >> 10) << 3;
+			byte g = ((data & 0x03E0) >>  5) << 3;
+			byte b = ((data & 0x001F) >>  0) << 3;
+
+			_blit16Lut[data] = ((r == 0) && (g == 0) && (b == 0)) ? 0 : pixelFormat.RGBToColor(r, g, b);
+		}
+
+		_blit16LutFormat = pixelFormat;
+	}
+
 	// We cannot use getBasePtr here because srcSurf.format.bytesPerPixel is
 	// different from _bytesPerPixel.
 	const byte *src = (const byte *)srcSurf.getPixels() +
@@ -2494,21 +2509,12 @@ void VMDDecoder::blit16(const Graphics::Surface &srcSurf, Common::Rect &rect) {
 		const byte *srcRow = src;
 		      byte *dstRow = dst;
 
-		for (int j = 0; j < rect.width(); j++, srcRow += 2, dstRow += _surface.format.bytesPerPixel) {
-			uint16 data = READ_LE_UINT16(srcRow);
-
-			byte r = ((data & 0x7C00) >> 10) << 3;
-			byte g = ((data & 0x03E0) >>  5) << 3;
-			byte b = ((data & 0x001F) >>  0) << 3;
-
-			uint32 c = pixelFormat.RGBToColor(r, g, b);
-			if ((r == 0) && (g == 0) && (b == 0))
-				c = 0;
-
-			if      (_surface.format.bytesPerPixel == 2)
-				*((uint16 *)dstRow) = (uint16) c;
-			else if (_surface.format.bytesPerPixel == 4)
-				*((uint32 *)dstRow) = (uint32) c;
+		if (_surface.format.bytesPerPixel == 2) {
+			for (int j = 0; j < rect.width(); j++, srcRow += 2, dstRow += 2)
+				*((uint16 *)dstRow) = (uint16)_blit16Lut[READ_LE_UINT16(srcRow) & 0x7FFF];
+		} else if (_surface.format.bytesPerPixel == 4) {
+			for (int j = 0; j < rect.width(); j++, srcRow += 2, dstRow += 4)
+				*((uint32 *)dstRow) = _blit16Lut[READ_LE_UINT16(srcRow) & 0x7FFF];
 		}
 
 		src += srcSurf .pitch;
@@ -553,6 +553,11 @@ private:
 	void blit16(const Graphics::Surface &srcSurf, Common::Rect &rect);
 	void blit24(const Graphics::Surface &srcSurf, Common::Rect &rect);
 
+	/** Lazily built table mapping a 15-bit RGB555 source pixel straight to
+	 *  an output pixel, replacing the per-pixel RGBToColor() in blit16(). */
+	Common::Array<uint32> _blit16Lut;
+	Graphics::PixelFormat _blit16LutFormat;
+
 	// Sound
 	void emptySoundSlice  (uint32 size);
 	void filledSoundSlice (uint32 size);
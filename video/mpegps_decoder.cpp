@@ -24,6 +24,7 @@
 #include "audio/decoders/raw.h"
 #include "audio/decoders/ac3.h"
 #include "audio/decoders/mp3.h"
+#include "common/bufferedstream.h"
 #include "common/debug.h"
 #include "common/endian.h"
 #include "common/stream.h"
@@ -262,7 +263,11 @@ MPEGPSDecoder::MPEGPSDemuxer::~MPEGPSDemuxer() {
 bool MPEGPSDecoder::MPEGPSDemuxer::loadStream(Common::SeekableReadStream *stream) {
 	close();
 
-	_stream = stream;
+	// Demuxing scans the stream byte-wise for start codes with short
+	// backtracking seeks, so keep a readahead buffer the size of a few
+	// program stream packs between us and the disk. Playback consumes the
+	// stream strictly sequentially, so let the window grow as it goes.
+	_stream = Common::wrapAdaptiveBufferedSeekableReadStream(stream, 32768, 256 * 1024, DisposeAfterUse::YES);
 
 	int queuedPackets = 0;
 	while (queueNextPacket() && queuedPackets < PREBUFFERED_PACKETS) {
@@ -362,21 +367,21 @@ bool MPEGPSDecoder::MPEGPSDemuxer::queueNextPacket() {
 			return false;
 		}
 
-		Common::SeekableReadStream *stream = _stream->readStream(size);
-
 		if (startCode == kStartCodePrivateStream1 || (startCode >= 0x1C0 && startCode <= 0x1DF)) {
 			// Audio packet
-			_audioQueue.push(Packet(stream, startCode, pts, dts));
+			_audioQueue.push(Packet(_stream->readStream(size), startCode, pts, dts));
 			return true;
 		}
 
 		if (startCode >= 0x1E0 && startCode <= 0x1EF) {
 			// Video packet
-			_videoQueue.push(Packet(stream, startCode, pts, dts));
+			_videoQueue.push(Packet(_stream->readStream(size), startCode, pts, dts));
 			return true;
 		}
 
-		delete stream;
+		// A stream we don't handle; skip the payload without pulling it
+		// onto the heap.
+		_stream->skip(size);
 	}
 }
 
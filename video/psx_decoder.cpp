@@ -26,6 +26,7 @@
 #include "audio/audiostream.h"
 #include "audio/decoders/adpcm.h"
 #include "common/bitstream.h"
+#include "common/cpuinfo.h"
 #include "common/huffman.h"
 #include "common/stream.h"
 #include "common/system.h"
@@ -34,6 +35,14 @@
 
 #include "video/psx_decoder.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define PSX_IDCT_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PSX_IDCT_SIMD
+#endif
+
 namespace Video {
 
 // Here are the codes/lengths/symbols that are used for decoding
@@ -541,17 +550,118 @@ int PSXStreamDecoder::PSXVideoTrack::readSignedCoefficient(Common::BitStreamMemo
 // IDCT table built with :
 // _idct8x8[x][y] = cos(((2 * x + 1) * y) * (M_PI / 16.0)) * 0.5;
 // _idct8x8[x][y] /= sqrt(2.0) if y == 0
-static const double s_idct8x8[8][8] = {
-	{ 0.353553390593274,  0.490392640201615,  0.461939766255643,  0.415734806151273,  0.353553390593274,  0.277785116509801,  0.191341716182545,  0.097545161008064 },
-	{ 0.353553390593274,  0.415734806151273,  0.191341716182545, -0.097545161008064, -0.353553390593274, -0.490392640201615, -0.461939766255643, -0.277785116509801 },
-	{ 0.353553390593274,  0.277785116509801, -0.191341716182545, -0.490392640201615, -0.353553390593274,  0.097545161008064,  0.461939766255643,  0.415734806151273 },
-	{ 0.353553390593274,  0.097545161008064, -0.461939766255643, -0.277785116509801,  0.353553390593274,  0.415734806151273, -0.191341716182545, -0.490392640201615 },
-	{ 0.353553390593274, -0.097545161008064, -0.461939766255643,  0.277785116509801,  0.353553390593274, -0.415734806151273, -0.191341716182545,  0.490392640201615 },
-	{ 0.353553390593274, -0.277785116509801, -0.191341716182545,  0.490392640201615, -0.353553390593273, -0.097545161008064,  0.461939766255643, -0.415734806151273 },
-	{ 0.353553390593274, -0.415734806151273,  0.191341716182545,  0.097545161008064, -0.353553390593274,  0.490392640201615, -0.461939766255643,  0.277785116509801 },
-	{ 0.353553390593274, -0.490392640201615,  0.461939766255643, -0.415734806151273,  0.353553390593273, -0.277785116509801,  0.191341716182545, -0.097545161008064 }
+static const float s_idct8x8[8][8] = {
+	{ 0.353553390593274f,  0.490392640201615f,  0.461939766255643f,  0.415734806151273f,  0.353553390593274f,  0.277785116509801f,  0.191341716182545f,  0.097545161008064f },
+	{ 0.353553390593274f,  0.415734806151273f,  0.191341716182545f, -0.097545161008064f, -0.353553390593274f, -0.490392640201615f, -0.461939766255643f, -0.277785116509801f },
+	{ 0.353553390593274f,  0.277785116509801f, -0.191341716182545f, -0.490392640201615f, -0.353553390593274f,  0.097545161008064f,  0.461939766255643f,  0.415734806151273f },
+	{ 0.353553390593274f,  0.097545161008064f, -0.461939766255643f, -0.277785116509801f,  0.353553390593274f,  0.415734806151273f, -0.191341716182545f, -0.490392640201615f },
+	{ 0.353553390593274f, -0.097545161008064f, -0.461939766255643f,  0.277785116509801f,  0.353553390593274f, -0.415734806151273f, -0.191341716182545f,  0.490392640201615f },
+	{ 0.353553390593274f, -0.277785116509801f, -0.191341716182545f,  0.490392640201615f, -0.353553390593273f, -0.097545161008064f,  0.461939766255643f, -0.415734806151273f },
+	{ 0.353553390593274f, -0.415734806151273f,  0.191341716182545f,  0.097545161008064f, -0.353553390593274f,  0.490392640201615f, -0.461939766255643f,  0.277785116509801f },
+	{ 0.353553390593274f, -0.490392640201615f,  0.461939766255643f, -0.415734806151273f,  0.353553390593273f, -0.277785116509801f,  0.191341716182545f, -0.097545161008064f }
+};
+
+#ifdef PSX_IDCT_SIMD
+
+// s_idct8x8 transposed, so the vector kernel can load matrix columns directly
+static const float s_idct8x8T[8][8] = {
+	{   0.353553390593274f,   0.353553390593274f,   0.353553390593274f,   0.353553390593274f,   0.353553390593274f,   0.353553390593274f,   0.353553390593274f,   0.353553390593274f },
+	{   0.490392640201615f,   0.415734806151273f,   0.277785116509801f,   0.097545161008064f,  -0.097545161008064f,  -0.277785116509801f,  -0.415734806151273f,  -0.490392640201615f },
+	{   0.461939766255643f,   0.191341716182545f,  -0.191341716182545f,  -0.461939766255643f,  -0.461939766255643f,  -0.191341716182545f,   0.191341716182545f,   0.461939766255643f },
+	{   0.415734806151273f,  -0.097545161008064f,  -0.490392640201615f,  -0.277785116509801f,   0.277785116509801f,   0.490392640201615f,   0.097545161008064f,  -0.415734806151273f },
+	{   0.353553390593274f,  -0.353553390593274f,  -0.353553390593274f,   0.353553390593274f,   0.353553390593274f,  -0.353553390593273f,  -0.353553390593274f,   0.353553390593273f },
+	{   0.277785116509801f,  -0.490392640201615f,   0.097545161008064f,   0.415734806151273f,  -0.415734806151273f,  -0.097545161008064f,   0.490392640201615f,  -0.277785116509801f },
+	{   0.191341716182545f,  -0.461939766255643f,   0.461939766255643f,  -0.191341716182545f,  -0.191341716182545f,   0.461939766255643f,  -0.461939766255643f,   0.191341716182545f },
+	{   0.097545161008064f,  -0.277785116509801f,   0.415734806151273f,  -0.490392640201615f,   0.490392640201615f,  -0.415734806151273f,   0.277785116509801f,  -0.097545161008064f }
 };
 
+#if defined(__SSE2__)
+
+typedef __m128 PsxVec;
+
+static inline bool psxHasIDCTSIMD() { return Common::hasCpuFeatureSSE2(); }
+static inline PsxVec pvLoad(const float *p) { return _mm_loadu_ps(p); }
+static inline PsxVec pvSet1(float v) { return _mm_set1_ps(v); }
+static inline PsxVec pvAdd(PsxVec a, PsxVec b) { return _mm_add_ps(a, b); }
+static inline PsxVec pvMul(PsxVec a, PsxVec b) { return _mm_mul_ps(a, b); }
+
+// Clip eight results to [-128, 127], rebias to [0, 255] and store as bytes.
+// cvttps truncates towards zero, matching the (int)CLIP<float>() cast in the
+// scalar path.
+static inline void pvStoreBytes(byte *dst, PsxVec lo, PsxVec hi) {
+	const __m128 minVal = _mm_set1_ps(-128.0f);
+	const __m128 maxVal = _mm_set1_ps(127.0f);
+	__m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(lo, minVal), maxVal));
+	__m128i b = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(hi, minVal), maxVal));
+	const __m128i bias = _mm_set1_epi32(128);
+	a = _mm_add_epi32(a, bias);
+	b = _mm_add_epi32(b, bias);
+	_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_setzero_si128()));
+}
+
+#else // NEON
+
+typedef float32x4_t PsxVec;
+
+static inline bool psxHasIDCTSIMD() { return true; }
+static inline PsxVec pvLoad(const float *p) { return vld1q_f32(p); }
+static inline PsxVec pvSet1(float v) { return vdupq_n_f32(v); }
+static inline PsxVec pvAdd(PsxVec a, PsxVec b) { return vaddq_f32(a, b); }
+static inline PsxVec pvMul(PsxVec a, PsxVec b) { return vmulq_f32(a, b); }
+
+static inline void pvStoreBytes(byte *dst, PsxVec lo, PsxVec hi) {
+	const float32x4_t minVal = vdupq_n_f32(-128.0f);
+	const float32x4_t maxVal = vdupq_n_f32(127.0f);
+	int32x4_t a = vcvtq_s32_f32(vminq_f32(vmaxq_f32(lo, minVal), maxVal));
+	int32x4_t b = vcvtq_s32_f32(vminq_f32(vmaxq_f32(hi, minVal), maxVal));
+	const int32x4_t bias = vdupq_n_s32(128);
+	a = vaddq_s32(a, bias);
+	b = vaddq_s32(b, bias);
+	vst1_u8(dst, vqmovun_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b))));
+}
+
+#endif
+
+/**
+ * Vector version of idct() with the [0, 255] rebias of decodeBlock() fused
+ * into the final store. Multiplications and additions happen in the same
+ * order as in the scalar code, so the output is identical.
+ */
+static void psxIDCTPut(const float *dequantData, byte *dst, int pitch) {
+	PsxVec tmp[8][2];
+
+	// Apply 1D IDCT to rows; tmp[k] holds what the scalar code stores at
+	// tmp[x * 8 + k]
+	for (int y = 0; y < 8; y++) {
+		PsxVec lo = pvMul(pvSet1(dequantData[0]), pvLoad(s_idct8x8T[0]));
+		PsxVec hi = pvMul(pvSet1(dequantData[0]), pvLoad(s_idct8x8T[0] + 4));
+
+		for (int k = 1; k < 8; k++) {
+			lo = pvAdd(lo, pvMul(pvSet1(dequantData[k]), pvLoad(s_idct8x8T[k])));
+			hi = pvAdd(hi, pvMul(pvSet1(dequantData[k]), pvLoad(s_idct8x8T[k] + 4)));
+		}
+
+		tmp[y][0] = lo;
+		tmp[y][1] = hi;
+		dequantData += 8;
+	}
+
+	// Apply 1D IDCT to columns and store each output row
+	for (int y = 0; y < 8; y++) {
+		PsxVec lo = pvMul(pvSet1(s_idct8x8T[0][y]), tmp[0][0]);
+		PsxVec hi = pvMul(pvSet1(s_idct8x8T[0][y]), tmp[0][1]);
+
+		for (int k = 1; k < 8; k++) {
+			lo = pvAdd(lo, pvMul(pvSet1(s_idct8x8T[k][y]), tmp[k][0]));
+			hi = pvAdd(hi, pvMul(pvSet1(s_idct8x8T[k][y]), tmp[k][1]));
+		}
+
+		pvStoreBytes(dst + pitch * y, lo, hi);
+	}
+}
+
+#endif // PSX_IDCT_SIMD
+
 void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
 	// IDCT code based on JPEG's IDCT code
 	// TODO: Switch to the integer-based one mentioned in the docs
@@ -602,6 +712,14 @@ void PSXStreamDecoder::PSXVideoTrack::decodeBlock(Common::BitStreamMemory16LEMSB
 	float dequantData[8 * 8];
 	dequantizeBlock(coefficients, dequantData, scale);
 
+#ifdef PSX_IDCT_SIMD
+	if (psxHasIDCTSIMD()) {
+		// IDCT with the range conversion fused into the store
+		psxIDCTPut(dequantData, block, pitch);
+		return;
+	}
+#endif
+
 	// Perform IDCT
 	float idctData[8 * 8];
 	idct(dequantData, idctData);
@@ -571,6 +571,7 @@ VideoDecoder::AudioTrack *SmackerDecoder::getAudioTrack(int index) {
 SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height, uint32 frameCount, const Common::Rational &frameRate, uint32 flags, uint32 signature) {
 	_surface = new Graphics::Surface();
 	_surface->create(width, height * ((flags & 6) ? 2 : 1), Graphics::PixelFormat::createFormatCLUT8());
+	_ownSurface = true;
 	_dirtyBlocks.set_size(width * height / 16);
 	_frameCount = frameCount;
 	_frameRate = frameRate;
@@ -583,8 +584,10 @@ SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height
 }
 
 SmackerDecoder::SmackerVideoTrack::~SmackerVideoTrack() {
-	_surface->free();
-	delete _surface;
+	if (_ownSurface) {
+		_surface->free();
+		delete _surface;
+	}
 
 	delete _MMapTree;
 	delete _MClrTree;
@@ -623,7 +626,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 
 	uint bw = getWidth() / 4;
 	uint bh = getHeight() / doubleY / 4;
-	uint stride = getWidth();
+	uint stride = _surface->pitch;
 	uint block = 0, blocks = bw*bh;
 
 	byte *out;
@@ -940,6 +943,48 @@ const Common::Rect *SmackerDecoder::getNextDirtyRect() {
 	return videoTrack->getNextDirtyRect();
 }
 
+bool SmackerDecoder::setOutputSurface(Graphics::Surface *surface) {
+	SmackerVideoTrack *videoTrack = (SmackerVideoTrack *)getTrack(0);
+
+	if (!videoTrack)
+		return false;
+
+	return videoTrack->setOutputSurface(surface);
+}
+
+bool SmackerDecoder::SmackerVideoTrack::setOutputSurface(Graphics::Surface *surface) {
+	bool own = false;
+
+	if (surface) {
+		if (surface == _surface)
+			return true;
+
+		if (surface->w != _surface->w || surface->h != _surface->h || surface->format != _surface->format)
+			return false;
+	} else {
+		if (_ownSurface)
+			return true;
+
+		surface = new Graphics::Surface();
+		surface->create(_surface->w, _surface->h, _surface->format);
+		own = true;
+	}
+
+	// Smacker blocks are conditional updates against the previous frame,
+	// so the new target has to start out with the old one's content.
+	for (int y = 0; y < _surface->h; y++)
+		memcpy(surface->getBasePtr(0, y), _surface->getBasePtr(0, y), _surface->w * _surface->format.bytesPerPixel);
+
+	if (_ownSurface) {
+		_surface->free();
+		delete _surface;
+	}
+
+	_surface = surface;
+	_ownSurface = own;
+	return true;
+}
+
 const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 	uint doubleY = (_flags & 6) ? 2 : 1;
 
@@ -75,6 +75,22 @@ public:
 
 	const Common::Rect *getNextDirtyRect();
 
+	/**
+	 * Decode frames directly into a caller-owned surface instead of the
+	 * decoder's internal one, so engines that keep their own backbuffer
+	 * skip the per-frame copy. Combined with getNextDirtyRect(), only
+	 * changed macroblocks need to be touched at all.
+	 *
+	 * The surface must be CLUT8 and match getWidth()/getHeight(); the
+	 * current frame content is carried over, since Smacker blocks are
+	 * conditional updates against the previous frame. The caller keeps
+	 * ownership and must not free the surface while it is set. Pass
+	 * nullptr to revert to an internal surface.
+	 *
+	 * @return true if the surface was accepted
+	 */
+	bool setOutputSurface(Graphics::Surface *surface);
+
 protected:
 	void readNextPacket();
 	bool supportsAudioTrackSwitching() const { return true; }
@@ -108,8 +124,12 @@ protected:
 
 		const Common::Rect *getNextDirtyRect();
 
+		/** @see SmackerDecoder::setOutputSurface */
+		bool setOutputSurface(Graphics::Surface *surface);
+
 	protected:
 		Graphics::Surface *_surface;
+		bool _ownSurface;
 
 	private:
 		Common::Rational _frameRate;
@@ -255,9 +255,9 @@ TheoraDecoder::TheoraVideoTrack::TheoraVideoTrack(const Graphics::PixelFormat &f
 	if (theoraInfo.pixel_fmt != TH_PF_420)
 		error("Only theora YUV420 is supported");
 
-	int postProcessingMax;
-	th_decode_ctl(_theoraDecode, TH_DECCTL_GET_PPLEVEL_MAX, &postProcessingMax, sizeof(postProcessingMax));
-	th_decode_ctl(_theoraDecode, TH_DECCTL_SET_PPLEVEL, &postProcessingMax, sizeof(postProcessingMax));
+	th_decode_ctl(_theoraDecode, TH_DECCTL_GET_PPLEVEL_MAX, &_ppLevelMax, sizeof(_ppLevelMax));
+	th_decode_ctl(_theoraDecode, TH_DECCTL_SET_PPLEVEL, &_ppLevelMax, sizeof(_ppLevelMax));
+	_ppLevel = _ppLevelMax;
 
 	_surface.create(theoraInfo.frame_width, theoraInfo.frame_height, format);
 
@@ -267,6 +267,7 @@ TheoraDecoder::TheoraVideoTrack::TheoraVideoTrack(const Graphics::PixelFormat &f
 
 	// Set the frame rate
 	_frameRate = Common::Rational(theoraInfo.fps_numerator, theoraInfo.fps_denominator);
+	_frameDuration = (uint32)(1000 * _frameRate.getInverse().toDouble());
 
 	_endOfVideo = false;
 	_nextFrameStartTime = 0.0;
@@ -281,6 +282,8 @@ TheoraDecoder::TheoraVideoTrack::~TheoraVideoTrack() {
 }
 
 bool TheoraDecoder::TheoraVideoTrack::decodePacket(ogg_packet &oggPacket) {
+	uint32 decodeStart = g_system->getMillis();
+
 	if (th_decode_packetin(_theoraDecode, &oggPacket, 0) == 0) {
 		_curFrame++;
 
@@ -289,6 +292,18 @@ bool TheoraDecoder::TheoraVideoTrack::decodePacket(ogg_packet &oggPacket) {
 		th_decode_ycbcr_out(_theoraDecode, yuv);
 		translateYUVtoRGBA(yuv);
 
+		// Adapt the post-processing level to the decode budget, as the
+		// reference player does: deblocking/deringing dominates on large
+		// frames, and dropping it gracefully beats stuttering.
+		uint32 decodeTime = g_system->getMillis() - decodeStart;
+		if (decodeTime > _frameDuration && _ppLevel > 0) {
+			_ppLevel--;
+			th_decode_ctl(_theoraDecode, TH_DECCTL_SET_PPLEVEL, &_ppLevel, sizeof(_ppLevel));
+		} else if (decodeTime * 2 < _frameDuration && _ppLevel < _ppLevelMax) {
+			_ppLevel++;
+			th_decode_ctl(_theoraDecode, TH_DECCTL_SET_PPLEVEL, &_ppLevel, sizeof(_ppLevel));
+		}
+
 		double time = th_granule_time(_theoraDecode, oggPacket.granulepos);
 
 		// We need to calculate when the next frame should be shown
@@ -96,6 +96,9 @@ private:
 		bool _endOfVideo;
 		Common::Rational _frameRate;
 		double _nextFrameStartTime;
+		uint32 _frameDuration;
+		int _ppLevel;
+		int _ppLevelMax;
 
 		Graphics::Surface _surface;
 		Graphics::Surface _displaySurface;
@@ -25,6 +25,7 @@
 #include "audio/audiostream.h"
 #include "audio/mixer.h" // for kMaxChannelVolume
 
+#include "common/profiler.h"
 #include "common/rational.h"
 #include "common/file.h"
 #include "common/system.h"
@@ -49,6 +50,11 @@ VideoDecoder::VideoDecoder() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_prefetchedFrame = 0;
+	_framePrefetched = false;
+	_prefetchedFrameStartTime = 0;
+	_prefetchedPalette = 0;
+	_prefetchedPaletteDirty = false;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -80,6 +86,7 @@ void VideoDecoder::close() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	discardPrefetchedFrame();
 }
 
 bool VideoDecoder::loadFile(const Common::Path &filename) {
@@ -94,7 +101,7 @@ bool VideoDecoder::loadFile(const Common::Path &filename) {
 }
 
 bool VideoDecoder::needsUpdate() const {
-	return hasFramesLeft() && getTimeToNextFrame() == 0;
+	return (hasFramesLeft() || _framePrefetched) && getTimeToNextFrame() == 0;
 }
 
 void VideoDecoder::pauseVideo(bool pause) {
@@ -185,9 +192,25 @@ Graphics::PixelFormat VideoDecoder::getPixelFormat() const {
 }
 
 const Graphics::Surface *VideoDecoder::decodeNextFrame() {
+	PROFILER_SCOPE("video.decodeNextFrame");
+
 	_needsUpdate = false;
 	_canSetDither = false;
 
+	// Hand out a prefetched frame if there is one; the decode work
+	// already happened in prefetchFrame().
+	if (_framePrefetched) {
+		_framePrefetched = false;
+
+		if (_prefetchedPaletteDirty) {
+			_palette = _prefetchedPalette;
+			_dirtyPalette = true;
+			_prefetchedPaletteDirty = false;
+		}
+
+		return _prefetchedFrame;
+	}
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -208,11 +231,55 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	return frame;
 }
 
+bool VideoDecoder::prefetchFrame() {
+	if (_framePrefetched)
+		return true;
+
+	if (endOfVideo() || !_nextVideoTrack || _nextVideoTrack->isReversed())
+		return false;
+
+	_canSetDither = false;
+
+	// Remember the frame's own presentation time; the track advances to
+	// the following frame's start time as part of the decode.
+	_prefetchedFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+
+	readNextPacket();
+
+	if (!_nextVideoTrack)
+		return false;
+
+	_prefetchedFrame = _nextVideoTrack->decodeNextFrame();
+
+	// Hold the palette back until the frame is actually handed out, so
+	// it doesn't get applied a frame early.
+	if (_nextVideoTrack->hasDirtyPalette()) {
+		_prefetchedPalette = _nextVideoTrack->getPalette();
+		_prefetchedPaletteDirty = true;
+	}
+
+	findNextVideoTrack();
+
+	_framePrefetched = true;
+	return true;
+}
+
+void VideoDecoder::discardPrefetchedFrame() {
+	_prefetchedFrame = 0;
+	_framePrefetched = false;
+	_prefetchedFrameStartTime = 0;
+	_prefetchedPalette = 0;
+	_prefetchedPaletteDirty = false;
+}
+
 bool VideoDecoder::setReverse(bool reverse) {
 	// Can only reverse video-only videos
 	if (reverse && hasAudio())
 		return false;
 
+	if (reverse)
+		discardPrefetchedFrame();
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -274,6 +341,20 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
+	// A prefetched frame is due at its own recorded time; the track has
+	// already advanced to the frame after it.
+	if (_framePrefetched) {
+		if (_needsUpdate)
+			return 0;
+
+		uint32 prefetchTime = getTime();
+
+		if (_prefetchedFrameStartTime <= prefetchTime)
+			return 0;
+
+		return _prefetchedFrameStartTime - prefetchTime;
+	}
+
 	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
 		return 0;
 
@@ -323,6 +404,8 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	discardPrefetchedFrame();
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -357,6 +440,8 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	discardPrefetchedFrame();
+
 	// Stop all tracks so they can be seeked
 	if (isPlaying())
 		stopAudio();
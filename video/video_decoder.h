@@ -356,6 +356,26 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Decode the frame that the next decodeNextFrame() call will return,
+	 * ahead of its presentation time.
+	 *
+	 * This is opt-in: an engine with idle time between screen updates can
+	 * call this to absorb decode spikes. needsUpdate() keeps reporting
+	 * based on the buffered frame's own presentation time, and the
+	 * following decodeNextFrame() call returns it without doing any
+	 * decoding work. Audio packets are queued as part of the early read,
+	 * so A/V sync is unaffected. Engines using this should drain frames
+	 * via needsUpdate()/decodeNextFrame() rather than stopping on
+	 * endOfVideo(), since the tracks may reach their end while the last
+	 * frame is still buffered.
+	 *
+	 * Videos playing in reverse cannot be prefetched.
+	 *
+	 * @return true if a frame is buffered for the next decodeNextFrame() call
+	 */
+	bool prefetchFrame();
+
 	/**
 	 * Set the default high color format for videos that convert from YUV.
 	 *
@@ -957,6 +977,16 @@ private:
 	// Enforcement of not being able to set dither
 	bool _canSetDither;
 
+	// Frame buffered by prefetchFrame() for the next decodeNextFrame()
+	const Graphics::Surface *_prefetchedFrame;
+	bool _framePrefetched;
+	uint32 _prefetchedFrameStartTime;
+	const byte *_prefetchedPalette;
+	bool _prefetchedPaletteDirty;
+
+	/** Drop any frame buffered by prefetchFrame(), e.g. after a seek. */
+	void discardPrefetchedFrame();
+
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 